@@ -289,7 +289,8 @@ static void id_file(av_input *_avin,const char *_file){
 }
 
 int fetch_and_process_video(av_input *_avin,ogg_page *_page,
- ogg_stream_state *_vo,daala_enc_ctx *_dd,int _video_ready){
+ ogg_stream_state *_vo,daala_enc_ctx *_dd,FILE *_twopass_file,
+ int _video_ready){
   ogg_packet op;
   while(!_video_ready){
     size_t ret;
@@ -340,16 +341,39 @@ int fetch_and_process_video(av_input *_avin,ogg_page *_page,
     while(daala_encode_packet_out(_dd,last,&op))ogg_stream_packetin(_vo,&op);
     /*Submit the current frame for encoding.*/
     if(!last)daala_encode_img_in(_dd,&_avin->video_img,0);
+    /*Save the first pass statistics for the frames coded so far.
+      With a lookahead, the last ones are coded while it is flushed above.*/
+    if(_twopass_file!=NULL){
+      unsigned char *buf;
+      int            bytes;
+      bytes=daala_encode_ctl(_dd,OD_2PASS_OUT,&buf,sizeof(buf));
+      if(bytes<0||fwrite(buf,1,bytes,_twopass_file)<(size_t)bytes){
+        fprintf(stderr,"Error writing first pass statistics.\n");
+        exit(1);
+      }
+    }
   }
   return _video_ready;
 }
 
 static const char *OPTSTRING="o:a:A:v:V:s:S:f:F:h:k:";
 
+/*Values for the options that only have a long form.*/
+#define OPT_CBR         (256)
+#define OPT_VIDEO_BUF   (257)
+#define OPT_FIRST_PASS  (258)
+#define OPT_SECOND_PASS (259)
+#define OPT_LOOKAHEAD   (260)
+
 static const struct option OPTIONS[]={
   {"output",required_argument,NULL,'o'},
   {"video-quality",required_argument,NULL,'v'},
   {"video-rate-target",required_argument,NULL,'V'},
+  {"cbr",no_argument,NULL,OPT_CBR},
+  {"video-buffer",required_argument,NULL,OPT_VIDEO_BUF},
+  {"first-pass",required_argument,NULL,OPT_FIRST_PASS},
+  {"second-pass",required_argument,NULL,OPT_SECOND_PASS},
+  {"lookahead",required_argument,NULL,OPT_LOOKAHEAD},
   {"keyframe-rate",required_argument,NULL,'k'},
   {"aspect-numerator",optional_argument,NULL,'s'},
   {"aspect-denominator",optional_argument,NULL,'S'},
@@ -376,6 +400,20 @@ static void usage(void){
    "                                 use -v and not -V if at all possible,\n"
    "                                 as -v gives higher quality for a given\n"
    "                                 bitrate.\n\n"
+   "     --cbr                      Keep the bitrate from going over the\n"
+   "                                 target for longer than the buffer\n"
+   "                                 allows, instead of just hitting it on\n"
+   "                                 average. Requires -V.\n\n"
+   "     --video-buffer <n>         Buffer size in kbits for --cbr;\n"
+   "                                 the default holds one second.\n\n"
+   "     --first-pass <filename>    Write the statistics for a 2-pass\n"
+   "                                 encode to this file.\n\n"
+   "     --second-pass <filename>   Use the statistics from a first pass\n"
+   "                                 to spread the bits over the whole\n"
+   "                                 file. Requires -V.\n\n"
+   "     --lookahead <n>            Look up to n frames ahead (0 to 32)\n"
+   "                                 to put keyframes at scene changes.\n"
+   "                                 The default is 0.\n\n"
    " encoder_example accepts only uncompressed YUV4MPEG2 video.\n\n");
   exit(1);
 }
@@ -398,8 +436,14 @@ int main(int _argc,char **_argv){
   int               video_q;
   int               video_r;
   int               video_keyframe_rate;
+  int               video_rate_mode;
+  int               video_buf;
+  int               video_lookahead;
   int               video_ready;
   int               pli;
+  FILE             *twopass_file;
+  const char       *first_pass_name;
+  const char       *second_pass_name;
   od_log_init(NULL);
 #if defined(_WIN32)
   _setmode(_fileno(stdin),_O_BINARY);
@@ -414,6 +458,12 @@ int main(int _argc,char **_argv){
   video_q=10;
   video_keyframe_rate=1; /* TODO - default off for now but make bigger later */
   video_r=-1;
+  video_rate_mode=OD_RC_ABR;
+  video_buf=0;
+  video_lookahead=0;
+  twopass_file=NULL;
+  first_pass_name=NULL;
+  second_pass_name=NULL;
   video_bytesout=0;
   video_kbps=0;
   while((c=getopt_long(_argc,_argv,OPTSTRING,OPTIONS,&loi))!=EOF){
@@ -449,6 +499,29 @@ int main(int _argc,char **_argv){
         }
         video_q=0;
       }break;
+      case OPT_CBR:{
+        video_rate_mode=OD_RC_CBR;
+      }break;
+      case OPT_VIDEO_BUF:{
+        video_buf=(int)rint(atof(optarg)*1000);
+        if(video_buf<=0){
+          fprintf(stderr,"Illegal video buffer size\n");
+          exit(1);
+        }
+      }break;
+      case OPT_FIRST_PASS:{
+        first_pass_name=optarg;
+      }break;
+      case OPT_SECOND_PASS:{
+        second_pass_name=optarg;
+      }break;
+      case OPT_LOOKAHEAD:{
+        video_lookahead=atoi(optarg);
+        if(video_lookahead<0||video_lookahead>32){
+          fprintf(stderr,"Illegal lookahead (use 0 through 32)\n");
+          exit(1);
+        }
+      }break;
       case 'h':
       default:{
         usage();
@@ -480,6 +553,57 @@ int main(int _argc,char **_argv){
   daala_comment_init(&dc);
   /*Set up encoder.*/
   daala_encode_ctl(dd, OD_SET_QUANT, &video_q, sizeof(int));
+  if(video_r>0){
+    daala_encode_ctl(dd,OD_SET_BITRATE,&video_r,sizeof(video_r));
+    daala_encode_ctl(dd,OD_SET_RATE_MODE,&video_rate_mode,
+     sizeof(video_rate_mode));
+    if(video_buf>0){
+      daala_encode_ctl(dd,OD_SET_RATE_BUFFER,&video_buf,sizeof(video_buf));
+    }
+  }
+  if(video_lookahead>0){
+    daala_encode_ctl(dd,OD_SET_LOOKAHEAD,&video_lookahead,
+     sizeof(video_lookahead));
+  }
+  if(first_pass_name!=NULL){
+    unsigned char *buf;
+    int            bytes;
+    twopass_file=fopen(first_pass_name,"wb");
+    if(twopass_file==NULL){
+      fprintf(stderr,"Unable to open first pass file '%s'\n",first_pass_name);
+      exit(1);
+    }
+    /*Write the header of the statistics.*/
+    bytes=daala_encode_ctl(dd,OD_2PASS_OUT,&buf,sizeof(buf));
+    if(bytes<0||fwrite(buf,1,bytes,twopass_file)<(size_t)bytes){
+      fprintf(stderr,"Error writing first pass statistics.\n");
+      exit(1);
+    }
+  }
+  if(second_pass_name!=NULL){
+    FILE          *fin;
+    unsigned char *buf;
+    long           bytes;
+    if(video_r<=0){
+      fprintf(stderr,"A second pass needs a rate target (-V).\n");
+      exit(1);
+    }
+    fin=fopen(second_pass_name,"rb");
+    if(fin==NULL||fseek(fin,0,SEEK_END)!=0||(bytes=ftell(fin))<0
+     ||fseek(fin,0,SEEK_SET)!=0){
+      fprintf(stderr,"Unable to read first pass file '%s'\n",
+       second_pass_name);
+      exit(1);
+    }
+    buf=(unsigned char *)malloc(bytes>0?bytes:1);
+    if(buf==NULL||fread(buf,1,bytes,fin)!=(size_t)bytes
+     ||daala_encode_ctl(dd,OD_2PASS_IN,buf,bytes)<0){
+      fprintf(stderr,"Invalid first pass file '%s'\n",second_pass_name);
+      exit(1);
+    }
+    free(buf);
+    fclose(fin);
+  }
   /*Write the bitstream header packets with proper page interleave.*/
   /*The first packet for each logical stream will get its own page
      automatically.*/
@@ -522,7 +646,7 @@ int main(int _argc,char **_argv){
     ogg_page video_page;
     double   video_time;
     video_ready=fetch_and_process_video(&avin,&video_page,
-     &vo,dd,video_ready);
+     &vo,dd,twopass_file,video_ready);
     /*TODO: Fetch the next video page.*/
     /*If no more pages are available, we've hit the end of the stream.*/
     if(!video_ready)break;
@@ -546,6 +670,7 @@ int main(int _argc,char **_argv){
     _ogg_free(avin.video_img.planes[pli].data);
   }
   if(outfile!=NULL&&outfile!=stdout)fclose(outfile);
+  if(twopass_file!=NULL)fclose(twopass_file);
   fprintf(stderr,"\r    \ndone.\n\r");
   if(avin.video_infile!=NULL&&avin.video_infile!=stdin){
     fclose(avin.video_infile);
@@ -142,9 +142,30 @@ extern int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
  *
  * These defines and macros are for altering the behaviour of the decoder
  * through the \ref daala_decode_ctl interface.
- *
- * No keys are currently defined.
+ * These should have odd values.
  */
+/** Set the number of threads used to reconstruct each frame.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * Rows of super blocks are inverse transformed and postfiltered in parallel
+ *  behind the calling thread, which does the entropy decoding.
+ * The default is 1.
+ * \retval OD_EINVAL The value was less than 1.
+ * \retval OD_EIMPL  The library was built without thread support.
+ * \retval OD_EFAULT The threads could not be created. */
+#define OD_DEC_SET_THREADS 4001
+/** Keep reference frames at their native resolution.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * When non-zero, the decoder stores each reference frame as is and applies
+ *  the sub-pixel interpolation filter to just the parts of it that motion
+ *  compensation reads, instead of storing a copy upsampled by a factor of
+ *  two in each direction.
+ * This uses roughly a quarter of the reference frame memory at the cost of
+ *  slower inter frame decoding.
+ * The output is identical either way.
+ * The default is 0.
+ * \retval OD_EINVAL A frame has already been decoded.
+ * \retval OD_EFAULT The reference frames could not be reallocated. */
+#define OD_DEC_SET_NATIVE_REFS 4003
 
 /*@}*/
 
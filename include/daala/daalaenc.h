@@ -45,6 +45,19 @@ extern "C" {
 typedef struct daala_enc_ctx daala_enc_ctx;
 /*@}*/
 
+/**Statistics collected by an encoder instance.
+ * These cover every frame encoded since the instance was created.*/
+typedef struct daala_enc_stats daala_enc_stats;
+
+struct daala_enc_stats {
+  /**The number of frames encoded.*/
+  ogg_int64_t nframes;
+  /**The number of intra prediction modes coded.*/
+  double intra_mode_count;
+  /**The total number of bits spent coding intra prediction modes.*/
+  double intra_mode_bits;
+};
+
 /**\defgroup encfuncs Functions for Encoding*/
 /*@{*/
 /**\name Functions for encoding
@@ -109,8 +122,9 @@ extern int daala_encode_flush_header(daala_enc_ctx *enc,
  * \retval 0 Success.
  * \retval OD_EFAULT \a enc or \a img was <tt>NULL</tt>.
  * \retval OD_EINVAL The image size does not match the frame size the encoder
- *                   was initialized with, or encoding has already
- *                    completed.*/
+ *                   was initialized with, encoding has already
+ *                    completed, or the first pass statistics from
+ *                    #OD_2PASS_OUT were not retrieved.*/
 extern int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration);
 /**Retrieves encoded video data packets.
  * This should be called repeatedly after each frame is submitted to flush any
@@ -132,7 +146,10 @@ extern int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration);
  *          produced.
  * \retval 0 No packet was produced, and no more encoded video data
  *            remains.
- * \retval OD_EFAULT \a enc or \a op was <tt>NULL</tt>.*/
+ * \retval OD_EFAULT \a enc or \a op was <tt>NULL</tt>.
+ * \retval OD_EINVAL The first pass statistics from #OD_2PASS_OUT were not
+ *                    retrieved, so the next frame in the lookahead could not
+ *                    be coded.*/
 extern int daala_encode_packet_out(daala_enc_ctx *enc,
  int last, ogg_packet *op);
 /**Frees an allocated encoder instance.
@@ -151,6 +168,128 @@ extern void daala_encode_free(daala_enc_ctx *enc);
  * The passed buffer is interpreted as containing a single <tt>int</tt>.
  * The valid range is 0-511. */
 #define OD_SET_QUANT 4000
+/** Set the number of threads used to encode each frame.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * Rows of macro blocks are analyzed in parallel as a wavefront, while the
+ *  calling thread entropy codes them in order, so the output does not depend
+ *  on the number of threads.
+ * Motion estimation is split across the threads the same way.
+ * The default is 1.
+ * \retval OD_EINVAL The value was less than 1.
+ * \retval OD_EIMPL  The library was built without thread support.
+ * \retval OD_EFAULT The threads could not be created. */
+#define OD_SET_THREADS 4002
+/** Retrieve the encoder statistics.
+ * The passed buffer is interpreted as a #daala_enc_stats struct, which is
+ *  filled in with the statistics for every frame encoded so far. */
+#define OD_GET_STATS 4004
+/** Select the fixed-point PVQ quantizer.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * When non-zero, the encoder searches for the PVQ gain and pulses with
+ *  integer arithmetic and table-based gain companding instead of floating
+ *  point, which is faster.
+ * This does not make the bitstream independent of the compiler or CPU: the
+ *  number of pulses, the dequantization and the DC quantization still use
+ *  floating point, in both the encoder and the decoder.
+ * The output can be decoded by any decoder either way.
+ * The default is 0. */
+#define OD_SET_FIXED_PVQ 4006
+/** Continue with the adapted entropy coding models between frames.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * When non-zero, each inter frame starts from the probability models of the
+ *  generic coder as the previous frame left them, instead of from their
+ *  initial values, so that the adaptation is not paid for again every frame.
+ * Keyframes always start from the initial models, so a decoder can still
+ *  start at any keyframe, but no frame after it can be decoded without the
+ *  ones before it.
+ * This is signaled in each frame, so the decoder needs no matching setting.
+ * The default is 0. */
+#define OD_SET_CARRY_MODELS 4008
+/** Set the target bitrate.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>, the
+ *  number of bits per second.
+ * When non-zero, the encoder picks the quantizer of each frame itself, and
+ *  the scale set with #OD_SET_QUANT is ignored.
+ * The default is 0, which uses the same quantizer for every frame.
+ * \retval OD_EINVAL The value was negative. */
+#define OD_SET_BITRATE 4010
+/** Set how strictly the target bitrate is followed.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>,
+ *  either #OD_RC_ABR or #OD_RC_CBR.
+ * The default is #OD_RC_ABR.
+ * \retval OD_EINVAL The value was not a valid mode. */
+#define OD_SET_RATE_MODE 4012
+/** Set the size of the buffer used with #OD_RC_CBR.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>, the
+ *  size of the buffer in bits.
+ * The default is 0, which uses a buffer that holds one second at the target
+ *  bitrate.
+ * \retval OD_EINVAL The value was negative. */
+#define OD_SET_RATE_BUFFER 4014
+/** Collect statistics for the first pass of a 2-pass encode.
+ * The passed buffer is interpreted as an <tt>unsigned char **</tt>, which is
+ *  pointed at the statistics that have not been retrieved yet, and the
+ *  return value is their size in bytes.
+ * This must first be called before the first frame is encoded, which
+ *  returns a header.
+ * After that, calling it after each frame returns the statistics for the
+ *  frames coded since the last call.
+ * With #OD_SET_LOOKAHEAD, that can be none of them, or several while the
+ *  lookahead is flushed.
+ * All of them should be written to a file, in order, to be passed to
+ *  #OD_2PASS_IN.
+ * If they are not retrieved, daala_encode_img_in() and
+ *  daala_encode_packet_out() fail with #OD_EINVAL rather than drop them.
+ * \retval OD_EINVAL A frame was encoded before this was first called. */
+#define OD_2PASS_OUT 4016
+/** Use the statistics from a first pass for the second pass of a 2-pass
+ *  encode.
+ * The passed buffer is interpreted as the whole contents of the file
+ *  written in the first pass, and is copied.
+ * #OD_SET_BITRATE must also be set, and the bits are then spread over the
+ *  whole file according to what each frame needed in the first pass.
+ * \retval OD_EINVAL The statistics were not valid.
+ * \retval OD_EFAULT Memory for the statistics could not be allocated. */
+#define OD_2PASS_IN 4018
+/** Trade compression efficiency for encoding speed.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * Higher values search for motion vectors with fewer block sizes, a coarser
+ *  resolution and fewer refinement passes, and give up on a search sooner.
+ * The valid range is 0-4.
+ * The default is 0, which is the slowest.
+ * \retval OD_EINVAL The value was out of range. */
+#define OD_SET_SPEED 4020
+/** Set how many frames to look ahead before coding each one.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * Frames are analyzed as they are passed to daala_encode_img_in(), and a
+ *  keyframe is placed wherever a new scene starts.
+ * A regular keyframe is put off if a new scene starts within the lookahead.
+ * The rate control also uses the estimated cost of the upcoming frames.
+ * Packets are delayed by this many frames.
+ * After the last frame, call daala_encode_packet_out() with \a last set until
+ *  it returns a packet with <tt>e_o_s</tt> set to flush the lookahead.
+ * The valid range is 0-32.
+ * The default is 0, which codes each frame as soon as it arrives.
+ * This can only be changed while no frames are waiting in the lookahead.
+ * \retval OD_EINVAL The value was out of range, or frames were waiting.
+ * \retval OD_EFAULT Memory for the frames could not be allocated. */
+#define OD_SET_LOOKAHEAD 4022
+/** Blend overlapping motion-compensated blocks at multiple resolutions.
+ * The passed buffer is interpreted as containing a single <tt>int</tt>.
+ * When non-zero, only the low frequencies of the predictions of blocks
+ *  4x4 and larger are blended together, and each quadrant keeps the high
+ *  frequencies of its own prediction, which blurs less than plain bilinear
+ *  blending but takes more time.
+ * This is signaled in each frame, so the decoder needs no matching setting.
+ * The default is 0. */
+#define OD_SET_MULTIRES_BLEND 4024
+
+/*Rate control modes for #OD_SET_RATE_MODE.*/
+/** Hit the target bitrate on average, letting it vary over a few seconds. */
+#define OD_RC_ABR (0)
+/** Never let the bitrate exceed what a buffer of the size set with
+ *  #OD_SET_RATE_BUFFER can smooth out. */
+#define OD_RC_CBR (1)
 
 /*@}*/
 
@@ -52,3 +52,50 @@ int od_block_size_cdf16_id(const unsigned char *bsize, int stride)
   id = up*24 + left*4 + upleft;
   return id;
 }
+
+/* Computes the statistics used by the block-size decision for n 4x4 blocks
+   starting at every other pixel of a row: the sum and sum of squares of
+   their pixels, their variance (floored so that it can never be zero) and
+   16384 divided by that variance. */
+void od_block_var4_row8_c(ogg_int32_t *var, ogg_int32_t *inv_var,
+ ogg_int32_t *sx, ogg_int32_t *sxx, const unsigned char *img, int stride,
+ int n)
+{
+  ogg_int32_t sx_left;
+  ogg_int32_t sxx_left;
+  int j;
+  sx_left = sxx_left = 0;
+  /* Each block is made of two 4x2 columns, the second of which is the first
+     one of the next block. */
+  for (j = -1; j < n; j++) {
+    ogg_int32_t sx_right;
+    ogg_int32_t sxx_right;
+    int k;
+    sx_right = sxx_right = 0;
+    for (k = 0; k < 4; k++) {
+      int x0;
+      int x1;
+      x0 = img[k*stride + 2*j + 2];
+      x1 = img[k*stride + 2*j + 3];
+      sx_right += x0 + x1;
+      sxx_right += x0*x0 + x1*x1;
+    }
+    if (j >= 0) {
+      ogg_int32_t s;
+      ogg_int32_t ss;
+      ogg_int32_t v;
+      ogg_int32_t var_floor;
+      s = sx_left + sx_right;
+      ss = sxx_left + sxx_right;
+      v = (ss - ((s*s) >> 4)) >> 5;
+      var_floor = 4 + (s >> 8);
+      if (v < var_floor) v = var_floor;
+      sx[j] = s;
+      sxx[j] = ss;
+      var[j] = v;
+      inv_var[j] = 16384/v;
+    }
+    sx_left = sx_right;
+    sxx_left = sxx_right;
+  }
+}
@@ -38,4 +38,12 @@ int od_block_size_prob32(const unsigned char *bsize, int stride);
 
 int od_block_size_cdf16_id(const unsigned char *bsize, int stride);
 
+typedef void (*od_block_var4_row_func)(ogg_int32_t *var,
+ ogg_int32_t *inv_var, ogg_int32_t *sx, ogg_int32_t *sxx,
+ const unsigned char *img, int stride, int n);
+
+void od_block_var4_row8_c(ogg_int32_t *var, ogg_int32_t *inv_var,
+ ogg_int32_t *sx, ogg_int32_t *sxx, const unsigned char *img, int stride,
+ int n);
+
 #endif
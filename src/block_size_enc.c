@@ -44,103 +44,137 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
    used to square integers, but not circles. */
 #define SQUARE(x) ((int)(x)*(int)(x))
 
-static void od_compute_stats(const unsigned char *img, int stride, BlockStats *stats)
+int od_block_stats_frame_init(BlockStatsFrame *stats, int nhsb, int nvsb)
 {
-  const unsigned char *x;
-  int i;
-  int j;
-  int off8;
-  ogg_int32_t (*Sx2)[SIZE2_SUMS];
-  ogg_int32_t (*Sxx2)[SIZE2_SUMS];
-  ogg_int32_t (*Sx4)[SIZE4_SUMS];
-  ogg_int32_t (*Sxx4)[SIZE4_SUMS];
-  ogg_int32_t (*Sx8)[SIZE8_SUMS];
-  ogg_int32_t (*Sxx8)[SIZE8_SUMS];
-  ogg_int32_t (*Var4)[SIZE4_SUMS];
-  ogg_int32_t (*invVar4)[SIZE4_SUMS];
-  ogg_int32_t (*Var8)[SIZE8_SUMS];
-  ogg_int32_t (*invVar8)[SIZE8_SUMS];
-
-  Sx2 = stats->Sx2;
-  Sxx2 = stats->Sxx2;
-  Sx4 = stats->Sx4;
-  Sxx4 = stats->Sxx4;
-  Sx8 = stats->Sx8;
-  Sxx8 = stats->Sxx8;
-  Var4 = stats->Var4;
-  invVar4 = stats->invVar4;
-  Var8 = stats->Var8;
-  invVar8 = stats->invVar8;
-
-  x = img - BLOCK_OFFSET(stride);
-  for (i = 0; i < SIZE2_SUMS; i++) {
-    for (j = 0; j < SIZE2_SUMS; j++) {
-      Sx2 [i][j] = x[2*j] + x[2*j + 1] + x[2*j + stride] + x[2*j+stride + 1];
-      Sxx2[i][j] = SQUARE(x[2*j]) + SQUARE(x[2*j + 1])
-       + SQUARE(x[2*j + stride]) + SQUARE(x[2*j + stride + 1]);
-    }
-    x += 2*stride;
+  int nrows4;
+  int nrows8;
+  int k;
+  stats->nhsb = nhsb;
+  stats->nvsb = nvsb;
+  /* The superblocks share all but the 16 (resp. 8) 4x4 (resp. 8x8) blocks
+     that start on their own even pixels (resp. multiples of 4). */
+  stats->stride4 = 16*nhsb + SIZE4_SUMS - 16;
+  stats->stride8 = 8*nhsb + SIZE8_SUMS - 8;
+  nrows4 = 16*nvsb + SIZE4_SUMS - 16;
+  nrows8 = 8*nvsb + SIZE8_SUMS - 8;
+  stats->Var4 = (ogg_int32_t *)_ogg_malloc(
+   2*nrows4*stats->stride4*sizeof(*stats->Var4));
+  stats->Var8 = (ogg_int32_t *)_ogg_malloc(
+   2*nrows8*stats->stride8*sizeof(*stats->Var8));
+  stats->Sx4[0] = (ogg_int32_t *)_ogg_malloc(
+   2*4*stats->stride4*sizeof(*stats->Sx4[0]));
+  if (stats->Var4 == NULL || stats->Var8 == NULL || stats->Sx4[0] == NULL) {
+    od_block_stats_frame_clear(stats);
+    return OD_EFAULT;
   }
-
-  for (i=0; i<SIZE4_SUMS; i++) {
-    for (j=0; j<SIZE4_SUMS; j++) {
-      Sx4[i][j] = Sx2[i][j] + Sx2[i][j + 1]
-       + Sx2[i + 1][j] + Sx2[i + 1][j + 1];
-      Sxx4[i][j] = Sxx2[i][j] + Sxx2[i][j + 1]
-       + Sxx2[i + 1][j] + Sxx2[i + 1][j + 1];
-    }
+  stats->invVar4 = stats->Var4 + nrows4*stats->stride4;
+  stats->invVar8 = stats->Var8 + nrows8*stats->stride8;
+  for (k = 0; k < 4; k++) {
+    stats->Sx4[k] = stats->Sx4[0] + 2*k*stats->stride4;
+    stats->Sxx4[k] = stats->Sx4[k] + stats->stride4;
   }
+  return 0;
+}
+
+void od_block_stats_frame_clear(BlockStatsFrame *stats)
+{
+  _ogg_free(stats->Var4);
+  _ogg_free(stats->Var8);
+  _ogg_free(stats->Sx4[0]);
+  stats->Var4 = stats->Var8 = stats->Sx4[0] = NULL;
+}
 
+/* Computes the variances of every superblock of the frame, and of the
+   borders around them. img points to the top-left corner of the first
+   superblock, and there must be BLOCK_OFFSET(stride) pixels of padding
+   around the superblocks. */
+void od_block_stats_frame_compute(BlockStatsFrame *stats,
+ od_block_var4_row_func var4_row, const unsigned char *img, int stride)
+{
+  const unsigned char *x;
+  int nrows4;
+  int nrows8;
+  int off8;
+  int i;
+  nrows4 = 16*stats->nvsb + SIZE4_SUMS - 16;
+  nrows8 = 8*stats->nvsb + SIZE8_SUMS - 8;
+  /* An 8x8 block is made of the 4x4 blocks starting 0 and 4 pixels to the
+     right of and below its top-left corner, which is off8 entries down and to
+     the right of the first 4x4 block. */
   off8 = OFF32 - 2*OFF8_32;
   OD_ASSERT(off8 >= 0);
-  for (i = 0; i < SIZE8_SUMS; i++) {
-    for (j = 0; j < SIZE8_SUMS; j++) {
-      Sx8[i][j] = Sx4[2*i + off8][2*j+off8] + Sx4[2*i + off8][2*j + 2 + off8]
-       + Sx4[2*i + 2 + off8][2*j + off8] + Sx4[2*i + 2 + off8][2*j + 2 + off8];
-      Sxx8[i][j] = Sxx4[2*i + off8][2*j + off8] + Sxx4[2*i + off8][2*j + 2 + off8]
-       + Sxx4[2*i + 2 + off8][2*j + off8] + Sxx4[2*i + 2 + off8][2*j + 2 + off8];
-    }
-  }
-
-  for (i = 0; i < SIZE4_SUMS; i++) {
-    for (j = 0; j < SIZE4_SUMS; j++) {
-      ogg_int32_t var_floor;
-      Var4[i][j] = (Sxx4[i][j] - (SQUARE(Sx4[i][j]) >> 4)) >> 5;
-      var_floor = 4 + (Sx4[i][j] >> 8);
-      if (Var4[i][j] < var_floor) Var4[i][j] = var_floor;
-      invVar4[i][j] = 16384/Var4[i][j];
+  OD_ASSERT(((nrows4 - off8 - 3) >> 1) + 1 >= nrows8);
+  x = img - BLOCK_OFFSET(stride);
+  for (i = 0; i < nrows4; i++) {
+    (*var4_row)(stats->Var4 + i*stats->stride4,
+     stats->invVar4 + i*stats->stride4, stats->Sx4[i & 3], stats->Sxx4[i & 3],
+     x + 2*i*stride, stride, stats->stride4);
+    /* Once the bottom half of a row of 8x8 blocks is done, add it up. */
+    if (i - off8 >= 2 && !((i - off8) & 1)
+     && (i - off8 - 2) >> 1 < nrows8) {
+      const ogg_int32_t *sx4_top;
+      const ogg_int32_t *sxx4_top;
+      const ogg_int32_t *sx4_bot;
+      const ogg_int32_t *sxx4_bot;
+      ogg_int32_t *var8;
+      ogg_int32_t *inv_var8;
+      int j;
+      sx4_top = stats->Sx4[(i - 2) & 3] + off8;
+      sxx4_top = stats->Sxx4[(i - 2) & 3] + off8;
+      sx4_bot = stats->Sx4[i & 3] + off8;
+      sxx4_bot = stats->Sxx4[i & 3] + off8;
+      var8 = stats->Var8 + ((i - off8 - 2) >> 1)*stats->stride8;
+      inv_var8 = stats->invVar8 + ((i - off8 - 2) >> 1)*stats->stride8;
+      for (j = 0; j < stats->stride8; j++) {
+        ogg_int32_t sx8;
+        ogg_int32_t sxx8;
+        ogg_int32_t var_floor;
+        sx8 = sx4_top[2*j] + sx4_top[2*j + 2]
+         + sx4_bot[2*j] + sx4_bot[2*j + 2];
+        sxx8 = sxx4_top[2*j] + sxx4_top[2*j + 2]
+         + sxx4_bot[2*j] + sxx4_bot[2*j + 2];
+        var8[j] = (sxx8 - (SQUARE(sx8) >> 6)) >> 5;
+        var_floor = 4 + (sx8 >> 8);
+        if (var8[j] < var_floor) var8[j] = var_floor;
+        inv_var8[j] = 16384/var8[j];
+      }
     }
   }
+}
 
-  for (i = 0; i < SIZE8_SUMS; i++){
-    for (j = 0; j < SIZE8_SUMS; j++){
-      ogg_int32_t var_floor;
-      Var8[i][j] = (Sxx8[i][j] - (SQUARE(Sx8[i][j]) >> 6)) >> 5;
-      var_floor = 4 + (Sx8[i][j] >> 8);
-      if (Var8[i][j] < var_floor) Var8[i][j] = var_floor;
-      invVar8[i][j] = 16384/Var8[i][j];
-    }
-  }
+/* Points bstats at the variances of superblock (sbx, sby). */
+void od_block_stats_get(BlockStats *bstats, const BlockStatsFrame *stats,
+ int sbx, int sby)
+{
+  OD_ASSERT(sbx >= 0 && sbx < stats->nhsb);
+  OD_ASSERT(sby >= 0 && sby < stats->nvsb);
+  bstats->stride4 = stats->stride4;
+  bstats->Var4 = stats->Var4 + 16*sby*stats->stride4 + 16*sbx;
+  bstats->invVar4 = stats->invVar4 + 16*sby*stats->stride4 + 16*sbx;
+  bstats->stride8 = stats->stride8;
+  bstats->Var8 = stats->Var8 + 8*sby*stats->stride8 + 8*sbx;
+  bstats->invVar8 = stats->invVar8 + 8*sby*stats->stride8 + 8*sbx;
 }
 
+#define VAR4(stats, i, j) ((stats)->Var4[(i)*(stats)->stride4 + (j)])
+#define INV_VAR4(stats, i, j) ((stats)->invVar4[(i)*(stats)->stride4 + (j)])
+#define VAR8(stats, i, j) ((stats)->Var8[(i)*(stats)->stride8 + (j)])
+#define INV_VAR8(stats, i, j) ((stats)->invVar8[(i)*(stats)->stride8 + (j)])
+
 /* This function decides how to partition a 32x32 superblock based on a simple
  * activity masking model. The masking at any given point is assumed to be
  * proportional to the local variance. The decision is made using a simple
  * dynamic programming algorithm, working from 8x8 decisions up to 32x32.
  * @param [scratch] bs Sratch space for computation
- * @param [in]      psy_img Image on which to compute the psy model (should not be a residual)
- * @param [in]      img     Image on which to compute the noise model (i.e. what is to be coded)
- * @param [in]      stride  Image stride
+ * @param [in]      psy_stats Variances on which to compute the psy model (should not be of a residual)
+ * @param [in]      img_stats Variances on which to compute the noise model (i.e. of what is to be coded)
  * @param [out]     dec     Decision for each 8x8 block in the image. 0=4x4, 1=8x8, 2=16x16, 3=32x32
  */
-void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
-    const unsigned char *img, int stride, int bsize[4][4])
+void process_block_size32(BlockSizeComp *bs, const BlockStats *psy_stats,
+    const BlockStats *img_stats, int bsize[4][4])
 {
   int i;
   int j;
-  od_compute_stats(img, stride, &bs->img_stats);
-  if (psy_img != img) od_compute_stats(psy_img, stride, &bs->psy_stats);
-  else memcpy(&bs->psy_stats, &bs->img_stats, sizeof(BlockStats));
   /* Compute 4x4 masking */
   for (i = 0; i < 8; i++) {
     for (j = 0; j < 8; j++) {
@@ -152,14 +186,15 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
       /* Masking based on 4x4 variances */
       for (k = 0; k < 3; k++) {
         for (m = 0; m < 3; m++) {
-          sum_var += bs->img_stats.Var4[2*i + k + OFF32 - 1][2*j + m + OFF32 - 1];
+          sum_var += VAR4(img_stats, 2*i + k + OFF32 - 1,
+           2*j + m + OFF32 - 1);
         }
       }
       bs->noise4_4[i][j] = sum_var/(3*3);
       for (k = 0; k < 3; k++) {
         for (m = 0; m < 3; m++) {
-          psy += OD_LOG2(1 + bs->noise4_4[i][j]*bs->psy_stats.invVar4
-           [2*i + k + OFF32 - 1][2*j + m + OFF32 - 1]/16384.);
+          psy += OD_LOG2(1 + bs->noise4_4[i][j]*INV_VAR4(psy_stats,
+           2*i + k + OFF32 - 1, 2*j + m + OFF32 - 1)/16384.);
         }
       }
       bs->psy4[i][j] = psy/(3*3) - 1.;
@@ -178,15 +213,15 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
       /* Masking based on 4x4 variances */
       for (k = 0; k < COUNT8; k++) {
         for (m = 0; m < COUNT8; m++) {
-          sum_var += bs->img_stats.Var4[4*i + k + OFF32 - OFF8][4*j + m + OFF32 - OFF8];
+          sum_var += VAR4(img_stats, 4*i + k + OFF32 - OFF8,
+           4*j + m + OFF32 - OFF8);
         }
       }
       bs->noise4_8[i][j] = sum_var/(COUNT8*COUNT8);
       for (k = 0; k < COUNT8; k++) {
         for(m = 0; m < COUNT8; m++) {
-          psy += OD_LOG2(1 + bs->noise4_8[i][j]*bs->img_stats.invVar4
-           [4*i + k + OFF32 - OFF8]
-           [4*j + m + OFF32 - OFF8]/16384.);
+          psy += OD_LOG2(1 + bs->noise4_8[i][j]*INV_VAR4(img_stats,
+           4*i + k + OFF32 - OFF8, 4*j + m + OFF32 - OFF8)/16384.);
         }
       }
       bs->psy8[i][j] = psy/(COUNT8*COUNT8) - 1.;
@@ -217,15 +252,15 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
       /* Masking based on 4x4 variances */
       for (k = 0; k < COUNT16; k++) {
         for (m = 0; m < COUNT16; m++) {
-          sum_var += bs->img_stats.Var4[8*i + k + OFF32 - OFF16]
-           [8*j + m + OFF32 - OFF16];
+          sum_var += VAR4(img_stats, 8*i + k + OFF32 - OFF16,
+           8*j + m + OFF32 - OFF16);
         }
       }
       bs->noise4_16[i][j] = sum_var/(COUNT16*COUNT16);
       for (k = 0; k < COUNT16; k++) {
         for (m = 0; m < COUNT16; m++) {
-          psy += OD_LOG2(1 + bs->noise4_16[i][j]*bs->img_stats.invVar4
-           [8*i + k + OFF32 - OFF16][8*j + m + OFF32 - OFF16]/16384.);
+          psy += OD_LOG2(1 + bs->noise4_16[i][j]*INV_VAR4(img_stats,
+           8*i + k + OFF32 - OFF16, 8*j + m + OFF32 - OFF16)/16384.);
         }
       }
       bs->psy16[i][j] = psy/(COUNT16*COUNT16) - 1.;
@@ -233,15 +268,15 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
       /* Use 8x8 variances */
       for (k = 0; k < COUNT8_16; k++) {
         for (m = 0; m < COUNT8_16; m++) {
-          sum_var += bs->img_stats.Var8[4*i + k + OFF8_32 - OFF8_16]
-           [4*j + m + OFF8_32 - OFF8_16];
+          sum_var += VAR8(img_stats, 4*i + k + OFF8_32 - OFF8_16,
+           4*j + m + OFF8_32 - OFF8_16);
         }
       }
       bs->noise8_16[i][j] = sum_var/(COUNT8_16*COUNT8_16);
       for (k = 0 ; k < COUNT8_16; k++) {
         for (m = 0; m < COUNT8_16; m++) {
-          psy8 += OD_LOG2(1 + bs->noise8_16[i][j]*bs->img_stats.invVar8
-           [4*i + k + OFF8_32 - OFF8_16][4*j + m + OFF8_32 - OFF8_16]/16384.);
+          psy8 += OD_LOG2(1 + bs->noise8_16[i][j]*INV_VAR8(img_stats,
+           4*i + k + OFF8_32 - OFF8_16, 4*j + m + OFF8_32 - OFF8_16)/16384.);
         }
       }
       bs->psy16[i][j] = OD_MAXF(bs->psy16[i][j], PSY8_FUDGE*
@@ -271,13 +306,13 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
     /* Masking based on 4x4 variances */
     for (k = 0; k < COUNT32; k++) {
       for (m = 0; m < COUNT32; m++) {
-        sum_var += bs->img_stats.Var4[k][m];
+        sum_var += VAR4(img_stats, k, m);
       }
     }
     bs->noise4_32 = sum_var/(COUNT32*COUNT32);
     for (k = 0; k < COUNT32; k++) {
       for (m = 0; m < COUNT32; m++) {
-        psy += OD_LOG2(1 + bs->noise4_32*bs->img_stats.invVar4[k][m]/16384.);
+        psy += OD_LOG2(1 + bs->noise4_32*INV_VAR4(img_stats, k, m)/16384.);
       }
     }
     bs->psy32 = psy/(COUNT32*COUNT32) - 1.;
@@ -285,13 +320,13 @@ void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img,
     /* Use 8x8 variances */
     for (k = 0; k < COUNT8_32; k++) {
       for (m = 0; m < COUNT8_32; m++) {
-        sum_var += bs->img_stats.Var8[k][m];
+        sum_var += VAR8(img_stats, k, m);
       }
     }
     bs->noise8_32 = sum_var/(COUNT8_32*COUNT8_32);
     for (k=0; k < COUNT8_32; k++) {
       for (m = 0; m < COUNT8_32; m++) {
-        psy8 += OD_LOG2(1 + bs->noise8_32*bs->img_stats.invVar8[k][m]/16384.);
+        psy8 += OD_LOG2(1 + bs->noise8_32*INV_VAR8(img_stats, k, m)/16384.);
       }
     }
     bs->psy32 = OD_MAXF(bs->psy32, PSY8_FUDGE*(psy8/(COUNT8_32*COUNT8_32) - 1.));
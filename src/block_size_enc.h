@@ -26,6 +26,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 #define _block_size_enc_h
 
 #include "entenc.h"
+#include "block_size.h"
 
 /* None of these values should be larger than OFF32 or else the sun will
    explode */
@@ -46,32 +47,45 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 #define COUNT8_16  (3+2*OFF8_16)
 #define COUNT8_32  (7+2*OFF8_32)
 
-#define SIZE2_SUMS (16+2*OFF32)
 #define SIZE4_SUMS (15+2*OFF32)
 #define SIZE8_SUMS ( 7+2*OFF8_32)
 
 /*#define STRIDE (32+4*OFF32)*/
 #define BLOCK_OFFSET(stride) ((2*OFF32)*(stride)+(2*OFF32))
 
-/* This struct can be made a lot smaller by using temporary values,
-   but as it is, it's much easier to debug and modify */
+/* The 4x4 and 8x8 variances of a superblock and its surroundings, pointing
+   into the tables of a BlockStatsFrame.
+   Var4 has SIZE4_SUMS x SIZE4_SUMS entries, one for every 4x4 block starting
+   on an even pixel, with entry [OFF32][OFF32] at the top-left corner of the
+   superblock. Var8 has SIZE8_SUMS x SIZE8_SUMS entries, one for every 8x8
+   block starting on a multiple of 4, with entry [OFF8_32][OFF8_32] at the
+   top-left corner of the superblock. */
 typedef struct {
-  ogg_int32_t Sx2 [SIZE2_SUMS][SIZE2_SUMS];
-  ogg_int32_t Sxx2[SIZE2_SUMS][SIZE2_SUMS];
-  ogg_int32_t Sx4 [SIZE4_SUMS][SIZE4_SUMS];
-  ogg_int32_t Sxx4[SIZE4_SUMS][SIZE4_SUMS];
-  ogg_int32_t Sx8 [SIZE8_SUMS][SIZE8_SUMS];
-  ogg_int32_t Sxx8[SIZE8_SUMS][SIZE8_SUMS];
-  ogg_int32_t Var4 [SIZE4_SUMS][SIZE4_SUMS];
-  ogg_int32_t invVar4[SIZE4_SUMS][SIZE4_SUMS];
-  ogg_int32_t Var8 [SIZE8_SUMS][SIZE8_SUMS];
-  ogg_int32_t invVar8[SIZE8_SUMS][SIZE8_SUMS];
+  const ogg_int32_t *Var4;
+  const ogg_int32_t *invVar4;
+  int stride4;
+  const ogg_int32_t *Var8;
+  const ogg_int32_t *invVar8;
+  int stride8;
 } BlockStats;
 
+/* The variances of a whole frame, computed once and shared by all of its
+   superblocks, whose neighbourhoods overlap. */
 typedef struct {
+  int nhsb;
+  int nvsb;
+  int stride4;
+  ogg_int32_t *Var4;
+  ogg_int32_t *invVar4;
+  int stride8;
+  ogg_int32_t *Var8;
+  ogg_int32_t *invVar8;
+  /* The last 4 rows of 4x4 sums, from which the 8x8 ones are made. */
+  ogg_int32_t *Sx4[4];
+  ogg_int32_t *Sxx4[4];
+} BlockStatsFrame;
 
-  BlockStats img_stats;
-  BlockStats psy_stats;
+typedef struct {
 
   /* 4x4 metrics */
   ogg_int32_t noise4_4[8][8];
@@ -96,7 +110,15 @@ typedef struct {
   float dec_gain16[2][2];
 } BlockSizeComp;
 
-void process_block_size32(BlockSizeComp *bs, const unsigned char *psy_img, const unsigned char *img, int stride, int dec[4][4]);
+int od_block_stats_frame_init(BlockStatsFrame *stats, int nhsb, int nvsb);
+void od_block_stats_frame_clear(BlockStatsFrame *stats);
+void od_block_stats_frame_compute(BlockStatsFrame *stats,
+ od_block_var4_row_func var4_row, const unsigned char *img, int stride);
+void od_block_stats_get(BlockStats *bstats, const BlockStatsFrame *stats,
+ int sbx, int sby);
+
+void process_block_size32(BlockSizeComp *bs, const BlockStats *psy_stats,
+ const BlockStats *img_stats, int dec[4][4]);
 
 void od_block_size_encode(od_ec_enc *enc,
  const unsigned char *bsize, int stride);
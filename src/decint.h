@@ -26,6 +26,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 # define _decint_H (1)
 # include "../include/daala/daaladec.h"
 # include "state.h"
+# include "thread.h"
+# include "generic_code.h"
 
 typedef struct daala_dec_ctx od_dec_ctx;
 
@@ -39,6 +41,25 @@ struct daala_dec_ctx {
   od_ec_dec ec;
   int scale[OD_NPLANES_MAX];
   int packet_state;
+  /*The worker threads used to reconstruct rows of super blocks, or NULL to
+     do everything on the calling thread.*/
+  od_thread_pool *threads;
+  /*The number of macro blocks in each row that have been entropy decoded.*/
+  od_row_sync mb_rows;
+  /*The postfilter progress of each row of super blocks: 1 once its right
+     edges are filtered, 2 once its bottom edges are filtered and it has been
+     copied to the output.*/
+  od_row_sync sb_rows;
+  /*Scratch space for decoding a frame, allocated once when the decoder is
+     created.*/
+  od_frame_bufs bufs;
+  /*The generic coder models and expectations at the end of the last frame,
+     which an inter frame may start from instead of the initial ones.*/
+  GenericEncoder model_dc[OD_NPLANES_MAX];
+  GenericEncoder model_g[OD_NPLANES_MAX];
+  GenericEncoder model_ym[OD_NPLANES_MAX];
+  int ex_dc[OD_NPLANES_MAX];
+  int ex_g[OD_NPLANES_MAX];
 };
 
 /*Stub for the daala_setup_info.*/
@@ -38,15 +38,48 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 static int od_dec_init(od_dec_ctx *dec, const daala_info *info,
  const daala_setup_info *setup) {
+  int pli;
   int ret;
   (void)setup;
   ret = od_state_init(&dec->state, info);
   if (ret < 0) return ret;
   dec->packet_state = OD_PACKET_DATA;
+  dec->threads = NULL;
+  /*Give inter frames valid models to continue with even if we start
+     decoding in the middle of a stream.*/
+  for (pli = 0; pli < OD_NPLANES_MAX; pli++) {
+    generic_model_init(dec->model_dc + pli);
+    generic_model_init(dec->model_g + pli);
+    generic_model_init(dec->model_ym + pli);
+    dec->ex_dc[pli] = pli > 0 ? 8 : 32768;
+    dec->ex_g[pli] = 8;
+  }
+  ret = od_frame_bufs_init(&dec->bufs, &dec->state);
+  if (ret < 0) {
+    od_state_clear(&dec->state);
+    return ret;
+  }
+  ret = od_row_sync_init(&dec->mb_rows, dec->state.nvmbs);
+  if (ret < 0) {
+    od_frame_bufs_clear(&dec->bufs);
+    od_state_clear(&dec->state);
+    return ret;
+  }
+  ret = od_row_sync_init(&dec->sb_rows, dec->state.nvsb);
+  if (ret < 0) {
+    od_row_sync_clear(&dec->mb_rows);
+    od_frame_bufs_clear(&dec->bufs);
+    od_state_clear(&dec->state);
+    return ret;
+  }
   return 0;
 }
 
 static void od_dec_clear(od_dec_ctx *dec) {
+  od_thread_pool_free(dec->threads);
+  od_row_sync_clear(&dec->sb_rows);
+  od_row_sync_clear(&dec->mb_rows);
+  od_frame_bufs_clear(&dec->bufs);
   od_state_clear(&dec->state);
 }
 
@@ -70,10 +103,37 @@ void daala_decode_free(daala_dec_ctx *dec) {
 }
 
 int daala_decode_ctl(daala_dec_ctx *dec, int req, void *buf, size_t buf_sz) {
-  (void)dec;
   (void)buf;
   (void)buf_sz;
   switch(req) {
+    case OD_DEC_SET_THREADS: {
+      int nthreads;
+      OD_ASSERT(dec);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(nthreads));
+      nthreads = *(int *)buf;
+      if (nthreads < 1) return OD_EINVAL;
+      od_thread_pool_free(dec->threads);
+      dec->threads = NULL;
+      if (nthreads > 1) {
+#if defined(OD_ENABLE_THREADS)
+        dec->threads = od_thread_pool_alloc(nthreads);
+        if (dec->threads == NULL) return OD_EFAULT;
+#else
+        return OD_EIMPL;
+#endif
+      }
+      return OD_SUCCESS;
+    }
+    case OD_DEC_SET_NATIVE_REFS: {
+      OD_ASSERT(dec);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      /*The reference buffers are reallocated, so this must come before the
+         first frame.*/
+      if (dec->state.ref_imgi[OD_FRAME_SELF] >= 0) return OD_EINVAL;
+      return od_state_set_native_refs(&dec->state, *(int *)buf);
+    }
     default: return OD_EIMPL;
   }
 }
@@ -97,10 +157,8 @@ struct od_mb_dec_ctx {
   GenericEncoder model_ym[OD_NPLANES_MAX];
   od_adapt_ctx adapt;
   signed char *modes;
-  od_coeff *c;
   od_coeff *d;
   od_coeff *md;
-  od_coeff *mc;
   od_coeff *l;
   int ex_dc[OD_NPLANES_MAX];
   int ex_g[OD_NPLANES_MAX];
@@ -115,6 +173,18 @@ struct od_mb_dec_ctx {
 };
 typedef struct od_mb_dec_ctx od_mb_dec_ctx;
 
+/*The per-frame state shared by all the reconstruction threads.*/
+struct od_frame_dec_ctx {
+  daala_dec_ctx *dec;
+  od_frame_bufs *bufs;
+  int is_keyframe;
+};
+typedef struct od_frame_dec_ctx od_frame_dec_ctx;
+
+/*Entropy decodes and dequantizes a single 4x4 block.
+  The inverse transform is left to od_dec_recon_sb_row(), since nothing
+   else in the frame depends on it.*/
+
 void od_4x4_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
   int bx, int by) {
   int xdec;
@@ -122,10 +192,7 @@ void od_4x4_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
   int w;
   int frame_width;
   signed char *modes;
-  od_coeff *c;
   od_coeff *d;
-  od_coeff *md;
-  od_coeff *mc;
   od_coeff *l;
   int x;
   int y;
@@ -144,16 +211,9 @@ void od_4x4_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
   frame_width = dec->state.frame_width;
   w = frame_width >> xdec;
   modes = ctx->modes;
-  c = ctx->c;
   d = ctx->d;
-  md = ctx->md;
-  mc = ctx->mc;
   l = ctx->l;
   vk = 0;
-  if (!ctx->is_keyframe) {
-    od_bin_fdct4x4(md + (by << 2)*w + (bx << 2), w,
-     mc + (by << 2)*w + (bx << 2), w);
-  }
   for (zzi = 0; zzi < 16; zzi++) pvq_scale[zzi] = 0;
   if (ctx->is_keyframe) {
     if (bx > 0 && by > 0) {
@@ -185,7 +245,7 @@ void od_4x4_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
          ctx->mode_p0, OD_INTRA_NMODES, m_l, m_ul, m_u);
         mode = od_ec_decode_cdf_unscaled(&dec->ec, mode_cdf,
          OD_INTRA_NMODES);
-        od_intra_pred4x4_get(pred, coeffs, strides, mode);
+        (*dec->state.opt_vtbl.intra_get[0])(pred, coeffs, strides, mode);
         modes[by*(w >> 2) + bx] = mode;
         od_intra_pred_update(ctx->mode_p0, OD_INTRA_NMODES, mode,
          m_l, m_ul, m_u);
@@ -292,8 +352,6 @@ void od_4x4_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
       d[((by << 2) + y)*w + (bx << 2) + x] = pred[OD_ZIG4[y*4 + x]];
     }
   }
-  /*iDCT the 4x4 block.*/
-  od_bin_idct4x4(c + (by << 2)*w + (bx << 2), w, d + (by << 2)*w + (bx << 2), w);
 }
 
 void od_b8_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
@@ -323,12 +381,238 @@ void od_mb_decode(daala_dec_ctx *dec, od_mb_dec_ctx *ctx, int pli,
   }
 }
 
+/*Predicts every nthreads'th row of 16x16 blocks, starting with row _ti.*/
+static void od_dec_mc_predict_rows(void *_ctx, int _ti) {
+  od_frame_dec_ctx *fctx;
+  daala_dec_ctx *dec;
+  int nthreads;
+  int vy;
+  fctx = (od_frame_dec_ctx *)_ctx;
+  dec = fctx->dec;
+  nthreads = od_thread_pool_nthreads(dec->threads);
+  for (vy = _ti << 2; vy < (dec->state.nvmbs + 1) << 2; vy += nthreads << 2) {
+    od_state_mc_predict_row(&dec->state, OD_FRAME_PREV, vy);
+  }
+}
+
+/*Collects the motion-compensated reference for one plane, applies the
+   prefilter to it, and transforms it.*/
+static void od_dec_prefilter_plane(od_frame_dec_ctx *fctx, int pli) {
+  daala_dec_ctx *dec;
+  od_coeff *mctmp;
+  od_coeff *mdtmp;
+  int nhsb;
+  int nvsb;
+  int xdec;
+  int ydec;
+  int w;
+  int h;
+  int y;
+  int x;
+  dec = fctx->dec;
+  nhsb = dec->state.nhsb;
+  nvsb = dec->state.nvsb;
+  xdec = dec->state.io_imgs[OD_FRAME_REC].planes[pli].xdec;
+  ydec = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ydec;
+  w = dec->state.frame_width >> xdec;
+  h = dec->state.frame_height >> ydec;
+  mctmp = fctx->bufs->mctmp[pli];
+  mdtmp = fctx->bufs->mdtmp[pli];
+  /*Collect the image data needed for this plane.*/
+  {
+    unsigned char *mdata;
+    int ystride;
+    mdata = dec->state.io_imgs[OD_FRAME_REC].planes[pli].data;
+    ystride = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
+    for (y=0;y<h;y++) {
+      for (x=0;x<w;x++) mctmp[y*w+x]=mdata[ystride*y+x]-128;
+    }
+  }
+  /*Apply the prefilter across the entire image.*/
+  {
+    int sby;
+    int sbx;
+    /* This code assumes 4:4:4 or 4:2:0 input. */
+    OD_ASSERT(xdec==ydec);
+    /*Apply the prefilter down the bottom block edge columns.*/
+    for (sby = 0; sby < nvsb; sby++) {
+      for (sbx = 0; sbx < nhsb; sbx++) {
+        unsigned char btmp[6*6];
+        od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
+        od_apply_filter(&dec->state.opt_vtbl.filter,
+         &mctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+         &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
+      }
+    }
+    /*Apply the prefilter across the right block edge rows.*/
+    for (sby = 0; sby < nvsb; sby++) {
+      for (sbx = 0; sbx < nhsb; sbx++) {
+        unsigned char btmp[6*6];
+        od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
+        od_apply_filter(&dec->state.opt_vtbl.filter,
+         &mctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+         &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
+      }
+    }
+  }
+  /*fDCT every 4x4 block of the prediction.*/
+  for (y = 0; y < h; y += 4) {
+    for (x = 0; x < w; x += 4) {
+      (*dec->state.opt_vtbl.fdct_2d[0])(mdtmp + y*w + x, w,
+       mctmp + y*w + x, w);
+    }
+  }
+}
+
+static void od_dec_prefilter_planes(void *_ctx, int _ti) {
+  od_frame_dec_ctx *fctx;
+  int nthreads;
+  int pli;
+  fctx = (od_frame_dec_ctx *)_ctx;
+  nthreads = od_thread_pool_nthreads(fctx->dec->threads);
+  for (pli = _ti; pli < fctx->dec->state.info.nplanes; pli += nthreads) {
+    od_dec_prefilter_plane(fctx, pli);
+  }
+}
+
+/*Applies the postfilter to the bottom edges of one row of super blocks and
+   copies the finished row to the output image.
+  This requires the right edges of this row and the next one to have been
+   filtered, and the row above to have been finished.*/
+static void od_dec_finish_sb_row(od_frame_dec_ctx *fctx, int sby) {
+  daala_dec_ctx *dec;
+  int nplanes;
+  int nhsb;
+  int nvsb;
+  int pli;
+  dec = fctx->dec;
+  nplanes = dec->state.info.nplanes;
+  nhsb = dec->state.nhsb;
+  nvsb = dec->state.nvsb;
+  od_row_sync_wait(&dec->sb_rows, sby - 1, 2);
+  for (pli = 0; pli < nplanes; pli++) {
+    unsigned char *data;
+    od_coeff *ctmp;
+    int ystride;
+    int xdec;
+    int ydec;
+    int sbx;
+    int w;
+    int y;
+    int x;
+    xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = dec->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    /*Apply the postfilter down the bottom block edge columns.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
+      od_apply_filter(&dec->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,1);
+    }
+    /*No later filter touches this row, so it can be output.*/
+    data = dec->state.io_imgs[OD_FRAME_REC].planes[pli].data;
+    ystride = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
+    for (y = sby << (5 - ydec); y < (sby + 1) << (5 - ydec); y++) {
+      for (x = 0; x < w; x++) {
+        data[ystride*y+x]=OD_CLAMP255(ctmp[y*w+x]+128);
+      }
+    }
+  }
+  /*Upsample the rows of the reference frame that are now final, while
+     the rest of the frame is still being coded.*/
+  od_state_store_ref8_sb_row(&dec->state,
+   dec->state.ref_imgi[OD_FRAME_SELF], sby);
+  od_row_sync_post(&dec->sb_rows, sby, 2);
+}
+
+/*Reconstructs one row of super blocks as soon as its coefficients have been
+   decoded: inverse transforms it, applies the postfilter to its right edges,
+   and then finishes the row above it.*/
+static void od_dec_recon_sb_row(od_frame_dec_ctx *fctx, int sby) {
+  daala_dec_ctx *dec;
+  int nplanes;
+  int nhmbs;
+  int nhsb;
+  int mbx;
+  int pli;
+  dec = fctx->dec;
+  nplanes = dec->state.info.nplanes;
+  nhmbs = dec->state.nhmbs;
+  nhsb = dec->state.nhsb;
+  for (mbx = 0; mbx < nhmbs; mbx++) {
+    od_row_sync_wait(&dec->mb_rows, (sby << 1) + 1, mbx + 1);
+    for (pli = 0; pli < nplanes; pli++) {
+      od_coeff *c;
+      od_coeff *d;
+      int xdec;
+      int ydec;
+      int w;
+      int by;
+      int bx;
+      xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+      ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+      w = dec->state.frame_width >> xdec;
+      c = fctx->bufs->ctmp[pli];
+      d = fctx->bufs->dtmp[pli];
+      /*iDCT the 4x4 blocks.*/
+      for (by = sby << (3 - ydec); by < (sby + 1) << (3 - ydec); by++) {
+        for (bx = mbx << (2 - xdec); bx < (mbx + 1) << (2 - xdec); bx++) {
+          (*dec->state.opt_vtbl.idct_2d[0])(c + (by << 2)*w + (bx << 2), w,
+           d + (by << 2)*w + (bx << 2), w);
+        }
+      }
+    }
+  }
+  for (pli = 0; pli < nplanes; pli++) {
+    od_coeff *ctmp;
+    int xdec;
+    int ydec;
+    int sbx;
+    int w;
+    xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = dec->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    /* This code assumes 4:4:4 or 4:2:0 input. */
+    OD_ASSERT(xdec==ydec);
+    /*Apply the postfilter across the right block edge rows.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
+      od_apply_filter(&dec->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,1);
+    }
+  }
+  od_row_sync_post(&dec->sb_rows, sby, 1);
+  if (sby > 0) {
+    od_row_sync_wait(&dec->sb_rows, sby - 1, 1);
+    od_dec_finish_sb_row(fctx, sby - 1);
+  }
+  if (sby == dec->state.nvsb - 1) od_dec_finish_sb_row(fctx, sby);
+}
+
+/*The job run by each reconstruction thread: every nthreads'th row of super
+   blocks, starting with row _ti.*/
+static void od_dec_recon_sb_rows(void *_ctx, int _ti) {
+  od_frame_dec_ctx *fctx;
+  int nthreads;
+  int sby;
+  fctx = (od_frame_dec_ctx *)_ctx;
+  nthreads = od_thread_pool_nthreads(fctx->dec->threads);
+  for (sby = _ti; sby < fctx->dec->state.nvsb; sby += nthreads) {
+    od_dec_recon_sb_row(fctx, sby);
+  }
+}
+
 int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
  const ogg_packet *op) {
   int nplanes;
   int pli;
   int frame_width;
-  int frame_height;
   int pic_width;
   int pic_height;
   int nvsb;
@@ -336,7 +620,9 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
   int refi;
   int i;
   int j;
+  int carry_models;
   od_mb_dec_ctx mbctx;
+  od_frame_dec_ctx fctx;
   if (dec == NULL || img == NULL || op == NULL) return OD_EFAULT;
   if (dec->packet_state != OD_PACKET_DATA) return OD_EINVAL;
   if (op->e_o_s) dec->packet_state = OD_PACKET_DONE;
@@ -344,6 +630,11 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
   /*Read the packet type bit.*/
   if (od_ec_decode_bool_q15(&dec->ec, 16384)) return OD_EBADPACKET;
   mbctx.is_keyframe = od_ec_decode_bool_q15(&dec->ec, 16384);
+  /*Read the bit that says whether an inter frame continues with the models
+     adapted by the previous frame.*/
+  carry_models = !mbctx.is_keyframe && od_ec_decode_bool_q15(&dec->ec, 16384);
+  fctx.dec = dec;
+  fctx.is_keyframe = mbctx.is_keyframe;
   /*Update the buffer state.*/
   if (dec->state.ref_imgi[OD_FRAME_SELF] >= 0) {
     dec->state.ref_imgi[OD_FRAME_PREV] =
@@ -401,6 +692,7 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
     nvmvbs = (dec->state.nvmbs + 1) << 2;
     img = dec->state.io_imgs + OD_FRAME_REC;
     mv_res = dec->state.mv_res = od_ec_dec_uint(&dec->ec, 3);
+    dec->state.multires_blend = od_ec_decode_bool_q15(&dec->ec, 16384);
     width = (img->width + 32) << (3 - mv_res);
     height = (img->height + 32) << (3 - mv_res);
     grid = dec->state.mv_grid;
@@ -433,19 +725,16 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
         }
       }
     }
-    od_state_mc_predict(&dec->state, OD_FRAME_PREV);
+    if (dec->threads != NULL) {
+      od_thread_pool_start(dec->threads, od_dec_mc_predict_rows, &fctx);
+      od_thread_pool_join(dec->threads);
+    }
+    else od_state_mc_predict(&dec->state, OD_FRAME_PREV);
   }
   frame_width = dec->state.frame_width;
-  frame_height = dec->state.frame_height;
   pic_width = dec->state.info.pic_width;
   pic_height = dec->state.info.pic_height;
   {
-    od_coeff *ctmp[OD_NPLANES_MAX];
-    od_coeff *dtmp[OD_NPLANES_MAX];
-    od_coeff *mctmp[OD_NPLANES_MAX];
-    od_coeff *mdtmp[OD_NPLANES_MAX];
-    od_coeff *ltmp[OD_NPLANES_MAX];
-    od_coeff *lbuf[OD_NPLANES_MAX];
     int xdec;
     int ydec;
     int nvmbs;
@@ -453,104 +742,55 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
     int mby;
     int mbx;
     int mi;
-    int h;
     int w;
-    int y;
-    int x;
     nhmbs = dec->state.nhmbs;
     nvmbs = dec->state.nvmbs;
     /*Initialize the data needed for each plane.*/
-    mbctx.modes = _ogg_calloc((frame_width >> 2)*(frame_height >> 2),
-     sizeof(*mbctx.modes));
+    fctx.bufs = &dec->bufs;
+    mbctx.modes = dec->bufs.modes;
     for (mi = 0; mi < OD_INTRA_NMODES; mi++) {
       mbctx.mode_p0[mi] = 32768/OD_INTRA_NMODES;
     }
     nplanes = dec->state.info.nplanes;
     /*Apply the prefilter to the motion-compensated reference.*/
     if (!mbctx.is_keyframe) {
-      for (pli = 0; pli < nplanes; pli++) {
-        xdec = dec->state.io_imgs[OD_FRAME_REC].planes[pli].xdec;
-        ydec = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ydec;
-        w = frame_width >> xdec;
-        h = frame_height >> ydec;
-        mctmp[pli] = _ogg_calloc(w*h, sizeof(*mctmp[pli]));
-        mdtmp[pli] = _ogg_calloc(w*h, sizeof(*mdtmp[pli]));
-        /*Collect the image data needed for this plane.*/
-        {
-          unsigned char *mdata;
-          int ystride;
-          mdata = dec->state.io_imgs[OD_FRAME_REC].planes[pli].data;
-          ystride = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
-          for (y=0;y<h;y++) {
-            for (x=0;x<w;x++) mctmp[pli][y*w+x]=mdata[ystride*y+x]-128;
-          }
-        }
-        /*Apply the prefilter across the entire image.*/
-        {
-          int sby;
-          int sbx;
-          /* This code assumes 4:4:4 or 4:2:0 input. */
-          OD_ASSERT(xdec==ydec);
-          /*Apply the prefilter down the bottom block edge columns.*/
-          for (sby = 0; sby < nvsb; sby++) {
-            for (sbx = 0; sbx < nhsb; sbx++) {
-              unsigned char btmp[6*6];
-              od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
-            }
-          }
-          /*Apply the prefilter across the right block edge rows.*/
-          for (sby = 0; sby < nvsb; sby++) {
-            for (sbx = 0; sbx < nhsb; sbx++) {
-              unsigned char btmp[6*6];
-              od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
-            }
-          }
+      if (dec->threads != NULL) {
+        od_thread_pool_start(dec->threads, od_dec_prefilter_planes, &fctx);
+        od_thread_pool_join(dec->threads);
+      }
+      else {
+        for (pli = 0; pli < nplanes; pli++) {
+          od_dec_prefilter_plane(&fctx, pli);
         }
       }
     }
     for (pli = 0; pli < nplanes; pli++) {
-      generic_model_init(mbctx.model_dc + pli);
-      generic_model_init(mbctx.model_g + pli);
-      generic_model_init(mbctx.model_ym + pli);
-      mbctx.ex_dc[pli] = pli > 0 ? 8 : 32768;
-      mbctx.ex_g[pli] = 8;
-      xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-      ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-      w = frame_width >> xdec;
-      h = frame_height >> ydec;
-      dec->scale[pli] = od_ec_dec_uint(&dec->ec, 512);
-      ctmp[pli] = _ogg_calloc(w*h, sizeof(*ctmp[pli]));
-      dtmp[pli] = _ogg_calloc(w*h, sizeof(*dtmp[pli]));
-      /*We predict chroma planes from the luma plane.
-        Since chroma can be subsampled, we cache subsampled versions of the
-         luma plane in the frequency domain.
-        We can share buffers with the same subsampling.*/
-      if (pli > 0) {
-        int plj;
-        if (xdec || ydec) {
-          for (plj = 1; plj < pli; plj++) {
-            if (xdec == dec->state.io_imgs[OD_FRAME_INPUT].planes[plj].xdec
-             && ydec == dec->state.io_imgs[OD_FRAME_INPUT].planes[plj].ydec) {
-              ltmp[pli] = NULL;
-              lbuf[pli] = ltmp[plj];
-            }
-          }
-          if (plj >= pli) {
-            lbuf[pli] = ltmp[pli] = _ogg_calloc(w*h, sizeof(*ltmp));
-          }
-        }
-        else{
-          ltmp[pli] = NULL;
-          lbuf[pli] = ctmp[pli];
-        }
+      if (carry_models) {
+        mbctx.model_dc[pli] = dec->model_dc[pli];
+        mbctx.model_g[pli] = dec->model_g[pli];
+        mbctx.model_ym[pli] = dec->model_ym[pli];
+        mbctx.ex_dc[pli] = dec->ex_dc[pli];
+        mbctx.ex_g[pli] = dec->ex_g[pli];
+      }
+      else {
+        generic_model_init(mbctx.model_dc + pli);
+        generic_model_init(mbctx.model_g + pli);
+        generic_model_init(mbctx.model_ym + pli);
+        mbctx.ex_dc[pli] = pli > 0 ? 8 : 32768;
+        mbctx.ex_g[pli] = 8;
       }
-      else lbuf[pli] = ltmp[pli] = NULL;
+      dec->scale[pli] = od_ec_dec_uint(&dec->ec, 512);
       od_adapt_row_init(&dec->state.adapt_row[pli]);
     }
+    /*Reconstruct the super block rows on the worker threads as we decode
+       them.
+      Without any worker threads, we reconstruct each row right after
+       decoding it.*/
+    od_row_sync_reset(&dec->mb_rows);
+    od_row_sync_reset(&dec->sb_rows);
+    if (dec->threads != NULL) {
+      od_thread_pool_start(dec->threads, od_dec_recon_sb_rows, &fctx);
+    }
     for (mby = 0; mby < nvmbs; mby++) {
       od_adapt_ctx adapt_hmean[OD_NPLANES_MAX];
       for (pli = 0; pli < nplanes; pli++) {
@@ -561,25 +801,22 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
           od_adapt_row_ctx *adapt_row;
           int by;
           int bx;
-          mbctx.c = ctmp[pli];
-          mbctx.d = dtmp[pli];
-          mbctx.mc = mctmp[pli];
-          mbctx.md = mdtmp[pli];
-          mbctx.l = lbuf[pli];
+          mbctx.d = fctx.bufs->dtmp[pli];
+          mbctx.md = fctx.bufs->mdtmp[pli];
+          mbctx.l = fctx.bufs->lbuf[pli];
           xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
           ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
           w = frame_width >> xdec;
-          h = frame_height >> ydec;
           /*Construct the luma predictors for chroma planes.*/
-          if (ltmp[pli] != NULL) {
+          if (fctx.bufs->ltmp[pli] != NULL) {
             OD_ASSERT(pli > 0);
-            OD_ASSERT(mbctx.l == ltmp[pli]);
+            OD_ASSERT(mbctx.l == fctx.bufs->ltmp[pli]);
             for (by = mby << (2 - ydec); by < (mby + 1) << (2 - ydec); by++) {
               for (bx = mbx << (2 - xdec); bx < (mbx + 1) << (2 - xdec);
                bx++) {
                 od_resample_luma_coeffs(mbctx.l + (by << 2)*w + (bx<<2), w,
-                 dtmp[0] + (by << (2 + ydec))*frame_width + (bx<<(2 + xdec)),
-                 frame_width, xdec, ydec, 4);
+                 fctx.bufs->dtmp[0] + (by << (2 + ydec))*frame_width
+                 + (bx<<(2 + xdec)), frame_width, xdec, ydec, 4);
               }
             }
           }
@@ -608,71 +845,27 @@ int daala_decode_packet_in(daala_dec_ctx *dec, od_img *img,
           }
           od_adapt_mb(adapt_row, mbx, &adapt_hmean[pli], &mbctx.adapt);
         }
+        od_row_sync_post(&dec->mb_rows, mby, mbx + 1);
       }
       for (pli = 0; pli < nplanes; pli++) {
         od_adapt_row(&dec->state.adapt_row[pli], &adapt_hmean[pli]);
       }
-    }
-    for (pli = 0; pli < nplanes; pli++) {
-      xdec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-      ydec = dec->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-      w = frame_width >> xdec;
-      h = frame_height >> ydec;
-      /*Apply the postfilter across the entire image.*/
-      {
-        int sby;
-        int sbx;
-        /* This code assumes 4:4:4 or 4:2:0 input. */
-        OD_ASSERT(xdec==ydec);
-        /*Apply the postfilter across the right block edge rows.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,1);
-          }
-        }
-        /*Apply the postfilter down the bottom block edge columns.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&dec->state.bsize[dec->state.bstride*(sby<<2)+(sbx<<2)],dec->state.bstride,xdec);
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,1);
-          }
-        }
-      }
-      {
-        unsigned char *data;
-        int ystride;
-        data = dec->state.io_imgs[OD_FRAME_REC].planes[pli].data;
-        ystride = dec->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
-        for (y=0;y<h;y++) {
-          for (x=0;x<w;x++) {
-            data[ystride*y+x]=OD_CLAMP255(ctmp[pli][y*w+x]+128);
-          }
-        }
-      }
-    }
-    for (pli = nplanes; pli-- > 0;) {
-      _ogg_free(ltmp[pli]);
-      _ogg_free(dtmp[pli]);
-      _ogg_free(ctmp[pli]);
-      if (!mbctx.is_keyframe) {
-        _ogg_free(mdtmp[pli]);
-        _ogg_free(mctmp[pli]);
+      if (dec->threads == NULL && (mby & 1)) {
+        od_dec_recon_sb_row(&fctx, mby >> 1);
       }
     }
-    _ogg_free(mbctx.modes);
+    if (dec->threads != NULL) od_thread_pool_join(dec->threads);
+    /*Save the adapted models for the next frame.*/
+    memcpy(dec->model_dc, mbctx.model_dc, sizeof(dec->model_dc));
+    memcpy(dec->model_g, mbctx.model_g, sizeof(dec->model_g));
+    memcpy(dec->model_ym, mbctx.model_ym, sizeof(dec->model_ym));
+    memcpy(dec->ex_dc, mbctx.ex_dc, sizeof(dec->ex_dc));
+    memcpy(dec->ex_g, mbctx.ex_g, sizeof(dec->ex_g));
   }
 #if defined(OD_DUMP_IMAGES)
   /*Dump YUV*/
   od_state_dump_yuv(&dec->state, dec->state.io_imgs + OD_FRAME_REC, "decout");
 #endif
-  od_state_upsample8(&dec->state,
-   dec->state.ref_imgs + dec->state.ref_imgi[OD_FRAME_SELF],
-   dec->state.io_imgs + OD_FRAME_REC);
   /*Return decoded frame.*/
   *img = dec->state.io_imgs[OD_FRAME_REC];
   img->width = dec->state.info.pic_width;
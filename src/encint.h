@@ -28,9 +28,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 # include "../include/daala/daalaenc.h"
 # include "state.h"
 # include "entenc.h"
+# include "thread.h"
+# include "block_size_enc.h"
+# include "generic_code.h"
+# include "ratectrl.h"
+# include "lookahead.h"
 
 typedef struct daala_enc_ctx od_enc_ctx;
 typedef struct od_mv_est_ctx od_mv_est_ctx;
+typedef struct od_4x4_syms od_4x4_syms;
 
 /*Constants for the packet state machine specific to the encoder.*/
 /*No packet currently ready to output.*/
@@ -40,17 +46,63 @@ typedef struct od_mv_est_ctx od_mv_est_ctx;
 /*The number of fractional bits of precision in our \lambda values.*/
 #define OD_LAMBDA_SCALE       (5)
 
+/*The quantized symbols of a single 4x4 block.
+  These are produced by the analysis stage, which may run on several threads
+   at once, and consumed in raster order by the entropy coding stage.*/
+struct od_4x4_syms{
+#ifdef OD_LOLOSSLESS
+  od_coeff backup[4*4];
+#endif
+  int dc;
+  int dc_sgn;
+  int qg;
+  od_coeff y[15];
+};
+
 struct daala_enc_ctx{
   od_state state;
   oggbyte_buffer obb;
   od_ec_enc ec;
   int packet_state;
   int scale;
+  /*Whether to use the fixed-point PVQ quantizer.*/
+  int fixed_pvq;
+  /*Whether inter frames start from the generic coder models adapted by the
+     previous frame instead of the initial ones (see OD_SET_CARRY_MODELS).*/
+  int carry_models;
+  /*The generic coder models and expectations at the end of the last frame.*/
+  GenericEncoder model_dc[OD_NPLANES_MAX];
+  GenericEncoder model_g[OD_NPLANES_MAX];
+  GenericEncoder model_ym[OD_NPLANES_MAX];
+  int ex_dc[OD_NPLANES_MAX];
+  int ex_g[OD_NPLANES_MAX];
   od_mv_est_ctx *mvest;
+  od_rc_state rc;
+  /*The frames waiting to be coded (see OD_SET_LOOKAHEAD).*/
+  od_lookahead la;
+  daala_enc_stats stats;
+  /*The worker threads used to analyze rows of macro blocks, or NULL to do
+     everything on the calling thread.*/
+  od_thread_pool *threads;
+  /*The number of macro blocks in each row that have been quantized.*/
+  od_row_sync mb_rows;
+  /*The lapping filter progress of each row of super blocks: 1 once it is
+     prefiltered, 2 once its right edges are postfiltered, and 3 once its
+     bottom edges are postfiltered and it has been copied to the
+     reconstructed image.*/
+  od_row_sync sb_rows;
+  /*Scratch space for coding a frame, allocated once when the encoder is
+     created.*/
+  od_frame_bufs bufs;
+  od_4x4_syms *syms[OD_NPLANES_MAX];
+  BlockSizeComp *bs;
+  /*The luma variances used to pick the block sizes.*/
+  BlockStatsFrame bstats;
 };
 
 od_mv_est_ctx *od_mv_est_alloc(od_enc_ctx *enc);
 void od_mv_est_free(od_mv_est_ctx *est);
+int od_mv_est_set_speed(od_mv_est_ctx *est, int speed);
 void od_mv_est(od_mv_est_ctx *est, int ref, int lambda);
 
 #endif
@@ -43,10 +43,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 # include "decint.h"
 #endif
 
-static double mode_bits = 0;
-static double mode_count = 0;
+static void od_enc_clear(od_enc_ctx *enc) {
+  int pli;
+  od_thread_pool_free(enc->threads);
+  _ogg_free(enc->bs);
+  od_block_stats_frame_clear(&enc->bstats);
+  for (pli = 0; pli < enc->state.info.nplanes; pli++) {
+    _ogg_free(enc->syms[pli]);
+  }
+  od_frame_bufs_clear(&enc->bufs);
+  od_row_sync_clear(&enc->sb_rows);
+  od_row_sync_clear(&enc->mb_rows);
+  od_mv_est_free(enc->mvest);
+  od_la_clear(&enc->la);
+  od_rc_clear(&enc->rc);
+  od_ec_enc_clear(&enc->ec);
+  oggbyte_writeclear(&enc->obb);
+  od_state_clear(&enc->state);
+}
 
 static int od_enc_init(od_enc_ctx *enc, const daala_info *info) {
+  int pli;
   int ret;
   ret = od_state_init(&enc->state, info);
   if (ret < 0) return ret;
@@ -54,17 +71,65 @@ static int od_enc_init(od_enc_ctx *enc, const daala_info *info) {
   od_ec_enc_init(&enc->ec, 65025);
   enc->packet_state = OD_PACKET_INFO_HDR;
   enc->scale = 10;
+  enc->fixed_pvq = 0;
+  enc->carry_models = 0;
+  od_rc_init(&enc->rc, info);
+  od_la_init(&enc->la, &enc->state);
   enc->mvest = od_mv_est_alloc(enc);
+  memset(&enc->stats, 0, sizeof(enc->stats));
+  enc->threads = NULL;
+  memset(enc->syms, 0, sizeof(enc->syms));
+  enc->bs = NULL;
+  memset(&enc->bstats, 0, sizeof(enc->bstats));
+  ret = od_row_sync_init(&enc->mb_rows, enc->state.nvmbs);
+  if (ret < 0) {
+    od_mv_est_free(enc->mvest);
+    od_ec_enc_clear(&enc->ec);
+    oggbyte_writeclear(&enc->obb);
+    od_state_clear(&enc->state);
+    return ret;
+  }
+  ret = od_row_sync_init(&enc->sb_rows, enc->state.nvsb);
+  if (ret < 0) {
+    od_row_sync_clear(&enc->mb_rows);
+    od_mv_est_free(enc->mvest);
+    od_ec_enc_clear(&enc->ec);
+    oggbyte_writeclear(&enc->obb);
+    od_state_clear(&enc->state);
+    return ret;
+  }
+  ret = od_frame_bufs_init(&enc->bufs, &enc->state);
+  if (ret < 0) {
+    od_row_sync_clear(&enc->sb_rows);
+    od_row_sync_clear(&enc->mb_rows);
+    od_mv_est_free(enc->mvest);
+    od_ec_enc_clear(&enc->ec);
+    oggbyte_writeclear(&enc->obb);
+    od_state_clear(&enc->state);
+    return ret;
+  }
+  for (pli = 0; pli < info->nplanes; pli++) {
+    enc->syms[pli] = (od_4x4_syms *)_ogg_malloc(
+     (enc->state.frame_width >> (info->plane_info[pli].xdec + 2))*
+     (enc->state.frame_height >> (info->plane_info[pli].ydec + 2))*
+     sizeof(*enc->syms[pli]));
+  }
+  enc->bs = (BlockSizeComp *)_ogg_malloc(sizeof(*enc->bs));
+  if (enc->bs == NULL) ret = OD_EFAULT;
+  if (od_block_stats_frame_init(&enc->bstats,
+   enc->state.nhsb, enc->state.nvsb) < 0) {
+    ret = OD_EFAULT;
+  }
+  for (pli = 0; pli < info->nplanes; pli++) {
+    if (enc->syms[pli] == NULL) ret = OD_EFAULT;
+  }
+  if (ret < 0) {
+    od_enc_clear(enc);
+    return ret;
+  }
   return 0;
 }
 
-static void od_enc_clear(od_enc_ctx *enc) {
-  od_mv_est_free(enc->mvest);
-  od_ec_enc_clear(&enc->ec);
-  oggbyte_writeclear(&enc->obb);
-  od_state_clear(&enc->state);
-}
-
 daala_enc_ctx *daala_encode_create(const daala_info *info) {
   od_enc_ctx *enc;
   if (info == NULL) return NULL;
@@ -95,6 +160,106 @@ int daala_encode_ctl(daala_enc_ctx *enc, int req, void *buf, size_t buf_sz) {
       enc->scale = *(int*)buf;
       return OD_SUCCESS;
     }
+    case OD_SET_THREADS:
+    {
+      int nthreads;
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(nthreads));
+      nthreads = *(int*)buf;
+      if (nthreads < 1) return OD_EINVAL;
+      od_thread_pool_free(enc->threads);
+      enc->threads = NULL;
+      if (nthreads > 1) {
+#if defined(OD_ENABLE_THREADS)
+        enc->threads = od_thread_pool_alloc(nthreads);
+        if (enc->threads == NULL) return OD_EFAULT;
+#else
+        return OD_EIMPL;
+#endif
+      }
+      return OD_SUCCESS;
+    }
+    case OD_GET_STATS:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(enc->stats));
+      memcpy(buf, &enc->stats, sizeof(enc->stats));
+      return OD_SUCCESS;
+    }
+    case OD_SET_FIXED_PVQ:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(enc->fixed_pvq));
+      enc->fixed_pvq = *(int*)buf != 0;
+      return OD_SUCCESS;
+    }
+    case OD_SET_CARRY_MODELS:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(enc->carry_models));
+      enc->carry_models = *(int*)buf != 0;
+      return OD_SUCCESS;
+    }
+    case OD_SET_MULTIRES_BLEND:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      enc->state.multires_blend = *(int*)buf != 0;
+      return OD_SUCCESS;
+    }
+    case OD_SET_SPEED:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      return od_mv_est_set_speed(enc->mvest, *(int*)buf);
+    }
+    case OD_SET_BITRATE:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      return od_rc_set_bitrate(&enc->rc, *(int*)buf);
+    }
+    case OD_SET_RATE_MODE:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      return od_rc_set_mode(&enc->rc, *(int*)buf);
+    }
+    case OD_SET_RATE_BUFFER:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      return od_rc_set_buffer(&enc->rc, *(int*)buf);
+    }
+    case OD_2PASS_OUT:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(unsigned char *));
+      return od_rc_2pass_out(&enc->rc, (unsigned char **)buf);
+    }
+    case OD_SET_LOOKAHEAD:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      OD_ASSERT(buf_sz == sizeof(int));
+      return od_la_set_depth(&enc->la, *(int*)buf);
+    }
+    case OD_2PASS_IN:
+    {
+      OD_ASSERT(enc);
+      OD_ASSERT(buf);
+      return od_rc_2pass_in(&enc->rc, (const unsigned char *)buf, buf_sz);
+    }
     default:return OD_EIMPL;
   }
 }
@@ -198,17 +363,31 @@ static void od_img_plane_edge_ext8(od_img_plane *dst_p,
 }
 
 
-struct od_mb_enc_ctx {
-  GenericEncoder model_dc[OD_NPLANES_MAX];
-  GenericEncoder model_g[OD_NPLANES_MAX];
-  GenericEncoder model_ym[OD_NPLANES_MAX];
-  od_adapt_ctx adapt;
+/*The analysis state of a single thread.*/
+struct od_mb_quant_ctx {
   signed char *modes;
   od_coeff *c;
   od_coeff *d;
   od_coeff *md;
   od_coeff *mc;
   od_coeff *l;
+  od_4x4_syms *syms;
+  int is_keyframe;
+  /*The mode probabilities used for the intra mode search.
+    These are reset at the start of each row of macro blocks, so that the
+     decisions made do not depend on how the rows are split among threads.*/
+  ogg_uint16_t mode_p0[OD_INTRA_NMODES];
+};
+typedef struct od_mb_quant_ctx od_mb_quant_ctx;
+
+/*The entropy coding state, which is only used by the calling thread.*/
+struct od_mb_enc_ctx {
+  GenericEncoder model_dc[OD_NPLANES_MAX];
+  GenericEncoder model_g[OD_NPLANES_MAX];
+  GenericEncoder model_ym[OD_NPLANES_MAX];
+  od_adapt_ctx adapt;
+  signed char *modes;
+  od_4x4_syms *syms;
   int ex_dc[OD_NPLANES_MAX];
   int ex_g[OD_NPLANES_MAX];
   int is_keyframe;
@@ -222,8 +401,16 @@ struct od_mb_enc_ctx {
 };
 typedef struct od_mb_enc_ctx od_mb_enc_ctx;
 
-void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
- int bx, int by) {
+/*The per-frame state shared by all the analysis threads.*/
+struct od_frame_quant_ctx {
+  daala_enc_ctx *enc;
+  od_frame_bufs *bufs;
+  int is_keyframe;
+};
+typedef struct od_frame_quant_ctx od_frame_quant_ctx;
+
+static void od_4x4_quantize(daala_enc_ctx *enc, od_mb_quant_ctx *ctx,
+ int pli, int bx, int by) {
   int xdec;
   int ydec;
   int w;
@@ -234,6 +421,7 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
   od_coeff *md;
   od_coeff *mc;
   od_coeff *l;
+  od_4x4_syms *syms;
   int x;
   int y;
   od_coeff pred[4*4];
@@ -243,7 +431,6 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
   int qg;
   int cblock[4*4];
   int zzi;
-  int vk;
 #ifdef OD_LOLOSSLESS
   od_coeff backup[4*4];
 #endif
@@ -257,12 +444,12 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
   md = ctx->md;
   mc = ctx->mc;
   l = ctx->l;
-  vk = 0;
+  syms = ctx->syms + by*(w >> 2) + bx;
   /*fDCT a 4x4 block.*/
-  od_bin_fdct4x4(d + (by << 2)*w + (bx << 2), w,
+  (*enc->state.opt_vtbl.fdct_2d[0])(d + (by << 2)*w + (bx << 2), w,
    c + (by << 2)*w + (bx << 2), w);
   if (!ctx->is_keyframe) {
-    od_bin_fdct4x4(md + (by << 2)*w + (bx << 2), w,
+    (*enc->state.opt_vtbl.fdct_2d[0])(md + (by << 2)*w + (bx << 2), w,
      mc + (by << 2)*w + (bx << 2), w);
   }
   for (zzi = 0; zzi < 16; zzi++) pvq_scale[zzi] = 0;
@@ -297,17 +484,12 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
         m_u = modes[(by - 1)*(w >> 2) + bx];
         od_intra_pred_cdf(mode_cdf, OD_INTRA_PRED_PROB_4x4[pli],
          ctx->mode_p0, OD_INTRA_NMODES, m_l, m_ul, m_u);
-        od_intra_pred4x4_dist(mode_dist,
+        (*enc->state.opt_vtbl.intra_dist[0])(mode_dist,
          d + (by << 2)*w + (bx << 2), w, coeffs, strides, pli);
         /*Lambda = 1*/
         mode = od_intra_pred_search(mode_cdf, mode_dist,
          OD_INTRA_NMODES, 128);
-        od_intra_pred4x4_get(pred, coeffs, strides, mode);
-        od_ec_encode_cdf_unscaled(&enc->ec, mode, mode_cdf, OD_INTRA_NMODES);
-        mode_bits -= M_LOG2E*log(
-         (mode_cdf[mode] - (mode == 0 ? 0 : mode_cdf[mode - 1]))/
-         (float)mode_cdf[OD_INTRA_NMODES - 1]);
-        mode_count++;
+        (*enc->state.opt_vtbl.intra_get[0])(pred, coeffs, strides, mode);
         modes[by*(w >> 2) + bx] = mode;
         od_intra_pred_update(ctx->mode_p0, OD_INTRA_NMODES, mode, m_l, m_ul,
          m_u);
@@ -369,33 +551,124 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
     backup[zzi] = cblock[zzi] + 32768;
     OD_ASSERT(backup[zzi] >= 0);
     OD_ASSERT(backup[zzi] < 65535);
-    od_ec_enc_uint(&enc->ec, backup[zzi], 65536);
+    syms->backup[zzi] = backup[zzi];
   }
 #endif
   sgn = (cblock[0] - predt[0]) < 0;
   cblock[0] = (int)floor(pow(fabs(cblock[0] - predt[0])/enc->scale,0.75));
-  generic_encode(&enc->ec, ctx->model_dc + pli, cblock[0],
-   ctx->ex_dc + pli, 0);
-  if (cblock[0]) od_ec_enc_bits(&enc->ec, sgn, 1);
+  syms->dc = cblock[0];
+  syms->dc_sgn = sgn;
   cblock[0] = (int)(pow(cblock[0], 4.0/3)*enc->scale);
   cblock[0] *= sgn ? -1 : 1;
   cblock[0] += predt[0];
-  quant_pvq(cblock + 1, predt + 1, pvq_scale, pred + 1, 15, enc->scale, &qg);
+  if (enc->fixed_pvq) {
+    quant_pvq_fixed(cblock + 1, predt + 1, pvq_scale, pred + 1, 15,
+     enc->scale, &qg);
+  }
+  else {
+    quant_pvq(cblock + 1, predt + 1, pvq_scale, pred + 1, 15, enc->scale,
+     &qg);
+  }
   for (zzi = 1; zzi < 16; zzi++) cblock[zzi] = pred[zzi];
   dequant_pvq(cblock + 1, predt + 1, pvq_scale, 15, enc->scale, qg);
-  generic_encode(&enc->ec, ctx->model_g + pli, abs(qg),
+  syms->qg = qg;
+  for (zzi = 0; zzi < 15; zzi++) syms->y[zzi] = pred[zzi + 1];
+#ifdef OD_LOLOSSLESS
+  for (zzi = 0; zzi < 16; zzi++) {
+    cblock[zzi] = backup[zzi] - 32768;
+  }
+#endif
+  /*Dequantize*/
+  for (y = 0; y < 4; y++) {
+    for (x = 0; x < 4; x++) {
+      d[((by << 2) + y)*w + (bx << 2) + x] = cblock[OD_ZIG4[y*4 + x]];
+    }
+  }
+  /*iDCT the 4x4 block.*/
+  (*enc->state.opt_vtbl.idct_2d[0])(c + (by << 2)*w + (bx << 2), w,
+   d + (by << 2)*w + (bx << 2), w);
+}
+
+static void od_b8_quantize(daala_enc_ctx *enc, od_mb_quant_ctx *ctx, int pli,
+ int bx, int by) {
+  int xdec;
+  int ydec;
+  xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+  ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+  bx<<=1;
+  by<<=1;
+  od_4x4_quantize(enc, ctx, pli, bx >> xdec, by >> ydec);
+  if (!xdec) od_4x4_quantize(enc, ctx, pli, (bx + 1) >> xdec, by >> ydec);
+  if (!ydec) od_4x4_quantize(enc, ctx, pli, bx >> xdec, (by + 1) >> ydec);
+  if (!xdec || !ydec) od_4x4_quantize(enc, ctx, pli, (bx + 1) >> xdec,
+   (by + 1) >> ydec);
+}
+
+static void od_mb_quantize(daala_enc_ctx *enc, od_mb_quant_ctx *ctx, int pli,
+ int mbx, int mby) {
+  int bx;
+  int by;
+  for (by = mby << 1; by < (mby + 1) << 1; by++) {
+    for (bx = mbx << 1; bx < (mbx + 1) << 1; bx++) {
+      od_b8_quantize(enc, ctx, pli, bx, by);
+    }
+  }
+}
+
+static void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
+ int bx, int by) {
+  int xdec;
+  int w;
+  od_4x4_syms *syms;
+  int zzi;
+  int vk;
+  xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+  w = enc->state.frame_width >> xdec;
+  syms = ctx->syms + by*(w >> 2) + bx;
+  if (ctx->is_keyframe && bx > 0 && by > 0 && pli == 0) {
+    ogg_uint16_t mode_cdf[OD_INTRA_NMODES];
+    signed char *modes;
+    int m_l;
+    int m_ul;
+    int m_u;
+    int mode;
+    modes = ctx->modes;
+    m_l = modes[by*(w >> 2) + bx - 1];
+    m_ul = modes[(by - 1)*(w >> 2) + bx - 1];
+    m_u = modes[(by - 1)*(w >> 2) + bx];
+    mode = modes[by*(w >> 2) + bx];
+    od_intra_pred_cdf(mode_cdf, OD_INTRA_PRED_PROB_4x4[pli],
+     ctx->mode_p0, OD_INTRA_NMODES, m_l, m_ul, m_u);
+    od_ec_encode_cdf_unscaled(&enc->ec, mode, mode_cdf, OD_INTRA_NMODES);
+    enc->stats.intra_mode_bits -= M_LOG2E*log(
+     (mode_cdf[mode] - (mode == 0 ? 0 : mode_cdf[mode - 1]))/
+     (float)mode_cdf[OD_INTRA_NMODES - 1]);
+    enc->stats.intra_mode_count++;
+    od_intra_pred_update(ctx->mode_p0, OD_INTRA_NMODES, mode, m_l, m_ul,
+     m_u);
+  }
+#ifdef OD_LOLOSSLESS
+  for (zzi = 0; zzi < 16; zzi++) {
+    od_ec_enc_uint(&enc->ec, syms->backup[zzi], 65536);
+  }
+#endif
+  generic_encode(&enc->ec, ctx->model_dc + pli, syms->dc,
+   ctx->ex_dc + pli, 0);
+  if (syms->dc) od_ec_enc_bits(&enc->ec, syms->dc_sgn, 1);
+  generic_encode(&enc->ec, ctx->model_g + pli, abs(syms->qg),
    ctx->ex_g + pli, 0);
-  if (qg) od_ec_enc_bits(&enc->ec, qg < 0, 1);
+  if (syms->qg) od_ec_enc_bits(&enc->ec, syms->qg < 0, 1);
   vk = 0;
-  for (zzi = 0; zzi < 15; zzi++) vk += abs(pred[zzi + 1]);
+  for (zzi = 0; zzi < 15; zzi++) vk += abs(syms->y[zzi]);
   /*No need to code vk because we can get it from qg.*/
   /*Expectation is that half the pulses will go in y[m].*/
   if (vk != 0) {
     int ex_ym;
     ex_ym = (65536/2)*vk;
-    generic_encode(&enc->ec, &ctx->model_ym[pli], vk - pred[1], &ex_ym, 0);
+    generic_encode(&enc->ec, &ctx->model_ym[pli], vk - syms->y[0], &ex_ym,
+     0);
   }
-  pvq_encoder(&enc->ec, pred + 2, 14, vk - abs(pred[1]), &ctx->adapt);
+  pvq_encoder(&enc->ec, syms->y + 1, 14, vk - abs(syms->y[0]), &ctx->adapt);
   if (ctx->adapt.curr[OD_ADAPT_K_Q8] >= 0) {
     ctx->nk++;
     ctx->k_total += ctx->adapt.curr[OD_ADAPT_K_Q8];
@@ -406,23 +679,9 @@ void od_4x4_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
     ctx->count_total_q8 += ctx->adapt.curr[OD_ADAPT_COUNT_Q8];
     ctx->count_ex_total_q8 += ctx->adapt.curr[OD_ADAPT_COUNT_EX_Q8];
   }
-#ifdef OD_LOLOSSLESS
-  for (zzi = 0; zzi < 16; zzi++) {
-    cblock[zzi] = backup[zzi] - 32768;
-  }
-#endif
-  /*Dequantize*/
-  for (y = 0; y < 4; y++) {
-    for (x = 0; x < 4; x++) {
-      d[((by << 2) + y)*w + (bx << 2) + x] = cblock[OD_ZIG4[y*4 + x]];
-    }
-  }
-  /*iDCT the 4x4 block.*/
-  od_bin_idct4x4(c + (by << 2)*w + (bx << 2), w, d + (by << 2)*w
-   + (bx << 2), w);
 }
 
-void od_b8_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
+static void od_b8_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
  int bx, int by) {
   int xdec;
   int ydec;
@@ -437,7 +696,7 @@ void od_b8_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
    (by + 1) >> ydec);
 }
 
-void od_mb_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
+static void od_mb_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
  int mbx, int mby) {
   int bx;
   int by;
@@ -448,6 +707,279 @@ void od_mb_encode(daala_enc_ctx *enc, od_mb_enc_ctx *ctx, int pli,
   }
 }
 
+/*Copies one row of super blocks of the input image (and the
+   motion-compensated reference, if there is one) into the coefficient
+   buffers.*/
+static void od_enc_collect_sb_row(od_frame_quant_ctx *fctx, int sby) {
+  daala_enc_ctx *enc;
+  int nplanes;
+  int pli;
+  enc = fctx->enc;
+  nplanes = enc->state.info.nplanes;
+  for (pli = 0; pli < nplanes; pli++) {
+    unsigned char *data;
+    unsigned char *mdata;
+    od_coeff *ctmp;
+    od_coeff *mctmp;
+    int ystride;
+    int mystride;
+    int xdec;
+    int ydec;
+    int w;
+    int y;
+    int x;
+    xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = enc->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    mctmp = fctx->bufs->mctmp[pli];
+    data = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].data;
+    ystride = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ystride;
+    mdata = enc->state.io_imgs[OD_FRAME_REC].planes[pli].data;
+    mystride = enc->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
+    for (y = sby << (5 - ydec); y < (sby + 1) << (5 - ydec); y++) {
+      for (x = 0; x < w; x++) ctmp[y*w + x] = data[ystride*y + x] - 128;
+      if (!fctx->is_keyframe) {
+        for (x = 0; x < w; x++) mctmp[y*w + x] = mdata[mystride*y + x] - 128;
+      }
+    }
+  }
+}
+
+/*Applies the prefilter to one row of super blocks.
+  The bottom edge filters reach into the next row, so that row is collected
+   here, and the right edge filters must wait until the bottom edges of the
+   row above have been filtered.
+  Neither touches any row that is being quantized, so this can run ahead of
+   the rows above.*/
+static void od_enc_prefilter_sb_row(od_frame_quant_ctx *fctx, int sby) {
+  daala_enc_ctx *enc;
+  int nplanes;
+  int nhsb;
+  int nvsb;
+  int pli;
+  enc = fctx->enc;
+  nplanes = enc->state.info.nplanes;
+  nhsb = enc->state.nhsb;
+  nvsb = enc->state.nvsb;
+  od_row_sync_wait(&enc->sb_rows, sby - 1, 1);
+  if (sby == 0) od_enc_collect_sb_row(fctx, sby);
+  if (sby + 1 < nvsb) od_enc_collect_sb_row(fctx, sby + 1);
+  for (pli = 0; pli < nplanes; pli++) {
+    od_coeff *ctmp;
+    od_coeff *mctmp;
+    int xdec;
+    int ydec;
+    int sbx;
+    int w;
+    xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = enc->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    mctmp = fctx->bufs->mctmp[pli];
+    /* This code assumes 4:4:4 or 4:2:0 input. */
+    OD_ASSERT(xdec==ydec);
+    /*Apply the prefilter down the bottom block edge columns.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
+      od_apply_filter(&enc->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
+      if (!fctx->is_keyframe) {
+        od_apply_filter(&enc->state.opt_vtbl.filter,
+         &mctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+         &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
+      }
+    }
+    /*Apply the prefilter across the right block edge rows.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
+      od_apply_filter(&enc->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
+      if (!fctx->is_keyframe) {
+        od_apply_filter(&enc->state.opt_vtbl.filter,
+         &mctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+         &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
+      }
+    }
+  }
+  od_row_sync_post(&enc->sb_rows, sby, 1);
+}
+
+/*Applies the postfilter to the bottom edges of one row of super blocks and
+   copies the finished row to the reconstructed image.
+  This requires the right edges of this row and the next one to have been
+   filtered, and the row above to have been finished.*/
+static void od_enc_finish_sb_row(od_frame_quant_ctx *fctx, int sby) {
+  daala_enc_ctx *enc;
+  int nplanes;
+  int nhsb;
+  int nvsb;
+  int pli;
+  enc = fctx->enc;
+  nplanes = enc->state.info.nplanes;
+  nhsb = enc->state.nhsb;
+  nvsb = enc->state.nvsb;
+  od_row_sync_wait(&enc->sb_rows, sby - 1, 3);
+  for (pli = 0; pli < nplanes; pli++) {
+    unsigned char *data;
+    od_coeff *ctmp;
+    int ystride;
+    int xdec;
+    int ydec;
+    int sbx;
+    int w;
+    int y;
+    int x;
+    xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = enc->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    /*Apply the postfilter down the bottom block edge columns.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
+      od_apply_filter(&enc->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,1);
+    }
+    /*No later filter touches this row, so it can be output.
+      Its motion-compensated reference was collected before this row was
+       quantized, so it is safe to overwrite.*/
+    data = enc->state.io_imgs[OD_FRAME_REC].planes[pli].data;
+    ystride = enc->state.io_imgs[OD_FRAME_REC].planes[pli].ystride;
+    for (y = sby << (5 - ydec); y < (sby + 1) << (5 - ydec); y++) {
+      for (x = 0; x < w; x++) {
+        data[ystride*y+x]=OD_CLAMP255(ctmp[y*w+x]+128);
+      }
+    }
+  }
+  /*Upsample the rows of the reference frame that are now final, while
+     the rest of the frame is still being coded.*/
+  od_state_store_ref8_sb_row(&enc->state,
+   enc->state.ref_imgi[OD_FRAME_SELF], sby);
+  od_row_sync_post(&enc->sb_rows, sby, 3);
+}
+
+/*Applies the postfilter to the right edges of one row of super blocks once
+   it has been completely quantized, and then finishes the row above it.*/
+static void od_enc_postfilter_sb_row(od_frame_quant_ctx *fctx, int sby) {
+  daala_enc_ctx *enc;
+  int nplanes;
+  int nhsb;
+  int pli;
+  enc = fctx->enc;
+  nplanes = enc->state.info.nplanes;
+  nhsb = enc->state.nhsb;
+  for (pli = 0; pli < nplanes; pli++) {
+    od_coeff *ctmp;
+    int xdec;
+    int ydec;
+    int sbx;
+    int w;
+    xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+    ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+    w = enc->state.frame_width >> xdec;
+    ctmp = fctx->bufs->ctmp[pli];
+    /*Apply the postfilter across the right block edge rows.*/
+    for (sbx = 0; sbx < nhsb; sbx++) {
+      unsigned char btmp[6*6];
+      od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
+      od_apply_filter(&enc->state.opt_vtbl.filter,
+       &ctmp[(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
+       &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,1);
+    }
+  }
+  od_row_sync_post(&enc->sb_rows, sby, 2);
+  if (sby > 0) {
+    od_row_sync_wait(&enc->sb_rows, sby - 1, 2);
+    od_enc_finish_sb_row(fctx, sby - 1);
+  }
+  if (sby == enc->state.nvsb - 1) od_enc_finish_sb_row(fctx, sby);
+}
+
+/*Quantizes one row of macro blocks in every plane.
+  Each macro block depends on the reconstructed coefficients of the blocks
+   to its left and above it, so we wait for enough of the previous row to
+   finish first, and report our own progress as we go.
+  The first row of each super block row also prefilters it, and the second
+   postfilters it once it is done, so that each row of super blocks goes
+   through the whole pipeline while it is still in cache.*/
+static void od_quantize_mb_row(od_frame_quant_ctx *fctx, int mby) {
+  daala_enc_ctx *enc;
+  od_mb_quant_ctx qctx;
+  int nplanes;
+  int nhmbs;
+  int frame_width;
+  int mbx;
+  int mi;
+  enc = fctx->enc;
+  nplanes = enc->state.info.nplanes;
+  nhmbs = enc->state.nhmbs;
+  frame_width = enc->state.frame_width;
+  qctx.modes = fctx->bufs->modes;
+  qctx.is_keyframe = fctx->is_keyframe;
+  for (mi = 0; mi < OD_INTRA_NMODES; mi++) {
+    qctx.mode_p0[mi] = 32768/OD_INTRA_NMODES;
+  }
+  if (!(mby & 1)) od_enc_prefilter_sb_row(fctx, mby >> 1);
+  for (mbx = 0; mbx < nhmbs; mbx++) {
+    int pli;
+    /*The up-right neighbor is not used yet, but we keep the usual wavefront
+       lag of two macro blocks so that it can be.*/
+    od_row_sync_wait(&enc->mb_rows, mby - 1, OD_MINI(mbx + 2, nhmbs));
+    for (pli = 0; pli < nplanes; pli++) {
+      int xdec;
+      int ydec;
+      int w;
+      int by;
+      int bx;
+      qctx.c = fctx->bufs->ctmp[pli];
+      qctx.d = fctx->bufs->dtmp[pli];
+      qctx.mc = fctx->bufs->mctmp[pli];
+      qctx.md = fctx->bufs->mdtmp[pli];
+      qctx.l = fctx->bufs->lbuf[pli];
+      qctx.syms = enc->syms[pli];
+      xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
+      ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
+      w = frame_width >> xdec;
+      /*Construct the luma predictors for chroma planes.*/
+      if (fctx->bufs->ltmp[pli] != NULL) {
+        OD_ASSERT(pli > 0);
+        OD_ASSERT(qctx.l == fctx->bufs->ltmp[pli]);
+        for (by = mby << (2 - ydec); by < (mby + 1) << (2 - ydec); by++) {
+          for (bx = mbx << (2 - xdec); bx < (mbx + 1) << (2 - xdec); bx++) {
+            od_resample_luma_coeffs(qctx.l + (by << 2)*w + (bx<<2), w,
+             fctx->bufs->dtmp[0] + (by << (2 + ydec))*frame_width
+             + (bx<<(2 + xdec)), frame_width, xdec, ydec, 4);
+          }
+        }
+      }
+      od_mb_quantize(enc, &qctx, pli, mbx, mby);
+    }
+    od_row_sync_post(&enc->mb_rows, mby, mbx + 1);
+  }
+  if (mby & 1) od_enc_postfilter_sb_row(fctx, mby >> 1);
+}
+
+/*The job run by each analysis thread: every nthreads'th row of macro blocks,
+   starting with row _ti.*/
+static void od_quantize_mb_rows(void *_ctx, int _ti) {
+  od_frame_quant_ctx *fctx;
+  int nthreads;
+  int nvmbs;
+  int mby;
+  fctx = (od_frame_quant_ctx *)_ctx;
+  nthreads = od_thread_pool_nthreads(fctx->enc->threads);
+  nvmbs = fctx->enc->state.nvmbs;
+  for (mby = _ti; mby < nvmbs; mby += nthreads) {
+    od_quantize_mb_row(fctx, mby);
+  }
+}
+
 static void od_encode_mv(daala_enc_ctx *enc, od_mv_grid_pt *mvg,
  int mv_res, int width, int height) {
   int ox;
@@ -461,7 +993,11 @@ static void od_encode_mv(daala_enc_ctx *enc, od_mv_grid_pt *mvg,
   laplace_encode(&enc->ec, oy, 569 >> mv_res, height << 1);
 }
 
-int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
+/*Codes a single frame.
+  If nplan > 0, plan holds the types and costs the lookahead planned for this
+   frame and the nplan - 1 frames after it.*/
+static int od_encode_frame(daala_enc_ctx *enc, od_img *img, int duration,
+ int is_keyframe, const od_la_plan *plan, int nplan) {
   int refi;
   int nplanes;
   int pli;
@@ -473,40 +1009,24 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
   int j;
   int k;
   int m;
-  BlockSizeComp *bs;
   int nhsb;
   int nvsb;
   od_mb_enc_ctx mbctx;
-  if (enc == NULL || img == NULL) return OD_EFAULT;
-  if (enc->packet_state == OD_PACKET_DONE) return OD_EINVAL;
-  /*Check the input image dimensions to make sure they're compatible with the
-     declared video size.*/
   nplanes = enc->state.info.nplanes;
-  if (img->nplanes != nplanes) return OD_EINVAL;
-  for (pli = 0; pli < nplanes; pli++) {
-    if (img->planes[pli].xdec != enc->state.info.plane_info[pli].xdec
-      || img->planes[pli].ydec != enc->state.info.plane_info[pli].ydec) {
-      return OD_EINVAL;
-    }
-  }
   frame_width = enc->state.frame_width;
   frame_height = enc->state.frame_height;
   pic_width = enc->state.info.pic_width;
   pic_height = enc->state.info.pic_height;
   nhsb = enc->state.nhsb;
   nvsb = enc->state.nvsb;
-  if (img->width != frame_width || img->height != frame_height) {
-    /*The buffer does not match the frame size.
-      Check to see if it matches the picture size.*/
-    if ( img->width != pic_width || img->height != pic_height) {
-      /*It doesn't; we don't know how to handle it yet.*/
-      return OD_EINVAL;
-    }
-  }
-  /* Check if the frame is a keyframe. */
-  mbctx.is_keyframe = ( enc->state.cur_time %
-      (enc->state.info.keyframe_rate) == 0) ? 1 : 0;
+  mbctx.is_keyframe = is_keyframe;
   OD_LOG((OD_LOG_ENCODER, OD_LOG_INFO,"is_keyframe=%d",mbctx.is_keyframe ));
+  /*Let the rate controller pick the quantizer for this frame.*/
+  if (enc->rc.target_bitrate > 0) {
+    enc->scale = od_rc_select_scale(&enc->rc, mbctx.is_keyframe,
+     enc->state.cur_time, plan, nplan);
+    OD_LOG((OD_LOG_ENCODER, OD_LOG_INFO, "scale=%d", enc->scale));
+  }
   /* Copy and pad the image. */
   for (pli = 0; pli < nplanes; pli++) {
     od_img_plane plane;
@@ -545,6 +1065,11 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
   od_ec_encode_bool_q15(&enc->ec,0,16384);
   /*Write a bit to mark it as a keyframe.*/
   od_ec_encode_bool_q15(&enc->ec,mbctx.is_keyframe,16384);
+  /*Write a bit to mark whether an inter frame continues with the models
+     adapted by the previous frame.*/
+  if (!mbctx.is_keyframe) {
+    od_ec_encode_bool_q15(&enc->ec, enc->carry_models, 16384);
+  }
   /*set the top row and the left most column to three*/
   for(i = -4; i < (nhsb+1)*4; i++) {
     for(j = -4; j < 0; j++) {
@@ -562,23 +1087,27 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
       enc->state.bsize[(j*enc->state.bstride) + i] = 3;
     }
   }
-  /* Allocate a blockSizeComp for scratch space and then calculate the block sizes
-     eventually store them in bsize. */
-  bs = _ogg_malloc(sizeof(BlockSizeComp));
+  /* Use the persistent blockSizeComp scratch space to calculate the block sizes
+     and eventually store them in bsize. */
   od_log_matrix_uchar(OD_LOG_GENERIC, OD_LOG_INFO, "bimg ", enc->state.io_imgs[OD_FRAME_INPUT].planes[0].data-16*enc->state.io_imgs[OD_FRAME_INPUT].planes[0].ystride-16,
       enc->state.io_imgs[OD_FRAME_INPUT].planes[0].ystride, (nvsb + 1)*32);
+  od_block_stats_frame_compute(&enc->bstats,
+   enc->state.opt_vtbl.block_var4_row8,
+   enc->state.io_imgs[OD_FRAME_INPUT].planes[0].data,
+   enc->state.io_imgs[OD_FRAME_INPUT].planes[0].ystride);
   for(i = 0; i < nvsb; i++) {
-    unsigned char *img;
-    int istride ;
     int bstride;
     bstride = enc->state.bstride;
-    img = enc->state.io_imgs[OD_FRAME_INPUT].planes[0].data;
-    istride = enc->state.io_imgs[OD_FRAME_INPUT].planes[0].ystride;
     for(j = 0; j < nhsb; j++) {
       int bsize[4][4];
       unsigned char *state_bsize;
+      BlockStats psy_stats;
+      BlockStats img_stats;
       state_bsize = &enc->state.bsize[i*4*enc->state.bstride + j*4];
-      process_block_size32(bs, img, img + i*istride*32 + j*32, istride, bsize);
+      /* The psy model always uses the first superblock. */
+      od_block_stats_get(&psy_stats, &enc->bstats, 0, 0);
+      od_block_stats_get(&img_stats, &enc->bstats, j, i);
+      process_block_size32(enc->bs, &psy_stats, &img_stats, bsize);
       /* Grab the 4x4 information returned from process_block_size32 in bsize
          and store it in the od_state bsize. */
       for(k = 0; k < 4; k++) {
@@ -596,7 +1125,6 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
     }
     OD_LOG_PARTIAL((OD_LOG_GENERIC, OD_LOG_INFO, "\n"));
   }
-  _ogg_free(bs);
   /*Update the buffer state.*/
   if (enc->state.ref_imgi[OD_FRAME_SELF] >= 0) {
     enc->state.ref_imgi[OD_FRAME_PREV] =
@@ -613,7 +1141,16 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
    || refi == enc->state.ref_imgi[OD_FRAME_PREV]
    || refi == enc->state.ref_imgi[OD_FRAME_NEXT]; refi++);
   enc->state.ref_imgi[OD_FRAME_SELF] = refi;
+  /*The motion search reads the input with a unit xstride, so point it at the
+     copy made above rather than at the caller's planes.*/
   memcpy(&enc->state.input, img, sizeof(enc->state.input));
+  for (pli = 0; pli < nplanes; pli++) {
+    enc->state.input.planes[pli].data =
+     enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].data;
+    enc->state.input.planes[pli].xstride = 1;
+    enc->state.input.planes[pli].ystride =
+     enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ystride;
+  }
   /*TODO: Incrment frame count.*/
   if ((enc->state.ref_imgi[OD_FRAME_PREV] >= 0) && (!mbctx.is_keyframe)){
 #if defined(OD_DUMP_IMAGES) && defined(OD_ANIMATE)
@@ -621,7 +1158,11 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
 #endif
     OD_LOG((OD_LOG_ENCODER, OD_LOG_INFO, "Predicting frame %i:",
             (int)daala_granule_basetime(enc, enc->state.cur_time)));
-    od_mv_est(enc->mvest, OD_FRAME_PREV, 452);
+    /*With a fixed quantizer, use the lambda it was tuned with.
+      Otherwise, the cost of a bit in SAD units follows the quantizer step
+       size, which the tuned value matches at a scale of about 14.*/
+    od_mv_est(enc->mvest, OD_FRAME_PREV, enc->rc.target_bitrate > 0 ?
+     enc->scale << OD_LAMBDA_SCALE : 452);
     /* output the motion vectors */
     {
       int nhmvbs;
@@ -640,6 +1181,9 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
       mv_res = enc->state.mv_res;
       OD_ASSERT(0 <= mv_res && mv_res < 3);
       od_ec_enc_uint(&enc->ec, mv_res, 3);
+      /*Write a bit to mark whether the blocks are blended with the
+         multiresolution blend.*/
+      od_ec_encode_bool_q15(&enc->ec, enc->state.multires_blend, 16384);
       width = (img->width + 32) << (3 - mv_res);
       height = (img->height + 32) << (3 - mv_res);
       grid = enc->state.mv_grid;
@@ -681,161 +1225,62 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
 #endif
   }
   {
-    od_coeff *ctmp[OD_NPLANES_MAX];
-    od_coeff *dtmp[OD_NPLANES_MAX];
-    od_coeff *mctmp[OD_NPLANES_MAX];
-    od_coeff *mdtmp[OD_NPLANES_MAX];
-    od_coeff *ltmp[OD_NPLANES_MAX];
-    od_coeff *lbuf[OD_NPLANES_MAX];
-    int xdec;
-    int ydec;
+    od_frame_quant_ctx fctx;
     int nvmbs;
     int nhmbs;
     int mby;
     int mbx;
     int mi;
-    int h;
-    int w;
-    int y;
-    int x;
     nhmbs = enc->state.nhmbs;
     nvmbs = enc->state.nvmbs;
+    fctx.enc = enc;
+    fctx.is_keyframe = mbctx.is_keyframe;
+    fctx.bufs = &enc->bufs;
     /*Initialize the data needed for each plane.*/
-    mbctx.modes = _ogg_calloc((frame_width >> 2)*(frame_height >> 2),
-     sizeof(*mbctx.modes));
+    mbctx.modes = enc->bufs.modes;
     for (mi = 0; mi < OD_INTRA_NMODES; mi++) {
      mbctx.mode_p0[mi] = 32768/OD_INTRA_NMODES;
     }
     for (pli = 0; pli < nplanes; pli++) {
-      generic_model_init(&mbctx.model_dc[pli]);
-      generic_model_init(&mbctx.model_g[pli]);
-      generic_model_init(&mbctx.model_ym[pli]);
-      mbctx.ex_dc[pli] = pli > 0 ? 8 : 32768;
-      mbctx.ex_g[pli] = 8;
-      xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-      ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-      w = frame_width >> xdec;
-      h = frame_height >> ydec;
-      od_ec_enc_uint(&enc->ec, enc->scale, 512);
-      ctmp[pli] = _ogg_calloc(w*h, sizeof(*ctmp[pli]));
-      dtmp[pli] = _ogg_calloc(w*h, sizeof(*dtmp[pli]));
-      mctmp[pli] = _ogg_calloc(w*h, sizeof(*mctmp[pli]));
-      mdtmp[pli] = _ogg_calloc(w*h, sizeof(*mdtmp[pli]));
-      /*We predict chroma planes from the luma plane.  Since chroma can be
-        subsampled, we cache subsampled versions of the luma plane in the
-        frequency domain.  We can share buffers with the same subsampling.*/
-      if (pli > 0) {
-        int plj;
-        if (xdec || ydec) {
-          for (plj = 1; plj < pli; plj++) {
-            if (xdec == enc->state.io_imgs[OD_FRAME_INPUT].planes[plj].xdec
-             && ydec == enc->state.io_imgs[OD_FRAME_INPUT].planes[plj].ydec) {
-              ltmp[pli] = NULL;
-              lbuf[pli] = ltmp[plj];
-            }
-          }
-          if (plj >= pli) {
-            lbuf[pli] = ltmp[pli] = _ogg_calloc(w*h, sizeof(*ltmp));
-          }
-        }
-        else{
-          ltmp[pli] = NULL;
-          lbuf[pli] = ctmp[pli];
-        }
+      if (!mbctx.is_keyframe && enc->carry_models) {
+        mbctx.model_dc[pli] = enc->model_dc[pli];
+        mbctx.model_g[pli] = enc->model_g[pli];
+        mbctx.model_ym[pli] = enc->model_ym[pli];
+        mbctx.ex_dc[pli] = enc->ex_dc[pli];
+        mbctx.ex_g[pli] = enc->ex_g[pli];
       }
-      else lbuf[pli] = ltmp[pli] = NULL;
+      else {
+        generic_model_init(&mbctx.model_dc[pli]);
+        generic_model_init(&mbctx.model_g[pli]);
+        generic_model_init(&mbctx.model_ym[pli]);
+        mbctx.ex_dc[pli] = pli > 0 ? 8 : 32768;
+        mbctx.ex_g[pli] = 8;
+      }
+      od_ec_enc_uint(&enc->ec, enc->scale, 512);
       od_adapt_row_init(&enc->state.adapt_row[pli]);
     }
-    for (pli = 0; pli < nplanes; pli++) {
-      xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-      ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-      w = frame_width >> xdec;
-      h = frame_height >> ydec;
-      /*Collect the image data needed for this plane.*/
-      {
-        unsigned char *data;
-        unsigned char *mdata;
-        int ystride;
-        data = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].data;
-        mdata = enc->state.io_imgs[OD_FRAME_REC].planes[pli].data;
-        ystride = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ystride;
-        for (y=0;y<h;y++) {
-          for (x=0;x<w;x++) {
-            ctmp[pli][y*w+x]=data[ystride*y+x]-128;
-            if (!mbctx.is_keyframe) {
-              mctmp[pli][y*w+x]=mdata[ystride*y+x]-128;
-            }
-          }
-        }
-      }
-      /*Apply the prefilter across the entire image.*/
-      {
-        int sby;
-        int sbx;
-        /* This code assumes 4:4:4 or 4:2:0 input. */
-        OD_ASSERT(xdec==ydec);
-        /*Apply the prefilter down the bottom block edge columns.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
-            if (!mbctx.is_keyframe) {
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,0);
-            }
-          }
-        }
-        /*Apply the prefilter across the right block edge rows.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
-            if (!mbctx.is_keyframe) {
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,0);
-            }
-          }
-        }
-      }
+    /*Quantize the macro blocks in wavefront order on the worker threads,
+       while we entropy code them in raster order as they become ready.
+      The lapping filters are applied one row of super blocks at a time as
+       part of the same pass (see od_quantize_mb_row()).
+      Without any worker threads, we quantize each row just before coding
+       it.*/
+    od_row_sync_reset(&enc->mb_rows);
+    od_row_sync_reset(&enc->sb_rows);
+    if (enc->threads != NULL) {
+      od_thread_pool_start(enc->threads, od_quantize_mb_rows, &fctx);
     }
     for (mby = 0; mby < nvmbs; mby++) {
       od_adapt_ctx adapt_hmean[OD_NPLANES_MAX];
+      if (enc->threads == NULL) od_quantize_mb_row(&fctx, mby);
       for (pli = 0; pli < nplanes; pli++) {
         od_adapt_hmean_init(&adapt_hmean[pli]);
       }
       for (mbx = 0; mbx < nhmbs; mbx++) {
+        od_row_sync_wait(&enc->mb_rows, mby, mbx + 1);
         for (pli = 0; pli < nplanes; pli++) {
           od_adapt_row_ctx *adapt_row;
-          int ystride;
-          int by;
-          int bx;
-          mbctx.c = ctmp[pli];
-          mbctx.d = dtmp[pli];
-          mbctx.mc = mctmp[pli];
-          mbctx.md = mdtmp[pli];
-          mbctx.l = lbuf[pli];
-          xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-          ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-          w = frame_width >> xdec;
-          h = frame_height >> ydec;
-          /*Construct the luma predictors for chroma planes.*/
-          if (ltmp[pli] != NULL) {
-            OD_ASSERT(pli > 0);
-            OD_ASSERT(mbctx.l == ltmp[pli]);
-            for (by = mby << (2 - ydec); by < (mby + 1) << (2 - ydec); by++) {
-              for (bx = mbx << (2 - xdec); bx < (mbx + 1) << (2 - xdec);
-                  bx++) {
-                od_resample_luma_coeffs(mbctx.l + (by << 2)*w + (bx<<2), w,
-                    dtmp[0] + (by << (2 + ydec))*frame_width + (bx<<(2 + xdec)),
-                    frame_width, xdec, ydec, 4);
-              }
-            }
-          }
-          ystride = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ystride;
+          mbctx.syms = enc->syms[pli];
           mbctx.nk = mbctx.k_total = mbctx.sum_ex_total_q8 = 0;
           mbctx.ncount = mbctx.count_total_q8 = mbctx.count_ex_total_q8 = 0;
           adapt_row = &enc->state.adapt_row[pli];
@@ -866,66 +1311,7 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
         od_adapt_row(&enc->state.adapt_row[pli], &adapt_hmean[pli]);
       }
     }
-    for (pli = 0; pli < nplanes; pli++) {
-      xdec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].xdec;
-      ydec = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ydec;
-      w = frame_width >> xdec;
-      h = frame_height >> ydec;
-      /*Apply the postfilter across the entire image.*/
-      {
-        int sby;
-        int sbx;
-        /* This code assumes 4:4:4 or 4:2:0 input. */
-        OD_ASSERT(xdec==ydec);
-        /*Apply the postfilter across the right block edge rows.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
-            /*extract_bsize(btmp,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);*/
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,1);
-            if (!mbctx.is_keyframe) {
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_RIGHT_EDGE,sbx<nhsb-1?OD_RIGHT_EDGE:0,1);
-            }
-          }
-        }
-        /*Apply the postfilter down the bottom block edge columns.*/
-        for (sby = 0; sby < nvsb; sby++) {
-          for (sbx = 0; sbx < nhsb; sbx++) {
-            unsigned char btmp[6*6];
-            od_extract_bsize(btmp,6,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);
-            /*extract_bsize(btmp,&enc->state.bsize[enc->state.bstride*(sby<<2)+(sbx<<2)],enc->state.bstride,xdec);*/
-            od_apply_filter(&ctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-             &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,1);
-            if (!mbctx.is_keyframe) {
-              od_apply_filter(&mctmp[pli][(sby<<(5-ydec))*w+(sbx<<(5-xdec))],w,0,0,3-xdec,
-               &btmp[6*1+1],6,OD_BOTTOM_EDGE,sby<nvsb-1?OD_BOTTOM_EDGE:0,1);
-            }
-          }
-        }
-      }
-      {
-        unsigned char *data;
-        int ystride;
-        data = enc->state.io_imgs[OD_FRAME_REC].planes[pli].data;
-        ystride = enc->state.io_imgs[OD_FRAME_INPUT].planes[pli].ystride;
-        for (y=0;y<h;y++) {
-          for (x=0;x<w;x++) {
-            data[ystride*y+x]=OD_CLAMP255(ctmp[pli][y*w+x]+128);
-          }
-        }
-      }
-    }
-    for (pli = nplanes; pli-- > 0;) {
-      _ogg_free(ltmp[pli]);
-      _ogg_free(dtmp[pli]);
-      _ogg_free(ctmp[pli]);
-      _ogg_free(mctmp[pli]);
-      _ogg_free(mdtmp[pli]);
-    }
-    _ogg_free(mbctx.modes);
+    if (enc->threads != NULL) od_thread_pool_join(enc->threads);
   }
 #if defined(OD_DUMP_IMAGES)
   /*Dump YUV*/
@@ -943,10 +1329,28 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
     packet.packet = od_ec_enc_done(&enc->ec, &nbytes);
     packet.bytes = nbytes;
     dec.packet_state = OD_PACKET_DATA;
+    dec.threads = NULL;
+    memcpy(dec.model_dc, enc->model_dc, sizeof(dec.model_dc));
+    memcpy(dec.model_g, enc->model_g, sizeof(dec.model_g));
+    memcpy(dec.model_ym, enc->model_ym, sizeof(dec.model_ym));
+    memcpy(dec.ex_dc, enc->ex_dc, sizeof(dec.ex_dc));
+    memcpy(dec.ex_g, enc->ex_g, sizeof(dec.ex_g));
+    od_row_sync_init(&dec.mb_rows, dec.state.nvmbs);
+    od_row_sync_init(&dec.sb_rows, dec.state.nvsb);
+    od_frame_bufs_init(&dec.bufs, &dec.state);
     ret = daala_decode_packet_in(&dec, &out_img, &packet);
+    od_frame_bufs_clear(&dec.bufs);
+    od_row_sync_clear(&dec.sb_rows);
+    od_row_sync_clear(&dec.mb_rows);
     OD_ASSERT(ret==0);
   }
 #endif
+  /*Save the adapted models for the next frame.*/
+  memcpy(enc->model_dc, mbctx.model_dc, sizeof(enc->model_dc));
+  memcpy(enc->model_g, mbctx.model_g, sizeof(enc->model_g));
+  memcpy(enc->model_ym, mbctx.model_ym, sizeof(enc->model_ym));
+  memcpy(enc->ex_dc, mbctx.ex_dc, sizeof(enc->ex_dc));
+  memcpy(enc->ex_g, mbctx.ex_g, sizeof(enc->ex_g));
   for (pli = 0; pli < nplanes; pli++) {
     unsigned char *data;
     ogg_int64_t mc_sqerr;
@@ -1051,12 +1455,13 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
             pli,(long long)enc_sqerr,npixels,10*log10(255*255.0*npixels/enc_sqerr)));
   }
   OD_LOG((OD_LOG_ENCODER, OD_LOG_INFO,
-          "mode bits: %f/%f=%f", mode_bits, mode_count,
-          mode_bits/mode_count));
+          "mode bits: %f/%f=%f", enc->stats.intra_mode_bits,
+          enc->stats.intra_mode_count,
+          enc->stats.intra_mode_bits/enc->stats.intra_mode_count));
+  od_rc_update(&enc->rc, mbctx.is_keyframe, enc->scale,
+   od_ec_enc_tell(&enc->ec));
+  enc->stats.nframes++;
   enc->packet_state = OD_PACKET_READY;
-  od_state_upsample8(&enc->state,
-   enc->state.ref_imgs + enc->state.ref_imgi[OD_FRAME_SELF],
-   enc->state.io_imgs + OD_FRAME_REC);
 #if defined(OD_DUMP_IMAGES)
   /*Dump reference frame.*/
   /*od_state_dump_img(&enc->state,
@@ -1067,20 +1472,76 @@ int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
   return 0;
 }
 
+/*Codes the oldest frame in the lookahead.*/
+static int od_encode_queued_frame(daala_enc_ctx *enc) {
+  od_la_plan plan[OD_LA_DEPTH_MAX + 1];
+  od_la_frame *frame;
+  int nplan;
+  nplan = od_la_plan_frames(&enc->la, plan);
+  frame = od_la_pop(&enc->la, plan[0].is_keyframe);
+  return od_encode_frame(enc, &frame->img, frame->duration,
+   plan[0].is_keyframe, plan, nplan);
+}
+
+int daala_encode_img_in(daala_enc_ctx *enc, od_img *img, int duration) {
+  int nplanes;
+  int pli;
+  if (enc == NULL || img == NULL) return OD_EFAULT;
+  if (enc->packet_state == OD_PACKET_DONE) return OD_EINVAL;
+  /*Check the input image dimensions to make sure they're compatible with the
+     declared video size.*/
+  nplanes = enc->state.info.nplanes;
+  if (img->nplanes != nplanes) return OD_EINVAL;
+  for (pli = 0; pli < nplanes; pli++) {
+    if (img->planes[pli].xdec != enc->state.info.plane_info[pli].xdec
+      || img->planes[pli].ydec != enc->state.info.plane_info[pli].ydec) {
+      return OD_EINVAL;
+    }
+  }
+  if (img->width != enc->state.frame_width
+   || img->height != enc->state.frame_height) {
+    /*The buffer does not match the frame size.
+      Check to see if it matches the picture size.*/
+    if (img->width != enc->state.info.pic_width
+     || img->height != enc->state.info.pic_height) {
+      /*It doesn't; we don't know how to handle it yet.*/
+      return OD_EINVAL;
+    }
+  }
+  /*The first pass statistics of the last frame were never retrieved.*/
+  if (!od_rc_2pass_ready(&enc->rc)) return OD_EINVAL;
+  if (enc->la.depth == 0) {
+    /*Without a lookahead, code the frame right away, with a keyframe every
+       keyframe_rate frames.*/
+    return od_encode_frame(enc, img, duration,
+     enc->state.cur_time % enc->state.info.keyframe_rate == 0, NULL, 0);
+  }
+  od_la_push(&enc->la, img, duration);
+  /*Once the lookahead is full, code the oldest frame in it.*/
+  if (enc->la.nframes > enc->la.depth) return od_encode_queued_frame(enc);
+  return 0;
+}
+
 int daala_encode_packet_out(daala_enc_ctx *enc, int last, ogg_packet *op) {
   ogg_uint32_t nbytes;
   if (enc == NULL || op == NULL) return OD_EFAULT;
-  else if (enc->packet_state <= 0 || enc->packet_state == OD_PACKET_DONE) {
+  /*After the last frame, code the ones still in the lookahead, one for each
+     packet.*/
+  if (last && enc->packet_state <= OD_PACKET_EMPTY && enc->la.nframes > 0) {
+    if (!od_rc_2pass_ready(&enc->rc)) return OD_EINVAL;
+    od_encode_queued_frame(enc);
+  }
+  if (enc->packet_state <= 0 || enc->packet_state == OD_PACKET_DONE) {
     return 0;
   }
   op->packet = od_ec_enc_done(&enc->ec, &nbytes);
   op->bytes = nbytes;
   OD_LOG((OD_LOG_ENCODER, OD_LOG_INFO, "Output Bytes: %ld", op->bytes));
   op->b_o_s = 0;
-  op->e_o_s = last;
+  op->e_o_s = last && enc->la.nframes == 0;
   op->packetno = 0;
   op->granulepos = enc->state.cur_time;
-  if (last) enc->packet_state = OD_PACKET_DONE;
+  if (op->e_o_s) enc->packet_state = OD_PACKET_DONE;
   else enc->packet_state = OD_PACKET_EMPTY;
   return 1;
 }
@@ -30,9 +30,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 
 
-/*OPT: od_ec_window must be at least 32 bits, but if you have fast arithmetic
-   on a larger type, you can speed up the decoder by using it here.*/
+/*od_ec_window must be at least 32 bits.
+  A larger window lets the encoder buffer more bits between flushes to the
+   pre-carry buffer and the decoder refill more bytes at once, so we use one
+   whenever we have fast 64-bit arithmetic.*/
+# if defined(__x86_64__)||defined(_M_X64)||defined(__aarch64__)|| \
+ defined(_M_ARM64)||defined(__powerpc64__)||defined(__LP64__)
+typedef ogg_uint64_t     od_ec_window;
+# else
 typedef ogg_uint32_t     od_ec_window;
+# endif
 
 
 
@@ -23,6 +23,9 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 #include "entdec.h"
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <emmintrin.h>
+#endif
 
 /*A range decoder.
   This is an entropy decoder based upon \cite{Mar79}, which is itself a
@@ -86,9 +89,71 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 
 
+/*Reads the next sizeof(od_ec_window) bytes of the stream as a big-endian
+   word.
+  Compilers turn this into a single load and byte swap.*/
+static od_ec_window od_ec_dec_load_word(const unsigned char *_bptr){
+  od_ec_window w;
+  int          i;
+  w=0;
+  for(i=0;i<(int)sizeof(od_ec_window);i++)w=w<<8|_bptr[i];
+  return w;
+}
+
+/*Finds the symbol whose range in a CDF contains a given value.
+  _cdf:   The CDF, which must be monotonically non-decreasing.
+  _nsyms: The number of symbols in the alphabet.
+          This should be at most 16.
+  _q:     The value to search for.
+          This must be less than _cdf[_nsyms-1].
+  Return: The number of entries of _cdf that are no larger than _q, which is
+           the decoded symbol.*/
+static int od_ec_dec_find_symbol(const ogg_uint16_t *_cdf,int _nsyms,
+ unsigned _q){
+  unsigned fh;
+  int      ret;
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+  /*Compare against every entry at once instead of stopping at the first one
+     larger than _q, so that no branch depends on the decoded symbol.
+    Since the CDF is monotonic, the entries no larger than _q are always a
+     prefix of it, and their count is the index of the highest set bit of the
+     comparison mask.
+    We only ever read the first _nsyms entries: the upper half is loaded so
+     that it ends at the last entry, and whatever it shares with the lower half
+     is shifted out of the mask.
+    Alphabets with fewer than 8 symbols are short enough to scan.*/
+  if(_nsyms>=8){
+    __m128i q;
+    __m128i lo;
+    __m128i hi;
+    unsigned m;
+    q=_mm_set1_epi16((short)_q);
+    /*An unsigned 16-bit x<=q is the same as x-q saturating to zero.
+      The CDF can contain 32768, so we cannot use a signed comparison.*/
+    lo=_mm_subs_epu16(_mm_loadu_si128((const __m128i *)_cdf),q);
+    hi=_mm_subs_epu16(_mm_loadu_si128((const __m128i *)(_cdf+_nsyms-8)),q);
+    lo=_mm_cmpeq_epi16(lo,_mm_setzero_si128());
+    hi=_mm_cmpeq_epi16(hi,_mm_setzero_si128());
+    m=_mm_movemask_epi8(_mm_packs_epi16(lo,hi));
+    ret=OD_ILOG(m&0xFF)+OD_ILOG(m>>8>>(16-_nsyms));
+    OD_ASSERT(ret<_nsyms);
+    OD_ASSERT(_cdf[ret]>_q);
+    OD_ASSERT(ret==0||_cdf[ret-1]<=_q);
+    return ret;
+  }
+#endif
+  ret=0;
+  for(fh=_cdf[ret];fh<=_q;fh=_cdf[++ret]);
+  OD_ASSERT(ret<_nsyms);
+  (void)_nsyms;
+  return ret;
+}
+
 /*Takes updated dif and range values, renormalizes them so that
    32768<=rng<65536 (reading more bytes from the stream into dif if necessary),
    and stores them back in the decoder context.
+  When there are enough bytes left in the stream, we refill dif a whole word at
+   a time.
   _dif: The new value of dif.
   _rng: The new value of the range.
   _ret: The value to return.
@@ -109,7 +174,19 @@ static int od_ec_dec_normalize(od_ec_dec *_this,
     const unsigned char *bptr;
     end=_this->end;
     bptr=_this->bptr;
-    for(s=OD_EC_WINDOW_SIZE-9-(c+15);s>=0;){
+    s=OD_EC_WINDOW_SIZE-9-(c+15);
+    if(end-bptr>=(int)sizeof(od_ec_window)){
+      int nbytes;
+      nbytes=(s>>3)+1;
+      /*Align the first new byte with bit s, and drop the bits of the byte
+         after the last one we consume.*/
+      _dif|=od_ec_dec_load_word(bptr)>>OD_EC_WINDOW_SIZE-8-s
+       &~(((od_ec_window)1<<(s&7))-1);
+      bptr+=nbytes;
+      c+=nbytes<<3;
+      s-=nbytes<<3;
+    }
+    for(;s>=0;){
       OD_ASSERT(s<=OD_EC_WINDOW_SIZE-8);
       if(bptr>=end){
         _this->tell_offs+=OD_EC_LOTS_OF_BITS-c;
@@ -139,7 +216,10 @@ void od_ec_dec_init(od_ec_dec *_this,
   ogg_int32_t  tell_offs;
   int          c;
   int          s;
-  tell_offs=10-(OD_EC_WINDOW_SIZE-8);
+  /*Every byte we read adds 8 to both the bytes consumed and cnt, which starts
+     at -15, so this makes od_ec_dec_tell() start at 1, the same as
+     od_ec_enc_tell(), for any window size.*/
+  tell_offs=-14;
   offs=0;
   dif=0;
   c=-15;
@@ -256,9 +336,9 @@ int od_ec_decode_cdf(od_ec_dec *_this,const ogg_uint16_t *_cdf,int _nsyms){
   q=OD_MAXI((int)(dif>>OD_EC_WINDOW_SIZE-15),
    (int)((dif>>OD_EC_WINDOW_SIZE-16)-d))>>s;
   OD_ASSERT(q<ft>>s);
-  fl=0;
-  ret=0;
-  for(fh=_cdf[ret];fh<=q;fh=_cdf[++ret])fl=fh;
+  ret=od_ec_dec_find_symbol(_cdf,_nsyms,q);
+  fl=ret>0?_cdf[ret-1]:0;
+  fh=_cdf[ret];
   OD_ASSERT(fh<=ft>>s);
   fl<<=s;
   fh<<=s;
@@ -298,9 +378,9 @@ int od_ec_decode_cdf_q15(od_ec_dec *_this,const ogg_uint16_t *_cdf,int _nsyms){
   q=OD_MAXI((int)(dif>>OD_EC_WINDOW_SIZE-15),
    (int)((dif>>OD_EC_WINDOW_SIZE-16)-d));
   OD_ASSERT(q<32768U);
-  fl=0;
-  ret=0;
-  for(fh=_cdf[ret];fh<=q;fh=_cdf[++ret])fl=fh;
+  ret=od_ec_dec_find_symbol(_cdf,_nsyms,q);
+  fl=ret>0?_cdf[ret-1]:0;
+  fh=_cdf[ret];
   OD_ASSERT(fh<=32768U);
   u=fl+OD_MINI(fl,d);
   v=fh+OD_MINI(fh,d);
@@ -349,9 +429,9 @@ int od_ec_decode_cdf_unscaled(od_ec_dec *_this,
   q=OD_MAXI((int)(dif>>OD_EC_WINDOW_SIZE-15),
    (int)((dif>>OD_EC_WINDOW_SIZE-16)-d))>>s;
   OD_ASSERT(q<ft>>s);
-  fl=0;
-  ret=0;
-  for(fh=_cdf[ret];fh<=q;fh=_cdf[++ret])fl=fh;
+  ret=od_ec_dec_find_symbol(_cdf,_nsyms,q);
+  fl=ret>0?_cdf[ret-1]:0;
+  fh=_cdf[ret];
   OD_ASSERT(fh<=ft>>s);
   fl<<=s;
   fh<<=s;
@@ -396,9 +476,9 @@ int od_ec_decode_cdf_unscaled_dyadic(od_ec_dec *_this,
   q=OD_MAXI((int)(dif>>OD_EC_WINDOW_SIZE-15),
    (int)((dif>>OD_EC_WINDOW_SIZE-16)-d))>>s;
   OD_ASSERT(q<1U<<_ftb);
-  fl=0;
-  ret=0;
-  for(fh=_cdf[ret];fh<=q;fh=_cdf[++ret])fl=fh;
+  ret=od_ec_dec_find_symbol(_cdf,_nsyms,q);
+  fl=ret>0?_cdf[ret-1]:0;
+  fh=_cdf[ret];
   OD_ASSERT(fh<=1U<<_ftb);
   fl<<=s;
   fh<<=s;
@@ -456,7 +536,7 @@ ogg_uint32_t od_ec_dec_bits(od_ec_dec *_this,unsigned _ftb){
         available=OD_EC_LOTS_OF_BITS;
         break;
       }
-      window|=*--eptr<<available;
+      window|=(od_ec_window)*--eptr<<available;
       available+=8;
     }
     while(available<=OD_EC_WINDOW_SIZE-8);
@@ -55,6 +55,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 /*Takes updated low and range values, renormalizes them so that
    32768<=rng<65536 (flushing bytes from low to the pre-carry buffer if
    necessary), and stores them back in the encoder context.
+  We only flush once low is about to run out of room, and then flush every
+   complete byte at once.
+  low holds cnt+25 bits, including one for the carry out of the top byte, and
+   we keep one more bit spare so that low+rng in od_ec_enc_done() cannot
+   overflow.
   _low: The new value of low.
   _rng: The new value of the range.*/
 static void od_ec_enc_normalize(od_ec_enc *_this,
@@ -66,21 +71,21 @@ static void od_ec_enc_normalize(od_ec_enc *_this,
   OD_ASSERT(_rng<=65535U);
   d=16-OD_ILOG_NZ(_rng);
   s=c+d;
-  /*TODO: Right now we flush every time we have at least one byte available.
-    Instead we should use an ec_window and flush right before we're about to
-     shift bits off the end of the window.
-    For a 32-bit window this is about the same amount of work, but for a 64-bit
-     window it should be a fair win.*/
-  if(s>=0){
+  if(s>=OD_EC_WINDOW_SIZE-25){
     ogg_uint16_t *buf;
     ogg_uint32_t  storage;
     ogg_uint32_t  offs;
-    unsigned      m;
+    od_ec_window  out;
+    int           nbytes;
+    int           i;
     buf=_this->precarry_buf;
     storage=_this->precarry_storage;
     offs=_this->offs;
-    if(offs+2>storage){
-      storage=2*storage+2;
+    /*We need to add one byte here, since cnt always counts one byte less (it
+       starts at -9) to leave room for the carry.*/
+    nbytes=(s>>3)+1;
+    if(offs+nbytes>storage){
+      storage=2*storage+nbytes;
       buf=_ogg_realloc(buf,storage*sizeof(*buf));
       if(buf==NULL){
         _this->error=-1;
@@ -90,19 +95,16 @@ static void od_ec_enc_normalize(od_ec_enc *_this,
       _this->precarry_buf=buf;
       _this->precarry_storage=storage;
     }
-    c+=16;
-    m=(1<<c)-1;
-    if(s>=8){
+    /*c becomes the number of bits left in low after the flush.*/
+    c+=24-(nbytes<<3);
+    out=_low>>c;
+    _low&=((od_ec_window)1<<c)-1;
+    /*The first byte also gets the carry bit, if any.*/
+    for(i=nbytes;i-->0;){
       OD_ASSERT(offs<storage);
-      buf[offs++]=(ogg_uint16_t)(_low>>c);
-      _low&=m;
-      c-=8;
-      m>>=8;
+      buf[offs++]=(ogg_uint16_t)(out>>(i<<3)&(i+1<nbytes?0xFF:0x1FF));
     }
-    OD_ASSERT(offs<storage);
-    buf[offs++]=(ogg_uint16_t)(_low>>c);
     s=c+d-24;
-    _low&=m;
     _this->offs=offs;
   }
   _this->low=_low<<d;
@@ -490,7 +492,7 @@ unsigned char *od_ec_enc_done(od_ec_enc *_this,ogg_uint32_t *_nbytes){
   offs=_this->offs;
   buf=_this->precarry_buf;
   if(s>0){
-    unsigned m;
+    od_ec_window n;
     storage=_this->precarry_storage;
     if(offs+(s+7>>3)>storage){
       storage=storage*2+(s+7>>3);
@@ -502,14 +504,14 @@ unsigned char *od_ec_enc_done(od_ec_enc *_this,ogg_uint32_t *_nbytes){
       _this->precarry_buf=buf;
       _this->precarry_storage=storage;
     }
-    m=(1<<c+16)-1;
+    n=((od_ec_window)1<<c+16)-1;
     do{
       OD_ASSERT(offs<storage);
       buf[offs++]=(ogg_uint16_t)(e>>c+16);
-      e&=m;
+      e&=n;
       s-=8;
       c-=8;
-      m>>=8;
+      n>>=8;
     }
     while(s>0);
   }
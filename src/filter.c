@@ -217,6 +217,7 @@ void od_post_filter4(od_coeff _x[4],const od_coeff _y[4]){
    of 16.8035257369844686. The small cg loss is likely
    worth the reduction in multiplies and adds.*/
 #define OD_FILTER8_TYPE3 (1)
+/*The SSE2 versions in x86/sse2filter.c only implement the type-3 structure.*/
 #define OD_FILTER_PARAMS8_0 (86)
 #define OD_FILTER_PARAMS8_1 (64)
 #define OD_FILTER_PARAMS8_2 (64)
@@ -359,6 +360,7 @@ void od_post_filter8(od_coeff _x[8],const od_coeff _y[8]){
    CG loss is likely worth the reduction in
    multiplies and adds.*/
 #define OD_FILTER16_TYPE3 (1)
+/*The SSE2 versions in x86/sse2filter.c only implement the type-3 structure.*/
 #define OD_FILTER_PARAMS16_0 (90)
 #define OD_FILTER_PARAMS16_1 (67)
 #define OD_FILTER_PARAMS16_2 (64)
@@ -610,8 +612,94 @@ void od_post_filter16(od_coeff _x[16],const od_coeff _y[16]){
 
 #define ZERO_FILTERS (0)
 
-static void od_apply_filter_rows(od_coeff *_c,int _stride,int _sbx,int _sby,
- int _l,const unsigned char *_bsize,int _bstride,int _inv){
+/*Applies _filter to _n rows that cross a vertical edge.*/
+static void od_filter_rows_c(od_coeff *_c,int _stride,int _n,int _f,
+ od_filter_func _filter){
+  int i;
+  for (i=_n;i-->0;) {
+    (*_filter)(&_c[i*_stride-(2<<_f)],&_c[i*_stride-(2<<_f)]);
+  }
+}
+
+/*Applies _filter to _n columns that cross a horizontal edge.*/
+static void od_filter_cols_c(od_coeff *_c,int _stride,int _n,int _f,
+ od_filter_func _filter){
+  int i;
+  for (i=_n;i-->0;) {
+    int j;
+    od_coeff c[4<<OD_NBSIZES];
+    for (j=4<<_f;j-->0;) {
+      c[j]=_c[_stride*(j-(2<<_f))+i];
+    }
+    (*_filter)(c,c);
+    for (j=4<<_f;j-->0;) {
+      _c[_stride*(j-(2<<_f))+i]=c[j];
+    }
+  }
+}
+
+static void od_pre_filter_rows4_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,0,od_pre_filter4);
+}
+
+static void od_pre_filter_rows8_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,1,od_pre_filter8);
+}
+
+static void od_pre_filter_rows16_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,2,od_pre_filter16);
+}
+
+static void od_post_filter_rows4_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,0,od_post_filter4);
+}
+
+static void od_post_filter_rows8_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,1,od_post_filter8);
+}
+
+static void od_post_filter_rows16_c(od_coeff *_c,int _stride,int _n){
+  od_filter_rows_c(_c,_stride,_n,2,od_post_filter16);
+}
+
+static void od_pre_filter_cols4_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,0,od_pre_filter4);
+}
+
+static void od_pre_filter_cols8_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,1,od_pre_filter8);
+}
+
+static void od_pre_filter_cols16_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,2,od_pre_filter16);
+}
+
+static void od_post_filter_cols4_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,0,od_post_filter4);
+}
+
+static void od_post_filter_cols8_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,1,od_post_filter8);
+}
+
+static void od_post_filter_cols16_c(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_c(_c,_stride,_n,2,od_post_filter16);
+}
+
+const od_filter_vtbl OD_FILTER_VTBL_C={
+  {
+    {od_pre_filter_rows4_c,od_pre_filter_rows8_c,od_pre_filter_rows16_c},
+    {od_post_filter_rows4_c,od_post_filter_rows8_c,od_post_filter_rows16_c}
+  },
+  {
+    {od_pre_filter_cols4_c,od_pre_filter_cols8_c,od_pre_filter_cols16_c},
+    {od_post_filter_cols4_c,od_post_filter_cols8_c,od_post_filter_cols16_c}
+  }
+};
+
+static void od_apply_filter_rows(const od_filter_vtbl *_vtbl,od_coeff *_c,
+ int _stride,int _sbx,int _sby,int _l,const unsigned char *_bsize,int _bstride,
+ int _inv){
   int f;
   int i;
   /*Assume we use the filter for the current blocks size.*/
@@ -639,22 +727,20 @@ static void od_apply_filter_rows(od_coeff *_c,int _stride,int _sbx,int _sby,
   }
   OD_ASSERT(0<=f&&f<=OD_NBSIZES);
   /* Apply the row filter down the edge. */
-  for (i=4<<_l;i-->0;) {
-    (*(_inv?OD_POST_FILTER:OD_PRE_FILTER)[f])(&_c[i*_stride-(2<<f)],
-     &_c[i*_stride-(2<<f)]);
+  (*_vtbl->rows[_inv][f])(_c,_stride,4<<_l);
 #if ZERO_FILTERS
-    {
-      int j;
-      for (j=4<<_l;j-->0;) {
-        _c[i*_stride-(2<<f)+j]=0;
-      }
+  for (i=4<<_l;i-->0;) {
+    int j;
+    for (j=4<<_l;j-->0;) {
+      _c[i*_stride-(2<<f)+j]=0;
     }
-#endif
   }
+#endif
 }
 
-static void od_apply_filter_cols(od_coeff *_c,int _stride,int _sbx,int _sby,
- int _l,const unsigned char *_bsize,int _bstride,int _inv){
+static void od_apply_filter_cols(const od_filter_vtbl *_vtbl,od_coeff *_c,
+ int _stride,int _sbx,int _sby,int _l,const unsigned char *_bsize,int _bstride,
+ int _inv){
   int f;
   int i;
   /*Assume we use the filter for the current blocks size.*/
@@ -682,24 +768,20 @@ static void od_apply_filter_cols(od_coeff *_c,int _stride,int _sbx,int _sby,
   }
   OD_ASSERT(0<=f&&f<=OD_NBSIZES);
   /* Apply the column filter across the edge. */
+  (*_vtbl->cols[_inv][f])(_c,_stride,4<<_l);
+#if ZERO_FILTERS
   for (i=4<<_l;i-->0;) {
     int j;
-    int c[4<<OD_NBSIZES];
     for (j=4<<f;j-->0;) {
-      c[j]=_c[_stride*(j-(2<<f))+i];
-    }
-    (*(_inv?OD_POST_FILTER:OD_PRE_FILTER)[f])(c,c);
-    for (j=4<<f;j-->0;) {
-      _c[_stride*(j-(2<<f))+i]=c[j];
-#if ZERO_FILTERS
       _c[_stride*(j-(2<<f))+i]=0;
-#endif
     }
   }
+#endif
 }
 
-void od_apply_filter(od_coeff *_c,int _stride,int _sbx,int _sby,int _l,
- const unsigned char *_bsize,int _bstride,int _edge,int _mask,int _inv){
+void od_apply_filter(const od_filter_vtbl *_vtbl,od_coeff *_c,int _stride,
+ int _sbx,int _sby,int _l,const unsigned char *_bsize,int _bstride,int _edge,
+ int _mask,int _inv){
   int sz;
   sz=4<<_l;
   /*Hack to correct for having block size decisions of 32x32 but we
@@ -707,25 +789,26 @@ void od_apply_filter(od_coeff *_c,int _stride,int _sbx,int _sby,int _l,
     Remove check for _l!=3 if we later support larger filter sizes.*/
   if (_l!=3&&OD_BLOCK_SIZE4x4(_bsize,_bstride,_sbx,_sby)==_l) {
     if (_edge&OD_BOTTOM_EDGE&_mask) {
-      od_apply_filter_cols(&_c[_stride*sz],_stride,_sbx,_sby+(1<<_l),_l,
-       _bsize,_bstride,_inv);
+      od_apply_filter_cols(_vtbl,&_c[_stride*sz],_stride,_sbx,_sby+(1<<_l),
+       _l,_bsize,_bstride,_inv);
     }
     if (_edge&OD_RIGHT_EDGE&_mask) {
-      od_apply_filter_rows(&_c[sz],_stride,_sbx+(1<<_l),_sby,_l,
+      od_apply_filter_rows(_vtbl,&_c[sz],_stride,_sbx+(1<<_l),_sby,_l,
        _bsize,_bstride,_inv);
     }
   }
   else {
     _l--;
     sz>>=1;
-    od_apply_filter(&_c[0*sz+0*sz*_stride],_stride,_sbx+(0<<_l),_sby+(0<<_l),
-     _l,_bsize,_bstride,_edge,_mask|OD_BOTTOM_EDGE|OD_RIGHT_EDGE,_inv);
-    od_apply_filter(&_c[1*sz+0*sz*_stride],_stride,_sbx+(1<<_l),_sby+(0<<_l),
-     _l,_bsize,_bstride,_edge,_mask|OD_BOTTOM_EDGE,_inv);
-    od_apply_filter(&_c[0*sz+1*sz*_stride],_stride,_sbx+(0<<_l),_sby+(1<<_l),
-     _l,_bsize,_bstride,_edge,_mask|OD_RIGHT_EDGE,_inv);
-    od_apply_filter(&_c[1*sz+1*sz*_stride],_stride,_sbx+(1<<_l),_sby+(1<<_l),
-     _l,_bsize,_bstride,_edge,_mask,_inv);
+    od_apply_filter(_vtbl,&_c[0*sz+0*sz*_stride],_stride,_sbx+(0<<_l),
+     _sby+(0<<_l),_l,_bsize,_bstride,_edge,
+     _mask|OD_BOTTOM_EDGE|OD_RIGHT_EDGE,_inv);
+    od_apply_filter(_vtbl,&_c[1*sz+0*sz*_stride],_stride,_sbx+(1<<_l),
+     _sby+(0<<_l),_l,_bsize,_bstride,_edge,_mask|OD_BOTTOM_EDGE,_inv);
+    od_apply_filter(_vtbl,&_c[0*sz+1*sz*_stride],_stride,_sbx+(0<<_l),
+     _sby+(1<<_l),_l,_bsize,_bstride,_edge,_mask|OD_RIGHT_EDGE,_inv);
+    od_apply_filter(_vtbl,&_c[1*sz+1*sz*_stride],_stride,_sbx+(1<<_l),
+     _sby+(1<<_l),_l,_bsize,_bstride,_edge,_mask,_inv);
   }
 }
 
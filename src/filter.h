@@ -47,6 +47,23 @@ typedef void (*od_filter_func)(od_coeff _out[],const od_coeff _in[]);
 extern const od_filter_func OD_PRE_FILTER[OD_NBSIZES];
 extern const od_filter_func OD_POST_FILTER[OD_NBSIZES];
 
+/*Applies one pre- or post-filter to _n lines that cross a block edge.
+  _c points to the first sample past the edge in the first line, and the filter
+   covers the same number of samples on either side of it.*/
+typedef void (*od_filter_lines_func)(od_coeff *_c,int _stride,int _n);
+
+typedef struct od_filter_vtbl od_filter_vtbl;
+
+/*The filters used by od_apply_filter(), indexed by [_inv][filter size].*/
+struct od_filter_vtbl{
+  /*Filters _n rows across a vertical edge.*/
+  od_filter_lines_func rows[2][OD_NBSIZES];
+  /*Filters _n columns across a horizontal edge.*/
+  od_filter_lines_func cols[2][OD_NBSIZES];
+};
+
+extern const od_filter_vtbl OD_FILTER_VTBL_C;
+
 /*These are the pre/post filtering functions used by Daala.
   The idea is to pre/post filter in the spatial domain (the time domain in
    signal processing terms) to improve the energy compaction as well as reduce
@@ -66,7 +83,8 @@ void od_post_filter16(od_coeff _x[16],const od_coeff _y[16]);
 #define OD_RIGHT_EDGE  (1<<1)
 #define OD_BOTTOM_EDGE (1<<0)
 
-void od_apply_filter(od_coeff *_c,int _stride,int _sbx,int _sby,int _l,
- const unsigned char *_bsize,int _bstride,int _edge,int _mask,int _inv);
+void od_apply_filter(const od_filter_vtbl *_vtbl,od_coeff *_c,int _stride,
+ int _sbx,int _sby,int _l,const unsigned char *_bsize,int _bstride,int _edge,
+ int _mask,int _inv);
 
 #endif
@@ -0,0 +1,18 @@
+/* This file is auto-generated using "gen_generic_cdf" */
+
+#include "generic_code.h"
+
+const ogg_uint16_t generic_cdf_init[12][16] = {
+  { 8896,12951,14805,15655,16046,16226,16309,16348,16366,16374,16378,16380,16381,16382,16383,16384},
+  { 7486,11541,13743,14941,15594,15951,16146,16253,16312,16344,16362,16372,16377,16380,16382,16384},
+  { 6114, 9938,12332,13834,14777,15370,15743,15978,16127,16221,16280,16318,16342,16357,16367,16384},
+  { 4858, 8268,10664,12349,13535,14371,14960,15376,15670,15878,16025,16129,16203,16255,16292,16384},
+  { 3762, 6655, 8881,10595,11915,12932,13716,14321,14788,15149,15428,15643,15810,15939,16039,16384},
+  { 2854, 5207, 7148, 8750,10072,11164,12065,12810,13425,13934,14355,14703,14991,15229,15426,16384},
+  { 2128, 3977, 5584, 6982, 8197, 9254,10174,10974,11670,12276,12804,13263,13663,14011,14314,16384},
+  { 1564, 4255, 6454, 8251, 9721,10923,11907,12712,13371,13911,14354,14717,15014,15258,15458,16384},
+  { 1138, 3181, 4948, 6476, 7798, 8943, 9934,10792,11535,12178,12735,13218,13636,13999,14313,16384},
+  { 1602, 4347, 6578, 8393, 9869,11070,12048,12845,13494,14023,14455,14807,15094,15329,15521,16384},
+  { 1158, 3231, 5020, 6564, 7896, 9046,10039,10896,11637,12277,12830,13308,13721,14078,14387,16384},
+  { 1621, 4396, 6644, 8467, 9946,11147,12122,12914,13558,14081,14507,14853,15135,15365,15552,16384}
+};
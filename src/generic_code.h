@@ -35,6 +35,8 @@ typedef struct {
   int increment; /**< Frequency increment for learning the cdfs */
 } GenericEncoder;
 
+extern const ogg_uint16_t generic_cdf_init[GENERIC_TABLES][16];
+
 void generic_model_init(GenericEncoder *model);
 
 void generic_encode(od_ec_enc *enc, GenericEncoder *model, int x, int *ExQ16, int integration);
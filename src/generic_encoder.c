@@ -23,6 +23,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 #include <stdio.h>
+#include <string.h>
 
 #include "generic_code.h"
 #include "entenc.h"
@@ -37,16 +38,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
  */
 void generic_model_init(GenericEncoder *model)
 {
-  int i, j;
   model->increment = 64;
-  for (i=0;i<GENERIC_TABLES;i++)
-  {
-    for(j=0;j<16;j++)
-    {
-      /* FIXME: Come on, we can do better than flat initialization! */
-      model->cdf[i][j] = (j+1)<<10;
-    }
-  }
+  /* Start from the distribution we expect for each table (see
+     tools/gen_generic_cdf.c), rather than a flat one. */
+  memcpy(model->cdf, generic_cdf_init, sizeof(model->cdf));
 }
 
 /** Encodes a random variable using a "generic" model, assuming that the distribution is
@@ -23,6 +23,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
 #include "filter.h"
 #include "intra.h"
@@ -34,6 +35,18 @@ const od_intra_mult_func OD_INTRA_MULT[OD_NBSIZES]={
   od_intra_pred16x16_mult
 };
 
+const od_intra_get_func OD_INTRA_GET[OD_NBSIZES]={
+  od_intra_pred4x4_get,
+  od_intra_pred8x8_get,
+  od_intra_pred16x16_get
+};
+
+const od_intra_dist_func OD_INTRA_DIST[OD_NBSIZES]={
+  od_intra_pred4x4_dist,
+  od_intra_pred8x8_dist,
+  od_intra_pred16x16_dist
+};
+
 void od_intra_pred4x4_mult(double *_pred,int _pred_stride,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode){
   int j;
@@ -159,218 +172,268 @@ void od_intra_pred16x16_mult(double *_pred,int _pred_stride,
   }
 }
 
-static const float OD_SATD_WEIGHTS_4x4[3][4*4]={
+const ogg_int16_t OD_SATD_WEIGHTS_4x4_Q8[3][4*4]={
   {
-    0.230317,0.329547,0.457088,0.517193,0.315611,0.389662,0.525445,0.577099,
-    0.424841,0.506366,0.648566,0.696878,0.473835,0.543352,0.681457,0.720876
+     59, 84,117,132, 81,100,135,148,109,130,166,178,121,139,174,185
   },
   {
-    0.458235,0.617704,0.811118,0.890949,0.601811,0.711183,0.906126,0.962359,
-    0.776575,0.882826,1.038644,1.073067,0.851901,0.929541,1.065617,1.084039
+    117,158,208,228,154,182,232,246,199,226,266,275,218,238,273,278
   },
   {
-    0.481204,0.631404,0.829253,0.905577,0.615889,0.736232,0.930215,0.983703,
-    0.802367,0.908049,1.060383,1.091684,0.872241,0.953467,1.087123,1.106003
+    123,162,212,232,158,188,238,252,205,232,271,279,223,244,278,283
   }
 };
 
-static const float OD_SATD_WEIGHTS_8x8[3][8*8]={
+static const ogg_int16_t OD_SATD_WEIGHTS_8x8_Q8[3][8*8]={
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   },
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   },
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   }
 };
 
-static const float OD_SATD_WEIGHTS_16x16[3][16*16]={
+static const ogg_int16_t OD_SATD_WEIGHTS_16x16_Q8[3][16*16]={
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   },
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   },
   {
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,
-    1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000,1.000000
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256,
+    256,256,256,256,256,256,256,256
   }
 };
 
-void od_intra_pred4x4_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
- od_coeff *_neighbors[4],int _neighbor_strides[4], int _pli){
-  double p[4*4];
-  float  satd;
-  int    mode;
-  int    i;
-  int    j;
-  for(mode=0;mode<OD_INTRA_NMODES;mode++){
-    od_intra_pred4x4_mult(p,4,_neighbors,_neighbor_strides,mode);
-    satd=0;
-    for(i=0;i<4;i++){
-      for(j=0;j<4;j++){
-        satd+=
-         fabs((_c[_stride*i+j]-p[i*4+j])*OD_SATD_WEIGHTS_4x4[_pli][i*4+j]);
-      }
+typedef struct od_intra_pred_taps od_intra_pred_taps;
+
+/*The fixed-point prediction taps for one block size.*/
+struct od_intra_pred_taps{
+  const int            *mults;
+  const int            *offsets;
+  const unsigned short *index;
+  const ogg_int32_t    *weights_q12;
+};
+
+static const od_intra_pred_taps OD_INTRA_PRED_TAPS[OD_NBSIZES]={
+  {
+    OD_PRED_MULTS_4x4[0][0],OD_PRED_OFFSETS_4x4,
+    OD_PRED_INDEX_4x4,OD_PRED_WEIGHTS_4x4_Q12
+  },
+  {
+    OD_PRED_MULTS_8x8[0][0],OD_PRED_OFFSETS_8x8,
+    OD_PRED_INDEX_8x8,OD_PRED_WEIGHTS_8x8_Q12
+  },
+  {
+    OD_PRED_MULTS_16x16[0][0],OD_PRED_OFFSETS_16x16,
+    OD_PRED_INDEX_16x16,OD_PRED_WEIGHTS_16x16_Q12
+  }
+};
+
+/*Copies the UL, U, UR and L neighbors of an _n x _n block into the single
+   buffer the fixed-point taps index, so the predictors never have to work out
+   which neighbor a tap refers to.*/
+static void od_intra_pred_gather(od_coeff *_buf,int _n,
+ od_coeff *_neighbors[4],int _neighbor_strides[4]){
+  int bi;
+  int j;
+  for(j=0;j<_n;j++){
+    for(bi=0;bi<3;bi++){
+      memcpy(_buf+3*_n*j+_n*bi,_neighbors[bi]+_neighbor_strides[bi]*j,
+       _n*sizeof(*_buf));
     }
-    _dist[mode]=satd;
+    memcpy(_buf+3*_n*(_n+j),_neighbors[3]+_neighbor_strides[3]*j,
+     _n*sizeof(*_buf));
   }
 }
 
-void od_intra_pred8x8_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
- od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli){
-  double p[8*8];
-  float  satd;
-  int    mode;
-  int    i;
-  int    j;
+/*Computes the prediction for mode _mode of a block of size 4<<_ln from the
+   neighbors gathered by od_intra_pred_gather().*/
+static void od_intra_pred_fixed(od_coeff *_pred,const od_coeff *_buf,
+ int _ln,int _mode){
+  const od_intra_pred_taps *taps;
+  const int                *mults;
+  const unsigned short     *index;
+  const ogg_int32_t        *weights_q12;
+  int                       n2;
+  int                       ci;
+  int                       k;
+  taps=OD_INTRA_PRED_TAPS+_ln;
+  n2=1<<2*(_ln+2);
+  mults=taps->mults+n2*_mode;
+  index=taps->index+taps->offsets[_mode];
+  weights_q12=taps->weights_q12+taps->offsets[_mode];
+  k=0;
+  for(ci=0;ci<n2;ci++){
+    ogg_int64_t sum;
+    int         kend;
+    sum=0;
+    for(kend=k+mults[ci];k<kend;k++){
+      sum+=_buf[index[k]]*(ogg_int64_t)weights_q12[k];
+    }
+    _pred[ci]=(od_coeff)(sum+(1<<OD_INTRA_PRED_SHIFT-1)>>OD_INTRA_PRED_SHIFT);
+  }
+}
+
+static void od_intra_pred_dist(ogg_uint32_t *_dist,
+ const od_coeff *_c,int _stride,od_coeff *_neighbors[4],
+ int _neighbor_strides[4],const ogg_int16_t *_satd_weights_q8,int _ln){
+  od_coeff buf[6*16*16];
+  od_coeff p[16*16];
+  int      n;
+  int      mode;
+  int      i;
+  int      j;
+  n=4<<_ln;
+  od_intra_pred_gather(buf,n,_neighbors,_neighbor_strides);
   for(mode=0;mode<OD_INTRA_NMODES;mode++){
-    od_intra_pred8x8_mult(p,8,_neighbors,_neighbor_strides,mode);
+    ogg_uint32_t satd;
+    od_intra_pred_fixed(p,buf,_ln,mode);
     satd=0;
-    for(i=0;i<8;i++){
-      for(j=0;j<8;j++){
-        satd+=
-         fabs((_c[_stride*i+j]-p[i*8+j])*OD_SATD_WEIGHTS_8x8[_pli][i*8+j]);
+    for(i=0;i<n;i++){
+      for(j=0;j<n;j++){
+        satd+=abs(_c[_stride*i+j]-p[i*n+j])
+         *(ogg_uint32_t)_satd_weights_q8[i*n+j];
       }
     }
-    _dist[mode]=satd;
+    _dist[mode]=satd>>8;
   }
 }
 
+void od_intra_pred4x4_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli){
+  od_intra_pred_dist(_dist,_c,_stride,_neighbors,_neighbor_strides,
+   OD_SATD_WEIGHTS_4x4_Q8[_pli],0);
+}
+
+void od_intra_pred8x8_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli){
+  od_intra_pred_dist(_dist,_c,_stride,_neighbors,_neighbor_strides,
+   OD_SATD_WEIGHTS_8x8_Q8[_pli],1);
+}
+
 void od_intra_pred16x16_dist(ogg_uint32_t *_dist,
  const od_coeff *_c,int _stride,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli){
-  double p[16*16];
-  float  satd;
-  int    mode;
-  int    i;
-  int    j;
-  for(mode=0;mode<OD_INTRA_NMODES;mode++){
-    od_intra_pred16x16_mult(p,16,_neighbors,_neighbor_strides,mode);
-    satd=0;
-    for(i=0;i<16;i++){
-      for(j=0;j<16;j++){
-        satd+=
-         fabs((_c[_stride*i+j]-p[i*16+j])*OD_SATD_WEIGHTS_16x16[_pli][i*16+j]);
-      }
-    }
-    _dist[mode]=satd;
-  }
+  od_intra_pred_dist(_dist,_c,_stride,_neighbors,_neighbor_strides,
+   OD_SATD_WEIGHTS_16x16_Q8[_pli],2);
 }
 
 /*These are used to weight the samples we use to build the chroma-from-luma
@@ -450,57 +513,41 @@ void od_chroma_pred4x4(od_coeff *_p,const od_coeff *_c,
 
 ogg_uint32_t od_chroma_pred4x4_dist(const od_coeff *_c,
  const od_coeff *_l,int _stride,const int _weights_q8[3],int _pli){
-  od_coeff p[4*4];
-  float    satd;
-  int      i;
-  int      j;
+  od_coeff     p[4*4];
+  ogg_uint32_t satd;
+  int          i;
+  int          j;
   od_chroma_pred4x4(p,_c,_l,_stride,_weights_q8);
   satd=0;
   for(i=0;i<4;i++){
     for(j=0;j<4;j++){
-      satd+=abs(_c[_stride*i+j]-p[i*4+j])*OD_SATD_WEIGHTS_4x4[_pli][i*4+j];
+      satd+=abs(_c[_stride*i+j]-p[i*4+j])
+       *(ogg_uint32_t)OD_SATD_WEIGHTS_4x4_Q8[_pli][i*4+j];
     }
   }
-  return (ogg_uint32_t)satd;
+  return satd>>8;
+}
+
+static void od_intra_pred_get(od_coeff *_out,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode,int _ln){
+  od_coeff buf[6*16*16];
+  od_intra_pred_gather(buf,4<<_ln,_neighbors,_neighbor_strides);
+  od_intra_pred_fixed(_out,buf,_ln,_mode);
 }
 
 void od_intra_pred4x4_get(od_coeff *_out,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode){
-  double p[4*4];
-  int    i;
-  int    j;
-  od_intra_pred4x4_mult(p,4,_neighbors,_neighbor_strides,_mode);
-  for(i=0;i<4;i++){
-    for(j=0;j<4;j++){
-      _out[4*i+j]=(od_coeff)floor(p[i*4+j]+0.5);
-    }
-  }
+  od_intra_pred_get(_out,_neighbors,_neighbor_strides,_mode,0);
 }
 
 void od_intra_pred8x8_get(od_coeff *_out,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode){
-  double p[8*8];
-  int    i;
-  int    j;
-  od_intra_pred8x8_mult(p,8,_neighbors,_neighbor_strides,_mode);
-  for(i=0;i<8;i++){
-    for(j=0;j<8;j++){
-      _out[8*i+j]=(od_coeff)floor(p[i*8+j]+0.5);
-    }
-  }
+  od_intra_pred_get(_out,_neighbors,_neighbor_strides,_mode,1);
 }
 
 void od_intra_pred16x16_get(od_coeff *_out,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode){
-  double p[16*16];
-  int    i;
-  int    j;
-  od_intra_pred16x16_mult(p,16,_neighbors,_neighbor_strides,_mode);
-  for(i=0;i<16;i++){
-    for(j=0;j<16;j++){
-      _out[16*i+j]=(od_coeff)floor(p[i*16+j]+0.5);
-    }
-  }
+  od_intra_pred_get(_out,_neighbors,_neighbor_strides,_mode,2);
 }
 
 void od_intra_pred_cdf(ogg_uint16_t _cdf[],
@@ -30,10 +30,24 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 # define OD_INTRA_NCONTEXTS (8)
 
+/*The fixed-point intra prediction weights are stored in Q12.*/
+# define OD_INTRA_PRED_SHIFT (12)
+
+/*The largest number of pairs of neighbors any 4x4 mode predicts from.*/
+# define OD_PRED_MAX_PAIRS_4x4 (22)
+
 typedef void (*od_intra_mult_func)(double *_p,int _pred_stride,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode);
 
+typedef void (*od_intra_get_func)(od_coeff *_out,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode);
+typedef void (*od_intra_dist_func)(ogg_uint32_t *_dist,
+ const od_coeff *_c,int _stride,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli);
+
 extern const od_intra_mult_func OD_INTRA_MULT[OD_NBSIZES];
+extern const od_intra_get_func OD_INTRA_GET[OD_NBSIZES];
+extern const od_intra_dist_func OD_INTRA_DIST[OD_NBSIZES];
 
 extern const double OD_INTRA_PRED_WEIGHTS_4x4[OD_INTRA_NMODES][4][4][2*4][2*4];
 extern const unsigned char OD_INTRA_PRED_PROB_4x4[3]
@@ -64,6 +78,8 @@ void od_intra_pred8x8_get(od_coeff *_out,
 void od_intra_pred16x16_get(od_coeff *_out,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode);
 
+/*Computes the weighted SATD of the prediction from every mode, using the same
+   fixed-point predictors as od_intra_pred4x4_get().*/
 void od_intra_pred4x4_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli);
 void od_intra_pred8x8_dist(ogg_uint32_t *_dist,const od_coeff *_c,int _stride,
@@ -72,6 +88,8 @@ void od_intra_pred16x16_dist(ogg_uint32_t *_dist,
  const od_coeff *_c,int _stride,
  od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli);
 
+extern const ogg_int16_t OD_SATD_WEIGHTS_4x4_Q8[3][4*4];
+
 extern const signed char OD_INTRA_CHROMA_WEIGHTS_Q6[OD_INTRA_NMODES][3];
 
 void od_chroma_pred4x4(od_coeff *_p,const od_coeff *_c,
@@ -106,5 +124,29 @@ extern const int OD_PRED_MULTS_16x16[OD_INTRA_NMODES][16][16];
 extern const int *OD_PRED_PARAMX_16x16[OD_INTRA_NMODES][16][16];
 extern const int *OD_PRED_PARAMY_16x16[OD_INTRA_NMODES][16][16];
 
+/*The fixed-point taps of each mode, starting at OD_PRED_OFFSETS_NxN[mode],
+   with OD_PRED_MULTS_NxN taps for each coefficient in raster order.
+  The neighbors are indexed in a buffer 3*N coefficients wide, with the UL, U
+   and UR blocks side by side in the first N rows and the L block in the first
+   N columns of the next N rows.*/
+extern const int OD_PRED_OFFSETS_4x4[OD_INTRA_NMODES];
+extern const unsigned short OD_PRED_INDEX_4x4[];
+extern const ogg_int32_t OD_PRED_WEIGHTS_4x4_Q12[];
+extern const int OD_PRED_OFFSETS_8x8[OD_INTRA_NMODES];
+extern const unsigned short OD_PRED_INDEX_8x8[];
+extern const ogg_int32_t OD_PRED_WEIGHTS_8x8_Q12[];
+extern const int OD_PRED_OFFSETS_16x16[OD_INTRA_NMODES];
+extern const unsigned short OD_PRED_INDEX_16x16[];
+extern const ogg_int32_t OD_PRED_WEIGHTS_16x16_Q12[];
+
+/*The 4x4 taps transposed for SIMD: each mode lists the pairs of neighbors it
+   uses, and for each pair, the weights of both neighbors interleaved for every
+   coefficient in raster order.*/
+extern const int OD_PRED_NPAIRS_4x4[OD_INTRA_NMODES];
+extern const unsigned char
+ OD_PRED_PAIR_INDEX_4x4[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][2];
+extern const ogg_int16_t
+ OD_PRED_PAIR_WEIGHTS_4x4_Q12[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][4*4*2];
+
 
 #endif
@@ -0,0 +1,3909 @@
+/* This file is auto-generated using "gen_intra_fixed" */
+
+#include "intra.h"
+
+const int OD_PRED_OFFSETS_4x4[OD_INTRA_NMODES]={
+  0, 64, 128, 192, 256, 320, 384, 448, 512, 576
+};
+
+const unsigned short OD_PRED_INDEX_4x4[640]={
+     0,   2,  24,  16,  17,  28,   8,   9,  21,  32,  48,  49,
+    50,  60,   4,   5,  17,  48,   6,  18,  50,   7,  19,   0,
+    12,   4,   8,  20,  21,  48,  49,  60,  61,  72,  13,   5,
+    17,  29,  20,  62,   6,  18,  62,   7,  19,  28,  72,  73,
+    21,  33,  34,  72,  73,  74,  34,  73,  74,  84,  85,  84,
+    85,  46,  86,  86,   0,   1,   2,  24,   4,  16,  28,   8,
+    48,  49,  50,  61,   0,   5,  17,  29,   8,  48,   2,   4,
+     6,  30,   8,  10,  49,  50,   3,   7,  11,  51,   4,  48,
+    60,  61,  62,  63,   5,  62,  63,  24,  16,  32,  72,  73,
+    74,  17,  26,  30,  34,  74,  27,  31,  35,  75,  84,  86,
+    38,  42,  46,  86,  39,  43,  47,  87,  12,   4,  17,   8,
+     9,  20,  48,  49,  51,  60,  61,  62,  63,  73,  74,  75,
+    85,  48,  49,  50,  51,  60,  63,  49,  50,  51,   0,  16,
+    17,  28,  29,   8,  20,  32,  60,  61,  72,  73,  74,  85,
+    86,  60,  61,  62,  61,  62,  16,  28,  29,  40,  20,  32,
+    44,  84,  85,  73,  74,  73,  74,  28,  72,  84,  86,  86,
+     0,  25,  37,   4,  48,  49,  50,  51,  73,  74,  75,   5,
+    49,  50,  51,   4,   8,  49,  50,  51,   0,  24,  36,   4,
+    28,  40,  60,  61,  62,  63,  85,   5,  29,  41,  61,  62,
+    63,   6,  42,  61,  62,  63,   7,  19,   4,  48,  72,  73,
+    74,   5,  29,  73,  74,  75,  73,  74,  84,  85,  84,  85,
+    86,  87,  85,  86,   0,   1,  12,  13,  25,   4,  48,  49,
+    60,  61,   0,   5,  17,  48,  49,  50,   6,  49,  50,   0,
+     1,  12,  13,  24,  25,   5,  17,  48,  49,  60,  72,  73,
+     5,  17,  60,  61,   6,  62,  19,  12,  24,  25,  36,  16,
+    28,  29,  60,  61,  72,  73,  84,  73,  74,  74,   0,  48,
+    72,  84,  85,  84,  85,  86,  85,  86,   0,   1,  12,  13,
+     4,   5,  16,  17,  28,  29,  40,  41,  20,  32,  33,  44,
+    45,  48,  50,  51,  60,  61,  62,  74,   4,   5,  17,  48,
+    49,  49,  50,  12,  13,  25,   4,  16,  17,  48,  60,  61,
+    62,  63,  72,   0,  12,  13,   4,  16,  48,  61,  61,  62,
+    16,  28,  72,  73,  17,  29,  30,  86,  74,  84,  85,  86,
+     0,   1,  12,  13,   4,   5,  16,  17,  60,  61,   0,   1,
+     2,  12,  13,  14,   4,   6,  16,  18,   8,  48,  49,  50,
+    60,  61,  62,   1,   2,   4,   5,   6,  18,   8,  49,  50,
+    51,   7,  19,   8,  48,  50,   4,  48,  60,  61,   0,   1,
+    17,  29,  48,  49,  60,  61,  14,   7,  72,  73,  72,  73,
+    31,  36,  40,  44,  14,   4,  16,  18,  28,  40,  20,  21,
+    22,   0,   2,   3,  14,   5,  17,  29,  41,  48,  50,  51,
+     0,   6,  18,  48,  50,   0,   7,  19,  48,  16,  28,  40,
+    17,  29,  41,  62,  63,  18,  30,  42,  60,  62,  63,  19,
+    31,  43,  16,  28,  40,  17,  29,  41,  74,  75,  18,  30,
+    72,  74,  36,  40,  85,  84,  87,  46,   4,   5,  16,  17,
+    28,  29,  40,  41,   8,   9,  20,  21,  22,  32,  33,  60,
+    61,   4,   6,  16,  18,   8,   9,  10,  20,  21,  60,  61,
+     0,   5,   6,  18,   8,   9,  10,  21,  49,  50,   7,  18,
+    19,   8,  48,   4,  16,  28,  40,   8,   5,  17,  29,   7,
+    18,  10,   6,   7,  31,  10,  11,  16,  28,  30,  19,  31,
+     0,  12,  13,   4,   5,  16,  17,  28,  40,   8,   9,  20,
+    32,  48,  51,  60,  61,  72,  84,   4,   5,  17,   8,  20,
+    48,  49,  50,  18,  49,  50,   4,   5,  16,  17,  28,   8,
+     9,  21,  49,   4,  16,  18,   8,   9,  21,  22,  33,  73,
+     6,  18,  21,  61,  62,  63,  19,  16,  28,  73,  17,  29,
+    73,  30,  22,  34
+};
+
+const ogg_int32_t OD_PRED_WEIGHTS_4x4_Q12[640]={
+     922,  -830,  -649,  1446,  -791,  -737,  1146,  -728,   987,  -967,
+    2039,  3061, -1416, -2851,  -189,  -965,   962,   183,  -494,   613,
+     539,  -523,   615,  -428,   808,  -285,   473,  -904,  -632,   228,
+    -431,  -658,   879, -1289,   440,  -589,   611,  -534,   369,   822,
+    -533,   536,   623,  -471,   551,   433,  -776,   824,   343,  -902,
+    -698,  -515,   663,   759,  -511,  -333,  1275, -1191,   600,  -870,
+    1277,  -437,   977,   358, -2121,  -409,   953,   962,  2251,   480,
+   -1201,   356,  3332,  1142, -1350,  -660,   132,  1989,   666, -1145,
+    -233,   124,  -721,   -88,  2015,  -687,    88,  -490,  -258,  -580,
+    -454,  1370,  -554, -1370,   274,  -228,  3182,  1484, -1932,  1093,
+     259,   265,  -643,  -286,  -179,  -356,  3037,   506,  -899,  -231,
+     704,  -731,   511, -1234,   611,  -600,   606, -1584,  3634,  -913,
+     662, -1213,   733,  -739,   810,  -744,   692, -1202,   467,  -746,
+     877,   622,  -806,  -702,  3487, -4545,  3380, -2889,  7811, -7200,
+    4178, -3379,  3646, -3365,  2194,   114, -1016,  2519, -2010,   344,
+    1322,  -347,   801,  -795,  -161,  -501,   797,   944, -1072,   211,
+    -607,  1389,  1898, -1797, -3579,  5349, -3763, -2314,  2544,   270,
+    -865,  1514,  -320,   696,  -410,   971,  -754,  -679,  -251,   729,
+    -678, -1546,  1435,  -719,  1092,  -270,   598,   396,   422,  -838,
+     925,   627,   168,   902,  -973,  -169,  4140, -7259,  7590, -4866,
+    1438, -2639,  1916,  -285,  -533,  1546, -1507,    44,   -43,  -328,
+     711,  -605,   176,  -453,   482,  -189,   535,  -470,  3580, -4416,
+    3254, -1582,   985,  -233,   584,  -552,  -563,  1198, -1010,  -303,
+    -485,  -279,   642,  -458,  -337,   295,   -58,    68,  2823, -2723,
+    1085,  -142,   301,  -485,   910,  -889,  -227,   470,  2322, -2732,
+     220,  -554,   733,  -705,  -218,   380,  1378, -1225, -1351,  1503,
+   -1065,  -393,  3084, -2882,  2277, -2328,  -173,  -700,   688,   169,
+    -450,   792,  -510,  -243,   457,   842,  -685, -1441,  1263,  1417,
+    -997,   538, -1168,  -843,   994,   716,  2490, -1660,  -523,   570,
+     491,  -932,  -457,   500,   552,  -415,   992,  -709,  -806,  -353,
+     672,   668,  -587,   509, -1281,   747,   874,  -933,  1115,   522,
+     -81,    82,  -575, -1973,  1297,  -634, -1177,  1716,  -408,   925,
+    1065, -1038,  -972,  1338,   503,   833,  1093, -2333, -4430,  2951,
+    6883, -2396,  1059, -2949, -1968,  3587,  2144,   966, -7864, 10298,
+    1890, -3103,  3499,  3027,  -336,  -820,  1070,   660, -1586,  -329,
+     800,  -799,  1099, -1307,   886, -1803, -1430,  -436, -1207,  1048,
+   -2277,  2666,  2248,   285,  -556,   934,  -201,   539,  -176,  -779,
+    -451,  1054,  -387,   865,  -808,   834,  -447,   892,  1337,  1402,
+    1203,  -649,   988,   704,  1300, -1364, -1964,  1997,  2762,  2590,
+   -2119, -2803,  1420, -1381,   551,  -991,  1452,  -602,   884, -1216,
+    -987,  2245,   947, -1494,   182,   251,  -710,   925,   592, -1343,
+    1542,  -241,   632,   125,  -461, -1288,   755,  -126,  -372,   921,
+    -815, -1181,   786,    72,   -72,   348,   196,  -191, -1282,   999,
+     177,  -331,  -762,   943,  -179,   369,  -467,   657,  -562,  -464,
+    -468,   602,  -405,   527,   572,   817,  1420,   666,   689,  4074,
+   -5550,   613,  4788, -2427,   219,   440,   774,   105,  -442,   450,
+     581,  3810, -3688,  2230,  -844,   -98,   475,  -458,    81,  3208,
+   -2028,   -84,   261,    46,  3013, -1818,   -51,  -722,  1620, -1335,
+    -510,  1024,  -720,   516,  -473,  -382,   744,  -628,  -102,   311,
+    -307,  -438,   494,  -497,  -260,   674,  -583,  -254,   504,  -383,
+     363,  -440,  -164,   289,   -98,   237,  -279,  -368,   285,  -185,
+    -449,   237,  2948, -2435, -4813,  3788,  3999, -3769, -2335,  2646,
+    1148,  1646, -2717, -3408, -1310,  2959,  2762,  -721,   932,   891,
+   -2021,  -945,  1477,  -879, -1777, -1326,   777,  1593,  -533,   795,
+     -83,   524, -1949,   915,    86,   591,   693,  -496,  -257,   678,
+   -1491,  -540,  1259,    72,   -71,   176,  -614,  1737, -1284,  -188,
+     391,  -734,  1124,  -732,  -675,   512,   603, -1258,  1658,  -440,
+    -661,  -321,   636,   676,  -465,   720,  -415,  1261,  -956,   569,
+   -1536,  1617,  1914, -5329,  5757,  3054,  1900, -3681,  1587,   697,
+    1682,  -581,  1171, -1336,  1698,   372, -1373,  1400,  -608,   653,
+     233, -1061,  2033,   835,  -401,  1032,   518,  -673,  -859,  1036,
+    1272,  -491,   606, -1186,  -562,   248,  -483,  1202,  -238,  -833,
+    1235,  1202, -1299,   976,  -648,  1181,  -432,  -354,   880,  -880,
+     898,  -355,   616,   717,  -362,   902,   670,   647,  -478,   642
+};
+
+const int OD_PRED_OFFSETS_8x8[OD_INTRA_NMODES]={
+  0, 256, 512, 768, 1024, 1280, 1536, 1792, 2048, 2304
+};
+
+const unsigned short OD_PRED_INDEX_8x8[2560]={
+     1,   2,   7,  25,  29,  53,  76,  78,  79,  98,   8,   9,
+    11,  38,  56,  57,  80, 129, 132,  16,  17,  19,  20,  40,
+    41,  42,  64,  68,  69,  71,  88,  93,  95, 112, 163, 191,
+   192, 194, 195, 197, 216, 217, 220, 223, 240, 241, 245, 246,
+   247, 270, 340,   4,   8,   9,  10,  57,  19,  64, 192, 193,
+   195, 199,  10, 193, 194,  11, 195,  12, 195, 196,   5,  13,
+    21, 197,   6,  14,  22, 198,   5,  21, 197,   0,  24,  25,
+     8,  33,  56, 104,  16,  40,  64, 192, 216, 218, 219, 265,
+    24,   9,  40,  64, 192, 216, 217, 220, 240, 265,  10, 217,
+   218, 219, 220, 219, 220, 221, 222,  72,   8,  32,  56, 192,
+   217,  33,  57,  65, 240, 241, 242, 244, 244, 246,   8,  56,
+    80, 192,  81, 105,  82, 266, 267, 268, 291, 267, 101,  94,
+   269, 270, 104,  81, 105, 123,  82, 107, 130, 131, 115, 291,
+    99, 123, 106, 107, 114, 115, 139, 290, 291, 292, 315, 107,
+   291, 292, 126, 109, 117, 102, 110, 294, 120, 128, 176, 136,
+   312, 136, 312,  99, 107, 123, 106, 107, 131, 115, 140, 291,
+   316, 339, 115, 315, 316, 125, 128, 133, 181, 141, 142, 317,
+   126, 150, 134, 142, 318, 133, 141, 317, 318, 152, 176, 160,
+   161, 336, 176, 160, 336, 186, 362, 156, 164, 339, 340, 125,
+   149, 152, 157, 165, 341, 126, 150, 158, 166, 342, 149, 165,
+   341, 168, 128, 152, 176, 136, 176, 360, 338, 364, 364, 141,
+   317, 134, 142, 366,   0,   1,   2,   3,   5,  48,  72,  75,
+    96,  98,   8,  33,  56,  57,  80,  87, 104,  16,  43,  68,
+    95, 162, 192, 193, 194, 195, 217, 218, 222, 240, 241, 242,
+   264, 289, 294, 340,   1,   4,   9,  57,  81, 105,  16, 192,
+   193, 196,   1,   9,  10,  82, 193, 194,  11,  83, 194, 195,
+    12, 195, 196,   5,  13,  14,  21, 197, 199,  14,  22, 198,
+   199,  13,  15, 197,  24,  72,  96, 120,   8,  32,  80, 104,
+   128,  40, 192, 194, 216, 218, 219, 242, 264,   0,   9,  33,
+    81, 105, 216, 217, 220,  10,  34,  82, 106, 217, 218,  11,
+    35, 107, 219,  12,  36, 219, 220,  13,  37, 197,  14, 198,
+   222,  15,   0,  96, 120,  32,  56, 104, 128, 192, 216, 240,
+   242, 243, 265,  33,  57, 105, 240, 241, 244,  34,  58, 106,
+   241,  35, 244, 246,  56, 240, 264, 265, 267, 288,  57, 264,
+   265, 265, 266, 268,  77,  85,  93,  78,  94, 270,  80, 104,
+   264, 288, 289, 312,  81, 288, 106, 289,  83, 107,  84, 108,
+   109, 133, 293, 102, 110, 134, 118, 294, 120, 168, 104, 128,
+   133, 136, 288, 312, 313, 336, 360, 312, 313, 313, 342, 149,
+   132, 316, 125, 149, 133, 134, 141, 317, 126, 150, 134, 142,
+   318, 133, 317, 144, 168, 152, 176, 312, 336, 337, 341, 336,
+   337, 134, 155, 156, 317, 340, 149, 133, 157, 165, 341, 126,
+   150, 158, 166, 342, 157, 159, 341, 152, 176, 184, 360, 361,
+   361, 361, 125, 133, 134, 318, 366, 141,   0,   1,  24,  25,
+    11,  32,  33,  56,  57, 176,  16,  17,  40,  41,  65,  88,
+    92, 192, 193, 194, 195, 197, 199, 216, 217, 218, 219, 240,
+   241, 242, 243, 244, 245, 265, 266, 288,   8,  32,  56,  16,
+    40, 192, 193, 194, 195, 216, 217, 219, 240, 241, 193, 194,
+   195, 195, 196, 196,   0,  24,  25,  48,   8,  32,  56,  57,
+    80, 104, 152,  16,  40,  41,  64,  88, 216, 217, 240, 241,
+   242, 243, 265, 266,   8,  32,  34,  56,  58,  81,  16,  40,
+    64, 216, 217, 218, 242, 217, 218, 219, 220, 219, 220, 221,
+     0,  24,  48,  49,   8,  32,  33,  56,  57,  81, 104, 128,
+    64,  65,  88, 216, 217, 240, 241, 264, 265, 266, 289,  33,
+    56,  57,  58,  80,  82, 104,  64,  65,  88, 240, 241, 242,
+   264, 265, 266,  81, 241, 242, 243,  48,  72,   8,  56,  57,
+    80,  81, 105,  88,  89, 112, 240, 241, 288, 289,  56,  57,
+    80,  82, 104, 128,  64,  65,  88,  89, 264, 265, 266, 288,
+   289, 290,  81, 265, 266, 290, 267, 268,  80,  81, 104, 105,
+   112, 113, 136, 264, 265, 288, 289, 312, 313,  81,  82, 104,
+   105, 106, 128, 130, 112, 265, 289, 312, 313, 314, 105, 289,
+   290, 314, 315, 290, 291, 104, 128, 129, 288, 289, 312, 313,
+   336, 105, 106, 128, 130, 137, 288, 289, 290, 336, 337, 129,
+   290, 314, 339, 128, 152, 336, 337, 360, 312, 313, 314, 361,
+   155, 163, 314, 314, 340, 341, 364, 341, 360, 361, 337, 361,
+    24,  25,  48,  49,  72,  73,  32,  56,  80, 192, 193, 194,
+   195, 196, 197, 199, 216, 218, 219, 241, 242, 243, 244, 367,
+     9,  57,  81, 193, 194, 195, 196,  58,  82, 193, 194, 195,
+   196, 197,  59,  83, 195, 196, 197,  12, 193, 194, 196, 197,
+   194, 197, 198, 199, 198, 199, 194,   0,  48,  49,  50,  72,
+    73,  74,  96,   8,  56,  80, 216, 217, 218, 219, 220, 223,
+   265, 266,   9,  57,  81, 217, 218, 219,  10,  58,  82, 217,
+   218, 219,  11,  59,  83, 219, 220, 221,  12,  84, 220, 221,
+    61, 221,  62,  86, 222,  15,  63,  87,   0,  48,  72,  73,
+    96,  97,   8,  56,  80, 104, 192, 216, 240, 241, 242, 243,
+   264,   9,  57,  81, 105, 240, 241, 242, 243,  10,  58,  82,
+   106, 241, 242, 243,  11,  83, 107, 243, 244,  12, 244, 245,
+   245, 246,   0,  24,  72,  96,   8,  32,  80, 104, 192, 193,
+   240, 264, 265, 266, 288,   9,  33,  81, 105, 129, 264, 265,
+   266, 267,  10,  34,  82, 106, 130, 266, 267,  83, 107, 131,
+   267, 268, 291, 108, 268, 269, 109, 133,   8,  32, 192, 288,
+   289, 290,   9,  33,  57, 129, 288, 289, 290,  34,  58, 106,
+   130, 131, 292, 315,  36,  60, 291, 292,  61, 293, 136, 288,
+   312, 313, 314,  57, 312, 313, 314, 291, 316, 315, 316, 318,
+   158, 144, 176, 160, 312, 336, 337, 338, 336, 337, 338, 337,
+   338, 341, 184, 336, 360, 361, 362, 360, 361, 362, 361, 362,
+   363, 148, 364, 365,   0,   1,  24,  25,   8,   9,  10,  32,
+    33,  57, 192, 193, 194, 195, 216, 217, 218, 219, 240,   8,
+     9,  32,  33, 192, 193, 194, 195, 216, 217, 193, 194, 195,
+    16, 192, 196,   0,  24,  25,  48,  49,  73,   8,   9,  32,
+    33,  56,  57,  81, 104,  40,  64,  88, 192, 193, 194, 216,
+   217, 218, 240, 241, 242, 265,   8,  32,  34,  56,  58, 192,
+   216, 217, 218, 217, 218, 219,  24,  48,  49,  72,  73,   8,
+    32,  33,  56,  57,  81, 105,  64,  88, 192, 216, 217, 218,
+   240, 264, 265, 266,   0,  24,  49,  73,   8,  32,  56,  58,
+    80,  82, 240, 241, 242, 264, 265,  57,  81, 241, 242, 244,
+    48,  72,  96,  97,   8,  56,  57,  80,  81, 105, 192, 240,
+   241, 264, 265, 288, 289,  48,  49,  72,  73,  56,  57,  58,
+    80,  82, 104, 106, 240, 241, 242, 265, 266, 288, 289, 290,
+    81, 105, 265, 266,  97,  80,  81, 104, 105, 288, 289, 312,
+    73,  96,  97,  80,  81,  82, 104, 106, 128, 130, 264, 265,
+   266, 312, 313, 314,  73,  81, 105, 129, 131, 289, 290, 292,
+   312, 313,  97, 104, 130, 154, 288, 289, 290, 312, 313, 336,
+   337, 338, 122, 129, 290, 313, 314, 337, 338, 146, 154, 155,
+   316, 317, 336, 337, 130, 312, 313, 336, 337, 360, 153, 186,
+   313, 314, 361, 362, 363, 147, 130, 155, 163, 338, 339, 340,
+   340,   8, 192, 360, 361, 337, 360, 361, 362, 146, 177, 337,
+   338, 339, 338, 362, 363, 363, 364, 364,   0,   1,  24,  25,
+    49,   8,   9,  10,  33,  34,  56,  57,  80,  81, 128, 176,
+    16,  40,  64,  65,  88,  89, 112, 192, 194, 195, 196, 198,
+   199, 216, 217, 218, 219, 223, 242,   1,  25,   8,   9,  33,
+    80,  81,  64,  65,  88,  89, 192, 193, 195, 196, 197, 198,
+   218,  34, 193, 194, 196, 197, 192, 194, 195, 198, 196, 192,
+   197, 197, 192,   0,   1,  24,  25,   8,  32,  33,  34,  57,
+    80,  81, 104, 105, 192, 193, 195, 216, 217, 218, 219, 223,
+   240, 241,   0,   1,  24,  25,  48,  49,  50,   8,  32,  34,
+    56,  58,  81, 104, 105, 192, 193, 216, 217, 219, 220, 241,
+   242,   9,  33,  57,  59, 216, 217, 218, 221, 242, 218, 219,
+   219,  32,  56,  80, 128, 240, 241, 264,  49,  33,  57,  58,
+    81,  82, 216, 217, 244, 265,  25,  50,  74,  33,  34,  57,
+    58,  59,  81,  83, 218, 240, 241, 242, 266, 267,  58,  60,
+   242, 243, 268, 243, 244,   8,  56,  80, 265,  57,  81, 241,
+   265, 290,  75,  58,  59,  82,  83, 107, 241, 242, 265, 266,
+   290,  50,  74,  82, 106, 108, 243, 267, 291,  59, 107, 267,
+   268,  84, 268, 270,  80, 289,  81, 105,  82, 106, 107, 265,
+   266, 100,  83, 107, 108, 132, 267, 315, 316, 124, 125, 107,
+   131, 292, 315, 316,  84, 293, 104, 155, 108, 132, 292, 100,
+   124, 131, 133, 140, 291, 292, 340, 125, 132, 134, 316, 318,
+   341, 336, 337, 338, 364, 132, 316, 364, 149, 341, 342,   8,
+     0,   1,  24,  25,   8,   9,  10,  32,  33,  56,  57,  17,
+    18,  64,  88, 192, 193, 216, 217, 218,   0,   1,   2,  24,
+    25,  26,  27,   8,   9,  10,  32,  33,  34,  56,  58,  16,
+    17,  18, 192, 193, 194, 196, 216, 217, 218, 219,   1,   2,
+     3,  26,  27,   9,  10,  11,  33,  34,  35,  16,  17,  18,
+    42, 192, 193, 194, 195, 217, 218, 219, 220,   2,   3,  10,
+    11,  12,  34,  35,  36,  16,  17, 192, 194, 195, 196, 219,
+   220,  12,  36, 195, 196, 197,  13,  37, 196, 197, 198,  14,
+    38, 197,  15,  39,  16, 192,  48,   8,   9,  32,  56,  80,
+   192, 193, 216, 217, 241,   0,   1,  25,   8,   9,  33,  34,
+    57,  80,  81, 192, 193, 194, 240, 241, 242,  25,  26,  10,
+    11,  33,  34,  35,  57,  58,  59, 193, 194, 195, 217, 218,
+   241, 242, 243, 244,   3,  26,  27,  10,  12,  34,  36,  58,
+    60, 194, 195, 196, 218, 219, 242, 243, 244,  13,  35,  37,
+    61, 219, 220, 243, 244, 245,  29,  12,  36,  37,  38,  60,
+   220, 221,  37,  38,  15,  39,  32,  56,  80,  33,  57,  81,
+   217, 218, 240,  34,  58,  59, 217, 218, 219, 266, 267,  35,
+    58,  59,  60,  84, 218, 219, 220, 267, 268,  51,  52,  36,
+    59,  61,  85, 219, 220, 221, 243, 268,  60,  84,  86, 221,
+    61,  85,   8,  80, 104, 192,  81, 242, 242, 243,  61, 243,
+   244,  62,  86,  85,  86, 289, 316, 110, 312, 313, 292, 180,
+   360, 361, 362, 341,   2,   3,  25,  26,  27,  50,  51,  75,
+     8,  32,  34,  56,  58,  80,  82, 104, 128, 152,  43,  89,
+   118, 194, 195,   1,   2,   3,  26,  27,  50,  51,  75,   9,
+    33,  34,  57,  81,  83, 105, 129, 153,  16,  17, 192, 193,
+   194, 195,   0,   2,   3,   4,  26,  27,  10,  34,  35,  58,
+    82,  17, 192, 194, 195, 196,   0,   1,   3,   4,   5,  11,
+    32,  35,  36,  59,  16,  18, 192, 193, 195, 196, 197,   1,
+     8,  12,  36,  60, 192, 193, 196,  13,  37,  61,  14,  38,
+   198,   7,  15,  39,  63,  32,  56,  80, 104, 128, 218, 219,
+    50,  33,  57,  81, 105, 217, 218, 219,  10,  34,  58,  82,
+   216, 218, 219, 220,  11,  35,  59,  83, 216, 217, 219, 220,
+   221,  12,  36,  60, 217, 218, 220, 221, 222,  13,  37,  61,
+   218, 222,  14,  38,  62,  15,  39,  63,  32,  56,  80, 104,
+   128, 242, 243,  57,  81, 105, 216, 241, 242, 243,  58,  82,
+   106, 240, 242, 243, 244, 240, 241, 243, 244, 245, 241, 244,
+   245, 246,  80, 104, 128, 266,  81, 105, 129, 264, 266, 267,
+    82, 106, 266, 267, 268,  83, 107, 267, 268, 108, 265, 266,
+   268, 269, 109, 271, 270,  32,  80, 104, 128, 152, 105, 129,
+   290, 291,  35, 291, 292, 108, 293,  32,  56,  80, 152, 129,
+   153, 313, 154, 316, 365, 144, 152, 153, 339, 362, 146, 363,
+   163, 340, 149, 157, 165, 342, 158, 342, 168, 169, 104, 128,
+   176, 184, 361, 363, 363, 362, 366, 367,   0,   1,   8,   9,
+    10,  32,  33,  56,  57,  81, 105, 128,  16,  17,  40,  41,
+    42,  64,  65,  89,  90, 192, 193, 216, 217, 218,   0,   1,
+     8,   9,  10,  32,  34,  58,  16,  17,  18,  40,  41,  42,
+    65, 192, 193, 194, 198, 216, 217, 218,   0,   1,   8,   9,
+    10,  11,  33,  34,  16,  17,  18,  41,  42,  43, 193, 194,
+   195, 217, 218, 219,  10,  11,  34,  35,  16,  42, 192, 194,
+   195, 196, 218, 219, 220,  11,  12,  35,  36, 195, 196, 197,
+   218, 219, 220,  13,  37,  16, 192, 197, 198,  14,  38,  15,
+    39,  16, 192,   8,   9,  32,  33,  56,  80,  81,  16,  17,
+    41,   8,   9,  10,  33,  57,  16, 194,  10,  11,  34,  35,
+    58,  59,  18,  43, 194, 195, 196,  10,  12,  34,  35,  36,
+    59,  60,  18,  19,  42,  43,  44,  67, 195, 196, 219, 243,
+   244,  11,  13,  35,  36,  37,  59,  61,  43,  44,  45,  68,
+    69, 196, 220, 243, 244, 245,  12,  13,  36,  37,  60,  62,
+    44,  68,  69, 221, 244, 245, 246,  14,  37,  38,  61,  62,
+   221, 245, 246,  15,  39,  63, 222,  32,  56,  80,  33,  57,
+    34,  58,  35,  59, 219,  52,  36,  37,  60,  61,  85,  45,
+   219, 220, 221,  36,  38,  61,  62,  44,  45,  70,  71, 221,
+   222,  37,  61,  63,  69,  70,  71, 221, 222,  38,  62,  63,
+    69,  70,  71, 104,  60,  87, 110,  94,  95,  86,  87, 111,
+    94,  95, 104, 108, 109,  86, 110,  87, 336, 337, 168, 338,
+    24,   8,   9,  33,  56,  80, 104,  16,  17,  19,  40,  64,
+    88, 112, 184, 192, 193, 194, 195, 196, 199, 216, 217, 220,
+   240, 264, 360,   8,   9,  32,  33,  57,  16,  40,  64, 192,
+   193, 194, 196, 197, 216, 217, 218, 242,   8,   9,  33,  34,
+   192, 193, 194, 196, 197, 194, 195,  38,  16, 192,   8,   9,
+    32,  33,  56,  57,  81,  16,  17,  40,  41,  65,  88, 192,
+   193, 216, 264,   8,  10,  32,  34,  56,  58,  16,  17,  40,
+    41,  42,  64,  65,  66, 193, 194, 217, 218, 219, 220, 240,
+   241, 242,   8,   9,  10,  33,  34,  57,  16,  41,  42,  65,
+    66, 217, 218, 241, 242, 243,  35, 218, 219,  32,  56,  80,
+    81, 240, 241,  33,  34,  57,  58,  82,  90, 216, 217, 218,
+   219,  34,  35,  57,  58,  59,  81,  42,  65,  66,  67,  90,
+   218, 219, 242, 266, 267,  58,  82,  66,  67, 243, 266, 267,
+   268,  59,  83, 243, 244, 267, 268,   8,  56,  80,  16,  57,
+    81,  82,  58,  59,  81,  83, 107,  90, 241, 242, 243,  60,
+    84, 108,  91, 242, 243, 244, 291,  83,  85, 107,  92, 244,
+   291, 292, 293,  84, 108, 110, 268, 269, 293, 269, 104, 105,
+   106, 131, 266,  82,  83, 108, 139, 267, 315, 316, 100, 124,
+    85, 109, 117, 268,  84,  86, 108, 110, 134, 269, 293, 109,
+   133, 294, 132, 139, 291, 340, 131, 139, 292, 316, 339, 340,
+   110, 134, 293, 109, 133, 141, 134, 132, 316, 140, 164, 316,
+   364, 156, 156, 340
+};
+
+const ogg_int32_t OD_PRED_WEIGHTS_8x8_Q12[2560]={
+     495,   402,  1825,   442,  1905,  1484,  1620,  2049,  2579,  1266,
+    1440,  -863,  -702,  1365, -1199,   943,  1411,  1439, -2492,   486,
+    -620, -1287,  -810,  -244,   624,  -783,  -647,  1097, -1662, -1875,
+     565,  1568,  1936, -1088,  1301,  2845,  2271, -1305,   664, -1422,
+   -1561,  1314, -2412,  1796,   505,  -956,  1451,  2081,  2210, -1815,
+   -1688,  -603,  -530,   673,  -583,  -518,   671,   315,   494,  -502,
+    1225, -1438,   426,  -239,   308,   240,  -265,   305,  -251,   343,
+     779,   947,   781,   862,   686,   857,   823,  1134,  -168,  -176,
+    -236,  -171,   595,  -461,   327,   662,  -659,  -673,   114, -1130,
+     483,  -330,   677,  -604,  1147,   876,  -184,   222,   335,  -260,
+      29,   464,  -471,  -833,  -315,  -414,   200,  -211,   419,  -324,
+     423,  -192,   307,  -219,   377,   387,    82,  -282,   493,   -65,
+    -296,  -198,   336,  -378,   290,  -288,   416,   323,   271,   365,
+     -36,   236,  -255,    39,  -319,   361,  -244,   257,  -332,   436,
+     281,  -190,  -328,   265,  -254,   442,   481,  -187,   285,  -382,
+    -236,  -363,  -287,   358,   459,   302,   566,  -441,   226,  -473,
+    -262,  -512,   552,  -237,  -380,   565,   704,   180,  -364,   369,
+     210,   402,   389,   299,   249,   425,   611,   931,  -556,   848,
+     730,  -163,   248,   263,  -293,   473,   221,   343,  -382,  -522,
+     362,  -419,   304,   276,   240,  -220,   634,   775,   119,   814,
+    -313,   874,  -258,   740,   650,   325,   759,   859,  1110,  -188,
+    -167,  -232,   179,  1590,  -260,  1205,   333,   598,   197,  -206,
+     295,  -358,  -287,   274,   297,  -238,   440,  -223,   824,   106,
+     981,   782,   784,  -194,   675,   871,   827,  1110,  -183,  -198,
+    -243,  -463,  -467,   212,  -828,  -274,   227,   210,   247,   407,
+     355,  -250,  -301,  -239,  -216,   345, -2979,   688,   651, -1036,
+    1838,  1200,  -714, -1919,  1264, -1667,  3171,   758, -1448,  -912,
+    2117, -3011, -1887,   162, -1184,  1631, -3877,  2017,  3414,  -337,
+   -1781,  1928, -1709,   973, -1937,  -415,   748, -1490,  -720,  1268,
+    3448,  3232,   503,   951,  2906, -1186,  1651, -1532,   -99,   129,
+    -899, -1205,   179,  -169,  2257,   907,  -311,   616,  1882,   670,
+     231,  -319,  1718,  -258,   276,   505,  2275,  -379,   659,   601,
+    -438,  1729,   680,  1554,  -348,  -193,  1568,  -238,   487,  -758,
+     913, -1028,   312,  -890,   894, -1466,  1094,   226,  -260,   445,
+    3301, -1316,  1112,   987,   398,   -28,   336,  -715,   799, -1222,
+     150,  -615, -1017,   364,  -449,   721,  -847,  -363,   456,   409,
+    -299,  -645,  -297,   331,  -339,  -258,   347,   258,  -360,  -239,
+     286,  -211,   545,   266,   105,   549,  -586,  -301,   487,  -799,
+     679,  -117,  -443,  2893, -1065,  1115,  -646,  -372,   443,  -591,
+     172,  -445,  -772,  -310,   297,  -494,  -208,  -259,   290,   329,
+     283,  -386,  2404,  -429,   777,   459,   229,   245,  -419,  -235,
+     342,  -416,   314,   298,   295,   294,   283,   583,  -292,   329,
+    -231,  2037,  -530,   227,  -281,   264,   304,  -258,  -288,   347,
+    -297,   315,   553,   248,   466,   316,   317,   224,   347,   673,
+     402,  -246,   243,   429,   661,   696,  -304,  2286,  -497,   345,
+     337,   138,  -403,  -241,  -336,  -352,   352,   465,   692,   449,
+    1050,  -254,   843,  1010,   550,   425,   960,   875,  1260,  -259,
+    -338,   473,  -377,   535,   523,  -415,  2612,  -537,   567,   146,
+    -335,   246,   426,   459,   201,   457,   699,  -302,  1163,   968,
+     849,  -323,   662,  1049,   848,  1070,  -234,   334,  -293,  -285,
+     726,   257,  3186,  -844,  -585,  -340,  -212,  -395,  -354,  -224,
+     342,   124,  -265,   647,   532,  -595,  1109,   343,  1323,  -787,
+   -1318,  1713,   376,  -470,  -794,   821,  -899,  1072, -2064,  3473,
+   -4022,  1395,  1625, -2653,  2814, -2632,  6112, -5456,  3031,   565,
+   -2915,  3897, -2136,  2572, -2261,  2491, -3256, -1038,   158,  -334,
+     356,  -159,   193,    95,  -849,  1654, -1119,   399,  -521,  1075,
+    -323,   669,  -244,   624,  -757,  -405,   568,   454,  -259,   407,
+    -587,  -542,   183,  -584,   394, -1125,   742, -1295,  1366,   210,
+    -608,  -499,  1143,  -667,  2222, -2264, -2493,  4673, -2872,  1267,
+   -2493,  2719,    70,  -220,   448,   409,  -757,   555,   -97,   238,
+    -286,   330,  -833,   943,  -711,  -202,   580,  -377,   570,  -222,
+     323,  -373,   -77,   244,  -387,   505,    76,  -493,   509,   611,
+    -949,   938,  -710,   677,   641,   585,  -796,   382,  -320,   570,
+    -669, -1250,  1789, -1056,  -845,  -235,   348,   351,  -501,  -541,
+     565,   442,  -323,  -306,   320,   342,  -854,   902,  -379,   845,
+   -1035,  -241,  -265,   545,  -439,  -288,   383,   -26,   399,  -499,
+    -527,   832,  -761,  -450,  -438,   664,   473,  -439,  -681,   989,
+     171,   303,  -437,   600,   493,  -367,  -164,  -368,   342,   430,
+     228,  -512,   627,  -591,   822,  -895,  -250,  -309,   522,  -346,
+    -309,   348,  -413,   406,   481,  -642,   363,   509,  -415,   403,
+    -310,  -591,   431,  -548,   443,  -394,   467,   372,   422,  -635,
+    -485,   535,  -329,  -252,  -322,  -511,   625,  -614,   317,  -222,
+     553,  -365,   419,   268,  -364,   312,  -476,   444,   292,  -300,
+    -760,   523,  -410,   273,  -395,  -285,   473,   378,   228,  -405,
+     381,  -471,   573,  -313,   369,   396,   479,  -334,   319,  -749,
+     520,  -383,   267,  -453,   336,   435,  -363,   383,   368,   227,
+     474,  -508,  -338,  -380,  -710,   468,  -373,   315,   146,  -286,
+    -439,   748,   460,  -835,  -169,   505,  -516,  4105, -6601,  7214,
+   -6422,  4727, -3122,  1263,  -181,  -625,  1179,  1165, -1872,  1829,
+   -1587,  3581,  -137,   400,  -399,  -327,   983, -1100,   489,   266,
+    -383,  -211,   551,  -769,   586,  -541,   265,  -286,  -388,   647,
+    -512,  -174,    56,   -89,   296,  -330,   -81,  -179,   480,  -276,
+     276,  -183,    56,    84,  -439,   707,  -654,   677,  -963,   796,
+    -329,   -78,   570,  -624,  3674, -4592,  3596, -2450,  1036,  1521,
+     865,  -894,  -128,   573,  -554,  -394,   922,  -513,  -162,   438,
+    -478,  -141,   338,  -377,  -154,   288,  -323,  -301,   404,  -322,
+    -203,  -270,   265,  -385,   209,  -242,   319,  -266,   207,  -199,
+     224,  -230,    58,  -193,   350,  -468,  -374,   641,   -91,   227,
+    -409,   433,    39,    90,  3070, -3193,  1756,  -709,  -263,  -100,
+     206,  -389,   463,   151,  -389,   776,  -484,  -120,   250,  -391,
+     330,  -148,   304,  -312,  -169,  -257,   260,  -329,   326,  -130,
+     242,  -268,  -282,   308,    59,   -96,   200,  -347,   -98,   150,
+    -197,   438,    37,  -119,   151,  2666, -2509,   889,  -332,  -118,
+     139,  -204,   410,  -302,   217,  -462,   612,  -342,   -92,   142,
+    -223,   359,  -307,   234,  -264,  -181,   278,  -241,  -204,   318,
+     263,   227,   277,  -244,   279,  -255,   -31,    90,    32,  2218,
+   -2186,   687,   -49,   132,  -143,  -311,   293,  -521,   463,   107,
+    -111,   213,  -219,  -248,   435,   311,   116,  -136,  -271,   410,
+    -143,  -221,  -204,   212,  1873, -1897,   586,  -100,   303,  -568,
+     532,  -279,   266,  -179,   379,   265,   231,  -207,   285,  -199,
+     254,  1859, -2118,   708,   339,  -545,   496,  -177,   285,  -223,
+    -417,   201,  1805, -2065,   849,   430,  -767,   436,  -237,   232,
+    -250,  -175,   232,  -268,   547,  -621,  -685,   706,   291,   643,
+     659,  -261, -1429,  1312,  3195, -4168,  2587,  -863,  1853, -2969,
+    2304, -1697,  -740,  -203,  -317,   276,   564,   218,  -837,  1538,
+    -776,  -307,   458,  -172,   504,  -442,    24,   -29,   411,   278,
+    -611,   668,   790, -1058,   677,   543,   462,  -986, -1268,   569,
+    1695, -1208,  -815,   333,  -549,   619,  -831,  1101,  -771,  1279,
+   -1326,   939,  2527, -2090,  1609,  -708,  -161,   334,  -461,  -445,
+     863,   163,   657, -1270,  1103,  -182,   417,  -521,  -220,   718,
+    -675,  -832,   586,   126,  -488,  -430,   890,  1067, -1167,   733,
+    -370,   488,  -126,  -727,  1051,  -544,  -423,  1424, -1035,   894,
+      73,  -154,  -403,   362,   -73,   200,  -466,   589,   510,  -731,
+     590, -1287,   910,   304,  -486,  -201,   248,  -220,   406,   426,
+     254,  -438,   494,  -569,   -49,   398,   409,  -590,  -809,   779,
+      47,  -394,   539,  -845,   673,   929,  -581,   200,  -426,  -368,
+     462,  -201,   296,   546,   573,  -827,  -557,   871,  -298,   543,
+    -493,  -622,   672,   576,  -608,   640,   313,  -304,  -378,   558,
+    -359,  -350,  -268,   537,   541,  -991,   543,   539,   318,   308,
+    -449,   277,  -382,  -431,  -531,   593,   394,  -526,  -293,   555,
+    -491,   461,  -709,   494,   192,   215,  -333,   286,  -493,  -343,
+     594,   337, -1001,   580,  -300,  -270,  -524,   386,  -363,   504,
+    -439,  -339,   403,   572,  -515,   487,  -336,   300,  -314,  -330,
+     418,  -402,   519,   267,  -346,  -381,   694,  -390,  -824,   583,
+    -347,  -311,   486,  -503,   732,   520,  -412,   468,   306,  -506,
+    -480,   747,  -435,  -376,   257,  -339,   372,   278,  -593,   610,
+     551,   -21,    20, -1004,   700,   299,  -790,   815,  -381,   435,
+     343,   312,  -854,   404,  -247,   472,  -601,  -376,   498,   266,
+     969,  -426,  -874,   826,  -850,   436,  1357,   992, -1914,  -940,
+   -2456,  2195,  4838, -1547, -2089,  2506,   250,   964, -2186, -1593,
+    2715,  2362, -1590,   983, -3624,  7267, -3947, -3290,  8576,  1555,
+   -2504,  2193, -1868, -4473,  1543,  -355,   418,  -461,  -837,   860,
+    -810,  1248,   693,   704,  -861,  -953,   876, -1535,  2330, -5042,
+    1654,  1952,   794,   569,  -338,   850,  -939,  1679,   -38,   326,
+    -507,  -901,   441,    16,  -367,  -321,   -14,   171,  -484,  -648,
+     603,   936, -1638,  -676,   760,  1460,  2814, -1319, -3636,  1703,
+    -541,   419, -1365,  -829,   913, -2043,  2681,  3777,  1219, -1480,
+     350,  -359,  -379,   540,   513,  -505,   857,  -322,   399,  -977,
+    -491,  1085,   978,   824, -1644,  -210,   379,   545, -1037,  1306,
+   -2816,  -939,   966,  -225,   312,  -339,   906,   131,  -561,   914,
+    1000,   465,   373,  -439,  -328,  -323,  1040,  -804,  1022,  -650,
+     874,   711,  -650,  -630,   904,   715,  -577,  -819,  -241,   508,
+    -953,  -980,   182,   574,  -476,   188,  -370,  -436,   450,   764,
+     422,  -785,  -304,   214,  -707,   779,   485,  -679,  -333,   536,
+     446,  -520,   600,  -341,   461,   -36,   403,  -514,   513,   385,
+    -603,   303,   385,   556,   496,   367,   470,  -492,  -611,   547,
+     250,  -384,  -357,   345,   531,   277,  -312,   472,  -382,   626,
+     345,  -615,  -584,  -261,  -353,  -386,   650,   291,   301,   360,
+    -279,   403,  -349,   396,  -341,   361,   528,   296,  -300,   443,
+    -300,   480,   592,  -507,   414,  -382,   477,  -395,   474,  -345,
+     456,   597,  -407,   682,   340,  -435,   296,   467,   383,  -391,
+    -475,   357,  -619,   355,  -482,   408,   334,  -490,   899,   486,
+     576,  -592,   449,   615,  -599,  -387,   432,  -439,   502,  -329,
+    -377,   456,  -369,  -445,   626,   -16,   415,  -612,  -758,  1080,
+    3059,  1913,  -570, -3773, -3413,  2199,  1652,  -299,  -576,  -597,
+     800,   572,  -617,  1192, -2152,  1535,   202,  -456,   855,  -317,
+     754,  -826,   785,  -934,  1191,  2076,  1285,  -380, -2222,  -959,
+    1462,   156,   376,   459,   571, -1008,  1011,  -927,   624, -1199,
+    1529, -1448,  -226,   570,  -557,  -354,   599,  -745,  -375,   928,
+     627,   391,  -850,  -108,  -244,  -314,   471,   109,  -413,   816,
+    -670,  -344,   701,  -807,   620,   220,  -288,  -340,  -700,   406,
+     325,   357,  -579,    56,   118,   -54,   340,  -589,   604,  -425,
+     520,  -644,   412,  -322,   546,  -415,  -601,   593,   241,  -400,
+     449,  -447,   364,  -351,  -409,   353,    18,   -18,   395,   279,
+    -194,  -948,  1474, -1221,  -266,   322,  -565,   691,  -584,   109,
+    -222,   291,   122,   500, -1138,  -429,  1094,   463,  -634,  -227,
+     464,  -569,   463,  -673,   844,   208,  -382,   449,   488,   251,
+    -623,  -569,  -414,   639,   653,   115,  -404,   518,  -349,   552,
+    -354,   693,  -883,   656,  -335,  -252,   344,  -247,   482,   412,
+    -666,  -385,   592,  -165,   364,  -423,   335,  -479,   333,  -624,
+     728,   353,   244,  -594,   442,  -322,   431,  -322,   514,  -476,
+     428,  -327,   343,   318,  -428,  -299,   256,  -379,   260,   419,
+    -412,   407,  -159,   337,  -471,  -217,   431,  -397,   191,  -293,
+    -227,  -330,   496,   443,   183,  -308,   334,   456,  -418,  -248,
+    -256,   430,   385,  -500,  -190,   363,  -380,  -440,   470,  -266,
+     416,  -250,  -332,   420,  -444,   227,  -379,   365,  -307,   496,
+    -302,   316,  -453,   284,  -293,   382,   -35,  -311,   477,    30,
+    -327,  -240,  -214,   300,   318,   232,  -380,   363,  -400,   282,
+     327,   358,   322,   355,  -316,   368,  -273,  -401,  -608,   334,
+    -344,   271,  -452,   473,  -392,   919,  -966,  -854,  1032, -1140,
+    4083, -6530,   658,  7397, -1026, -7293,  1195,  5774, -4709,  2601,
+     749,   705,  2118,   506,  -426,   136,  -530,   521,   590,  -920,
+    -579,   684,  -957,  3802, -4195,   433,  3555, -3044,  1067,  2277,
+   -1660,   952,   -29,  -118,    35,  -239,   617,  -537,    64,  -276,
+     415,  -372,   280,  -540,  3495, -3084,   407,  1721,  -778,    72,
+     -63,   348,  -440,   368,    61,  -104,   201,  -346,   330,  3181,
+     -88, -2215,   412,   827,    19,  -118,   -81,    99,  -306,   383,
+    -316,   -62,    22,  2796, -1803,   625,   -20,   103,   197,  2634,
+   -1591,   546,  2546, -1946,   237,   193,  2475, -1418,   585,  -368,
+    1226, -1403,  1308,  -754,   462,  -491,  -340,  -401,   822,  -765,
+     632,  -204,   678,  -570,   107,  -432,   652,  -566,   -74,   314,
+    -521,   377,   146,  -421,   451,  -403,   -90,   115,  -222,   461,
+    -350,   180,  -440,   409,    93,  -100,   231,  -319,   254,   232,
+    -490,   381,   -87,   210,   263,  -463,   360,   246,  -526,   507,
+    -197,   622,  -898,   853,  -624,   384,  -395,   297,  -463,   423,
+     -60,  -177,   504,  -467,   253,  -351,   362,   -87,   252,  -477,
+     291,   -81,   106,  -302,   388,  -272,   102,   239,  -278,   279,
+    -483,   752,  -598,   249,  -244,   544,  -434,  -126,   456,  -407,
+    -187,   304,   165,  -294,   297,  -230,   269,  -184,   374,   293,
+      99,  -150,   249,  -272,   235,  -223,   183,    57,  -133,   413,
+    -533,   312,   223,  -262,   451,  -250,    95,  -179,   262,   286,
+    -175,    42,  -118,   149,   303,  -190,   326,   178,   206,   231,
+     242,   234,   454,   196,  -276,   227,   201,   252,   243,   214,
+     184,   189,   193,   197,   249,   278,   464,  -293,  -124,   184,
+     630,   267,   180,  -344,  -352,  -161,   218,  -213,  -146,   373,
+    2923, -2201,  -504, -3567,  3752,  1943, -2833,  1969, -1317, -1459,
+    1014,  1286, -1148, -2603,  -687,   644,  1655, -1007, -1308,   277,
+    -451,  -687,   982,  -873,  -173,   256,   927,   447, -2006,  -819,
+    1818,  -890,  -930, -1456, -1125,   932,  2026,  1233, -1065,   182,
+    -407,   686,  1201,  -335,   661, -1135,   -69,   195,  -136,   857,
+   -1018,  -518,  -696,   815,   206,   567,   673,  -623,  -850,  -567,
+    -256,   581,  -432,   365,  -840,   798,   358,  -883,  -513,   848,
+      66,   427,   -66,   296,  -600,   407,  -418,   555,  -536,   211,
+    -692,  -268,   645,  -254,   510,  -379,  -185,   261,  -480,  -662,
+     508,   -19,    20,  -398,   348,  -318,   628,  -476,   589,    18,
+     -18,   257,   224,  -742,  -379,  1367,  -779,   766,  -253,  -257,
+     459,  -127,   646,  -383, -1023,   942,   128,   265,   473,  -660,
+   -1060,  1000,   793,  -722,   304,  -497,   325,  -600,   471,   289,
+    -508,  -364,  -391,  1083,   518,  -661,  -267,  -390,   317,   826,
+     768,  -542,  -417,   527,  -440,   607,  -730,   241,  -521,  -739,
+     465,   734,   499,  -714,  -565,  -939,  -485,   490,   479,   400,
+     324,   540,  -685,   604,   332,  -483,  -508,   862,   685,  -473,
+     253,  -425,  -634,  -357,  -364,   364,  -369,  -510,  -353,   660,
+     548,  -614,  -288,   327,  -362,  -554,   671,  -334,   261,  -169,
+     490,  -465,  -194,   427,  -234,   371,  -340,   503,  -250,  -339,
+    -464,   483,   555,  -368,   447,  -341,  -173,   364,  -375,  -311,
+     689,   691,  -843,   306,   423,  -559,  -405,  -392,   431,  -480,
+     667, -1105,   468,   955,   786,  -240,   462,  -394,  1111, -1277,
+    -304,  -714,  -579,   479,   250,  -582,   673,   562,   631,   595,
+   -1330,   697,  -580,  -712,   324,   345,   454,  -387,   407,  -340,
+    -379,   300,  -697,   361,   406,   269,  -931,  1089, -1241,  1928,
+   -1790,  2814,  1390,  1265, -3741,  3267, -1689,  1677,  2784,   832,
+    -479, -1239,  4236, -3624,  4560, -1020,  1458,  1891,  -757,  1327,
+    2355,   409,  -738,  -526,   790,  -697,  -836,  1089,  -735,   442,
+   -1034,   819, -2780,  2078,  -364,   786,  -748,   801,   -89,   267,
+    -237,   648,    90,  -503,   794,  -855,  1244,   299,  -362,   444,
+      18,   -19,   482,  -579,  -986,   877,  1261, -1273,  1045,  -600,
+     502,   656,  -952,  1213,  -801,   166,  -529,  -378,  -748,   259,
+    -466,  -434,  1078,   465,  -799,  -259,  -907,   328,  1138,   870,
+    -606, -1079,  -743,  -287,   610,  -659,   718,   852, -1567,  -483,
+     710, -1220,   -56,   252,  -395,  -486,   593,   654,    56,  -419,
+    -450,   376,   453,  -333,   756,   412,  -911,   723,   547,   368,
+    -552,  -311,   664,  -766,   635,  -434,   406,  -292,   519,   591,
+    -849,  1024,   673,   163,  -417,   558,  -587,  -370,   529,   383,
+     417,  -862,  -671,  -390,   352,   751,   637,  -509,   426,  -623,
+     470,  -545,   567,   540,  -605,  -529,  -510,  -451,  -427,   737,
+    -646,   311,  -423,  -365,   463,   336,  -530,   -56,   243,  -518,
+      49,   314,  -572,   499,   288,  -517,  -374,   674,  -633,  -468,
+    -206,   354,  -487,  -613,   619,  -590,   419,   257,  -537,   576,
+     495,  -503,   730,   387,  -693,   363,   404,  -489,   666,  -357,
+     434,  -601,   349,  -486,   453,  -287,   401,   438,   427,   485,
+     314,  -285,  -300,  -474,   418,  -343,   442,  -524,  -424,   431,
+     477,  -721,   464,   651,  -355,   461,   490,  -537,   576,  -360,
+    -386,   361,  -341,   413,   605,   475,  -352,  -489,  -395,  -386,
+     320,   364,   477,  -546,  -444,   514,  -395,   285,  -389,  -348,
+    -320,   341,   388,  -398,   568,   437,  -553,   329,   344,   411
+};
+
+const int OD_PRED_OFFSETS_16x16[OD_INTRA_NMODES]={
+  0, 1024, 2048, 3072, 4096, 5120, 6144, 7168, 8192, 9216
+};
+
+const unsigned short OD_PRED_INDEX_16x16[10240]={
+     5,   6,   7,  11,  12,  13,  55,  60,  62,  99, 106, 107,
+   108, 111, 149, 151, 154, 155, 156, 203, 204, 205, 206, 207,
+   245, 249, 250, 252, 254, 255, 290, 294, 295, 298, 299, 300,
+   301, 302, 336, 338, 341, 342, 345, 348, 350, 351, 386, 388,
+   393, 394, 395, 396, 397, 398, 399, 434, 436, 437, 439, 442,
+   445, 447, 485, 487, 489, 490, 491, 493, 494, 529, 530, 532,
+   534, 535, 536, 537, 540, 541, 542, 543, 579, 583, 588, 589,
+   590, 624, 625, 629, 631, 634, 635, 636, 637, 638, 673, 674,
+   675, 678, 679, 680, 681, 682, 683, 684, 686, 722, 725, 726,
+   728, 729, 730, 731, 732, 735,  16,  22,  29,  31,  64,  65,
+    71,  72,  73,  74,  77, 112, 117, 118, 126, 127, 162, 163,
+   168, 170, 172, 173, 175, 209, 210, 214, 217, 222, 223, 264,
+   265, 268, 269, 270, 271, 310, 311, 313, 314, 315, 317, 318,
+   352, 354, 357, 360, 361, 362, 363, 364, 367, 405, 408, 409,
+   411, 414, 415, 448, 452, 453, 455, 456, 458, 460, 461, 462,
+   463, 496, 499, 501, 503, 504, 505, 508, 509, 510, 511, 545,
+   548, 550, 551, 553, 554, 555, 557, 558, 559, 595, 603, 604,
+   605, 606, 607, 640, 642, 644, 647, 651, 653, 654, 655, 688,
+   689, 690, 691, 693, 696, 697, 698, 699, 700, 701, 702, 703,
+   736, 741, 743, 744, 745, 746, 747, 749, 750,  32,  36,  40,
+    44,  47,  80,  88,  89,  92, 133, 142, 183, 190, 229, 230,
+   234, 235, 238, 239, 274, 277, 279, 283, 284, 286, 287, 323,
+   324, 327, 329, 330, 331, 333, 335, 379, 381, 383, 417, 423,
+   427, 428, 430, 464, 467, 468, 469, 471, 472, 473, 477, 479,
+   513, 517, 518, 520, 521, 522, 523, 525, 562, 563, 564, 565,
+   567, 568, 569, 570, 572, 573, 574, 575, 612, 613, 614, 617,
+   621, 623, 659, 660, 661, 662, 663, 664, 667, 668, 670, 671,
+   708, 709, 713, 715, 718, 719, 756, 757, 759, 760, 762, 763,
+   764, 765, 766, 767, 768, 769, 770, 772, 775, 777, 778, 781,
+   783, 827, 828, 829, 830, 868, 871, 873, 874, 875, 915, 918,
+   923, 925, 927, 962, 969, 970, 971, 972, 973, 974,1014,1017,
+  1019,1020,1021,1022,1023,1056,1057,1062,1066,1068,1069,1070,
+  1104,1108,1112,1113,1114,1117,1118,1158,1161,1162,1163,1164,
+  1165,1167,1201,1203,1209,1210,1211,1212,1213,1215,1252,1255,
+  1257,1258,1260,1301,1302,1306,1308,1310,1311,1344,1350,1351,
+  1352,1353,1355,1357,1358,1359,1394,1396,1397,1399,1401,1403,
+  1404,1407,1441,1446,1447,1448,1449,1452,1455,1488,1491,1492,
+  1495,1497,1498,1500,1502,1503,  61, 111, 155, 206, 253, 296,
+   300, 303, 344, 346, 349, 395, 397, 399, 438, 441, 443, 445,
+   489, 493, 537, 582, 587, 589, 634, 635, 638, 681, 684, 729,
+   730, 731, 734,  28, 125, 171, 219, 268, 319, 353, 361, 363,
+   365, 367, 412, 413, 461, 462, 499, 556, 557, 559, 647, 652,
+   653, 690, 697, 699, 702, 703, 737, 751,  90,  92, 188, 191,
+   234, 238, 284, 286, 329, 330, 332, 381, 421, 427, 474, 475,
+   477, 524, 525, 527, 566, 572, 575, 611, 616, 623, 670, 718,
+   761, 767, 769, 770, 772, 776, 875, 879,1065,1068,1069,1071,
+  1113,1117,1166,1167,1214,1215,1257,1259,1261,1348,1396,1404,
+  1406,1442,1450,1451,1452,1454,1497,1499,1500,1502, 111, 155,
+   202, 397, 491, 493, 495, 537, 590, 636, 637, 638, 731, 316,
+   413, 462, 463, 509, 558, 602, 604, 607, 654, 700, 748, 426,
+   431, 527, 620, 719, 760, 766, 770, 771, 783,1117,1118,1213,
+  1257,1309,1352,1355,1406,1407,1502,1503, 351, 542, 543, 734,
+   558, 654, 284, 522, 622, 719,1307,1452, 687, 430,  11,  27,
+    43, 779,  12,  28,  44, 780,  56, 111, 152, 156, 157, 198,
+   207, 253, 254, 255, 299, 301, 302, 342, 347, 386, 392, 438,
+   442, 444, 446, 491, 531, 535, 537, 540, 541, 543, 583, 586,
+   589, 627, 637, 639, 676, 680, 681, 686, 687, 728, 730, 731,
+   733,  31,  64, 112, 126, 171, 174, 208, 222, 256, 319, 361,
+   366, 367, 406, 413, 448, 452, 455, 456, 459, 461, 463, 510,
+   552, 556, 603, 604, 607, 644, 652, 698, 700, 702, 738, 748,
+    40,  44, 143, 189, 286, 333, 430, 473, 474, 475, 516, 526,
+   567, 574, 616, 617, 618, 621, 664, 667, 668, 716, 717, 718,
+   719, 755, 756, 758, 760, 764, 765, 767, 776, 816, 823, 827,
+   831, 878, 926, 927,1071,1112,1116,1119,1165,1208,1209,1212,
+  1251,1259,1260,1306,1310,1354,1357,1358,1359,1399,1401,1403,
+  1404,1407,1442,1448,1453,1455,1493,1497,1500,  62, 156, 348,
+   350, 487, 533, 543, 590, 633, 634, 635, 639, 685, 687, 730,
+   223, 270, 316, 503, 603, 604, 606, 650, 653, 654, 655, 695,
+   698, 701, 702, 703, 748, 190, 478, 572, 618, 622, 623, 667,
+   670, 711, 716, 817, 818, 826,1116,1118,1167,1210,1259,1262,
+  1306,1308,1357,1358,1403,1404, 110, 681, 682, 734, 606, 746,
+   382, 879, 927,1018,1260,1405,1503, 446, 589, 635, 735, 511,
+   605, 607, 747, 575,1407,1500, 127, 668, 397, 494, 536, 538,
+   578, 589, 632, 634, 638, 686, 687, 729, 112, 127, 316, 455,
+   508, 559, 597, 654, 701, 748, 751, 236, 238, 284, 380, 429,
+   520, 620, 622, 668, 713, 719, 767, 875, 877, 927,1065,1156,
+  1262,1305,1306,1352,1358,1359,1399,1404,1406,1449,1452,1454,
+  1499, 207, 350, 390, 494, 589, 590, 637, 680, 684, 685, 686,
+   687, 551, 600, 602, 641, 703, 744, 748, 478, 479, 525, 718,
+   761, 878,1071,1261,1405,1452,1455,1495,1501,1503, 489, 457,
+   607, 700, 524, 527, 462, 655, 636, 637, 687, 730,  78, 559,
+   601, 604, 478,1167,1261,1407, 590, 732, 696, 744, 526, 573,
+   574, 623,1306, 239, 479, 765, 490, 639, 559, 696, 525, 700,
+   718, 639, 470,1256, 528, 544, 571,1296, 539, 555, 571,1307,
+   540, 556, 572,1308, 592, 604, 608,1355, 587, 603, 619,1355,
+   588, 604, 620,1356,  14,  15,  58,  61, 105, 107, 148, 151,
+   153, 158, 199, 200, 205, 206, 207, 243, 245, 247, 248, 251,
+   252, 253, 254, 255, 290, 292, 295, 299, 302, 303, 340, 345,
+   349, 351, 387, 389, 390, 392, 393, 395, 396, 397, 398, 399,
+   433, 436, 437, 440, 441, 442, 443, 444, 446, 447, 482, 484,
+   485, 486, 490, 492, 494, 495, 529, 534, 535, 539, 540, 541,
+   542, 543, 577, 579, 580, 581, 582, 585, 586, 587, 588, 589,
+   590, 591, 632, 633, 635, 636, 637, 676, 677, 679, 681, 682,
+   683, 684, 687, 723, 724, 725, 726, 728, 729, 731, 732, 734,
+   118, 120, 125, 126, 170, 173, 220, 223, 265, 266, 268, 309,
+   310, 312, 313, 314, 316, 317, 358, 359, 361, 363, 364, 365,
+   366, 367, 404, 405, 407, 413, 453, 456, 457, 458, 459, 460,
+   461, 463, 500, 502, 503, 505, 506, 507, 509, 510, 511, 545,
+   546, 551, 553, 554, 557, 558, 559, 594, 595, 597, 599, 602,
+   603, 606, 607, 645, 649, 650, 651, 652, 653, 654, 655, 689,
+   693, 694, 699, 701, 702, 703, 738, 740, 741, 742, 743, 744,
+   745, 747, 750, 751,  91,  95, 135, 139, 189, 191, 229, 230,
+   235, 237, 238, 239, 282, 285, 286, 287, 324, 328, 329, 330,
+   331, 372, 374, 377, 379, 381, 382, 383, 423, 424, 425, 429,
+   431, 467, 468, 470, 471, 473, 474, 478, 479, 516, 518, 519,
+   522, 523, 566, 567, 568, 570, 571, 573, 574, 611, 612, 613,
+   616, 618, 619, 621, 623, 660, 661, 662, 665, 666, 667, 671,
+   708, 709, 710, 711, 712, 713, 714, 716, 719, 756, 758, 759,
+   760, 761, 762, 763, 764, 766, 767, 782, 827, 830, 831, 873,
+   875, 877, 879, 924, 927, 969, 974,1011,1015,1016,1017,1018,
+  1020,1061,1062,1064,1065,1069,1107,1109,1112,1113,1115,1117,
+  1119,1158,1159,1161,1162,1165,1166,1203,1204,1208,1210,1212,
+  1213,1214,1249,1251,1254,1255,1257,1258,1261,1263,1300,1301,
+  1302,1303,1306,1308,1309,1346,1347,1352,1356,1357,1358,1359,
+  1396,1397,1398,1399,1400,1401,1403,1404,1405,1406,1407,1445,
+  1447,1448,1449,1452,1454,1455,1489,1490,1491,1494,1498,1499,
+  1500,1501,1503, 111, 152, 158, 159, 205, 243, 252, 254, 296,
+   297, 298, 299, 301, 350, 351, 397, 440, 441, 442, 443, 446,
+   447, 486, 488, 489, 491, 492, 537, 541, 542, 580, 583, 584,
+   586, 587, 588, 589, 590, 591, 627, 630, 633, 634, 635, 637,
+   639, 673, 676, 677, 678, 680, 685, 686, 725, 728, 729, 733,
+   734, 735, 222, 316, 318, 319, 362, 408, 411, 412, 451, 455,
+   457, 460, 463, 498, 501, 504, 506, 507, 510, 550, 552, 554,
+   557, 558, 559, 600, 601, 602, 604, 605, 606, 644, 648, 649,
+   653, 654, 693, 694, 697, 699, 703, 739, 744, 745, 746, 747,
+   748, 749, 750, 751,  94, 191, 235, 286, 329, 332, 378, 422,
+   428, 429, 431, 468, 479, 518, 521, 571, 574, 617, 622, 623,
+   659, 662, 664, 665, 666, 667, 669, 671, 709, 713, 716, 717,
+   718, 719, 757, 758, 759, 762, 763, 764, 766, 767, 878, 974,
+   975,1015,1019,1022,1023,1113,1114,1115,1118,1119,1159,1166,
+  1206,1207,1209,1210,1211,1212,1255,1260,1261,1262,1263,1304,
+  1305,1307,1309,1310,1347,1351,1354,1357,1358,1359,1396,1397,
+  1403,1404,1405,1406,1443,1444,1445,1446,1451,1455,1493,1494,
+  1495,1499,1500,1502, 207, 302, 349, 398, 399, 441, 444, 446,
+   487, 495, 588, 632, 639, 681, 729, 733, 125, 316, 366, 414,
+   452, 455, 508, 510, 597, 647, 653, 699, 701, 703, 746, 751,
+   191, 238, 281, 382, 383, 423, 527, 565, 617, 671, 713, 714,
+   717, 759, 762, 763,1117,1212,1214,1254,1255,1311,1359,1406,
+  1407,1450,1452,1453,1455,1495,1501, 350, 397, 446, 732, 364,
+   410, 509, 607, 653, 698, 739, 749, 751, 285, 424, 472, 478,
+   671, 758, 760, 761, 927,1022,1070,1210,1262,1263,1310,1450,
+  1451,1501, 637, 622, 764,1454,1497, 462, 463, 479, 670, 590,
+   110, 111, 199, 245, 297, 299, 300, 302, 339, 344, 347, 349,
+   350, 351, 392, 398, 442, 444, 445, 489, 492, 494, 530, 537,
+   540, 542, 543, 580, 582, 587, 590, 591, 630, 636, 637, 638,
+   639, 677, 679, 680, 681, 682, 683, 684, 685, 723, 727, 729,
+   732, 733, 734, 735,  78, 174, 266, 268, 269, 271, 319, 356,
+   363, 364, 365, 367, 404, 408, 412, 413, 414, 457, 458, 461,
+   462, 501, 506, 509, 510, 548, 553, 554, 559, 599, 600, 607,
+   643, 644, 645, 647, 648, 653, 655, 696, 698, 700, 701, 740,
+   742, 743, 744, 746, 750, 140, 234, 235, 237, 277, 286, 326,
+   333, 379, 381, 430, 431, 472, 475, 520, 525, 526, 527, 566,
+   574, 575, 620, 660, 668, 669, 670, 712, 715, 716, 717, 719,
+   757, 762, 763, 829, 874, 922, 925, 970,1018,1019,1021,1062,
+  1066,1069,1111,1114,1116,1117,1157,1163,1165,1166,1205,1209,
+  1251,1257,1258,1260,1261,1262,1310,1353,1359,1400,1402,1403,
+  1405,1407,1447,1451,1454,1455,1492,1495,1496,1497,1498,1500,
+  1501,1502, 349, 398, 439, 446, 585, 631, 639, 680, 685, 313,
+   364, 460, 506, 510, 549, 551, 607, 697, 698, 702, 749, 751,
+   380, 382, 474, 476, 661, 663, 718, 719, 761, 767,1069,1070,
+  1071,1116,1255,1263,1300,1397,1401,1451,1453,1455,1495,1498,
+  1499,1501, 447, 730, 719,1309, 650, 298, 395, 446, 489, 543,
+   585, 680, 730, 731, 733, 734, 735, 271, 414, 463, 511, 552,
+   559, 598, 602, 605, 606, 648, 649, 653, 698, 700, 742, 743,
+   749, 335, 471, 472, 478, 479, 521, 575, 617, 667, 719, 758,
+   761, 762, 766, 767,1022,1117,1118,1210,1262,1263,1311,1401,
+  1406,1446,1453,1498,1501,1503, 445, 719,1449,1450,1503, 762,
+   301, 303, 396, 446, 495, 635, 637, 680, 684, 687, 727, 735,
+   455, 504, 553, 646, 478, 713, 719,1062,1213,1305,1358,1405,
+  1446,1447,1453,1494,1499, 718, 447, 495, 718,1305,1448, 655,
+   685, 462, 670, 718,1263,1310,1455, 446,   8,  11,  14,  56,
+    57,  58,  60,  61,  62, 102, 105, 106, 108, 152, 153, 156,
+   157, 159, 202, 205, 207, 248, 249, 250, 251, 253, 254, 255,
+   294, 298, 299, 302, 303, 344, 345, 346, 348, 384, 386, 387,
+   390, 391, 392, 393, 395, 396, 397, 398, 435, 436, 439, 440,
+   442, 443, 444, 447, 480, 482, 483, 485, 486, 487, 491, 492,
+   495, 530, 531, 532, 536, 539, 540, 541, 543, 578, 581, 582,
+   589, 590, 591, 624, 628, 629, 630, 631, 632, 633, 636, 638,
+   639, 672, 673, 674, 675, 676, 677, 679, 680, 681, 682, 685,
+   686, 687, 723, 725, 731, 732, 733, 734, 735,  24,  26,  30,
+    31,  74,  75,  76,  78,  79, 125, 127, 167, 172, 174, 215,
+   218, 219, 221, 223, 268, 269, 270, 304, 313, 315, 316, 317,
+   318, 319, 357, 358, 360, 362, 365, 366, 367, 400, 409, 410,
+   413, 414, 454, 456, 458, 459, 461, 462, 463, 498, 499, 504,
+   506, 508, 509, 510, 511, 544, 546, 547, 550, 551, 553, 554,
+   555, 556, 557, 596, 599, 600, 601, 603, 604, 605, 606, 641,
+   644, 651, 652, 653, 690, 691, 692, 694, 695, 696, 697, 698,
+   699, 700, 701, 703, 736, 739, 741, 743, 744, 745, 748, 749,
+   751,  41,  42,  43,  44,  89,  91,  92, 134, 136, 140, 142,
+   184, 188, 234, 281, 283, 286, 327, 328, 330, 331, 332, 335,
+   371, 374, 375, 377, 380, 381, 382, 383, 419, 423, 425, 428,
+   429, 430, 431, 465, 468, 474, 475, 476, 477, 479, 516, 517,
+   518, 519, 521, 523, 524, 525, 526, 527, 563, 564, 565, 566,
+   569, 572, 573, 574, 575, 611, 613, 616, 617, 618, 619, 620,
+   622, 656, 658, 663, 665, 666, 668, 671, 704, 706, 709, 711,
+   714, 715, 716, 717, 718, 719, 756, 757, 758, 759, 760, 762,
+   764, 765, 768, 769, 770, 777, 781, 816, 817, 818, 819, 821,
+   825, 826, 830, 865, 866, 868, 869, 873, 874, 876, 879, 921,
+   922, 925, 927, 962, 967, 968, 969, 970, 972, 973, 974, 975,
+  1012,1013,1015,1016,1017,1019,1020,1060,1061,1062,1063,1064,
+  1065,1066,1067,1068,1069,1071,1108,1109,1110,1111,1113,1114,
+  1116,1117,1118,1119,1155,1157,1160,1161,1164,1165,1166,1167,
+  1200,1206,1210,1211,1212,1213,1215,1252,1255,1258,1259,1261,
+  1262,1263,1298,1299,1301,1302,1304,1305,1307,1309,1311,1344,
+  1346,1351,1353,1354,1355,1356,1358,1359,1392,1396,1398,1402,
+  1404,1405,1406,1407,1441,1444,1445,1446,1447,1449,1451,1452,
+  1453,1454,1490,1491,1494,1496,1498,1499,1500,1501,1502,  62,
+   206, 249, 300, 303, 346, 395, 399, 443, 445, 447, 484, 486,
+   488, 533, 542, 589, 591, 631, 635, 637, 639, 684, 685, 728,
+   735, 124, 127, 174, 221, 222, 271, 312, 360, 365, 409, 412,
+   413, 414, 458, 510, 553, 555, 556, 559, 604, 607, 646, 692,
+   699, 701, 702, 703, 745, 746, 748, 750, 751, 189, 190, 284,
+   377, 383, 428, 474, 524, 525, 527, 572, 573, 575, 622, 623,
+   668, 670, 709, 713, 719, 754, 758, 760, 763, 765, 767, 780,
+   828, 877, 926, 972,1021,1023,1061,1067,1113,1119,1165,1167,
+  1213,1255,1260,1311,1352,1358,1359,1398,1402,1444,1445,1450,
+  1452,1454,1455,1499, 255, 488, 539, 542, 589, 636, 639, 686,
+   459, 508, 605, 606, 702, 239, 430, 471, 575, 671, 719,1118,
+  1356,1451, 703,  14,  15,  59,  61, 105, 106, 108, 152, 153,
+   207, 245, 248, 249, 251, 253, 254, 255, 296, 297, 299, 301,
+   344, 346, 347, 348, 351, 390, 391, 395, 396, 399, 440, 444,
+   488, 489, 490, 492, 534, 536, 538, 541, 543, 581, 585, 588,
+   589, 629, 630, 631, 635, 636, 638, 639, 675, 680, 684, 685,
+   687, 725, 726, 730, 731, 733, 734, 735,  72,  74,  79, 121,
+   126, 127, 172, 173, 217, 270, 312, 317, 318, 319, 358, 360,
+   365, 366, 367, 410, 413, 414, 453, 456, 457, 460, 463, 503,
+   505, 506, 507, 509, 510, 545, 546, 547, 551, 553, 554, 559,
+   600, 602, 603, 604, 605, 645, 646, 648, 651, 653, 690, 692,
+   696, 698, 700, 701, 703, 739, 743, 744, 745, 749, 750, 751,
+    90, 143, 190, 235, 239, 329, 331, 335, 376, 377, 380, 381,
+   418, 428, 431, 466, 479, 520, 523, 525, 526, 527, 563, 565,
+   567, 569, 572, 573, 575, 612, 613, 614, 615, 616, 618, 619,
+   621, 660, 665, 669, 670, 671, 713, 714, 715, 716, 719, 755,
+   757, 758, 759, 764, 765, 767, 823, 827, 829, 830, 831, 864,
+   865, 873, 875, 876, 877, 878, 914, 924, 927, 962, 969, 972,
+   975,1020,1021,1061,1067,1069,1113,1114,1116,1117,1119,1160,
+  1161,1162,1163,1165,1166,1167,1206,1207,1208,1211,1213,1214,
+  1249,1252,1256,1258,1261,1262,1263,1300,1304,1305,1307,1310,
+  1349,1354,1356,1358,1359,1399,1402,1404,1406,1442,1445,1446,
+  1448,1449,1450,1452,1453,1454,1455,1489,1492,1496,1497,1499,
+  1502,  60,  63, 155, 201, 298, 346, 350, 397, 442, 446, 532,
+   537, 540, 542, 631, 633, 638, 686, 724, 730, 733, 269, 363,
+   364, 408, 459, 511, 551, 601, 604, 605, 606, 644, 655, 699,
+   702, 747, 142, 287, 333, 379, 382, 471, 478, 519, 569, 572,
+   662, 666, 667, 710, 713, 718, 759, 765,1023,1114,1117,1162,
+  1165,1166,1211,1213,1256,1262,1263,1357,1407,1455,1496,1498,
+  1502, 446, 638, 685, 221, 410, 415, 557, 559, 522, 667,1308,
+  1309,1357, 157, 158, 346, 351, 399, 442, 487, 587, 589, 639,
+   681, 727, 732, 735, 122, 460, 461, 558, 601, 655, 693, 700,
+   701, 745, 191, 379, 474, 525, 569, 570, 574, 669, 711, 715,
+   717, 758, 767, 926,1068,1069,1214,1263,1304,1308,1401,1402,
+  1405,1406,1441,1455,1500,1503, 254, 350, 351, 447, 542, 631,
+   638, 639, 365, 462, 510, 607, 651, 695, 699, 700, 748, 431,
+   620,1069,1213,1263,1309,1357,1402,1497, 303, 558, 715, 298,
+   495, 734, 557, 431, 527, 571, 715, 763, 927,1453,1500, 558,
+   670, 762,1355,1403, 639, 734, 335, 767,1452,1311, 732,1503,
+     9,  11,  15, 106, 108, 109, 110, 157, 158, 200, 202, 203,
+   204, 205, 206, 249, 250, 251, 255, 294, 296, 298, 299, 300,
+   301, 303, 342, 344, 345, 346, 347, 350, 351, 391, 392, 393,
+   394, 397, 399, 434, 435, 437, 441, 442, 443, 444, 445, 446,
+   447, 488, 489, 491, 493, 494, 533, 534, 535, 536, 537, 538,
+   539, 540, 582, 584, 586, 588, 590, 591, 632, 634, 636, 637,
+   675, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 722,
+   725, 726, 729, 730, 731, 732, 733, 734,  31,  74,  77, 126,
+   166, 167, 169, 172, 173, 174, 215, 217, 218, 219, 220, 222,
+   223, 261, 263, 265, 269, 270, 315, 318, 319, 358, 360, 361,
+   362, 365, 366, 400, 408, 413, 414, 415, 449, 453, 457, 458,
+   460, 463, 504, 505, 509, 510, 511, 548, 552, 553, 554, 555,
+   556, 557, 558, 597, 599, 600, 602, 606, 607, 643, 644, 645,
+   647, 648, 649, 651, 652, 654, 696, 740, 741, 742, 743, 744,
+   745, 747, 748, 749, 751,  95, 143, 185, 186, 187, 191, 232,
+   234, 235, 236, 238, 280, 282, 283, 286, 327, 328, 330, 332,
+   333, 371, 372, 373, 375, 376, 379, 381, 382, 426, 428, 431,
+   468, 471, 474, 475, 478, 479, 515, 517, 520, 521, 522, 525,
+   526, 527, 565, 566, 568, 570, 571, 572, 573, 574, 575, 613,
+   615, 616, 618, 621, 659, 660, 664, 666, 668, 669, 670, 671,
+   706, 707, 710, 711, 712, 715, 717, 718, 719, 755, 758, 759,
+   762, 763, 765, 766, 768, 769, 770, 771, 772, 773, 774, 775,
+   776, 777, 778, 780, 782, 783, 827, 828, 829, 867, 868, 869,
+   872, 874, 877, 879, 919, 920, 921, 922, 924, 925, 926, 969,
+   971,1014,1016,1017,1018,1019,1020,1021,1023,1063,1064,1065,
+  1066,1069,1070,1071,1106,1109,1111,1112,1113,1117,1118,1159,
+  1160,1162,1163,1164,1166,1167,1204,1206,1208,1210,1211,1212,
+  1213,1214,1253,1255,1257,1263,1299,1300,1301,1304,1305,1306,
+  1307,1308,1310,1345,1348,1349,1352,1353,1354,1355,1356,1359,
+  1395,1396,1399,1400,1401,1403,1404,1405,1441,1444,1445,1446,
+  1447,1448,1449,1450,1453,1454,1455,1491,1493,1497,1498,1499,
+  1501,1502,1503, 108, 111, 300, 301, 347, 350, 391, 442, 446,
+   487, 543, 633, 638, 731, 732, 734, 171, 217, 269, 361, 365,
+   412, 458, 460, 463, 508, 510, 559, 607, 648, 654, 695, 700,
+   703, 750, 187, 237, 238, 334, 375, 377, 379, 523, 526, 574,
+   620, 622, 664, 671, 711, 765, 781, 783, 874, 971,1023,1115,
+  1118,1214,1255,1260,1262,1263,1303,1304,1310,1356,1358,1359,
+  1397,1402,1451,1453,1492,1494,1501,1502,1503, 348, 590, 591,
+   638, 680, 732, 267, 462, 510, 651, 699, 383, 526, 669, 719,
+   766, 926,1068,1309,1406,1453, 559,1453,1499,  15, 107, 109,
+   201, 202, 203, 206, 250, 251, 254, 297, 301, 302, 341, 343,
+   350, 393, 394, 395, 396, 436, 441, 444, 446, 447, 490, 491,
+   493, 495, 538, 540, 542, 582, 585, 586, 587, 589, 591, 628,
+   629, 632, 633, 634, 635, 638, 639, 676, 680, 681, 682, 684,
+   685, 686, 687, 725, 726, 727, 728, 730, 732, 733,  30,  79,
+   120, 127, 171, 175, 218, 219, 223, 266, 270, 271, 311, 361,
+   363, 364, 365, 407, 414, 456, 458, 460, 462, 507, 509, 511,
+   554, 559, 597, 603, 605, 607, 642, 646, 647, 654, 693, 694,
+   695, 697, 698, 699, 702, 740, 742, 743, 744, 745, 746, 748,
+   750, 751,  89,  92, 138, 142, 184, 186, 191, 235, 237, 238,
+   239, 279, 281, 282, 287, 325, 327, 379, 380, 424, 426, 427,
+   431, 470, 473, 474, 476, 477, 478, 520, 524, 525, 527, 568,
+   575, 613, 614, 615, 617, 618, 619, 620, 623, 658, 660, 663,
+   664, 667, 668, 669, 670, 708, 710, 715, 719, 756, 762, 764,
+   766, 781, 816, 817, 818, 819, 820, 821, 822, 825, 826, 828,
+   829, 831, 871, 872, 874, 875, 919, 925, 926, 969, 971, 972,
+   973,1018,1021,1022,1023,1071,1112,1113,1114,1115,1117,1157,
+  1159,1161,1162,1164,1167,1207,1208,1209,1212,1213,1214,1255,
+  1256,1257,1300,1304,1305,1306,1309,1311,1348,1350,1352,1353,
+  1354,1358,1396,1397,1398,1402,1403,1404,1405,1407,1446,1447,
+  1449,1451,1452,1453,1492,1494,1496,1498,1499,1500,1501,1502,
+   255, 346, 395, 399, 634, 635, 686, 733, 734, 366, 509, 554,
+   559, 600, 653, 700, 703, 747, 748, 751, 477, 478, 668, 718,
+  1066,1112,1119,1159,1160,1354,1358,1359,1400,1406,1407,1453,
+  1454, 635, 558, 605, 573,1310,1499,1500,  15, 109, 111, 156,
+   158, 159, 205, 206, 303, 343, 351, 398, 399, 439, 440, 443,
+   445, 493, 494, 535, 537, 538, 541, 589, 590, 639, 676, 681,
+   683, 686, 724, 127, 171, 218, 222, 267, 271, 314, 318, 359,
+   457, 458, 463, 499, 501, 508, 550, 555, 598, 605, 649, 702,
+   741, 747, 748, 750, 751,  95, 238, 239, 326, 328, 429, 472,
+   474, 524, 619, 622, 660, 665, 667, 668, 669, 713, 718, 760,
+   829, 864, 865, 866, 867, 868, 869, 870, 872, 873, 877, 969,
+   971, 974,1014,1067,1071,1114,1115,1117,1159,1161,1167,1213,
+  1302,1311,1356,1358,1359,1400,1402,1405,1406,1447,1451,1454,
+  1492,1497,1498,1501,1503, 350, 494, 686, 751,1117,1215,1311,
+  1354,1501, 621, 622,1166, 159, 252, 255, 351, 443, 447, 488,
+   491, 495, 634, 637, 680, 683, 733, 124, 318, 319, 367, 413,
+   462, 463, 503, 602, 606, 655, 703, 741, 746, 287, 335, 381,
+   476, 527, 571, 573, 575, 622, 623, 671, 708, 713, 714, 764,
+   912, 913, 914, 921, 924, 925, 970,1020,1071,1118,1306,1307,
+  1310,1353,1357,1402,1405,1453,1455,1497,1499,1502, 493, 636,
+   654, 703, 523, 618,1308,1407, 397, 446, 447, 486, 631, 638,
+   686, 604, 606, 652, 664, 960, 961, 962,1263,1357,1401,1453,
+  1455, 590, 462, 505, 699, 751, 427, 713,1008,1009,1116,1501,
+   447, 542, 686, 730,1056,1057,1118, 527, 767,1104,1105,1164,
+  1500,1296,1440,1488,  10,  15,  56,  57, 105, 107, 108, 156,
+   157, 203, 205, 207, 249, 250, 251, 252, 253, 255, 296, 297,
+   299, 302, 343, 345, 347, 348, 350, 351, 387, 389, 390, 394,
+   395, 396, 398, 434, 435, 441, 443, 446, 447, 480, 482, 485,
+   488, 490, 491, 492, 495, 529, 532, 536, 537, 538, 539, 540,
+   541, 543, 581, 582, 583, 586, 587, 588, 589, 590, 591, 625,
+   626, 627, 628, 631, 633, 635, 637, 638, 639, 673, 678, 680,
+   681, 682, 685, 687, 723, 729, 730, 731, 733, 735,  22,  30,
+    72,  73,  75,  78, 123, 124, 125, 126, 127, 167, 169, 173,
+   215, 216, 218, 220, 221, 222, 265, 267, 269, 270, 315, 317,
+   318, 359, 360, 361, 362, 365, 366, 367, 406, 410, 411, 414,
+   415, 455, 456, 457, 458, 459, 461, 463, 497, 500, 508, 510,
+   544, 546, 547, 548, 549, 550, 551, 554, 555, 556, 557, 558,
+   559, 592, 595, 602, 603, 605, 607, 641, 642, 643, 648, 649,
+   652, 653, 654, 689, 696, 699, 700, 701, 738, 740, 744, 747,
+   748, 749, 750, 751,  40,  88,  91,  94,  95, 140, 141, 142,
+   143, 181, 187, 189, 190, 228, 235, 238, 277, 279, 280, 282,
+   286, 324, 327, 330, 332, 333, 334, 372, 375, 376, 379, 383,
+   420, 428, 429, 430, 469, 472, 473, 476, 512, 515, 522, 523,
+   525, 526, 527, 562, 563, 567, 569, 570, 571, 573, 574, 575,
+   610, 611, 615, 618, 619, 621, 658, 659, 661, 662, 663, 670,
+   671, 706, 710, 711, 712, 713, 716, 717, 718, 761, 762, 763,
+   764, 765, 768, 769, 770, 771, 772, 773, 774, 781, 783, 817,
+   818, 819, 820, 821, 822, 824, 825, 828, 831, 874, 875, 878,
+   921, 922, 925, 965, 969, 972, 973,1014,1018,1019,1021,1022,
+  1023,1061,1064,1066,1071,1114,1115,1117,1118,1156,1157,1161,
+  1162,1165,1166,1167,1200,1203,1207,1208,1209,1211,1212,1213,
+  1215,1256,1257,1258,1259,1260,1261,1262,1302,1303,1310,1346,
+  1349,1352,1353,1354,1355,1359,1392,1393,1394,1398,1400,1401,
+  1402,1405,1407,1442,1449,1450,1451,1452,1455,1488,1490,1493,
+  1494,1497,1500,1501,1503, 159, 252, 344, 348, 350, 351, 393,
+   444, 489, 494, 495, 541, 542, 543, 585, 587, 588, 635, 639,
+   680, 682, 684, 687, 731, 733, 734, 735, 169, 174, 270, 309,
+   317, 360, 410, 413, 507, 509, 511, 546, 557, 601, 602, 603,
+   605, 606, 647, 650, 653, 699, 701, 702, 703, 746, 747, 749,
+   750, 751,  93, 139, 141, 190, 191, 239, 331, 332, 333, 382,
+   426, 475, 479, 524, 525, 566, 573, 663, 664, 666, 670, 715,
+   717, 719, 753, 765, 767, 824, 830, 831, 878, 922, 975,1018,
+  1019,1068,1116,1158,1159,1161,1164,1165,1262,1310,1355,1356,
+  1401,1402,1407,1449,1496,1498,1500,1503, 351, 396, 491, 586,
+   590, 635, 683, 685, 730, 735, 221, 605, 607, 702, 574, 668,
+   670, 763,1259,1262,1311,1450, 569,1358,1406,  14,  63, 106,
+   108, 109, 152, 154, 155, 158, 203, 207, 246, 249, 255, 300,
+   343, 346, 349, 350, 394, 395, 437, 444, 447, 494, 495, 537,
+   538, 581, 582, 586, 589, 590, 630, 631, 634, 635, 638, 639,
+   675, 681, 687, 726, 730, 731, 733, 734, 121, 123, 124, 125,
+   169, 173, 216, 221, 223, 263, 264, 270, 309, 311, 312, 313,
+   314, 317, 318, 319, 361, 362, 363, 365, 367, 411, 413, 415,
+   455, 457, 458, 461, 463, 502, 503, 504, 507, 509, 547, 548,
+   555, 556, 558, 559, 593, 601, 602, 603, 604, 647, 648, 652,
+   695, 698, 699, 700, 702, 703, 740, 746, 748, 750,  47, 137,
+   140, 142, 143, 187, 234, 235, 239, 278, 287, 329, 332, 335,
+   375, 381, 426, 428, 470, 471, 472, 473, 474, 479, 515, 520,
+   521, 524, 525, 526, 527, 562, 563, 566, 614, 619, 663, 664,
+   712, 717, 753, 755, 759, 762, 764, 766, 767, 780, 827, 828,
+   866, 871, 873, 877,1022,1023,1064,1065,1067,1112,1114,1161,
+  1163,1165,1167,1210,1212,1213,1214,1215,1255,1257,1260,1263,
+  1304,1306,1308,1309,1311,1353,1356,1357,1398,1402,1404,1405,
+  1407,1451,1453,1455,1493,1496,1499,1500,1502,1503, 111, 155,
+   156, 157, 205, 252, 253, 255, 303, 351, 394, 395, 542, 583,
+   587, 591, 626, 636, 639, 683, 684, 686, 687, 730, 125, 267,
+   270, 319, 360, 362, 367, 414, 415, 462, 506, 510, 554, 556,
+   558, 559, 603, 606, 607, 644, 652, 655, 699, 700, 743, 744,
+   751, 141, 191, 235, 281, 381, 383, 423, 473, 474, 524, 526,
+   573, 575, 618, 663, 665, 668, 671, 706, 714, 716, 718, 764,
+   767, 781, 877, 974,1016,1019,1066,1068,1115,1208,1210,1212,
+  1257,1263,1306,1307,1308,1354,1355,1358,1400,1406,1449,1450,
+  1451,1452,1489,1497,1498,1501, 254, 590, 636, 733, 734, 315,
+   460, 607, 652, 654, 750, 574, 621, 764,1215,1306,1359,1405,
+   302, 303, 349, 350, 395, 398, 442, 495, 538, 541, 586, 590,
+   636, 732, 733, 735, 124, 170, 317, 364, 367, 413, 459, 461,
+   496, 555, 558, 559, 596, 600, 603, 647, 652, 653, 654, 690,
+   698, 702, 703, 746, 748, 749, 238, 328, 474, 475, 521, 523,
+   525, 526, 573, 621, 670, 707, 716, 719, 754, 758, 761, 763,
+   764, 766, 767, 872, 924,1019,1065,1069,1071,1112,1165,1166,
+  1167,1215,1260,1263,1309,1311,1355,1397,1400,1449,1450,1454,
+  1455,1503, 205, 206, 298, 300, 348, 349, 397, 543, 590, 591,
+   639, 683, 686, 127, 265, 266, 316, 365, 462, 508, 556, 603,
+   606, 607, 655, 703, 749, 335, 381, 427, 668, 767, 877,1023,
+  1165,1213,1214,1309,1357,1358,1454,1455,1499,1501,1502,1503,
+   109, 397, 588, 639, 682, 412, 413, 461, 511, 557, 605, 751,
+   766,1311, 441, 493, 541, 542, 586, 588, 733, 559, 651, 654,
+   655, 668, 717, 765,1261,1404, 495, 591, 685, 732, 734, 319,
+   461, 509, 650, 702, 751, 523, 527, 669, 671, 717, 925,1309,
+  1354,1356,1400,1500, 751, 524, 639, 426, 767,1454, 349, 684,
+   603, 699, 714, 716,1357,1452,1453,1455,   7,   8,  14,  15,
+    58,  59,  62, 104, 105, 108, 110, 151, 154, 156, 157, 159,
+   197, 198, 200, 203, 204, 205, 244, 251, 252, 253, 255, 293,
+   297, 298, 299, 300, 302, 343, 344, 346, 347, 350, 351, 387,
+   389, 390, 394, 396, 397, 398, 434, 435, 436, 443, 444, 445,
+   446, 447, 483, 485, 487, 491, 495, 531, 532, 538, 539, 540,
+   541, 543, 576, 577, 578, 579, 580, 581, 586, 588, 591, 624,
+   627, 632, 634, 635, 638, 672, 674, 677, 679, 680, 684, 686,
+   687, 722, 724, 725, 726, 729, 730, 732, 733, 734, 735,  21,
+    24,  25,  26,  27,  28,  30,  31,  65,  71,  75,  76,  78,
+   116, 118, 122, 124, 126, 165, 170, 171, 174, 175, 213, 215,
+   218, 219, 220, 221, 223, 260, 262, 267, 305, 316, 319, 353,
+   355, 358, 360, 361, 364, 366, 367, 405, 406, 411, 412, 413,
+   414, 449, 457, 461, 463, 496, 498, 500, 505, 507, 509, 552,
+   554, 557, 559, 593, 594, 595, 601, 604, 605, 607, 640, 641,
+   643, 644, 645, 646, 647, 650, 652, 653, 654, 655, 688, 690,
+   691, 692, 693, 694, 695, 696, 697, 699, 700, 740, 742, 743,
+   744, 746, 748, 749, 750, 751,  43,  44,  46,  47,  89,  91,
+    95, 136, 140, 143, 186, 187, 188, 189, 190, 191, 228, 232,
+   236, 237, 238, 273, 281, 282, 283, 286, 287, 330, 331, 332,
+   333, 335, 372, 375, 378, 379, 381, 382, 383, 421, 422, 423,
+   427, 429, 431, 466, 470, 471, 474, 475, 476, 477, 513, 515,
+   524, 526, 565, 569, 570, 573, 575, 613, 614, 615, 616, 619,
+   621, 623, 656, 657, 660, 661, 662, 664, 667, 668, 669, 670,
+   671, 705, 706, 709, 710, 711, 712, 713, 714, 715, 716, 718,
+   719, 756, 757, 758, 760, 761, 765, 777, 817, 818, 820, 822,
+   825, 827, 829, 830, 831, 869, 873, 874, 875, 877, 878, 879,
+   918, 925, 926, 927, 967, 968, 969, 970, 975,1015,1019,1020,
+  1021,1022,1061,1062,1063,1066,1067,1068,1070,1071,1104,1112,
+  1113,1117,1119,1155,1159,1160,1163,1165,1166,1167,1203,1207,
+  1208,1210,1211,1212,1214,1215,1253,1255,1256,1259,1260,1300,
+  1305,1307,1309,1310,1311,1345,1347,1348,1350,1352,1354,1355,
+  1357,1359,1396,1399,1401,1402,1403,1405,1407,1442,1445,1446,
+  1447,1449,1451,1452,1454,1488,1489,1490,1491,1493,1496,1497,
+  1498,1500,1503, 110, 156, 200, 206, 253, 301, 302, 346, 347,
+   391, 398, 446, 487, 493, 495, 533, 534, 535, 539, 540, 542,
+   587, 589, 591, 632, 637, 639, 673, 680, 683, 684, 686, 687,
+   720, 725, 726, 729, 731,  27, 122, 124, 125, 126, 221, 267,
+   270, 365, 451, 455, 456, 459, 460, 507, 509, 510, 511, 547,
+   548, 552, 554, 593, 594, 597, 599, 603, 606, 607, 640, 643,
+   648, 651, 655, 692, 693, 697, 702, 740, 742, 749,  43,  46,
+   186, 231, 232, 281, 285, 329, 334, 381, 383, 427, 428, 431,
+   478, 519, 522, 564, 571, 572, 609, 610, 612, 617, 618, 623,
+   667, 668, 669, 710, 715, 717, 718, 753, 763, 764, 766, 826,
+   925, 926, 972,1017,1018,1021,1022,1023,1069,1071,1117,1157,
+  1162,1163,1164,1166,1167,1203,1205,1213,1252,1259,1261,1297,
+  1302,1308,1309,1311,1348,1351,1352,1353,1357,1359,1397,1400,
+  1445,1446,1449,1451,1452,1488,1497,1502, 398, 399, 540, 542,
+   624, 630, 639, 687, 728, 171, 460, 603, 653, 654, 700, 745,
+   750, 238, 283, 286, 379, 569, 575, 713, 714, 718, 764, 874,
+   879, 971, 972,1021,1166,1214,1215,1302,1355,1453,1502, 584,
+   412,1212,  59, 105, 108, 157, 158, 204, 206, 207, 247, 249,
+   254, 299, 300, 302, 303, 347, 350, 395, 397, 399, 441, 445,
+   447, 485, 490, 493, 495, 537, 542, 578, 581, 582, 585, 629,
+   632, 637, 638, 679, 680, 682, 685, 686, 727, 730, 731,  76,
+    79, 126, 175, 214, 219, 221, 269, 304, 315, 318, 362, 366,
+   367, 405, 414, 461, 498, 499, 503, 504, 510, 511, 553, 558,
+   598, 602, 605, 606, 607, 646, 647, 650, 654, 688, 689, 692,
+   694, 697, 698, 702, 703, 742, 743, 744, 745, 747, 748, 138,
+   140, 141, 188, 232, 236, 237, 329, 334, 377, 383, 427, 428,
+   430, 431, 517, 518, 524, 526, 563, 574, 575, 609, 611, 612,
+   618, 621, 622, 660, 669, 671, 710, 713, 714, 715, 718, 719,
+   754, 760, 761, 763, 764, 765, 766, 767, 775, 778, 823, 827,
+   829, 830, 971, 973,1015,1022,1064,1067,1113,1117,1211,1214,
+  1252,1260,1261,1262,1303,1309,1311,1347,1350,1354,1355,1359,
+  1400,1403,1406,1441,1451,1452,1455,1492,1502,  63, 109, 111,
+   349, 350, 395, 396, 397, 441, 444, 447, 491, 494, 495, 539,
+   582, 583, 584, 585, 589, 632, 634, 637, 639, 682, 683, 686,
+   687, 725, 732, 733, 734,  76, 124, 217, 221, 222, 318, 363,
+   412, 414, 458, 507, 508, 544, 552, 557, 558, 594, 598, 601,
+   603, 640, 643, 648, 649, 695, 697, 702, 739, 748, 749, 751,
+    90, 189, 237, 282, 284, 285, 286, 331, 335, 378, 425, 524,
+   526, 527, 570, 573, 574, 610, 622, 660, 666, 668, 669, 671,
+   712, 713, 714, 757, 758, 759, 766, 871,1020,1068,1069,1071,
+  1114,1116,1212,1213,1306,1352,1357,1359,1395,1398,1403,1445,
+  1448,1453,1454,1455,1499,1500,1501,1502,  14, 445, 492, 634,
+   685, 728, 127, 413, 415, 655, 690, 698, 746, 747, 750, 334,
+   335, 379, 666, 714, 761, 763, 764, 766, 782,1261,1307,1311,
+  1350,1447,1498, 686, 509, 698, 671, 717, 110, 345, 392, 445,
+   447, 630, 636, 682, 685, 735, 268, 271, 316, 410, 412, 413,
+   462, 509, 511, 559, 607, 651, 703, 748, 238, 282, 479, 572,
+   620, 670, 927,1070,1258,1498,1503, 399, 446, 447, 678,  78,
+   413, 461, 507, 648, 749, 427, 476, 666, 670, 712, 764, 766,
+   831, 926,1071,1311,1453,1502,1503, 447, 494, 687, 412, 655,
+   426, 476, 669, 712, 509, 558,1402, 680, 653, 574, 541, 316,
+   696,  95, 524, 613, 557, 615,1503,1406, 668, 623, 765, 623,
+    13,  56,  60,  61,  62,  63, 108, 110, 153, 156, 157, 159,
+   199, 201, 249, 251, 252, 255, 299, 302, 303, 340, 346, 349,
+   351, 388, 391, 395, 442, 443, 444, 446, 488, 489, 491, 494,
+   495, 534, 536, 537, 539, 542, 543, 578, 582, 584, 586, 587,
+   588, 589, 626, 632, 633, 634, 635, 638, 639, 676, 678, 681,
+   683, 684, 685, 687, 721, 722, 723, 724, 728, 729, 730, 731,
+   732, 733, 734, 735,  31,  64,  65, 112, 113, 125, 126, 161,
+   172, 174, 175, 209, 213, 216, 219, 256, 266, 268, 271, 304,
+   305, 312, 313, 314, 315, 352, 354, 356, 359, 361, 362, 364,
+   367, 400, 402, 403, 406, 407, 410, 413, 414, 415, 448, 458,
+   460, 461, 496, 499, 500, 501, 504, 507, 509, 510, 511, 544,
+   546, 549, 551, 552, 553, 554, 555, 559, 593, 599, 600, 601,
+   602, 605, 606, 607, 640, 641, 642, 644, 645, 646, 648, 649,
+   651, 652, 653, 654, 655, 688, 689, 690, 693, 695, 696, 697,
+   698, 700, 701, 702, 703, 736, 737, 738, 739, 741, 743, 744,
+   746, 747, 748, 750, 751,  43,  46,  86,  92,  93,  94, 134,
+   140, 141, 143, 181, 230, 234, 235, 236, 238, 239, 277, 283,
+   286, 329, 331, 333, 375, 380, 381, 416, 424, 426, 427, 428,
+   429, 430, 431, 469, 477, 478, 479, 514, 517, 520, 523, 524,
+   525, 526, 527, 560, 562, 564, 566, 568, 570, 571, 573, 615,
+   617, 618, 619, 621, 622, 623, 656, 658, 660, 661, 662, 663,
+   664, 666, 667, 668, 669, 670, 671, 706, 710, 711, 712, 713,
+   715, 716, 717, 754, 755, 759, 760, 761, 762, 763, 764, 765,
+   766, 767, 777, 781, 782, 825, 827, 828, 830, 831, 872, 876,
+   878, 879, 919, 926, 968, 971, 972,1019,1023,1059,1064,1071,
+  1108,1115,1116,1117,1119,1158,1159,1160,1162,1163,1164,1165,
+  1167,1204,1205,1206,1207,1208,1209,1210,1211,1213,1214,1215,
+  1248,1253,1254,1255,1258,1259,1261,1262,1263,1296,1298,1300,
+  1301,1302,1303,1305,1306,1308,1309,1310,1311,1350,1351,1352,
+  1353,1356,1357,1359,1399,1400,1401,1403,1404,1406,1441,1444,
+  1446,1450,1451,1453,1455,1491,1492,1496,1497,1499,1500,1501,
+  1502,1503, 108, 110, 111, 157, 158, 204, 250, 303, 390, 394,
+   396, 434, 437, 438, 443, 444, 445, 447, 485, 487, 489, 490,
+   491, 493, 494, 530, 532, 536, 537, 539, 541, 543, 582, 585,
+   586, 587, 590, 591, 626, 629, 632, 633, 635, 638, 674, 675,
+   678, 679, 681, 684, 686, 721, 723, 727, 728, 729, 731, 733,
+   735,  26,  29, 114, 126, 174, 220, 223, 261, 267, 270, 271,
+   314, 317, 318, 319, 363, 365, 413, 414, 415, 449, 462, 463,
+   501, 502, 507, 508, 509, 511, 557, 558, 559, 596, 641, 646,
+   647, 648, 649, 650, 651, 654, 655, 689, 691, 693, 697, 698,
+   699, 700, 701, 703, 746, 747, 750,  95, 188, 235, 236, 284,
+   376, 377, 379, 380, 382, 383, 424, 426, 428, 470, 473, 474,
+   478, 521, 523, 526, 564, 566, 567, 569, 571, 572, 613, 616,
+   620, 623, 658, 664, 665, 667, 670, 709, 713, 715, 716, 718,
+   719, 755, 756, 760, 761, 763, 764, 766, 767, 778, 782, 824,
+   826, 827, 831, 877, 923, 971,1016,1018,1020,1021,1110,1116,
+  1117,1162,1166,1201,1202,1208,1212,1215,1248,1258,1261,1262,
+  1263,1298,1304,1305,1309,1311,1348,1349,1350,1351,1352,1353,
+  1355,1357,1400,1405,1406,1446,1447,1448,1451,1453,1455,1496,
+  1498,1502,1503, 206, 351, 396, 438, 443, 444, 446, 538, 581,
+   589, 633, 638, 679, 729, 735, 359, 364, 409, 415, 547, 551,
+   558, 607, 652, 697, 702, 745, 746, 750, 751, 333, 426, 428,
+   521, 524, 574, 610, 664, 667, 670, 712, 714, 715, 716, 717,
+   759, 766, 924, 925,1068,1117,1159,1165,1252,1258,1260,1261,
+  1304,1307,1353,1359,1405,1406,1407,1445,1449,1450,1452,1453,
+  1493,1496,1499,1500, 253, 490, 535, 542, 589, 636, 684, 731,
+   414, 510, 556, 607, 701, 702, 142, 669, 716,1166,1263,1351,
+  1403,1407,1447,1491,1500, 702,1454, 638, 152, 156, 158, 159,
+   255, 351, 442, 445, 482, 488, 533, 541, 542, 577, 590, 624,
+   628, 631, 632, 636, 638, 675, 679, 680, 685, 686, 720, 725,
+   727, 728, 734, 735,  75, 126, 316, 318, 365, 366, 367, 415,
+   453, 460, 462, 498, 508, 510, 553, 555, 597, 598, 601, 604,
+   650, 653, 689, 691, 692, 698, 699, 700, 701, 702, 736, 741,
+   744, 745, 747, 750,  93, 285, 287, 377, 379, 423, 424, 429,
+   467, 520, 521, 564, 573, 574, 575, 610, 612, 616, 619, 622,
+   623, 664, 667, 669, 670, 671, 710, 711, 713, 714, 715, 719,
+   760, 763, 764, 766, 827, 829, 924, 973,1021,1069,1070,1114,
+  1117,1206,1211,1252,1262,1263,1305,1308,1309,1311,1346,1352,
+  1357,1358,1396,1399,1401,1403,1404,1405,1447,1451,1453,1454,
+  1497,1502,1503,  15,  61, 303, 394, 442, 444, 491, 540, 591,
+   626, 630, 633, 685, 686, 724, 730, 732, 315, 359, 367, 405,
+   414, 457, 504, 557, 559, 595, 597, 599, 645, 651, 652, 654,
+   700, 701, 740, 746, 747, 750,  91, 233, 380, 425, 473, 474,
+   476, 477, 524, 570, 571, 572, 614, 617, 618, 667, 708, 716,
+   717, 922,1118,1258,1262,1305,1308,1311,1356,1358,1359,1395,
+  1401,1445,1450,1452,1454,1455,1494,1498,1500,1502, 484, 539,
+   541, 584, 589, 683, 684, 687, 726, 728, 731, 734, 221, 222,
+   363, 457, 463, 551, 606, 607, 646, 694, 701, 702, 746, 330,
+   431, 525, 564, 566, 617, 663, 667, 668, 671,1118,1158,1302,
+  1307,1355,1357,1399,1400,1401,1404,1447,1450,1453,1491,1497,
+  1501, 638, 655, 700, 573, 716, 718,1355, 699, 718,1500, 538,
+   684, 725, 730, 734, 414, 509, 651, 652, 749, 523, 615, 616,
+   671, 717, 759,1021,1263,1352,1356,1404,1405,1452,1490, 636,
+   727, 557, 750, 574,1207,1261,1357,1501, 687, 651, 698, 700,
+   714,1450,1492,1501, 728, 731, 606, 751,1404, 637, 719, 412,
+   703, 716, 767,1455,  62, 106, 111, 149, 157, 159, 205, 245,
+   247, 248, 249, 250, 251, 253, 289, 294, 296, 298, 300, 302,
+   303, 339, 341, 342, 345, 346, 349, 350, 351, 389, 391, 393,
+   394, 396, 398, 399, 436, 438, 439, 442, 444, 481, 487, 491,
+   492, 493, 495, 531, 542, 543, 579, 580, 581, 582, 583, 585,
+   586, 587, 588, 589, 590, 629, 630, 632, 633, 634, 635, 637,
+   638, 673, 676, 677, 679, 681, 683, 684, 686, 687, 721, 724,
+   725, 726, 727, 728, 729, 730, 731, 732, 733, 735,  16,  64,
+   112, 127, 160, 164, 171, 173, 175, 208, 209, 216, 217, 218,
+   219, 220, 256, 262, 265, 267, 269, 304, 307, 308, 315, 316,
+   317, 318, 319, 352, 356, 358, 359, 363, 365, 366, 367, 400,
+   404, 407, 408, 410, 412, 413, 448, 449, 454, 455, 458, 460,
+   463, 496, 497, 498, 501, 504, 505, 506, 507, 509, 510, 546,
+   547, 550, 552, 553, 556, 557, 595, 596, 597, 599, 601, 602,
+   604, 605, 606, 607, 640, 641, 642, 643, 645, 646, 647, 648,
+   649, 650, 652, 653, 655, 689, 691, 693, 695, 698, 736, 738,
+   740, 741, 743, 745, 750,  90,  95, 136, 142, 182, 189, 190,
+   191, 230, 232, 234, 237, 274, 278, 280, 283, 284, 285, 322,
+   324, 327, 331, 335, 372, 374, 375, 376, 377, 379, 380, 381,
+   382, 383, 424, 428, 430, 431, 465, 466, 475, 479, 516, 521,
+   522, 524, 525, 526, 560, 561, 562, 565, 568, 569, 570, 574,
+   575, 610, 611, 612, 613, 615, 616, 617, 618, 619, 620, 623,
+   657, 659, 664, 665, 668, 670, 671, 705, 706, 707, 712, 713,
+   717, 754, 755, 756, 759, 761, 764, 766, 781, 877, 919, 922,
+   924, 927, 969, 975,1014,1021,1023,1066,1067,1069,1070,1106,
+  1110,1113,1114,1117,1119,1163,1166,1205,1206,1207,1209,1212,
+  1214,1255,1257,1259,1260,1263,1297,1298,1299,1300,1301,1304,
+  1305,1307,1308,1309,1351,1352,1354,1355,1358,1393,1394,1395,
+  1397,1399,1400,1401,1402,1403,1404,1406,1407,1440,1442,1444,
+  1446,1447,1448,1450,1453,1494,1496,1497,1499,1501,1502,1503,
+    60,  63, 108, 109, 110, 157, 159, 203, 250, 253, 254, 300,
+   302, 303, 345, 348, 351, 442, 443, 446, 482, 490, 492, 493,
+   494, 495, 533, 535, 538, 543, 583, 584, 585, 586, 587, 589,
+   590, 591, 629, 635, 636, 639, 675, 676, 677, 680, 681, 683,
+   684, 687, 724, 725, 726, 730, 732, 734, 735,  17,  65, 113,
+   161, 171, 174, 175, 209, 212, 216, 219, 221, 223, 257, 265,
+   266, 269, 271, 305, 306, 311, 313, 315, 318, 357, 361, 362,
+   365, 401, 407, 409, 415, 449, 457, 460, 462, 463, 497, 500,
+   503, 505, 506, 509, 511, 549, 555, 556, 559, 593, 596, 597,
+   598, 601, 602, 605, 607, 641, 643, 645, 650, 652, 654, 689,
+   691, 693, 695, 697, 701, 703, 737, 747, 748, 749, 751,  93,
+   187, 189, 232, 236, 237, 239, 280, 334, 335, 374, 376, 380,
+   382, 417, 424, 425, 426, 427, 430, 431, 470, 473, 474, 476,
+   520, 522, 523, 525, 561, 564, 565, 566, 568, 572, 573, 575,
+   609, 610, 613, 617, 621, 622, 623, 662, 663, 666, 667, 669,
+   670, 671, 706, 708, 710, 711, 712, 716, 717, 718, 752, 756,
+   757, 759, 762, 764, 766, 824, 831, 878, 971,1022,1023,1063,
+  1066,1110,1112,1115,1117,1158,1203,1208,1212,1214,1215,1257,
+  1259,1261,1262,1301,1303,1305,1309,1351,1354,1355,1357,1394,
+  1395,1400,1401,1403,1405,1407,1448,1452,1453,1454,1455,1492,
+  1493,1494,1496,1499,1500,1502,1503, 111, 205, 341, 351, 395,
+   439, 442, 443, 445, 447, 492, 493, 536, 540, 542, 585, 587,
+   589, 632, 638, 639, 681, 727, 728, 733, 734, 735,  18,  66,
+   114, 162, 219, 223, 306, 317, 318, 364, 409, 410, 412, 450,
+   452, 461, 463, 502, 507, 508, 551, 556, 557, 601, 602, 604,
+   605, 606, 607, 645, 650, 652, 653, 696, 697, 701, 702, 703,
+   739, 750, 751, 140, 191, 239, 283, 285, 286, 325, 334, 381,
+   430, 431, 471, 472, 478, 516, 522, 524, 526, 574, 575, 613,
+   614, 615, 620, 622, 669, 707, 712, 714, 716, 718, 719, 757,
+   763, 764, 767, 874, 878, 879,1023,1067,1069,1071,1114,1165,
+  1167,1203,1212,1254,1301,1311,1354,1355,1359,1394,1396,1404,
+  1405,1406,1444,1445,1454,1497,1498,1499,1500,1503, 348, 447,
+   492, 494, 590, 636, 678, 681, 685, 729, 730,  19,  67, 222,
+   271, 367, 414, 415, 453, 504, 556, 558, 650, 652, 697, 700,
+   702, 703, 745, 478, 574, 621, 664, 667, 716, 718, 763, 764,
+   766,1069,1113,1215,1301,1311,1404,1446,1448,1450,1452,1454,
+  1455,1496,1502,1503, 538, 585, 587, 729,  20,  68, 317, 605,
+   743, 748, 718,1306,1355,1407,1452,1453, 445,  21,  69, 558,
+   698, 475, 574, 685, 735,  22,1406,1452,  23,  24,  25,  26,
+    27,  28,  29,  30,  31, 302, 348, 398, 437, 442, 443, 445,
+   447, 487, 492, 495, 533, 536, 539, 541, 583, 585, 632, 633,
+   634, 637, 676, 677, 683, 685, 687, 727, 732, 734, 319, 358,
+   365, 410, 412, 457, 458, 459, 463, 510, 549, 553, 555, 599,
+   600, 649, 650, 651, 655, 696, 700, 740, 741, 743, 749, 332,
+   423, 430, 474, 526, 527, 569, 571, 614, 617, 620, 662, 665,
+   668, 671, 705, 713, 716, 717, 759, 764, 925,1071,1163,1167,
+  1207,1210,1211,1262,1298,1307,1310,1355,1357,1358,1359,1402,
+  1405,1406,1450,1451,1452,1453,1491,1492,1496, 255, 491, 495,
+   541, 542, 585, 590, 728, 730, 733, 312, 409, 500, 501, 507,
+   511, 559, 597, 654, 690, 702, 703, 750, 751, 567, 569, 574,
+   661, 665, 761, 767,1119,1166,1212,1213,1451,1452,1454,1455,
+  1496,1500,1501, 590, 638, 731, 366, 652, 525, 574,1359,1404,
+  1447,1503, 638, 684, 655, 703, 382, 525, 713, 399, 318, 666,
+   717, 442, 495, 543, 639, 687, 509, 653, 383, 467, 527, 623,
+   713,1307,1357, 622, 623, 717,1213,1396,1449, 716, 734, 607,
+   719,1451, 632, 733, 765, 592, 603, 604,  14,  60, 104, 109,
+   151, 157, 158, 159, 198, 204, 206, 207, 244, 246, 247, 252,
+   253, 293, 297, 299, 300, 301, 339, 344, 345, 346, 350, 389,
+   391, 398, 434, 435, 436, 441, 442, 443, 444, 445, 446, 484,
+   485, 486, 487, 488, 489, 490, 491, 494, 529, 536, 539, 541,
+   542, 579, 580, 586, 588, 589, 591, 625, 632, 634, 635, 636,
+   637, 638, 639, 673, 677, 678, 679, 680, 681, 683, 686, 687,
+   723, 724, 727, 728, 729, 733, 734, 735,  16,  17,  23,  28,
+    31,  64,  65,  72,  76,  77,  78,  79, 112, 113, 125, 161,
+   173, 208, 209, 214, 215, 220, 256, 257, 261, 262, 264, 268,
+   304, 305, 307, 312, 316, 354, 357, 362, 363, 365, 366, 403,
+   404, 405, 407, 412, 413, 451, 452, 453, 455, 460, 462, 463,
+   500, 503, 507, 508, 509, 511, 545, 547, 551, 555, 556, 558,
+   559, 592, 598, 600, 601, 602, 603, 604, 605, 606, 607, 641,
+   642, 646, 647, 651, 690, 691, 694, 695, 696, 697, 698, 699,
+   700, 702, 703, 736, 738, 739, 742, 743, 748, 749, 751,  46,
+    81,  90,  94, 129, 140, 143, 177, 179, 187, 189, 190, 191,
+   225, 231, 232, 239, 273, 275, 278, 279, 280, 282, 283, 285,
+   286, 322, 335, 368, 377, 381, 419, 420, 425, 428, 430, 431,
+   464, 474, 475, 476, 478, 514, 517, 519, 521, 523, 524, 525,
+   527, 561, 562, 565, 567, 573, 574, 614, 617, 619, 621, 622,
+   623, 656, 657, 664, 666, 667, 669, 670, 671, 704, 706, 707,
+   714, 716, 752, 755, 756, 757, 758, 759, 760, 762, 764, 765,
+   766, 767, 775, 779, 780, 781, 826, 828, 831, 879, 925, 926,
+   973, 974,1014,1015,1016,1062,1064,1065,1067,1069,1071,1109,
+  1113,1114,1117,1119,1158,1161,1164,1205,1206,1207,1210,1211,
+  1213,1214,1251,1252,1253,1254,1255,1256,1257,1258,1262,1263,
+  1305,1306,1307,1308,1309,1310,1345,1346,1347,1348,1349,1352,
+  1355,1357,1358,1359,1399,1405,1406,1440,1442,1444,1445,1447,
+  1448,1450,1451,1453,1455,1491,1493,1494,1497,1498,1502,1503,
+    15,  61, 106, 107, 109, 158, 204, 207, 347, 349, 396, 397,
+   434, 436, 438, 443, 444, 484, 490, 491, 494, 495, 529, 531,
+   533, 540, 543, 581, 584, 586, 588, 590, 591, 625, 628, 630,
+   632, 637, 678, 679, 682, 683, 684, 687, 724, 726, 729, 730,
+   731, 732, 733, 735,  31,  76,  79, 125, 126, 127, 173, 217,
+   221, 267, 306, 313, 353, 354, 357, 360, 363, 410, 413, 451,
+   456, 457, 458, 462, 502, 508, 509, 546, 548, 552, 554, 555,
+   556, 557, 559, 594, 596, 601, 602, 604, 605, 606, 607, 641,
+   643, 645, 646, 648, 649, 650, 653, 654, 688, 689, 693, 700,
+   701, 702, 738, 741, 748, 749, 750, 751,  47,  94, 139, 141,
+   182, 188, 189, 324, 328, 374, 427, 430, 431, 465, 472, 476,
+   479, 513, 519, 520, 524, 526, 527, 566, 568, 569, 570, 573,
+   574, 575, 609, 613, 615, 618, 620, 622, 660, 661, 663, 667,
+   705, 706, 710, 715, 717, 718, 719, 753, 755, 758, 759, 761,
+   762, 763, 765, 767, 782, 830, 877, 878,1061,1066,1113,1118,
+  1156,1158,1163,1164,1166,1249,1250,1252,1253,1254,1258,1261,
+  1262,1263,1296,1298,1299,1307,1309,1310,1311,1346,1350,1357,
+  1358,1359,1392,1397,1399,1401,1403,1404,1405,1406,1453,1454,
+  1488,1492,1497,1498,1499,1501,1502, 109, 351, 398, 493, 539,
+   541, 585, 628, 683, 685, 725, 728, 730, 413, 454, 499, 505,
+   511, 555, 559, 698, 741, 745, 747, 239, 378, 429, 477, 525,
+   565, 572, 620, 623, 663, 664, 665, 669, 716, 718, 719, 758,
+   766,1160,1205,1211,1214,1308,1357,1359,1407,1447,1448,1451,
+  1455,1502,1503, 750, 751, 519, 569, 619, 670,1214, 747,  15,
+    63, 110, 159, 254, 395, 396, 398, 440, 442, 482, 486, 493,
+   494, 533, 535, 540, 579, 588, 589, 633, 637, 638, 681, 682,
+   683, 684, 723, 725, 732, 733, 735, 309, 411, 460, 462, 463,
+   511, 550, 554, 557, 596, 601, 645, 646, 648, 649, 651, 695,
+   697, 701, 738, 740, 746, 749,  46,  94,  95, 138, 191, 431,
+   475, 525, 565, 567, 572, 575, 616, 658, 659, 661, 667, 668,
+   671, 705, 710, 713, 714, 715, 716, 717, 718, 756, 757, 758,
+   760, 765, 767, 824, 924,1019,1068,1161,1201,1202,1214,1255,
+  1259,1260,1261,1300,1301,1302,1309,1311,1350,1353,1355,1357,
+  1358,1394,1401,1403,1404,1405,1406,1407,1447,1449,1451,1452,
+  1454,1455,1494,1495,1499,1500,1502,1503,  60, 111, 155, 345,
+   399, 445, 487, 494, 534, 541, 578, 582, 588, 591, 636, 638,
+   639, 677, 680, 687, 728, 733, 734, 221, 454, 502, 509, 511,
+   551, 592, 596, 605, 607, 645, 648, 652, 653, 654, 694, 698,
+   699, 700, 701, 702, 703, 748,  45, 142, 238, 474, 476, 477,
+   522, 525, 526, 527, 567, 570, 573, 574, 613, 617, 619, 663,
+   665, 668, 669, 670, 714, 717, 719, 754, 758, 760, 761, 764,
+   766, 829, 924, 925,1068,1165,1211,1258,1299,1305,1309,1311,
+  1353,1356,1359,1398,1403,1404,1405,1407,1440,1445,1453,1454,
+  1491,1497, 158, 446, 490, 539, 543, 581, 589, 591, 631, 683,
+   687, 727, 729, 730, 731, 733, 462, 463, 509, 511, 557, 648,
+   652, 653, 654, 693, 695, 702, 703, 743, 751, 238, 430, 478,
+   479, 521, 522, 526, 527, 615, 619, 622, 623, 670, 713, 718,
+   761, 762, 767,1350,1357,1358,1400,1401,1451,1454,1496,1497,
+  1503, 539, 541, 733, 734, 703, 669, 670, 710,1214,1262,1311,
+  1446,1503, 495, 588, 651, 749,1501, 605, 748, 345, 445, 446,
+   483, 532, 587, 589, 590, 637, 678, 685, 720, 734, 173, 603,
+   604, 653, 654, 695, 143, 527, 668, 715, 717, 718, 765, 766,
+  1215,1261,1451,1455,1497, 255, 495, 638, 678, 686, 730, 733,
+   606, 702, 703, 476, 525, 574, 668, 671, 766, 767,1353,1446,
+  1453, 493, 634, 638, 681, 602, 570, 716, 767, 589, 686, 703,
+   685, 763, 591, 665,1450, 637, 749, 765,1497, 605, 767,1499,
+    10,  15,  53,  58, 106, 107, 108, 110, 111, 149, 153, 158,
+   199, 200, 201, 202, 204, 205, 206, 207, 246, 252, 296, 298,
+   301, 303, 339, 340, 346, 348, 350, 388, 391, 392, 394, 395,
+   396, 398, 437, 439, 440, 441, 442, 445, 446, 447, 484, 486,
+   489, 493, 494, 495, 530, 533, 537, 538, 541, 542, 579, 580,
+   581, 583, 584, 587, 588, 590, 625, 626, 627, 628, 630, 631,
+   632, 634, 637, 638, 639, 674, 679, 680, 681, 684, 686, 687,
+   720, 721, 722, 723, 725, 728, 729, 730, 731, 732, 733, 734,
+   735,  29,  70,  72,  73,  77,  78,  79, 123, 124, 127, 167,
+   170, 171, 173, 214, 217, 218, 219, 220, 223, 257, 263, 264,
+   266, 267, 268, 271, 305, 307, 309, 313, 314, 316, 319, 353,
+   360, 362, 365, 366, 367, 400, 403, 404, 406, 411, 412, 413,
+   415, 448, 451, 453, 454, 455, 456, 458, 462, 463, 497, 499,
+   500, 501, 504, 505, 507, 508, 509, 546, 547, 548, 549, 550,
+   552, 553, 555, 556, 558, 559, 592, 593, 596, 597, 600, 601,
+   603, 604, 605, 646, 647, 648, 650, 651, 653, 654, 689, 690,
+   691, 694, 696, 697, 698, 699, 701, 702, 703, 739, 743, 745,
+   746, 748, 749, 750, 751,  40,  43,  45,  46,  47,  80,  90,
+    93,  94, 128, 136, 137, 140, 141, 185, 187, 236, 237, 239,
+   273, 281, 283, 285, 324, 326, 328, 329, 332, 335, 368, 369,
+   377, 379, 382, 383, 416, 418, 423, 424, 428, 429, 430, 431,
+   466, 470, 472, 473, 475, 477, 515, 520, 521, 522, 525, 526,
+   527, 561, 562, 563, 565, 567, 570, 571, 572, 575, 610, 613,
+   615, 616, 617, 619, 620, 621, 622, 660, 664, 665, 666, 667,
+   668, 670, 671, 705, 708, 709, 711, 712, 713, 714, 716, 717,
+   718, 719, 753, 756, 757, 758, 759, 760, 761, 763, 764, 765,
+   766, 767, 776, 778, 781, 824, 825, 826, 827, 828, 830, 831,
+   873, 927, 970, 971, 972, 973, 974, 975,1015,1016,1018,1020,
+  1022,1023,1064,1070,1071,1106,1108,1111,1112,1114,1115,1116,
+  1118,1119,1152,1158,1160,1166,1167,1204,1208,1209,1210,1211,
+  1213,1214,1215,1251,1255,1256,1260,1261,1298,1301,1302,1303,
+  1304,1306,1307,1346,1350,1351,1353,1355,1356,1357,1358,1395,
+  1396,1397,1398,1399,1400,1401,1403,1404,1405,1442,1444,1445,
+  1446,1447,1449,1450,1451,1452,1455,1488,1489,1490,1493,1494,
+  1498,1499,1500,1501,  15,  62, 111, 207, 300, 301, 350, 492,
+   494, 536, 538, 583, 585, 586, 589, 590, 591, 629, 631, 632,
+   638, 639, 681, 684, 686, 725, 728, 731, 734,  28,  75,  78,
+   124, 126, 173, 174, 216, 220, 270, 315, 316, 353, 362, 364,
+   462, 463, 504, 551, 557, 593, 603, 642, 647, 652, 654, 655,
+   692, 693, 697, 699, 701, 703, 740, 742, 744, 746, 748, 751,
+    47, 143, 189, 237, 283, 330, 335, 381, 383, 421, 428, 473,
+   520, 521, 523, 524, 525, 527, 566, 571, 575, 614, 617, 619,
+   622, 623, 659, 664, 666, 711, 712, 718, 719, 756, 757, 761,
+   763, 782, 783, 874, 875, 970,1021,1067,1117,1161,1165,1166,
+  1204,1210,1213,1215,1256,1262,1304,1306,1309,1347,1350,1351,
+  1353,1354,1359,1443,1450,1453,1493,1495,1496,1497,1498,1499,
+   348, 589, 638, 681, 686, 731, 126, 318, 365, 510, 601, 650,
+   652, 653, 751, 381, 383, 623, 666, 671, 719,1257,1405, 680,
+   335,  13,  59,  60, 105, 106, 109, 110, 111, 158, 207, 249,
+   252, 254, 301, 348, 351, 386, 390, 393, 395, 399, 436, 445,
+   446, 487, 494, 533, 536, 537, 538, 539, 543, 578, 580, 585,
+   587, 590, 625, 626, 628, 630, 631, 632, 636, 639, 674, 682,
+   683, 684, 685, 686, 726, 729, 730, 731, 732, 733,  74, 121,
+   124, 127, 171, 173, 220, 221, 222, 266, 267, 270, 316, 365,
+   367, 404, 406, 412, 413, 414, 459, 504, 505, 506, 507, 508,
+   551, 554, 556, 557, 559, 593, 606, 607, 641, 646, 648, 649,
+   650, 693, 697, 698, 701, 737, 742, 743, 744, 748, 751,  41,
+    95, 142, 185, 233, 237, 238, 281, 283, 326, 331, 332, 334,
+   335, 381, 382, 383, 416, 428, 431, 472, 475, 479, 515, 516,
+   524, 527, 565, 566, 573, 575, 609, 616, 619, 623, 657, 661,
+   665, 666, 667, 671, 707, 710, 712, 713, 714, 715, 716, 717,
+   719, 753, 754, 755, 757, 758, 765, 766, 767, 779, 826, 827,
+   831, 877, 925, 927, 968,1021,1063,1112,1116,1118,1166,1215,
+  1260,1261,1262,1307,1309,1346,1347,1358,1395,1396,1399,1400,
+  1401,1402,1442,1453,1455,1492,1497,  61,  63, 159, 252, 293,
+   351, 396, 438, 443, 445, 447, 485, 490, 495, 532, 540, 584,
+   591, 627, 630, 634, 635, 638, 639, 681, 683, 684, 729, 730,
+   731, 732, 735, 121, 124, 169, 223, 271, 316, 362, 365, 410,
+   411, 415, 455, 457, 462, 463, 502, 506, 550, 551, 555, 597,
+   600, 601, 647, 649, 651, 653, 654, 655, 693, 697, 698, 703,
+   739, 741, 742, 744, 745, 751,  89, 137, 142, 187, 237, 285,
+   328, 330, 331, 332, 378, 381, 382, 417, 424, 517, 524, 526,
+   527, 561, 568, 569, 574, 617, 618, 619, 623, 657, 663, 671,
+   704, 709, 754, 756, 757, 760, 763, 923, 972,1019,1067,1118,
+  1163,1212,1262,1304,1310,1359,1401,1404,1447,1451,1452,1453,
+  1455,1490,1492,1496,1497,1500,1502, 446, 585, 589, 684, 728,
+   123, 461, 511, 650, 651, 239, 381, 383, 429, 764,1497,1500,
+  1503, 750, 666,1119,  13, 109, 252, 397, 494, 588, 631, 639,
+   676, 682, 725, 726, 730, 734, 126, 455, 459, 602, 651, 695,
+   143, 428, 476, 569, 617, 619, 660, 712, 715,1022,1116,1215,
+  1304,1310,1351,1352,1397,1406,1497,1499,1502, 108, 254, 445,
+   539, 591, 676, 558, 600, 603, 646, 650, 701, 741, 746, 749,
+   335, 568, 671, 755,1262,1359,1400,1450,1496, 590, 509, 644,
+   749, 751, 429, 666, 713, 718, 759, 764, 766,1115,1119,1262,
+  1357,1403, 634, 574, 716, 733, 734, 601, 697, 764, 638, 695,
+   623,1451, 239, 732
+};
+
+const ogg_int32_t OD_PRED_WEIGHTS_16x16_Q12[10240]={
+     655,  -572,  -374,  -519,   455,   412,  -749,  -578,  -540,   396,
+     456,  1294,  -678, -1667,  -682,  -419,   457,   971,  -389,  -540,
+    -516,   572,  1306,   957,  -531,  1370,  -923,  -942,  -418,  -509,
+     571,   715,  -493,  -521,  -976,   473,  1013,  -687,   448,  -552,
+    -607,   524,   500,   691,  -741,  1198,  -542,   514,   468,  -752,
+    1264,  -807,  -687,   578,   403,   663,   402,   609,   804,   726,
+    -480,  -500,   569,   770,   382,   714,  -441,   552,   789,  -456,
+     927,  -553,   832, -1118,   527,   385,  -657,  1099,   777,  1231,
+     526,   400,  -466,   852,  1085,  -395,  -790,   528,   667,   817,
+    1510,   628,   550,  -585,   467,  -490,   694,   406,   602,   751,
+    -840,   544,  -830, -1543,   550,  -735,  -811,  -421,  -628,   997,
+    -952, -1410,  1200,  1148,  1763,   434,   522,   443, -2057,   426,
+    -425,  -437,  -438,  1407,  -571,  1090,  -495,  -484,   985,  -405,
+    -385,   490,  1029,   575,  -400,   591,  -906,   416,   395,   784,
+    -457,  -970,   405,  -373,   821,   557, -1336,   813,   518,  -807,
+    -472,  1140,  -629,   928,  -597,  1062,  1158,  -371,   659,   606,
+     660,   406,  -713, -1169,  1983, -1159,  -528,   608,   439,  -686,
+    -691,  -521,  -592,  -480,  -627,  -654,   594,   541, -1059,   476,
+     483,   731,  -909,   542,  -493,  1133,   762,  -715,   388,  -680,
+   -1492,  -470,   786,   497,   792,  -955,  -428,   594,  -861, -1049,
+     413,  -834,  -903,   712,   504,  1449,  1131,  -567,   382,   926,
+   -1047,  -489,  -491,  -477,  -826,   899,  1024,  -913,   679,  -379,
+    1105,   481, -1475, -1450,  -779,  1686,  -438, -1401,   907,   568,
+     461,  1044,  -953, -1977,  1322,   816,  -763,   443,  -422,  -493,
+    -664,   614,  -551,   576,   483,  1044,  -397,  -536,  -488,  -369,
+    -932,   376,  -549,   874,  -587,  2002,   392,   593,   372,  1511,
+     507,  -738,   713,  -596,   524,  -921,  -630,   503,   549,   790,
+   -1015,  1088,  -438,  -749,  -469,  -610, -1068,  -420,   929,  -414,
+     613,  -438,   537,  -700,  -982,   972,  -934,   894,  -575,  -956,
+    -456,  -554,   540,  1173,   750,  -839,   703,  -582,   751,  -818,
+     394,   990,  -456,   521,   702,   667,   454, -1187,   914,   737,
+     491,  1109,   865,  -758,   640,  -773,  -653,   577,   685, -1275,
+   -1391,   389,   997,  1926,  -520,  -883,   382,  1062,  1170,  -448,
+     371,   456,   686,   511,  -373,  -405,   475,  -600,   794,  1653,
+    2093, -2032,  1029,  -566,   378,  -936,   387, -1295,  2254,   393,
+     518,  -632,   418,   586,   539,   412,  -488,  -641,   449,   490,
+     776,  -894,  -607,   411,   777,  -534,   420,   544,  -922,  -621,
+    -516, -1037, -1489,   984,  1736,  -652,   869,  -404,   408,  -493,
+    1103,   552,  -627,  1561,   471,  -853,   870,  -495,  1598,   649,
+    1223,   374,   802,  -389, -1129,   438, -1098, -1220,   563,   410,
+    -468,  -636,   638,   896,   399,   436, -1139,   435, -1182,   435,
+    1120,   696,  -604,  -404, -1309,   526,   579,   493,  -822, -1071,
+    -947,   721,   486,  1162,  -389,  -953,   858,  1758,  -556,  -493,
+     374,  -840,  -776,   776,  -971,  -451,   591,  -811, -1683,  -546,
+     403,   581,   486,   802,  -688,  1295,  -765,   734, -1344, -1098,
+     428,   755,  -670,   412,  -392,  -442,  -415,   422,  -370,   528,
+    -420,  -517,  -749,   484,  -469,   405,  -415,   462,  -486,   581,
+    -616,   480,   391,  -902,   503,  -601,   947,   589,  -470,  -694,
+    1004,  -811,  -460,   377,  -384,   716,  -383,  -400,   645,   383,
+     496,  -501,  -536,   803,   499,  -566,   883,   525,   478,  -487,
+     769,   674,   419,   865,  -807,   560,   459,   994,   476,   504,
+     567,   424,   432,  -381,  -452,   718,   424,   674,  -529,  -426,
+    -524,  -473,   583,   593,  -370,   495,   430,  -522,   594,  -445,
+     710,  -795,   589,   482,  -627,  -441,  -532,   917,   695,  -560,
+     424,   408,  -678,   580,  -579,  -378,   426,   501,  -512,  -503,
+     499,   609,   766,   576,   466,  -468,  -656,   812,   538,   736,
+    -404,  -438,  -370,  -399,  -419,  -454,  -625,   614,   431,  1279,
+     576,  -372,   521,   591,  -507,  -373,   416,   371,  -512,   371,
+     528,  -381,  -403,  -462,   580,   399,   514,   377,  -395,   453,
+    -524,   369,   419,  -510,  -431,  -519,   384,  -423,  -376,  -369,
+     432,   462,   399,   424,   429,  -412,   392,  -370,  -475,  -424,
+    -434,   527,   427,  -537,   417,  -380,  -423,  -498,  -723,  -429,
+    -489,   466,  -477,   461,   500,  -475,  -454,   382,  -439,  -421,
+    -453,  -522,   384,   451,   495,   801,   562,   522,   472,   819,
+     534,   648,   582,   780,   400,  -476,   428,  -454,   432,  -665,
+    -486,   493,   573,   584,   519,  -470,  -378,   413,  -553,  -477,
+     539,   839,  -413,  -511,  -384,   393,   451,  -732,  -566,  -444,
+    -488,   466,   401,  -381,   503,  -827,  -411,  -409,  -486,  -627,
+     495,   403,   503,   379,   496,  -414,  -460,   471,  -502,  -406,
+    -416,  -420,   909,   379,  -379,   554,  -437,  -418,   394,  -394,
+     453,  -405,   514,  -416,   590,   794,   487,   551,   446,  -410,
+     451,  -740,   665,  -572,  -410,  -405,  -497,  -470,   464,   785,
+     394,   488,  -518,   403,   516,  -389,  -520,  -469,   427,   446,
+    -423,  -769,  -484,   855,   526,  -423,  -461,   716,   369,   390,
+    -538,  -437,  -381,  -619,  -984,  -391,   496,  -388,   650,   378,
+    -542,   782,  -399,   439,   677,   521,   736,  -380,  -435,   494,
+     428,  -382,  -494,   689,   557,   734,   761,  -432,  -446,   528,
+    -492,   382,   372,   527,   582,   789,   526,  -445,   534,   390,
+    -768,   541,  -417,   468,  -607,   467,  -599,   549,   406,   384,
+    -425,  -420,  -538,  -397,   514,  -393,   789,  -449,   500,   406,
+    -582,  -498,   572,  -438,  -492,   528,   613,   371,  -480,  -403,
+    -713,   397,   828,   497,  -378,  -570,   392,   934,  -453,  -533,
+    -574,  -602,   403,  -384,   402,   667,  -742,   577,   448,   534,
+     456,  -426,   529,   388,   393,   565,   665,   579,   550,  -497,
+    -566,  -374,  -390,  -534,  -557,  -486,  -370,   419,  -474,  -559,
+     377,  -371,  -390,   521,  -432,   403,  -383,   535,  -499,   370,
+     432,   415,   545,   373,  -508,   482,  -419,  -378,  -538,  -473,
+    -375,  -386,   692,  -383,  -429,  -479,  -402,   806,   486,  -373,
+     427,  -621,   433,   396,   375,   399,   410,   408,  -869,  -438,
+    -504,  -379,   717,  -380,   734,  -435,  -511,   571,  -469,   375,
+    -497,  -458,  -627,  -386,   629,  -613,  -435,   595,  -553,  -511,
+     391,   409,   566,  -501,  -461,  -488,   424,  -417,   570,   572,
+     414,  -599,  -426,  -506,  -511,   382,   420,  -401,   383,   466,
+     373,   411,  -385,  -670,   596,   434,  -413,  -504,   377,   407,
+     431,  -523,   408,   553,   398,   574,  -457,   556,   499,   534,
+    -431,   386,  -505,   457,   635,  -391,  -515,  -631,  -463,   394,
+     431,   432,   380,  -511,   377,   430,  -499,   425,  -474,  -468,
+     390,   511,   414,   405,   373,   427,  -442,  -599,   387,  -410,
+    -370,   402,   378,  -426,   371,  -372,   392,  -437,  -409,   384,
+    -385,   380,   397,  -407,   369,   388,   388,  -376,  -369,   443,
+     431,   486,   386,   388,   498,   603,   417,   379,   467,   575,
+     572,   707,   861,  -398,   485,   509,   456,   770,   624,   513,
+     435,   536,   500,   542, -6677,  5235, -6957, -5733,  6571, -6348,
+    5706,-10234, -6648,  5365, -8895,  8508, -9822,-12364, -9350, -6399,
+    5839, -7854, -5218,  6400, -5492,-18347, -5124,-18109, -6542,-14964,
+    6638, 16484,-18320,  7651,  6248,-14818, -5221,  8545,  8273,  5934,
+   -5359,  5921,  5688, 11499,  9222,-11268,-27842, -5350, -5289,  8546,
+  -11964,  8833,-14422, 10095, -9698, 11975, 20600,  8277,  6597, -7277,
+    5793,-14930,-17263, -6068,-14382, 11079,  5643,  6872, -7883, -5497,
+   -5160, -9430, 16825, 14867, -6489, -5981,  5523, -8895,  8355, 27983,
+    7340, -9401, -5386,  6570,  8771,-29886,  8099,-16591,-13533,  9708,
+   -5601,  7260, -5517,  5129, -6875, -6541, -9846, 14198, -6263,-15475,
+   11231, -8948, -6734, 13562, 38697,  7496, 14020, 13644, -5449, -5263,
+    6085,-11170,  8946,  7448, -6615, -6429, 12298,-10433, -9368, -5162,
+    5762, -6690,  7481, 10191,-11181, -7856, 18548,-15574,  7398, 10295,
+    6244, -8252, -5191,  6746, -5144, -8276, 11193,-25842,  7210, -9481,
+    5389,  5842, -7771,  9465,-21457, 11168, 14784,  7489,  5630, -6063,
+   -9965,  7647,  6641, 20219,-10430,  6753, -5570, -6025,-11881, 19581,
+   -7963, 18405, 19292,  6790,-11629, -6103, 11587, 15367, 13733, 21381,
+   -5103,-12229, -6949,-16068, 12787,  7413, -8193,-19961, -9424, -5432,
+   -5794, -8864, -7981, -5074, -5615,-23827, -6045, 11787,  8707, 20165,
+    9550,  9462,-12855,-13878,  8339,-18498,  7382,  8250,  8927,  5353,
+    6857,  5722,  7094,  5268,  5401,  8951, 12580, -5810,  6795, -7950,
+    6990, 14448, -5070,-11785,  9505, -9631, -6195,  7106, -8877,  9801,
+    5831, 13838,-13996, -5976,-10028,  5324, -9519,-11360,  5730, -6468,
+   -9787, -5425, -5662,  9918, -7056,-11028, 15819, -6887,  5349, 11011,
+   11171,-21166,-13488,  6729,  5125, 10349, -6629,-13235, 11181, -5266,
+    6008,  5326, -7643, -6533,-11048, -9640,  6449,  6374, -8331,-15641,
+  -10347,  6518,  9645,  6079,-17697,-11602,-15478, 16717,  9328, -6650,
+   13197,-10203,  7468, -6718, 22157,-13477,  8752, -8614,  7990, 12065,
+   22299, 10429,-10221,  5916,  6512,  5900, -8085,  6749, -5663, -6682,
+   12787,-10094,  8111,  5585,-11904,  7632, -7495, -6385, 11527, -6744,
+    8732,  5096,-14091,  6805,  8592, -7922, -5694, -7758,  7928, -6470,
+  -17786,-15793,-18234, -7158,-17805,-20122, -6686, 11065, -6492, -6398,
+   -5360, 16608,-17177,  7917,  9053, 25330,  6280,-10775,-17385,-16639,
+   -6513, 25701,-15959, 24326,  9779,  5123, -7179,  9711, -8515,  8684,
+  -22110,  6466,  5957, 12366,  5179,-14220, 13984, 22742,  6125,-17402,
+   12840, -5893,  7918,-17437,-17737,  9099,-17505,-10996,-13334, 18840,
+   12709, 16295, 16026, 10827, 11843, 13176,  8738, -5943, -8198,-14079,
+   22852,  5600, 12408,-15460, 13324, -6834, -5423, -5660, 11973, -6230,
+    5426,  9014, -8214, -9211,  5616,  6408, -7031,  7721,  8981,  7372,
+  -16528,  7575,  7096, -6928,  8286, 10113, -7494, -6855,-10395, -7099,
+   -7173, -5585, -6998,  7753, -5420,  5586, -7928, -7529,  9410, -5244,
+    7576,-13748,  8823, -5854,  5756, -8964, -6549, -7883,  6419,  8777,
+   -5622,  5348, -6094,  8927,  5916,  5711, 12888, -5966, -8751, -6950,
+  -12339,-15242, -5757,-12797, -5709, -5344,  5303, -6473,  6678,  8298,
+   -9893, -7033,  5077,  6407,  8770,  7915,  7412,  6133,  6280, -5536,
+   -5674,-11758, -8225, -5203,  6962, 11241,  9404, 13576,-11336, -7911,
+   -7819,  6466, -6098,-14216,-14485,  6295,  5380, 12794, 11403, 21032,
+    6946,  7711, 11224, -9479, 12044, -5736, 12419,  5417, -8175, 13537,
+  -12609,-11989,  5474, -6558, -8525, -6646,  5928,  6428,  7794,  5096,
+   -5439, -7565,  5100,  6562, -7105,  5901, 11610, -5783, 11208,  6488,
+    5539,  8642, -9571, -9586,  8901,  8175, -7953,  5268, 10426, 16426,
+   17044, -9918, -7233,  6146,  6407, 15148,-18150, -5203,  5642, 12870,
+   -7074, -7417, -5975, -6860,  6588, -9317, -5955,  8806,  5236,  5716,
+    7090,  5659,-11814,  5855, -6580,  5705, 12003, -9634,  9086,  8400,
+    5613, 10023, -6274,  9406,-13427,  9057, -5175, -6834,  6902,  5122,
+   20602,  5185, -9552,  7131,  8913, -7143,  6437,  5643,-10402,  6274,
+   -6115,-14176,-10652,  6748, 12324,  5832, 10204, -8779, -6563,  6017,
+   -9958,  5776,  5215, -7503, -6342,  7702, 16775,-10445,-16550, -9805,
+   -5144, -6192, -7041,  6915, -7739,  6255,-13225,-11133,  6608, -6245,
+    5080,  6721,  5529,  5350,-11358,  6083, -6313, -6283,  5960, -7767,
+   -5246,  6244,  9094,  5968,  6042, -5696, -7744,  9075, -5319,-12995,
+    5725, -8476, -5109, -5962,  5719,  6024,  9443, -6456,-10364,  9426,
+   -5438, -8507,  5537,  5264, -5828, -6632,  5673,  7459,  5602, -5618,
+   -6529,  5397,  5264,  5939, -5790, 14183,  8209,  6081, -7085, 13474,
+  -19229, -7298, 14049,-10950,  5402, -7885, -5324,  5544, -5341,  6411,
+   -5376, -5432, -8298,  5464,  6523,  6330,  5190,  6236, -6283, -6045,
+    7531,  6537, -5764,  5897,  5398,  5667,  5887, -6947,  6349, -6250,
+    7591, -6903, -6072,  7956, -5361, -6428,  5285, -7463, -5116, -5475,
+   -5333,  6073, -5867, -5109, -5550, -5253, -5118, -6171, -5828,  5107,
+   -8464, -7575,  5357,  5342, 11420, -7848,  8217,  6797, -7002,  7770,
+   -5244,-18213,-12852,  7242, 10689,  9645, -5144,  6279,  5347,-13640,
+  -10508, -6635,  5386,  5820, -8621,  6459, 10070,  6016,-15134, 10249,
+  -17396,  9166, -5510, -7342, 11319,  8784,  9376, -5585, 17397, -8049,
+    7031,  5273, -5246,  8056, -6908, -5811,  5104,  5417, 10066,  7989,
+    5294, -8548,  9741, -5455, -8894, 10342,  5535, 11249,  5136,  5960,
+   -5896,  9702,  6455,-13203, -8936, -5397, -6281, -6506,  6705, -7398,
+   -6677, -7592,  5122, -5702,  7163, -8827,  5229,  7542,  9942, -7340,
+   -5674, -5657, -7948,  6732,-10356,  5147, -5123,  8228, -8803, -5602,
+    5205,  5450,  5858, -8034, -7014, -5599, -8945,  7612, -5974, -5743,
+   -5910,  5854,  6032,  6588, -5769,-13167,  8064, -5338, -6704, -7740,
+   -8760, 14083,-19561,-10851, -6048, 11185,  6877, -6337,  8874, -8164,
+    5527, 15403,  5214, 10575, -6542,-13871, -5227, -8908, -5458, -6824,
+   -5379,  5485, -6149, -5155, 11683,  5399, -5718,  6731,  6517,  6411,
+   -6407,  5762, -7013,  6569,  7047, -5880,  6458,-11365,  9535,  9835,
+    5437, 13431,-10128,  5479,  8633,  7756,-11507,  5938, 12619,-10868,
+    5268, -8409,  8576, 11755, -5572,-13407,  9068, -6620, -8479,  5754,
+    8763, -8338, 16373, -6946,  6109, -6961, -6442, -5973, -5652, -7548,
+   -7394,  6519,  8404, -6181, -5115, -6972, -5115,  5223, -5072,-12161,
+   -5423,  5155, -5545, -5557,  5289, -7660,  6461,  7512, -5170,  6330,
+    6069, -7107, -6192, -6291, -6657,-12912,  7546,  5951,  6619,  7633,
+   -6793,  6730,  5790, -5319,  5334, -5347,  8508, -5089, -5893, -8577,
+   -5354, -8607, -5633, -7447, -5352, -6365,  7076, -6468,  6889, -6234,
+   -9237, -7016,  6037,  8691, -6538,  5243, -9832, -7623,  5435,  6308,
+   -6194,  5548, -5704,-10943, -8189, -5472, -6500, -5862, -7249, -6449,
+   -8318, -5170, -5163, -7673, -5813, -7338,  5833, -5608,  7199, -6138,
+    5319,  5274, -6886, -9384, -9194,  7301, -6010, -7485,  5279, -5857,
+    7323, -5591, -6205,  9404, -5431, -6131, -6736, -8213,  6129, -6095,
+   -7751,  5597,  7704,  7459,  8201,-10062,  7529, -5553, -5457,  7858,
+    6482, -5305,  5755, -5509,  5142,  5365, -5382, -5983, -5392,  5492,
+    6761,  5569,  7439, -7391, -5415,  6928, -5221,  5486, -5244,  6372,
+   -5543,  6115,  6044, -5102, -5398,  6242, -7359,  5270, -5685, -6291,
+    6389, -6134, -5643, -5957, -7350,  6411, -7907,  5399, -6414,  5887,
+   -5104,  5346,  5275, -5432, -5082, -5194, -6403, -5613,  3321, -2355,
+   -4619,  2563,  5227, -3090, -2019,  3320,  2428,  2253, -3579, -3167,
+    4032, -2714, -2972,  3014, -2390,  5848, -2352, -3641,  2502,  3492,
+   -8498,  4566,  2684,  3076,  2670, -9577,  2888, -3057,  2164,  6333,
+    2764,  5000, -4155,  6251, -4850,  1958,  2328, -1975, -4204, -4501,
+    3298, -2458,  7728,  4750, -3948, -8382,  4012, -3594, -2752, -2421,
+   -7368,  4512,  3994, -6373,  2025, -2316, -2211, -3471, -2828,  2566,
+   -2464,  3110,  6120,  3176,  2142, -3349, -2195, -3063, -2802, -7357,
+    9438, -2973, -2649,  2538,  3874,  5720,  3326,  2270,  2222, -4504,
+    2912,  3472,  2106,  2452,  2395,  6738,  4585, -3546, -5462,  3876,
+   -4131, -4002,  1970, -2159,  3604,  3671, -4507,  3539,  6289, -2551,
+   -2511, -3365,  3497, -5221,  2176, -4765, -7738,  1962,  2752, -2436,
+   -2652,  2959, -2483, -3864, -4352, -2487, -5837,  2366,  2112, -2561,
+    2416,  3278,  3780, -2738, -2539,  2053,  2172, -5028,  4051, -2211,
+    2454, -2108,  6598, -4201, -2076, -4094,  2638,  2509, -2302,  2695,
+    2597,  5796, -2164, -2664, -3648, -3377,  5476, -7296,  4955,  4228,
+   -2653, -3334, -6903, -2115, -2059, -3140,  2148, -2606,  2180,  2737,
+   -4527,  7818, -4966,  3700,  4671,  2550,  2539,  5710,  6972, -3943,
+    5144, 11599,  3075, -3141,  2726,  3912, -2735,  7003,  4874,  4956,
+   -8438,  3149,  3723, -3032, -4322, -5465,  3705,  2999, -2384, -4927,
+    4840, -2258,  4840,  7140,  2075,  9405,-10819,  7898,  3932,  2153,
+    2380, -2899, -6208,  6929,  5868, -3903, -7461, -3127, -3248,  2020,
+    4217,  3916, -3584,  5013, -2775, -2716,  2661,  4271,  2107,  3452,
+   -4360, -2313,  2230,  2293, -2719, -3412,  3646,  3571,  5215, -7744,
+   -2776, -4598, -2037,  4227,  3448,  3070, -2510, -3644, -3073, -2495,
+   -2994,  6855,  6388, -1942, -4793,  2243, -4061, -9491, -3041, -7190,
+    2573, -4061,  2611, -2214, -3533,  2177, -3644, -5666,  6501, -3058,
+    4560, -2274, -2812,  2215,  4559,  2996,  4482, -6407,  7461,-10058,
+   -1964,  2296, -5072, -3245, -2450,  6334, -4153, 11325, -8968, -3506,
+    2646,  4160, -3516, -4754, -2279,  5996,  2614,  2686, -2511, -4398,
+    6179,  3553,  6708, -5683, -3424, -2570,  5492,  2490, -3683, -2138,
+   -3659,  2626,  2078, -3213,  2988, -3692,  2161, -4813, -7659, -2638,
+    3965, -3586,  2228,  2311,  4900, -2144, -4544, -2076,  2313,  2370,
+   -2954, -3225,  2298,  2461, -2667, -2178,  2194,  4719,  2497,  2023,
+   -2602,  4014, -4868, -3264, -6272, -3045, -2986, -3813, -3865,  2218,
+    3490, -3213,  4179,  5301, -2227,  3589, -3451,  3885,  3862,  2881,
+   -8614, -4677,  8425, -2842,  2489, -3593, -2123,  2256, -3924,  3176,
+    3438,  2218, -6659, -2228, -6836, -2054, -2016, -2700,  2652, -7706,
+    3330, -4061, -2196, -2657, -3224, -2322,-10235,  3218,  2436,  2452,
+    5933,  5124, -7894, -2637,  3071,  4433,  3988,  3460,  2717,  3582,
+   -3243,  2017, -6602,  3716,  1976,  9716,  7784,  2356, -3784, -2131,
+   -6013, -4126, -5345, -5198, 11038,  9010, -3636, -3136, -2735, -6837,
+    5299, -4015, -8522,  4071, -2165,  6117, -4512, -4878, -4767,  2044,
+   -6154,  4610, -6340, -3896,  2027,  2000,  3661,  4989,  4068,  7137,
+   -2932,  5393,  2341, -2818, -2909,  2042, -4471,  2973, -3019, -2071,
+    2278,  1973, -2818,  1988, -2400, -2192,  2756,  3009,  3362, -2454,
+    2298, -2539, -2999,  3502, -2721, -2864,  3319, -2512,  3403, -1949,
+   -3504, -2595,  2782, -2379, -2815,  2619,  2866, -7085,  2624, -2073,
+    2820,  4699,  3007, -2313, -2433,  2959, -2414,  2433, -3397,  4091,
+    2269,  2273,  3219,  2534, -3383, -3946, -2178, -2537,  2469,  3201,
+   -3347, -2157, -2956,  3301, -2739,  2220, -2983,  2008,  2017,  2501,
+   -2561,  3977, -2467,  4513, -2376, -3144, -4201, -3291, -2374, -2212,
+    2757, -2107,  3014,  2054, -4329, -2671, -2060, -2083, -2277,  2791,
+   -1948,  3851, -2851, -2048,  2175, -2091, -2910,  2998, -2529, -4062,
+   -2751,  2382,  1976,  2998, -2128, -5168, -2545,  2008,  3527, -2262,
+    2329,  3260, -2985,  2849, -2687, -3031,  1950, -2298,  2404, -2231,
+    2289,  1972,  2801,  2093, -2291, -2361, -2411,  2869,  2223, -1974,
+   -2584, -2258,  2139, -3206, -3522,  2129, -2284, -2106, -2417, -2061,
+   -3404,  2571, -2183,  2381,  2541, -2632,  2135,  2002, -3330,  2546,
+   -2094,  4136,  2347,  4826, -1961,  2143, -3797, -2066, -2829, -2787,
+   -2597, -6287, -2754,  2420,  2179,  1995,  2357, -3007,  2392,  3192,
+    2025, -3336,  2132, -2825, -2889,  3435,  3791, -2006,  4626,  3406,
+   -2033, -2453,  2041,  3927, -3767,  3233, -2612, -7534, -4216, -3637,
+   -3368, -5049,  3015, -4188, -2677,  3082, -2405,  3799, -2957,  2219,
+   -2789,  2952,  3640, 10537, -2165, -2513,  2089, -2755,  2364, -7459,
+    2110, -2216,  1969, -1967,  2985, -2341,  3928,  3297, -2493,  4149,
+   -3391, -3935,  3522,  4672, -3858,  5400,  2601, -2712, -2270, -2322,
+    4319, -2266,  2356,  2446,  3042,  4740, -5154,  2123, -3142,  3066,
+   -2780, -4874, -2320,  5160, -3270, -3889, -2046, -4152, -5053, -1954,
+    5119,  3106, -2087, -4100, -3037,  5230,  5829, -4643, -2265,  6327,
+   -6500, -2092,  2151,  2704, -2306,  6175,  2675,  5618,  2855,  2327,
+   -2488,  2409,  1948,  2387, -2097,  3957,  3291, -2198, -4750, -4334,
+    1982, -5563,  7085,  2466,  5407, -2201,  2707,  3949, -9942,  5469,
+    2876, -2526, -2250, -4268,  3751, -4294,  2494,  1973,  3597,  2655,
+    2186, -3089, -2891, -2403,  6709,  3190,  2313,  4280, -2512, -8873,
+   -3839, -2646, -3458, -4397,  5342, -2067, -2920,  6160, -2174,  2878,
+   -3183, -2167,  2553,  3516, -2906,  1973,  4265, -1945,  3385,  3821,
+    2560, -2702,  2074, -2398,  1961, -4106, -2167, -2188,  2018,  4951,
+   -2011,  3547, -1979,  2772, -5204, -2426, -2171,  3404,  2760,  3448,
+    2504, -3291,  2331, -2425,  2052, -3235,  3369, -2221,  2189, -4544,
+    2442, -2803, -1947,  4192,  1981, -2988, -2080,  2227,  2218, -3006,
+    4001,  2353,  6412, -5633, -1949,  2620,  3193,  3774,  2613, -5905,
+   -3537, -3688,  8060, -2392,  3347,  2123,  3951,  2785, -2354, -2733,
+    6496, -4528,  3551,  3279, -2889, -2245, -2975, -3657,  2922, -3107,
+    4290, -2172,  1968, -2012,  2219,  1942,  2116,  3510,  3778,  2379,
+   -2455, -2622, -3213, -2000,  2425,  2588,  2134, -2735,  2457,  2314,
+    2673, -2419,  2978,  3205,  3104, -2635, -2577, -1966,  2169,  2124,
+    2336,  2487,  2655, -2347, -3115,  2463, -3501, -3622, -2314, -2353,
+   -2594, -3787, -2210,  2080, -2129, -1988,  2426,  2476,  2249,  2158,
+   -2807,  2275,  2056, -3560,  1945,  2125,  2527, -2391,  2233,  2008,
+    2066,  3320,  2507,  2547,  2942,  3311,  2905,  2314, -2055,  3076,
+    2531, -2512, -2652,  2235, -2117, -2110,  1949, -2066, -2008, -2195,
+   -2056,  2385,  2556, -2078, -2395,  2622, -2589, -2120,  2740,  2367,
+    1953,  2730, -2940,  2198,  2427,  3884,  3173,  3048, -2818, -2703,
+   -2042,  1991,  3716,  3769,  2120, -2148, -2792,  1948, -2134,  2212,
+   -2438, -2446, -2036, -3453,  2412, -2021, -2592, -2377,  2147,  3014,
+    2798, -2418, -2885, -2154, -2937, -4241, -2254,  2468, -3247, -1991,
+   -2784, -2036, -3526,  2019,  2035,  2263, -3157,  2208, -2182, -2048,
+   -2757, -2242, -2908,  3761,  3514,  2871,  2376,  2070,  2213,  2374,
+   -2088,  2061, -2134,  2086, -2879, -3519, -1966,  2019, -2256, -2162,
+    2287,  2148, -2044, -1975,  2336, -2446, -1944,  2623,  1993, -2382,
+   -3006, -1976,  2005, -2138,  2185, -2289,  3071, -2178, -2680, -2487,
+   -1956,  2419,  1958,  2448, -2179,  1986, -1947, -2055, -2000, -2256,
+    2073, -2239, -1384, -1936, -1967, -1171,  1763, -2501, -1611,   915,
+    1864,  1244,   861,  1412,  1083, -1058, -1919, -1484, -1881,  1023,
+   -1038, -1096,  1381,  1179,  1417, -3898, -2321, -1240, -2276,  1127,
+   -2100,  1593,  2921,   875,   848,  1554,  -867,  1532,  1451,  1811,
+    -951,   898, -1000, -1733,  1523,  1369, -1628, -2822,  1041, -1036,
+    1577,  1502, -2226, -2952, -1579,  1793, -2117,  2085, -1306,  -881,
+    1281, -1209,  1769,  2156,   934,  1579,  2100,  3130,  -951, -3145,
+    1432, -1609, -1927,  1602, -1769,  2026,  -955, -1650,  -854, -1092,
+     872,  3114,  1654, -2689, -1963,  1287,   863,  1640, -1283,  1546,
+    2747,  2112, -1542,  2041,  1519,  -897,  1027, -1567,  1018, -1651,
+     862,  1033, -1531, -1512, -1038,  1396,  1118,  -865,  1088,  3032,
+    1102,  -881, -1591, -2526,  1115, -2206, -1944, -1067,  2015,  1090,
+     978,   986, -1232,  1567, -1272,  -893,   982, -1836,  2031,  -880,
+    -960,   897,  1645, -2717,   895,  3155, -1013, -1004,  1831,   880,
+    1859, -1506,  1292, -2097, -1083, -1288,  1295,  2150,  2665,  1285,
+     913, -1287,  1031,  2726, -2361, -1012, -1528,  -908,  1955,  1357,
+    1300,  -933, -2650, -2305, -1861, -1201, -1202, -1763, -1086,  2614,
+   -1509, -1249,  1267, -2252, -2306,  2008,   877, -1710, -1045,  1092,
+   -1125,   907, -1206,  -940,  1579,  1497, -1072, -1273, -2392, -2109,
+     968,  1988,  1107, -1551, -2383,  -862,   939, -2233,  1451,  1206,
+   -1850,  1039,   902, -2761, -4119, -1714, -1031,  1329,  1359,  1303,
+    1333,  2180,  1233,   923, -1812, -2610, -1750, -2537,  2058,  4395,
+    1207,  1971,  -945, -1485, -1047, -2183,   892,  1210, -1060,  1639,
+   -1886, -1385, -1874,  1059, -1013,  2760, -1334, -1618,  1967, -1304,
+   -1363, -2115, -1133,  1675,  1000,  1009, -2482, -1238, -1079,  2560,
+    2318, -1140,  1591, -1466, -1702,  1477, -3077,  1849,  3907, -5354,
+    5181, -4105,  4227, -3784,  2957, -1491,  1221, -1747,  1725,   998,
+     866,  1552,  1041, -1467,  1491,  1279, -1348,  1249, -1836, -1081,
+    2382, -1853,  2427,  1325,  -941,   860,  1344, -1222,  1664,  1964,
+     927,  -859,   923,   888,  1208,  1993,  1032, -1777,  1506, -1712,
+    1099, -1845, -1334,  2427,  2368, -1243,  1289,   946, -2438, -2467,
+   -1182,  -854,   937,   942, -2193,  1318, -2813,  -991, -1993,  1121,
+     979,  1541,  1348, -1366, -2163, -1400,  3585, -3398, -1400,  1294,
+   -2826,  1458,  -933,   879,   923,  -870,  2139,  3495, -1138, -1737,
+   -1289,   953, -1362,  -902, -1603, -1889, -3434,  1469,  1875, -2741,
+    2084, -2395,  3160,  1375, -1208, -4193, -1192,  2790,   890, -1620,
+    2010,  -947,  -850,  1310,  2625, -1654,  2012,  1204,  3221, -2226,
+    1567, -1153,  3379, -1553, -1786,  3072,  3295,   855,  -997,  1002,
+     898, -1773, -1094,   983,  -888,  1323, -1477, -1892,  -867,  1101,
+    1953, -1395, -2030,   860, -1006,  -871,  -911,  1173,  -895,  1249,
+    -868,  1275, -1121, -1040,  -866,  1211,  1082, -1649,  -939,  -983,
+   -1012,  1588,  1051, -1334,  -917, -1165,   856,  1097,  1066,  -878,
+    -851,  1572, -1296,  1087,  -854, -1147,  -857,  1049,   876,  -886,
+    1021,  1067,  1607,  -907,   865,   986, -1091, -1545,  -944,   985,
+    -975,  1580,  1134, -1520, -1483,  1217,  -980, -1225,  -851, -1204,
+    -847,  -900,  1103, -1537, -1380,   875,  -851,   967, -1208,   907,
+     997,   910, -1283,   896,   932,  -968,  -941,   879,  -867, -1214,
+     896,  -884,  1027,  1208,  1057,  1673,   861,  -916,  -895, -1013,
+   -1131,  1162,  -892,  -895,  1180,   911, -2395,  -876, -1093,  -898,
+   -1435,  1302, -1044, -1185, -1082, -1012, -1601, -1065,  1345, -1257,
+   -1545, -1101,   894, -1384,   994, -2109,  1495,  -958,   872,  1938,
+    1197,   895, -2164,  1064, -2050,   965, -1952,  1473,  1817,  1117,
+   -1138,  1180,  1308,  2518,  1161,  -942,   943,  1336,  1481,  -890,
+   -1057,  2098,  1542, -1038,   968, -1779,  -948,  -920, -2376, -1191,
+     855,  1205, -1189, -1622,  1183, -1270,  -883,  -937,  1244,  1447,
+    1147,  1021, -1543,  1183,   881,   973,  1342, -1283, -1037,  1497,
+   -1452, -1574, -1576,  1707, -2262, -1254,  1334,  1594,  1737,  2832,
+    1409,  2036,  1242,   864,  -920,  1314,  1403, -1778,  1825,   925,
+    1732,  2193, -3222,  -943,  -958,  1444,  2135, -1181,  2205, -1404,
+   -2248,  1443, -1213, -1087,   865,  1036,   849,   966,  1433,  1743,
+     881,   891,  1029, -1131,  1087,  1090, -1153,  1202,   978,  1862,
+    1137, -1454,   862, -1413, -2018, -1270,  -979,  1608, -1562,  1182,
+    1064, -2064,  1199,   884, -1790,  1435,  1846, -1151, -1345, -1081,
+   -1076,  1890,  -876,  1968, -1478,  -864,   951,  -913, -2174, -2019,
+   -1589, -1306,  2836,  1326, -1609,  1256,  1804, -1494,  -985,  3109,
+    1899,  -891,  3323, -3928,  2820, -1895,  1463, -2003,  1981, -1952,
+    1256,  1569, -2341,  1134, -1063,   847,   869, -1584, -1360,  1929,
+   -1626,  1111, -1389,  1028, -1038,  1310, -1873, -1236,  1146, -2089,
+     885, -1546,  1020,   885,  2065, -1563, -1586,  1010, -1569, -1328,
+   -2478,  1668,   878, -1878, -2696, -1224,  2394,  1099,  1751,  1222,
+   -1050,  -932,  1809, -2411,  1145,  1108,  1294, -1573,  2029,  1430,
+     932, -1311,  -986, -1836,  1141, -2147,  2721, -1676,  1769,  1306,
+     968,  -869, -1377, -2695,  3133,  1600,  -931, -1047,  1925,  1115,
+     946,  1612,  1084, -1245,  1003, -1028,  -887,   998, -1021,  -954,
+   -1641,  2153,   876,  1065, -1291,   976,   990,  1038,   898,   863,
+    1168, -1115,  1018,  -852,   912,   859,  1428, -1019,  -930,  -932,
+    -851,   936,  1056,  -960, -1439,  1004,  -861,  1231,  -877, -1260,
+    1414,   912,   883,  -860,  -853,  1079,  1025,  -994, -1129,  2044,
+    1025,   979,   930,  1156,  1266,  1759,   946,  -907, -1182, -1798,
+    1618,  -850,  1200,  1060, -1596,  1289,  1117, -1107,  -849,  1525,
+    1375,   885,  1859, -1832,   982, -1007, -1127,  1421,  1116, -1133,
+     881,  1358, -1170, -1562,  1243, -1040,  1579, -1173,   914,  1249,
+    -971,   887,  1047,  1067, -1141,   933, -1284, -1273,  1448, -1192,
+    -956,  -871,  -937,  -904, -2321,  -903,   848,  1208,  -859,  1257,
+   -1800,  1050, -1377,   890, -1241, -1968,   921,   883, -1758,  1155,
+   -1424, -1185,  1498,  1655, -1080,  2580, -2901,  1904,  -936,   975,
+   -1150,  1130,   945, -1235, -1946, -1109,  1008, -1035,  1080,  -894,
+    -977,  -928,  1123,  1282,  1443, -1023, -1362,  -873,   871,  1293,
+   -1135,  2482, -1649, -1955,   920, -1580, -1759,   907,   911, -1341,
+    1095, -1116, -2862, -1246, -1888, -1255, -1047,  1167,  1125,  -994,
+    -847,   850, -1070,   945,   989,  1031,  -929,  -932,  -926, -1150,
+     863,  1213,   984,  -898, -1002,  -874,  1197, -1255,   883,   849,
+    2130,  -889,   879,   889,  -984, -1215, -1189,  -879, -1388,  -851,
+     954,  1682, -2213,   864,  -982,   861, -1208,  -903,   858,  -922,
+   -1051,  1210, -1485,  1072, -1458,  1002,   857,   905, -1232,  -851,
+    1999, -2204,  1375,  -981,  1037, -2026,  1256,   858,   893,  1311,
+   -1427,   900,   883,  -945,  1115,   876, -1083,  1143,  1014,  1032,
+    1296,   889,   968,  -887, -1034,  -921,  -975,   901,  -869,  -886,
+     860, -1730,  -853,  -883,  1202,  1621, -1081,  1040,   983,  1006,
+     860,  1462, -1756,   852,  1085, -1005,  -864,   900, -1048,   951,
+     910,   985,   877,  -866,   954,   962,  1291, -1208,   856,  -858,
+    -970, -1053, -1203,   880,  1212,  -942, -1208, -1047,  1213,   862,
+    -897, -1048,   947,   878,   979,  1251,  4140,  2663, -2811, -2653,
+    2855, -5851, -2564, -2452, -5929, -4684,  3858,  2945, -7806, -3182,
+   -5421, -2448,  2600, -6125,  2690, -2723, -8153,  8088, -3840,  6226,
+   -4464,  4878, -6879,  5915, -3452,  5824,  3346, -6740,  5968, -5720,
+   -2512, -3565,  3205, -2469, -2841,  2608, -7128,  3258,  2994, -3707,
+    3015,  5646, -3435, -6078,  5051,  5368, -3676, -5643,  5385, -5121,
+   -2784, -3277,  6324, -7508,  2494, -5496,  2947,  5920,  6165, -5067,
+    6529, -7934, -2839,  6632, -5536,  3419,  2867, -4009,  2448, -3280,
+  -12778, -7252, -7558,  4003, -4736, -8187, -4076, -6468, -5338, -3406,
+   -4552, -6867, -6182,  4046,  5102, -5436,  2517, -4423,  3487,  2556,
+    2543, -2880, -4878, -7400, -7503, -5445, -3798, -2559,  3332, -2813,
+    3260,  5421, -3495, -3301,  4900,  5018,  2797, -4819,  4018,  2743,
+   -4407, -3887, -4947, -2481, -4584, -3591, -6726,  6656,  2798, -2476,
+   -4573,  3211,  6835,-15789, -7687, -2612,  4121,  4696, -8957, -3807,
+    4478,  3623,  2630, -5507,  6635, -6815,  2457, -2980, -3662,  2750,
+    2937,  2493,  4091, 11114, -3835, -8490,  3635, -7037, -9695,  2729,
+    3474,  3272,  3343, -2617, 10840, -4636, -6086,  2672, -3932,  2826,
+    2604,  3981, 12153,  5622, -3550,-10092, -9028,  5305,  3777,  4302,
+   -3236,  3473, 12481, -8494, -5251,  8364,  2814,  2792,  5451,  3989,
+   -3316,  4055, -6449, -5980, -8012,  2503, -3758, -3221, -3157, -3050,
+   -2999,  4616, -2839, -3806,  2722, -4869,  5125,  3139, -3682, -2649,
+   -5980,  3294,  4784,  4215, -2748,  3630,  2626, -3798, -2958, -4656,
+   -8712, -2661, -2717,  6862, -2630, -4203, -2704,  2497, -3769,  7435,
+   -5250,  3449,  4529, -3108, -2519, -3384,  2862,  3701,  3048,  6627,
+   -4376,  3674, -3704, -2861,  6821, -4721, -8551, 10742, -3153,  3318,
+    5716, -4096, -6414, -4154,  9476, -5093, -2439, -2998,  3232, -5681,
+    4890, -7753,  2955,  2471, -3021,  5627,  2796, -7443,  2801, -4176,
+    4498, -3516,  2586, -3122,  3235, -4587,  3578, -2829,  3281, -3057,
+    2839, -4257,  2707,  5516, -2756,  5226, -5543, -6260,  4228,  3046,
+   -3441,  3105,  4435, -2711, -2456,  4192,  5443,  4251, -4159, -7125,
+    3023,  2601,  6102, -2513, -3255,  3637, -3513,  4158, -4114,  2894,
+    2881, -3292,  3365, -2711,  3691,  4955, -7393,  5596,  3015,  3498,
+    3180, -6808,  8715,  3185,-10053,  3189,  4650, -4241,  2754, -6568,
+    2822,  7660,  5604, -3581,  3093,  4060,  7896, -2599,  3436,  3333,
+    3217, -5532, -5496,  4018, -3342, -3045, -2601, -4264,  6486, -5359,
+    6111, -3579,  4363,  2475,  2476, -9016, -5459,  2686,  2587, -3706,
+    6726,  4835,  2818, -5736, -4692,  5284, -4583, -2923, -2792,  2875,
+    3324,  2497, -5458,  3160,  2636,  3899,  5084, -3063, -2783, -3944,
+   -3941, -7053,  2902,  3690,  3683,  2964,  2646, -4145, -2985,  3820,
+   -3511,  4824,  3481, -5376, -2717, -3013, -2677,  2547, -4542,  2932,
+   -3411, -2589, -3533,  3980,  3342, -2561, -2951, -3336, -3739, -4860,
+    3108,  3535, -2477, -3887, -4172,  3102, -4999,  5596,  6979,  3175,
+   -6125,  4332,  3314, -2725,  2694,  2862,  3745, -2432, -5429, -3100,
+   -2926,  3910, -2927, -2638, -6036,  3289, -3627, -3382,  4965,  3022,
+   -3421, -3606,  2931, -2692,  2538, -5072, -2541, -5908,  2538,  2652,
+    3114, -2523, -2719,  2693,  2909,  3027, -3057,  2865,  2657, -2779,
+   -3615, -2680,  2571,  3357, -3825,  2741,  4177, -2626,  3010, -2603,
+    2805, -2691,  2438,  2849,  2625,  2706,  2511, -4194,  2609,  3069,
+    2682, -2767,  2840, -3173, -2898, -3170,  2677,  2527, -2587,  2449,
+   -2691, -3419,  2611, -2499, -3424,  2903, -2628, -2737, -3212, -2899,
+    2503,  2737, -3935, -2655,  3097,  3913, -2865,  2532,  2961, -3618,
+   -3266,  3122, -2907, -5167,  2620, -3095,  3596, -3357, -3246, -6406,
+    4198, -6046,  2711,  4466, -2675, -2709, -3782, -3262,  4344,  2707,
+    5388,  3269,  3266, -3754, -6504,  6210,  3233,  4121, -2670, -3846,
+    2443,-10567, -2718, -2677,  2643, -4799,  4755, -2915, -4098,  6898,
+   -3644,  2862,  3516,  5869,  4164,  4595, -3357,  5108,  5135, -4289,
+   -2840,  4867, -2680, -2610,  2784,  3476, -3688,  4578,  5313,  5504,
+    2900,  3940,  3002, -5889,  2740, -3559, -5797, -2842, -3407,  4360,
+   -2911, -5294, -5640,  4275, -4499,  3202,  3043,  4670,  2993, -3302,
+   -3586,  2998,  3888, -2611,  2832, -2598,  4130,  3552,  6121,  3602,
+   -2953,  6376, -3275,  5227, -3434, -2511, -5217, -4978,  3336, -4409,
+    2469, -5315, -3238, -2524,  4600, -2779,  3004,  3440, -3250,  2857,
+    2749,  2482,  2537, -2675, -3566, -3687,  2483,  6016,  2867,  3390,
+    3554,  2798, -3005,  2699,  3141,  2699,  2512, -2962,  4248,  3533,
+   -3499,  3031,  4101, -2815,  2722,  2529, -2457, -3926,  3376, -4653,
+    2913,  2560, -3182,  3810,  2941,  3742,  5150,  4280, -2610, -3805,
+    2507, -3075,  3105, -3937, -2679, -2812, -2963, -4325, -2735, -4801,
+   -5042, -3528,  5057,  3144, -3876, -4382,  3483,  4342,  3560,  2837,
+   -2761,  5782, -2582,  5170, -4386,  8003,  2676, -3556,  3390, -2694,
+    3373, -4070, -2792,  2683, -2496, -4085,  4918, -2540,  2442, -2501,
+   -4487,  3128,  2606, -3542, -2673, -6298,  5520,  2936, -5205, -2522,
+    3373,  2452, -4769,  3866,  3039,  2664, -2454,  4252, -2698,  3581,
+    4445,  2936,  3603,  3766, -3641, -4365, -3776, -2773, -3640, -2630,
+   -2901, -3525, -4869,  2646,  2839, -2874, -2671, -4219, -3163, -3381,
+   -5272, -3007, -2949, -5236,  2908,  3220, -7340,  2897,  3117, -2838,
+   -3287, -2503,  3399, -4391,  3008, -3211,  3286, -3934, -4909, -2575,
+    2430,  3500, -3781, -3048, -2956, -3122, -2593, -4785,  3869, -2786,
+    4813,  2665, -2430, -2736, -3070, -3668,  3176, -2883,  4234,  6523,
+    4924,  2751, -5457, -2463,  2449,  3861, -2461, -4681,  2858,  2461,
+   -3049, -2671, -2789, -5859,  4158,  3311, -3648, -4003, -2667, -2805,
+   -2774,  4451,  2533, -4074, -3709, -3158,  2502,  3495,  3531, -3158,
+   -2880, -3104,  2528, -2702, -2506,  3163,  2671, -2733,  2722,  3209,
+    3585,  2548,  2943, -3868,  3920,  2512,  2687,  2608,  2544, -3189,
+    2447,  3701,  2716, -4102, -5278,  3229, -2590, -2645, -4107,  3204,
+   -4313, -2983,  3902, -2670,  2601,  5991,  3132,  2462, -2867,  3542,
+    4078, -2681,  2883,  3298,  2572,  2976,  2607,  4380,  2727,  3040,
+   -4364, -3255, -2449,  4680, -2592,  2626,  3057, -2720, -3631,  2523,
+    5344,  3589, -2717,  2895,  4038, -2501, -3505,  4067, -2848,  3067,
+   -2846, -3698,  3423,  2613, -2905,  2597,  2756,  2751,  2930, -2933,
+   -3323, -5202,  7473, -2819, -2899,  2788,  4009, -2871, -2573, -2865,
+    2738, -4342, -2750, -3011,  3036,  2765,  2504, -3424, -2859, -2687,
+    2454,  3007,  3755, -3267, -4157, -6008,  2979, -2447, -2505, -2890,
+    3042,  2561,  4577,  3163,  5965, -5175, -2662,  5190, -2796,  3108,
+   -2616,  3294,  2441, -2555, -2890,  3183, -3369,  2989,  3762,  2764,
+    3447, -5377, -4648, -2445,  2723,  2921,  3048, -6710, -2763, -2663,
+   -2586,  3077, -2764, -3107,  4160, -2986, -2662,  2783,  2593,  3206,
+   -3046,  2945,  2439, -3077,  2981, -2485,  3279,  2484, -3614, -2718,
+   -2932, -2996, -2769, -3530, -2455, -3224, -2692, -2511, -3383,  3478,
+   -2903,  2896, -4280,  2615, -2794, -2694, -4148, -3228,  4347,  3437,
+    2944,  2717,  3039,  3274, -2711, -2862, -3222,  3912,  2778,  4248,
+    2707, -3562,  3618,  2677,  3085,  3014, -2568,  2802,  2668,  2787,
+    3231, -2531,  3243, -2473, -2915,  2701,  3058, -2800,  2555, -3152,
+    2910,  3119, -2726, -2520, -2795, -2705, -2490, -2480,  3014,  2744,
+   -3287,  5235,  3744,  4623, -2629,  3802, -5816, -3453,  2809,  4694,
+  -10431, -2917, -3063, -3321,  4587, -8717,  3531,  3817, -4107,  7320,
+   -3842,  9056, -3529,  6487, -2598,  4899,  4964,  2875,  8188,  2906,
+    3972,  4369,  3519, -4387,  3852, -5633, -7252,  3646, -2793, -3432,
+   -5519, -3031,  2840,  2756, -4829, -3295,  2580, -2682, -5985, -4277,
+   -9835,-12896,  5561, -3264, -3410,  5846, -3110, -4446, 10113,-10116,
+    2740, -4744, -7076,  4624,  3014,  4569, -5028, -3235,  3673,  7196,
+    3883, -4289, -4980,  6470,-10500,  3512,  6762,  6909,  8331,  5612,
+   10858,  5393,  6003,  8180,-15408,  7200,  6080, -9123, -3080, -5485,
+    4246, -2991, 11050,  5017,  9229,  3676, -2864,  5059,  3240,  4327,
+    4420,  2906, -2941,  4232,  5141, -8059, -3190, -2633,  3218, -5048,
+    5104,  4448,  3604,  2633,  8053,  2831, -6816, -3011,  3180, -3311,
+   -5926,  5218,  4328,  2800,  2700, 10605,  4768, -8011, -9102,  3010,
+   -3178, -3216,  5250, -4322,  5306, -4626,  4009, -3192,  3247, -5278,
+   -4755,  6446,  7124, -3162,  2781, -3336, -3876,  2779,  5403, -3189,
+   -4490,-10866,  4325,  3220,  2608, -3086, -4291, -6105, -4394,  8765,
+   -2727,  9309, -6829,  2916,  4336,  3080, -9837,  4533,  3197, -3705,
+   -9102, -5861, -2760, -5468,  3174, -4701,  4119,  2991,  7505, -7111,
+   -3101,  3478, -2809,  5920,  7701,  3659, -3066,  3141, 13189, -8488,
+   -6827, 13645,  5947,  5663,  4341, -8748, -5953,  8006,  6275, -6423,
+   -4221,  6367, -3085, -3736,  3701,  4324,  3761, -2818, -3981, -4626,
+    2910, -5506,  4839, -3628,  3516,  2828, -8344,  2592, -2892, -4573,
+    4760,  3350, -4615, -2904, -6647,  4582, -4257, -5647, -6160,  2685,
+    2790,  6294,  2862,  6698, -3631,  3398,  3600, -4840,  5905,-10582,
+   -4617,  4368,  3629,  3264,  3001,  7572, -3302,  3341, -3177, -2755,
+    4104, -5332,  4746, -3035,  3295, -4408, -4627,  2913,  7407,  7450,
+    4021, -5182,  6338,  4065,  5398, -3742,  6316, -3772, -7144, -8631,
+   -3554, -3804,  4053, -4403, -2777,  3766,  8220,  3550, -3324, 10405,
+  -12473, -3143, -7508, -3682, -5173, -3812,  8136,  3688, -8258,  2982,
+   -3026, -6096,  6591,  4768,  6002,  7587,  5425,  7836,  4605, -2875,
+   -2683,  3087,  2780,  4116, -3198, -7956, -7790,  3387, -4702, -2640,
+   -4832,  6304, -6592,  2733,  7583,  4544,  5190,  3151,  5984, -6365,
+   -3950,  6089,  4922,  4828, -6247,  4359, -6946, -5724, -6535,  3475,
+   -2702,  2579,  4262, -4879, -4812,  3315,  7628,  4531,  3228,  3473,
+    3424, -4069,-10984, -7954,  3809, -3226,  4177, -7247,  8679,  4090,
+   -3178, -4228, -2999, -6618,  7750, -4400,  2719,  2768, -8028, -5692,
+   -6503, -3116, -2737, -3894, -2965, -2881, -3590, -5188, -9485,  2899,
+    2562,  3286,  3327, -7335,  3422,  4840, -5943,  6014,  6413, -6178,
+   -5529, -4142, -3192, -7051, -3771, -2699,  3097,  4183, -9472,  4138,
+   -8316, -8727, 13396,  4385, -5532,  3802,  4245,  2917,  5729,  3747,
+   -9068, -4842,  2993,  4745, -2763,  3061, -2801, -4004, -3808,  2592,
+    2940, -2738,  2775, -3609, -2722,  2608,  3470, -5400, -5888,  3254,
+   -2854, -3311, -2950,  4938, -2908, -4022,  3016,  4560,  4671, -3077,
+    4390,  3346, -3354,  4035,  2839,  3034, -2747, -2718, -2661, -4403,
+   -2910, -2822,  3174,  2605, -4617,  2725,  3144, -3841, -3182, -3230,
+   -3129,  4135, -2643, -2829, -3820, -3378, -3820,  4735, -6103, -3564,
+   -2659, -3932, -6237, -3202, -3941,  3272,  5326,  2666,  3636,  2685,
+    2840, -2845, -3160,  2829, -4926, -2862,  3147,  3367, -5451, -2971,
+   -4658,  2856,  2640, -2916, -2837,  3806,  3674, -3755, -6271,  2789,
+   -3493, -2904,  7116,  4094, -2590,  2977,  3060,  2853, -3968, -2947,
+    4130,  3689, -3714, -2632,  3452, -3077, -3105,  4950, -5326,  4343,
+    3149, -3957, -4824,  3050, -2756, -4032,  3280, -2876,  3976, -3369,
+    4026, -3983,  4618,  3161, -3259, -5329,  3909, -6373, -4631,  2577,
+   -3399, -3029,  2932, -2739, -4456, -2840, -2940,  2686,  3960,  5853,
+   -2919,  3277, -4657, -2567, -2696, -3620, -4681, -3221,  4936,  2798,
+    2839, -2923,  2792, -3848,  2760, -3345, -2608,  2763, -4744, -3553,
+   -3504, -3116, -4487, -4203,  3576, -3801,  2861, -2885,  2950,  2720,
+    3051,  4631, -3771, -2614,  3661,  3258,  2813, -3525,  4993, -3118,
+    2959, -3029, -3003, -3189,  3622, -3087, -2948,  2939,  2733,  3137,
+   -2567,  2630, -3617, -3084,  3115,  3805, -4503,  4662, -4079,  2642,
+   -2894, -3269,  5373, -2711,  2634, -2765, -3332, -2664, -3309,  2927,
+   -2788, -2997,  3432,  2801,  2580,  4733, -2664, -3816,  5754, -4191,
+   -4287,  3464, -3138,  6216,  3144,  5776,  3529,  6447, -4113, -5267,
+   -4644, -3397, -2780, -2570, -3536, -5298,  2722, -3542, -2886, -5463,
+   -2834,  2803,  3996,  5232, -3046,  4972, -3102, -2593, -2803,  2794,
+    5563, -3413,  4276, -3111,  4742, -2647,  2801, -4719,  3735,  3104,
+   -3428, -4468, -2869, -3085,  4704,  3074,  3050,  2696, -2757, -3129,
+    2932, -2751, -3678, -4405, -2793,  4070, -5137,  3011,  3107, -4980,
+   -6098,  2669, -2601, -2781, -2628, -2860, -2753,  4886,  4139, -4023,
+   -5150, -2769, -4057,  4264, -4758, -2817,  5377,  3724,  3164, -3898,
+   -3234, -3628, -2793, -3184,  4315, -2608, -3220,  4345, -2659, -6772,
+   -3252, -3623, -4072, -6605, -2884,  3027,  3042, -3009,  2784, -4499,
+   -4607,  6128, -3416, -3891,  3566, -4831, -3676,  3274,  3824, -6525,
+    3989, -7260,  3157,  3754,  4507,  2846,  3809, -3862, -3679, -3732,
+   -3898, -3216, -3677,  3179,  3221, -3253,  3170,  3008, -3024,  3164,
+    2818,  3070, -2953, -3063,  2833, -2997, -3777,  3617, -4477, -4123,
+    2617,  7430,  2924,  3997, -2629, -2718,  4617, -3268, -4302, -3440,
+   -3522,  3983, -4206,  5119, -4706,  3521,  3449,  3128,  3817,  3324,
+   -2594,  3632,  2729, -3998,  3588,  2736, -3977, -3351, -4191, -2686,
+   -2939, -2637, -3175, -3125,  4186,  3353,  3318, -3399, -3665,  4428,
+    4419,  3031, -3102, -2835, -2569, -2963,  2746, -4653, -3129,  3801,
+    2605,  3328,  2591,  2656,  3953, -2808,  2619, -2858, -2578, -2724,
+   -2631, -4345, -2658,  3375,  5819, -2591,  3278,  3788, -5036,  2927,
+    3903, -2635, -4587, -3134, -3247,  3430,  3285,  3784, -4437, -4404,
+   -2799, -2800, -3508,  3021,  2728,  4483,  4079,  3272,  2878,  2796,
+   -4168, -2570,  5346,  2737, -5531,  4065, -3904,  2599, -5113, -4859,
+    3485,  2835,  5685, -3240,  7607, -3709, -2869,  2820,  5207,  3521,
+    3628,  2879,  2890, -2659,  4308, -2659, -3494, -2680,  2576,  3692,
+    3934,  2623, -2611, -3814,  4046, -2903, -3663, -4367,  3036, -3603,
+   -3348,  3321, -4886,  5330,  4093,  3640,  3425,  2692, -2952, -3146,
+    2631, -3188, -2764,  3473, -2571,  2887,  2720,  3034,  3852,  4496,
+    2713,  3284, -3026, -2840, -4014,  3138,  2773, -3025,  3455, -3276,
+    2664,  2768,  4222,  2816,  2576, -2821, -3022, -3386,  2953, -3141,
+   -2704,  2892, -2922,  3013,  2807, -2801, -2963,  2707,  2754, -2626,
+    2604,  2732, -2753,  3050,  3061, -3011, -2712,  2693,  2817, -2940,
+   -2821,  2950,  2927,  3542,  3874,  2936,  2937,  2811,  3257,  2658,
+   -3333, -2662,  4489, -2659,  3152,  4150, -2676,  2960, -2806,  3211,
+    2650,  3314,  2839, -2831,  3175,  2847, -2959, -2805, -2850,  2682,
+    2735,  3969, -3243, -2880, -3299, -2924,  4504, -2571, -2790, -2817,
+   -2900, -4129,  3106, -3184, -3318, -3869, -2590, -4499,  3129, -2697,
+   -2836,  2765,  4004,  2875,  3109, -2563, -2569, -2561, -3180,  3141,
+    3183,  2831,  2607, -2693,  2625,  2682,  2593, -3100, -2900, -2980,
+   -2766,  2752, -2714, -2792,  5656,  3651,  3180,  8654, -4911,  6955,
+    4866,  5545, -4449, -3411, -4863, 11445,  3466,  7716, -3735, -6895,
+   -3601, -3524, -7398, -3180, -6093, -4353, -6096,  4250,  9203, -4217,
+    3293,  3198,  6314, -8391,  6535, -7831,  3486, -7563, -8811,-14583,
+   -3074,  6369,  4416, 11853,  4130,  3349, -5171,  3600, -8574,  5192,
+    3427, 10426,  8506, -3135,  3825, -7090,  4431, -3125,  9792,  3347,
+    6888,  9620,  6121,-11343,  6492, -5741,-11506, -5972,  4969, -3556,
+    6077, -5243, -3848, -4346, -8217, -4881,  5688,  8313,-11426, -6050,
+   -6948, -3672, -3198,  3583,  3166,  3932, -4624, -3907, -4230, -5037,
+    7289,  3646, -3994,  4977, -3970, -4259, -7881, -6589, -4474,  5126,
+    3183, -3332,  4237, -3721,  7266, -4205, -3906, -6950,  6032,  3672,
+   -4648, -6239,  4488,  4754,  3227,  3597, -3162, 11294, 13667,  3089,
+  -12533, -8437, -3689, -5448,  6747,  3686,  4937,  5632,  8141,  7760,
+    7272,  5418,-10611, -7333,  6659,  3384, -4830,  5449,  8597,  5147,
+    3316, -6491, -7819,  8564,  6709,  5782, -8753,  7219,  9990, -7204,
+   -4665,  9409, -6993,  7449, -3138, -5122, -4770,  5043, -4784,  7123,
+   -4243, -3782,  3395, -6714, -4573,  6082, -3246,  3607, -4097, -8527,
+  -14212,  8106, -6714,  3417, -5280, -5241, -8194,  4585,  5831, -7629,
+    3414, -4684, -6041, -5036, -4217, -3824,  9379, -6040, -5502, -4446,
+   -3790, -3186,  3414,  4544,  3702, -3136, -5022,  7710, -3478, -5498,
+   -3210, -3398,  3157, -4177, -5743, -5812,  3471,  3412,  5353, -6007,
+    8384,  4326, -3747,-15240, -7946, -4370,  6258,  5369, -5313,-12619,
+    7100, -7758, -5235, -4082, -5624,  3775, -3504,  3423,-10966, -5755,
+    7401, -5614, -3203, -5368,  7629, -5081,  5136,  5365,-10954, -8150,
+   -6183, -7311, -4370, -6945, -9968,  3706,  9528,  4867,  6089,  5598,
+   -3160,  3537,  4642,  6183, -3379,-14006, -8333,-15038, -6389,  4929,
+   -6108, -5168, 24122,  3665, 14522,  5701, -7868,  5806,  3183, 14945,
+    5690, -3403,  4468, -7611, 10191,  9281, -8876, -9795, 14117,  8585,
+   -4025,  8822, -3582, -5870,  3812, -3078, -3797, -7026, -3905,  5730,
+    3410, -4268,  8675,  3087, -3789, -5258,  4308,  3553,  6201,  3188,
+    7403, -5140, -9541, 19047,  3588,  4081,  5090,  7274, -8139,  3440,
+   -5050, -5010, -3578,  4594,  4317,  5466, -6723, -4845, -5144, -3397,
+   -8742,  4203,  5310,  4320,  8872, -4470,  9758,  7586, -3419,  3177,
+    7567,  4415,  4704,  4257, -5150, -4570,  3185, -4169, -4174,  4807,
+   -3447,  7302,  5801,  3793, -8604, -4909,  5663, -3274, -5400,  4999,
+  -10159, -5437,  4073, -6369,  6519,  6029, -5390,  5038,-12283,  7506,
+  -10416, -7415,  3799, -3480, -5438,  4637, -5699,-11112, -3202, -5443,
+   -6399,  7943,  4939,  8674, -9736,-12139,  6347,  6557,  4433,  4407,
+   -5626, -3471,  5947, -3358,  3740,  3418,  5245, -6741,  5147, -3912,
+   -3787,  3775,  4729,  4631, -3382,  4606, -3139, -4296,  7019,  4137,
+    4118, -3749,  4211,  3476, -3071,  3930, -4475,  4727,  7380,  3615,
+    3995, -4894,  7401,  4616, -6576, -5144,  5761,  5524, -3754, -6896,
+   -8082, -5472, -4515, -4107, -3452,  4710,  7352,  6663,  6161,  3480,
+    3880, -7022, -7155, -5273, -4357, -3096,  3861, -3314,  3108,  3725,
+    3986, -4193,  3680, -5179, -4644, -4533,  5085, -3874, -3168, -4221,
+    3227,  4700, -3281, -5260, -3731,  5939,  5079, -3972, -4200, -4891,
+    6670, -6276, -3363,  9193,  5746, -4510,  3990,  4681,  3881, -6026,
+   -3861,  4833, -6544,  8329,  3235,  6814,  6353, -3466, -5532,  3832,
+    3181,  3341,  5397,  4132, -5440, -4383,  7204, -9838, -4827,  5368,
+    4067,  5198,  3452, -3198,  5753, -5636, -4138, -4469, -5381,  4404,
+    3874,  3613, -3188,  3738,  3796, -3160,  3082, -5432, -7217, -7482,
+    3186, -3830, -3548,  7392,  3243, -3554,  4184,  7446,  5230, -5839,
+   -4719, -5201, -4390,  9695, -3546,  5331,  8657,  6068,  5765,  8569,
+   -5731, -3795,  3642, -4491, -6663, -4337, -7634,  4719,  6540, -6816,
+    3944,  3861, -3534,  3375,  3314,  4569, -4632,  4955, -3357, -3534,
+   -3460,  3295, -6878, -3073,  5241, -3829, -7137,  3165,  4256, -3295,
+    4096, -3720, -3109, -4003,  3676,  4100, -7268, -8258, -3673,  3107,
+    4919, -5173, -7787, -9158,  5971, -4330,  3649, -4134, -6716,  4810,
+   -7736, -5345, -5185, -4823,  3097,  4274, -6636, -5253,  4234,  5475,
+    3233,-10734,-10795,  6915, -5867, -4394, -4718, -3945, -3085, -3793,
+   -3587,  4036, -3174, -3371, -5120, -3760, -4058,  3726,  4551, 10412,
+   -4209,  3401, -4110, -3419, -3195, -7001, -3128, -4461,  3280, -4080,
+   -4456,  5415,  4480,  4708, -4106, -3411, -4428,  3962,  3125,  4574,
+    6206, -3095, -6943, -3409,  5573, -3457, -5681, -5472, -7974, -5496,
+   -5972,  3953,  3239, -3314, -3699,  3770, -3069, -3074, -3134, -3189,
+    3128,  5567,  5002, -3395,  4297, -3379,  3357,  3286,  4331, -3764,
+   -3526, -3691, -4434, -4270,  4142, -3531, -3152,  4373,  4311,  3573,
+    3621,  4346, -3214, -3315, -3933,  3156, -3347, -3221,  3177,  3364,
+   -3938, -4449,  3240, -3232,  5644, -3321, -4359,  3931,  3176,  3130,
+    3148, -3424, -7825,  3854,  3414,  3199, -3187, -4775, -6394,  3171,
+    3656,  3728, -3527, -4172, -3699,  3072,  4762, -4204,  4604,  3182,
+    4092, -3292,  3075,  4258, -5442,  3577, -4754,  3366, -5398,  4692,
+   -3811, -5371, -3414, -3968,  5214,  3749, -5727,  6471,  3633, -3716,
+   -5982, -3993,  5208,  5031, -4344, -4457, -3465, -3359,  3410,  3577,
+   -3755,  3556,  5755, -6240,  5618,  5247, -4078,  3732, -3156,  3226,
+   -4328, -3181,  3172, -4761, -6261,  3133, -5656,  8198,  4118,  8557,
+    3073,  3566, -3330, -3313, -3123,  5169, -3145,  3367,  4192,  3634,
+    3789, -6519,  3208, -4322,  3379,  3471, -4334,-10658,  7823,  3140,
+    4252,  4161,  4755, -7208,  4239, -4866, -7298,  5762, -3425,  6871,
+    4241,  4519, -4327,  3944,  5459,  3956,  3608,  3102,-12146, -4814,
+    3219, -5884,  3913, -5755,  3858,  4292,  3280, -3522,  4759,  3684,
+    3073,  3584,  4960, -3433,  3143,  4679, -4146,  4586, -3473, -4432,
+   -3693,  3974,  3555, -4174, -3804,  3462,  4341,  5605,  5048, -3818,
+    3100, -6838, -3526, -8417,  5639,  3481,  3794, -3616,  3267, -4668,
+   -3294, -8185,  4536,  4935,  3765, -3168,  5229, 11120, -3169,  3324,
+   -3310,  5836,  4063,  3099,  3827,  3463, -4983, -3547,  5330, -5087,
+    5296,  4397,  3178,  4804, -3075,  3927,  3284,  4205,  4320,  9950,
+    3686,  4654, -3584, -3750,  3363, -3112, -3941,  3321,  3628,  3091,
+   -4647,  8531, -3098, -4091,  4704, -3144, -3242, -4438,  5196,  4539,
+   -3936,  4197, -3566,  3315,  3299,  4326, -3190, -3698, -6442,  3251,
+    5988, -4804,  4076, -3255,  3779,  4442,  4707,  3568, -4069, -4572,
+   -5066,  4899, -3835, 12280,  3117,  4420,  3085, -3363,  3496,  4164,
+    3455,  4460,  4096,  3269, -5085,  4368,  3577, -3831, -5056,  3484,
+   -3467,  3672, -5248, -3917, -3981, -4076,  3500,  4389, -3867,  3464,
+    4200,  3233, -3198,  3154,  3420, -4354,  3879, -5727, -4119,  4748,
+    3418, -3466,  7500, -4464, -3552, -3749, -4893,  3577, -3093, -4981,
+    3629,  4463,  3872, -3976, -5242,  3391, -4402, -5241, -3426, -4072,
+   -3845, -3144, -3452,  3845, -3846, -3224,  3845,  3561,  4857,  3374,
+   -3397, -3764, -3077, -4029, -3525, -4046, -3112, -3563,  3394,  4174,
+   -3203, -4250,  4068, -3527, -3130, -4136, -3422,  3535, -3330, -3563,
+    3383,  5046, -6104, -4579, -3745, -3240,  3989,  4549,  4236,  3723,
+    3935,  4026, -4176,  3330,  3169, -3230,  3636, -3891, -3334,  3468,
+   -3648,  4290,  3982, -3213, -3344,  3379, -3502, -3123,  1152,  1076,
+    1666, -1422, -2039,  1592, -1374,  1130,  2909,  2024,  2716, -1161,
+    2271, -2684, -1175, -1276,  1559, -1259, -2123,  1839, -1320, -1833,
+    1256,  1184, -1253, -1185,  1148, -2582,  2901,  1223,  2853,  2147,
+   -2388,  1906, -2159,  1918,  1770, -1184,  2113, -1094, -3526,  1263,
+   -2116,  2470, -2587, -1672,  1757,  1648,  1290, -2269, -1864, -1813,
+    3399,  1361,  3673, -1178, -1842, -1270, -1997, -2841,  1770,  1841,
+    1346, -2279,  1647,  1551,  1783, -1630, -2007,  1654,  1199,  1140,
+   -2060, -2552,  4865, -1698,  1329, -2393, -1701,  1385, -1158, -1498,
+    1912, -2976, -3893, -4368, -1981,  2612,  2782,  3067,  3774, -5206,
+    4492, -1785, -4058, -1065,  1108,  1480,  1138,  3943, -1077,  1116,
+   -1474, -1926,  1405, -1325, -3448,  2081,  1506, -1407,  2779,  3452,
+   -1760,  2278, -2002, -1390, -4416, -1358,  2424, -2398, -1863, -1381,
+   -1281,  1506, -2065, -2713, -2774,  3080, -2061, -3551, -2471,  1466,
+   -2319,  2690, -3549,  1981, -2075,  2010, -2655, -1744, -2727,  2412,
+   -1360, -1299,  2007,  2572,  2439, -1248, -2375, -2829, -3562,  2161,
+    1169, -1064, -2788, -1283,  2117, -3529,  1230, -1626,  1936, -1878,
+   -1253,  4267, -6016, -1315,  4710,  1067, -1831,  1329,  2427, -1566,
+   -2512,  1455,  1294, -4202,  3954,  2700,  1141,  4285, -4561, -2377,
+    2899, -1192, -2897,  3293,  1146, -1289,  1199,  1256, -3022, -1123,
+   -3548, -1372, -1198,  1693,  1278, -1133, -1241, -1104,  1224, -1274,
+   -1189, -1183,  1751, -1184,  1295,  1575,  1082, -2252, -1100, -1091,
+    1108, -1753, -1165, -1332, -1253,  1650, -1631, -2553, -1897, -2097,
+   -2159, -2821,  1105,  2055, -2575, -1748,  1911, -4153,  1241,  2246,
+   -2487, -1279,  2027,  2891,  1799, -3561,  1227, -2486, -1103,  2637,
+   -1165,  1105,  1727,  4275, -3285, -2018, -2052,  2255, -2052, -1982,
+    1323,  3882, -2649, -2727, -3041,  1120,  2358, -2045,  2947, -2007,
+    1248,  1189, -2487, -1599,  1112, -1457, -2523, -4134, -3090,  1420,
+   -1244,  2856, -1781,  1437,  1914, -3357, -4358,  1486, -1128,  1826,
+   -1163,  1737, -1461,  1666, -2126,  1143,  1971, -1234,  2711,  1782,
+    1490, -1459,  1460,  1144, -1719, -1445,  3196,  2756,  2397, -2851,
+   -1625, -1147,  1181,  2636, -2659,  2659,  2375,  1422, -1114,  2646,
+   -2099,  1818, -1646,  2047, -1153,  1376, -3410, -4118,  1743, -1450,
+   -2306, -1889, -2264, -2924,  1225, -3783,  1967,  1065, -2571, -2101,
+    2361,  1551,  3318,  2627,  1239,  1581,  3202,  1731,  1461,  1635,
+    1397, -2267, -3169, -1535,  2278, -1338,  3027,  1201,  2142, -3868,
+    3975, -2869,  5737,  5391, -1654, -1417,  1688,  1147,  1417, -1303,
+   -1339, -1172,  1143,  1182, -1182,  1164, -2576, -3477, -1456,  2147,
+   -1723,  1574,  1279,  2242, -1444, -1097,  1455,  2214,  2710,  1528,
+    1229, -1230, -3650,  2892, -1852, -1129,  2905,  1827,  1839, -1549,
+    1202,  1564, -1324, -1089,  1068,  1352,  2326, -1104, -1690,  1453,
+    2533, -2189,  1190,  1258, -1558,  1110, -2536,  1734,  4214, -3944,
+   -1128,  3309, -3787,  2661, -2010,  1217, -1570, -1128,  2157, -1120,
+   -1390, -2343, -1624, -1623, -2518, -1275, -1321, -1411,  1782,  2333,
+    1183,  1548, -1162,  1405, -1184, -1241, -1552,  1216,  1918,  1668,
+   -1762, -1424,  1361, -2253, -1617, -2536, -2767,  1290,  1802,  1071,
+   -1772, -1267,  1253, -1693, -1343, -1829, -1844, -1309, -2078,  1998,
+    1366, -2001,  1189,  1636, -2113,  1181,  2120, -3139, -2135, -1327,
+    2535,  1602,  3383,  1122, -1556,  1798, -1589, -4378, -1386, -1078,
+    1716, -2488,  2219,  4389, -1709,  1064, -1216,  1274, -1321, -1434,
+   -1175, -1157, -1304, -2312, -1661, -1106,  1433,  2643,  3649,  1304,
+    1714,  1313, -1555, -2244, -2164, -1218, -2801,  1690,  4057,  1499,
+   -1687,  1784, -1886, -1697, -1582, -1065, -1197, -1498, -1097,  1694,
+    1150,  1479,  1401, -1256, -1328,  2681,  1403,  1567,  1085, -1979,
+   -2369,  2191, -1273,  2071, -4383, -2382,  1369,  1467,  1645,  1189,
+   -1361, -1116, -1063, -1798,  1283,  1173, -1961,  1134,  1959,  2366,
+   -1850,  1100, -1539,  1523, -1510,  1248, -1173,  2297,  1099,  2044,
+   -1799, -1542, -1765,  1905, -1291,  1247,  2183,  1452,  1283,  1619,
+   -1535, -2471, -1504,  1551,  1893, -2947, -3060, -1463, -2239, -1597,
+   -2579,  1539, -1312,  1828, -1239,  2394, -1434, -1147,  1074, -1760,
+   -1446, -1893,  2258, -1500, -1936,  1716, -2289,  1091, -2637, -2023,
+   -1821,  1315, -1186, -1104,  2001,  1773, -1300, -1138, -1312, -1106,
+   -1916, -1207, -2024, -1521, -1108,  1700,  1541, -1452,  1084,  1452,
+    2531, -1471, -1216, -1257, -1980,  1635,  1227,  1568,  3087, -2544,
+    1639, -1091, -1518,  1826,  1178,  1367,  1933,  1928, -1512,  1065,
+    1885, -1529,  1116, -1446,  1465,  1533, -1807, -1168, -1401, -1863,
+   -1803,  2009, -1258,  1120,  1322,  1408,  2396, -1626,  1587, -2658,
+    2294,  1719,  1174, -1417,  1282, -1788, -1195, -1671,  1386,  1233,
+    1380, -1436, -1711,  1749,  1820,  1209, -1357, -1962,  1302, -1205,
+    1673,  1713,  1666, -1202, -1109,  1610, -2129, -1573, -1190, -1178,
+   -2340, -1446, -2389, -1830, -1327, -1444, -1959,  1162, -1284, -2243,
+   -2114, -1232,  3288,  1083,  2788,  1083,  1126,  1223, -1173, -1086,
+    1322, -1531,  1722,  1324,  1479, -1414,  1215, -1307, -1456,  1793,
+   -1386,  1175, -2198, -1065,  1415,  1300,  1373,  1470,  2028, -1369,
+    3083,  1429,  1687, -1647, -1697, -1484, -1723, -1098, -1367,  1647,
+   -1170, -1105, -1119, -1294,  1402,  1106, -1113,  2312, -1570,  1227,
+   -1181,  1161, -1108, -1277, -1072,  1170, -1067, -1811, -1085, -2065,
+    1723, -1217,  1593,  1128,  1275, -1077,  1750,  1347, -1792,  1583,
+   -1743, -1466,  1374,  1995, -1556,  1421, -1219,  1108, -1071,  1331,
+    1086, -1289, -1397,  1368, -1331, -1258, -1683, -1386, -1438, -1405,
+   -1626, -1361,  1235, -1110,  2287, -1411, -1325, -1802,  1302, -1297,
+    1191, -1368, -1265,  1158, -1104,  1113, -1219,  2135, -1167, -1158,
+   -1418,  1133, -1082, -1187,  1218,  1817,  1106, -1130,  1663,  1570,
+    1574,  1559,  1742,  1541,  1099,  1122,  1236, -1156,  1333,  1354,
+    1115,  1800,  1500,  1204,  2657,  1498,  1104,  1538, -1531, -1201,
+    1090, -1517, -1092,  1308,  1295,  1309, -1572,  2042, -1185,  1897,
+   -1651, -1324,  1931, -1220,  1074,  2058, -1527,  1271,  1554,  1065,
+    1400, -1088, -1285,  1767,  1416, -1089, -1095,  1248,  1122, -1317,
+    1263, -1497, -2836,  1718,  1146, -1709,  1633, -1395, -1214,  1729,
+    1622,  1207,  1199,  1371,  1524,  1227,  1370, -1138, -1473,  1085,
+    1236,  1262, -1131, -1858,  1092, -1249, -1170,  1261, -1542,  1650,
+    1270,  1127, -1341, -1132,  1141, -1282, -1362,  2179,  2556,  1658,
+    1576, -1269, -1851,  1921, -2203, -2792, -1247,  1092,  1216,  1211,
+    2269,  1575,  1507, -1650,  1318,  1488, -1452,  1195, -1127, -1693,
+    2664,  2040, -1626,  1453,  1248, -1323,  1854,  1191,  1678,  1267,
+    1246,  1919,  1622, -1490,  1095,  1212, -1267, -1558,  1152,  1462,
+   -1214, -1069,  1408, -2489,  1155,  1529,  1497,  1640, -1092, -2262,
+   -1092, -1482,  1343, -2032,  1384,  2805,  1255,  1150, -1753, -1101,
+   -1098, -1317,  1225, -1826,  1094, -1588, -1318, -1124, -1265, -1242,
+   -1101,  1068, -1068,  1707, -1174, -1124, -1127,  1307,  1157,  1064,
+   -1109, -1571,  1178, -1552,  1189, -1775, -1083,  1130,  1100,  1121,
+   -1382, -1657, -1456,  1278,  1374,  1068,  1131,  1163,  1149,  1416,
+   -1171,  1224, -1699,  1544, -1120,  1148, -1144,  1266,  1185,  1118,
+    1196,  1102, -3261, -2165,  2393, -2499, -2134, -2648, -4513,  4938,
+    2676,  4840,  4439, -2170, -2136,  2306,  2731, -2670,  3876, -2013,
+   -3538, -3733, -2923, -2287, -2091,  2772, -2014, -3099, -2809,  2348,
+   -3705, -2305, -2255,  4505, -2389, -2861, -3689,  3122,  4339,  5865,
+   -2149, -5905, -3660,  3798, -5454, -3493,  3793, -8291, -5844, -7027,
+    2093,  2352, -5387, -3562,  6128, -5655,  3419,  2288, -5853, -2397,
+   -4917,  5904,  4903,  5381,  8079, -9237,  8479, -3922, 10299, -2232,
+   -5106, -4591,  6843,  7664,  3161,  2728, -4307,  2032, -2949,  2037,
+    7668,  2841,  5906, -3879,  6776, -3494,  2515, -2061,  2428,  2778,
+    3338, -3021,  2546,  2073,  3791, -2159,  2621, -2114,  2574, -2110,
+    3416,  2246, -2876,  2077, -2091,  2626,  3347,  2349, -3574,  2373,
+   -5060, -3464, -3084,  2487,  2422, -2851, -2351,  3844,  3396, -2627,
+   -3959,  3522,  2477,  4762,  2905, -2273, -2294, -6156,  5405,  3055,
+    4121,  3335,  5512, -4524, -1999, -3637, -2089,  2179,  2417, -2728,
+   -4857, -2100, -3602,  7269,  2303, -2703, -3537, -3764, -9675,  4430,
+   -4450, -2263, -4059, -3038,  4787,  5944,-11193,  4925, -3523, -2068,
+    3276, -2066,  3992, -2070, -4352,  2846,  4428, -4547,  3389,  3952,
+    6154,  4192,  5074,  3177, -2409, -3234, -4051,  4387,  3851,  5697,
+   -9199, -2390, -4423,  5261,  6614,  2014, -2421, -2240, -2045,  2662,
+   -2443, -2746, -1987, -2890,  2266, -7682, -3053,  2426,  2789,  2354,
+    2769,  5843, -2860,  2182, -1991,  1981,  2257,  2292, -2842,  2816,
+   -3044,  2237,  2494,  2159, -2872, -2837, -2083, -2708,  2823,  1992,
+    2960, -4210, -3506, -6374,  7155, -6408,  5069, -3463,  3749,  6341,
+   -2116, -2072,  2263, -2974,  8152,  2877, -1998, -4965, -8275, -2914,
+   -4394, -2780, -3007,  3555, -5706, -6638,  2189, -3345,  2757, -3317,
+    3452, -6797,-16399, -2578, -6775,  4920,  4568, -4663, -2832, -5789,
+   -2716, -2105,  6778, -4069, -2789,  2882, -2649,  4071, -5721,  3412,
+   -2734,  5361,  2455,  3587, -5135, -2312, -3039, -3909,  3718,  3204,
+   -6317, -3031,  2639,  6821, -2272,  4265, -4202, -2747,  3212, -3812,
+   -2513,  2627,  2953,  2186,  3107, -5113, -4579, -4496,  2417, -2138,
+   -2419,  4612,  4653, -2305, -3145, -2111, -2062,  4769,  3087, -2946,
+   -2653, -2987,  3942, -3269, -3006, -3272,  7032,  3438,  3330, -5438,
+   -5703,  2132,  6251,  2549, -3642,  2509,  2418, -5465, -2661, -2098,
+    4214, -4266,  2353,  7695,  3651,  2781,  6379, -3017, -2222, -5195,
+   -5466, -2219, -4528, -2543,  4263, -6279, -7149, -3002, -3904, -2350,
+  -13393,  6264, -2203,  3927,  2272,  2402,  2660,  2419,  3334,  3256,
+   -1982,  2173, -3016,  2007,  2678,  4286,  2972,  2081,  2703,  2204,
+    3045, -2507,  2268,  2266, -1996,  3165, -3147, -3185, -2587, -3734,
+   -2162,  2155, -2294, -2035, -4458,  2223, -3593, -3189, -2545,  2576,
+    2532,  3298,  3013, -3653, -3128, -2106,  3100, -3188, -2750,  5524,
+   -2944,  3034,  6484,  2310, -3233,  4757, -2914, -2915,  2231,  3231,
+    3437,  2568, -2300, -2188, -2139,  2590, -2322,  3035,  3664,  2427,
+    2058, -2255,  2124,  2118,  2881,  2665,  4970,  4226, -2653,  2774,
+    2132, -2390,  4750,  3716, -3577, -4128,  2183, -3916,  4017,  3751,
+    3845, -2902,  2477, -2507,  4135, -2091, -2710, -6154,  3621, -2669,
+   -4818,  3397,  2374,  2623, -2856, -2767, -8274, -4671, -2203, -2540,
+    3650,  3914, -3642,  3481, -3237,  3948,  2037, -2237,  4269,  2077,
+    2267,  3779, -2514,  4427,  2042, -3463,  2857, -2565, -3471, -3070,
+    2051, -2793,  2791,  2939,  2901,  6473, -3035,  2071, -4931, -3121,
+   -2746,  5437, -2424, -2833, -2908, -2362,  2577, -4822, -2311, -5271,
+   -2136, -2585, -3051, -2414, -5316,  2863, -2084, -3106,  2224,  5453,
+   -2267, -3562, -2401,  3062, -2289,  5446, -2343,  2225, -2403,  2360,
+    2030,  6328, -2249, -2249,  3158, -3690,  2739,  2490,  4146,  2001,
+    2498, -2647,  2369, -3307, -3159, -2059,  2850, -2700,  3137, -3649,
+   -3575,  1985, -2433,  2540, -2112,  6188,  3069,  2723, -2018,  2724,
+   -4371, -5136, -2127,  5788,  2066, -2411,  2352,  2429,  5704, -4196,
+   -2006, -2594, -2544,  4171,  4361,  4148, -2653, -5125, -2170,  3310,
+    2325, -3339,  5788, -3326,  4510,  2093,  3692,  2933,  2079, -2860,
+    2017,  2075,  2723, -2578,  2283,  2464, -2785,  2463,  2633,  3288,
+    2403, -3234,  1982,  2228, -2525, -3589,  3512, -3075,  2005, -3724,
+   -2030, -2493,  2190,  2275,  2262,  3150, -2094, -2361, -1986,  3494,
+    2168, -2367,  3857,  2801,  2467,  3331,  2731,  2631, -3758, -2415,
+   -2082,  2091,  2680, -2452,  2226,  1992, -2016,  2255, -2876,  2564,
+   -2295, -2118,  3243,  2530, -2058, -2187,  2010,  2259, -3691,  2087,
+   -2138,  2110, -2886, -2289, -2779,  2386, -2495,  2330, -2416, -2376,
+   -2750,  2224, -2173,  3093, -2282, -2192,  3015,  4111, -2977, -2214,
+    2934, -2003,  3110,  2002,  2461,  2626,  3100,  3477,  2515,  2142,
+    3465, -5604, -4684,  2265,  2442,  3844,  3039, -2145,  2977,  2461,
+    2067,  2746, -2380, -5122,  3119,  2615,  2013, -2274,  2787,  2065,
+   -3956, -4393, -2422,  2340, -3830, -5253, -2179,  2557,  1993, -2396,
+    2510,  2143, -2178,  3334, -2784,  2396,  2684, -6206, -2269,  2010,
+   -2349, -2134, -2395,  2222,  3772, -2276,  3085,  2241,  2743, -2300,
+   -5491,  2795, -5488, -2400, -2576,  4849,  2775,  4888, -2752, -2209,
+   -3150,  2112, -3125, -2040,  2073, -2390, -2955, -2018, -2729,  2433,
+    2366, -2226,  1988, -2094, -2527,  4183,  2692,  2576, -4565,  2024,
+   -2583,  2637, -2367,  4928,  3701,  2721, -2275, -5722, -3272,  3442,
+   -2278,  2643,  3270,  2516,  2004, -2269, -2710, -3965, -2920,  2545,
+    2450, -2000,  2291,  2275,  2360,  2536,  2916,  3717, -2929,  3119,
+    2691, -2709,  3604,  2752, -3390,  2585, -3164,  2328,  2203, -4938,
+   -2710,  3290, -2413,  2028, -2780, -2283, -2851, -3416,  2017,  2169,
+   -2101,  2682, -2692, -2160,  2394,  2178,  4647, -3050, -3289, -3896,
+    2220,  2257,  2214,  3587, -5267,  2198,  2170, -2947,  2227,  4668,
+    4428,  4360,  2117,  3835,  2152,  2872, -2078, -2939,  2179,  2313,
+    2219,  2758, -2306, -3075, -3562, -2068,  2524,  2160,  4433,  2196,
+    3081, -2857,  2663,  2455, -2072,  3707,  2157,  2629,  2002,  3490,
+   -2988,  2258,  2534,  2598,  2992, -2356,  4114, -2507, -2896, -5842,
+   -3401,  2474, -3760, -4939,  6075,  2757,  2048,  2645,  4279, -4307,
+   -2035,  2649, -1996, -2353, -3578, -3438,  3703, -2156,  2520, -2967,
+    2028,  2181,  5489,  2480,  2329, -3046, -4185,  2018,  2189, -2237,
+   -2184,  2818, -2163, -2753,  3615,  3785,  2566, -2033, -3082, -3183,
+   -2527,  2103, -2448, -2064,  2087, -2155,  2958, -4061, -2337,  2343,
+   -2131,  2324,  2112, -3389, -2486, -2482, -2757, -3228, -2755, -2125,
+    2004, -2098, -2878, -3257, -2619, -2133,  2543, -2232, -3279, -2987,
+    4312, -2188, -2246,  2145, -3014, -2332, -2173,  2114, -2179, -2341,
+   -2561, -3251, -2338,  2030,  1987,  2079, -2017,  2163,  2325,  2033,
+   -2457,  2308,  2129,  2504,  2139,  2304, -2089, -1982, -2262,  2357,
+    2047,  2990, -2326, -2503,  2083, -2023,  2057,  2211,  3074, -2028,
+    2044, -2302, -2070,  2166, -3528,  3426, -3196,  2237,  1998, -2512,
+   -2415, -3072,  2807,  2141,  2614, -2297,  1997,  2160,  2096,  2471,
+   -2315, -3042,  2301, -2134, -2113, -2955, -2006, -2486, -2147,  2298,
+    2192,  2134,  2664,  2519, -2256, -2009, -2023,  2224,  2163,  2084,
+   -2104, -2092,  3506,  2523, -1984, -2331, -2108, -2247,  2050,  2835,
+   -2068, -2683,  2119, -2032,  2180, -2056, -2878, -4692,  3205,  3140,
+    4525,  2866, -4020, -3855,  3449, -3062, -2915,  2833, -3571,  3690,
+    4312, -4303,  7946, -6097,  6164, -6228,  3321,  3316, -3634,  3222,
+   -5347,  3693,  3350,  4907,  5823, -3371, -6704, -3815, -3865, -5581,
+   -3657, 10191, -4756,  3362, -6936,  3011, -8760,  2832,  5723, -5372,
+   -9584, -3782, -4971, -3688, -2989, -5146,  5911, -4383,  3337,  3523,
+    4738, -6729, -7285,-11136,  4771, -3872,  4085,  6434,  3655, -5402,
+    8646, -5433,  4037, -4193, -3094, -2977,  7863, -3332, -6078, -6830,
+    4458, -5907, -7774,  4697, -9334,  6251,  9425,  6465,-15811, 10713,
+    5550,  6590, -4228,  3390,  6288, -4449,  5124, -6281,  8321,  5613,
+    4125, -4380, -6395,  4506,  3530,  3287, -3417,  6274,  9083, 10327,
+    5386, -5227, -6967,  2900, -3210,  7269, -6981, -3659,  6116,  3517,
+   -4754,  3802, -2848,  3784, -4470,  4534,  3506, -6639, -3263, 14556,
+   -3114,  3974, -3872,  3198, -4979,  8361, -5377,  2997,  4830,  3029,
+   -3830, -4086,-13623,  4682,  2840, -4616,  2860,  9180,  2998,  5317,
+   -8872, -4763, -3098, -3887,  5058, -2955,  7537,  3609,-10887, -3441,
+   -3425,  6794, -6191,  6783, -5026,  8501, -5360, -4941, -5588, -3713,
+   -3766,  3283,  7298, -2948, -5471, -4258, -4053,  4883, -3346,  5722,
+    5410,  3502, -9974, -3573, -3332, 13238, -3114, -8132, -8027, -4057,
+    8739, -3959,  6410, -3313, -5410,  3727,-10537, -6535,  3242,  3932,
+   -3646, 13867,  7163, -4564,  5088, -8755, 10910, -5480,  3920,  4131,
+    8343, -4599,  6784,  7952,  7843,  4055, -2950, -2998, -3137,  5952,
+   -3691, -3792,  3741, -4144,  4057, -5250,  3845,  4245, -7361, -9038,
+    5420, -3298,  4380, -6252, -4071,  4658,  7418, -6964,  2971, -4851,
+   -3858,  4482, -3263, -8487, -3752, -5122, -3880,-11772,  6304,  6015,
+    4987,  5205, -4307, -8153,  7660, -4494, -3884,  8916,  3847,  2830,
+   -2877, -4878, -7100,  3884,  3189, -6644,  5255,  5307,  4335,  5142,
+  -13845,  3996, -2870, -2879,  3249,  7578,  5880,  5530, -3951, -5239,
+    3711,  5163, -9844, -3887, -6969,  3140, 10111, -5705, -4134, -4146,
+    7040, -3340,  4714,  5272,  7798, -4893, 13435, -8975, -7217,-15785,
+    3582,  7624,  5449,  3023,  4490,  3928,-12353,  8544, -3483,  4282,
+   -3926, -6888, -3806,  3412,  9977,  4324, -9347,  6031, -3537, -5956,
+   -3256, -3327, -3560,  4585, -3709,  5709, -3467, -3311, -7054,  7696,
+    4763,  4049,  5049,  4502, -3990,  4600,  4072,  6321,  4734,  3040,
+    3949, -5297,  2872, -7835, -3568, -5804,  4039, -6787,  3736, -4011,
+    4673, -4256, -4014,  6955,  4501, -6665, -3901,  5208,  4802, 12271,
+    2949,  3909,  3957,  4066,  7703,  3810,  6010, 11115,  5287,  3442,
+    5510, -5421,  7896,  6168,  3047,  9623,  3348,  6105,  3130, -6148,
+   -3044,  3745, -3194,  5124,  4582,  3006, -6147, -3619, -4047,  6219,
+   -4228, -3262,  5763, -5119,  3123, -5311,-15205,  3216,  6403, -6899,
+   11370,  8648,  4566,  4064,  7639, -5436,  8911, -3700,  4930,  3400,
+   -5240, -6193, -6126, -3504, -6902, -4413,  9851, -6337,  3693,  4390,
+    3755, -3213,  4336,  4039,  3528,  2879, -2940,  4863,  4241, -3411,
+   -3657, -2898,  4656,  4288, -3374, -3384,  3546,  3753,  4572, -5878,
+   -3186,  8334,  3382,  2869,  5812,  3677,  4555,  3098, -3530,  4336,
+    3077,  3699, -3034,  3159,  2983, -3954, -5369,  3437, -3599,  3044,
+    4159,  3692, -7160, -3045,  3525,  3723, -4890, -2947, -3704, -3584,
+    3740,  5570, -5012,  3119,  3799, -3607, -2884,  3401, -5883,  4296,
+    3195,  2967, -9408,  7033,  3292, -3476, -2912, -5603,  2880, -5779,
+   -3257,  3901,  7710,  5281, -4571,  3419,  2910,  4437,  3103, -3426,
+    3338, -2901,  4143,  4662, -2926,  6410, -5228,  3166, -5510,  3958,
+    3098, -4121, -3126,  4154, -7121,  5920, -3159, -4234, -3958,  4832,
+    3275, -3500,  5255,  3967, -2861, -2966,  2969, -2899, -5115,  2847,
+   -4651,  2936, -3160, -3227,  2944,  3213, -4881, -4805,  3159,  7461,
+   -3540,  4067, -2918, -4573,  3186,  3483, -4602,  5288,  5283, -4013,
+    3660,  3895, -2967,  3091, -3330, -5588,  5477, -2978,  3092,  4579,
+    3716, -3203, -3024,  2972,  3818, -2901,  4024, -3855, -4574, -3057,
+    3102,  3490,  2881,  3135, -3978, -3640, -4539,  3328, -3319,  3426,
+    3333,  2905, -3670,  3080,  3302, -3112,  3948,  3304, -3303,  4557,
+    5778,  3713, -3711, -3178, -3841,  3087,  4120,  3063,  4309,  4605,
+    3055, -3680, -3287,  8071,  3819,  6600,  6600,  4550,  3410, -3935,
+    6657, -3875, -4810,  3957, -4057,  3401,  5653, -3190,  4777, -4764,
+   -3058,  3732,  5523,  4802,  7408,  3389, -7712,  4530,  3364,  3318,
+    5754, 11782, -3368,  4202, -3452, -2883, -5870,  5341, -6561,  7445,
+    3316, -3119,  3965,  6203, -3101,  3034, -3167, -6259,  4252, -3185,
+   -3644, -4479, -5103,  4097,  7440,  3156,  3228, -4089, -4482, -3751,
+    4817,  4146,  4295, -2861, -4102, -6257,  3783,  2828, -3180, -7588,
+    3531, -5207, -3583, -4879,  5457,  6904, -4528,  4410, -5909, -7707,
+   -3334, -8926,-10747, -4591,  5220,  3919, -3284,  4679, -4173, -3402,
+    3944, -3265,  5030, -4577, -5801, -2965, -4238, -3928,  3014,  2906,
+   -2890, -2892, -2987,  5958, -3523, -5323, -2906, -3780,  4414, -3505,
+    3078, -4658, -3015, -3227,  5344,  2887, -3947, -5195,  5868, -4939,
+    2936,  4956,  3231,  5649,  3824,  4191, -6014, -3872,  5956, -4215,
+   -5078, -2878, -7209, -4611, -3380,  5771,  4361,  5917, -4279, -4111,
+   -3038,  3262,  3969, -3715,  2961,  7358,  4759,  3208, -4135,  3032,
+   -4406, -3053,  4604,  3275,  3434, -4000, -2843, -4208, -4243, -4127,
+    6048, -4221,  4071, -4348,  4405, -2874, -3972, -4620, -4395,  5284,
+   -6260,  3412,  3525,  4791,  6456,  3490,  3798,  3974,  3324,  3295,
+    6243,  4016,  2983,  3134,  4688, -3030, -3951,  3325,  4419, -3064,
+   -3022,  2978, -2989,  3689, -2999, -3491, -3787, -4823,  4808, -3706,
+    4365, -2913, -3487, -3515,  3470, -3285, -2941, -3062,  4084, -4150,
+   -5290,  3094, -3863, -2836,  3183,  3303,  3685,  4027, -3451, -4390,
+   -3769,  2928,  2914,  6122, -4333, -3726,  6159,  4913, -3086, -5435,
+   -3161, -4527, -4117, -4188, -4549,  3723, -3721, -5828,  3420,  5040,
+    3318, -3543,  3130, -3709, -3294, -5651,  4463,  4051,  4735, -2858,
+   -5151,  3038,  3372, -4960,  6876,  2981,  3251, -3065, -2995, -2966,
+    3660,  4260, -3249, -3893, -3733, -3411,  2938, -3443,  4002,  3743,
+   -3626,  2902,  3356, -2981,  8693,  3475, -3052, -5195,  7711,  3387,
+   -4812,  5841,  2889,  3500,  3090, -4294, -3451,  3229, -3410, -3263,
+   -3049,  4205, -3075, -3103,  3158, -3515, -4391,  3073,  5553,  3416,
+   -4433, -4915, -3606, -3479, -3918, -3419, -3043, -3762, -4526,  3510,
+   -3820, -3545,  3496, -3293,  3884,  4191, -2905, -2851,  3162, -2932,
+   -3221,  3645, -3520, -3600, -3118,  7156, -2907, -2952,  2865, -3581,
+   -3535,  4137, -2947,  2957, -2989,  4056,  2843, -2903,  3845,  3041,
+    3128, -3635, -3043, -3916, -3744, -4099,  4641, -5667, -3099, -3241,
+   -3375,  3737,  3999,  3316, -4225,  3213, -2937, -3141,  2835, -3347,
+    2929,  3710, -4027, -2838, -3029, -4343, -3662, -3754, -2969,  3064,
+    3013, -3733, -2877,  3298,  3418,  3083, -3156, -3132, -3099, -3831,
+   -3046, -3123, -2941, -3247, -3551,  3064,  2968,  3054,  3050, -3896,
+   -3160, -2942,  3199,  3757, -4091, -3855, -2893, -2900, -3570, -3688,
+   -2863,  2861, -3349, -3594,  2930, -3493,  3242,  3072, -2837,  2967,
+   -4377,  3271,  2901,  3176, -3808, -3441, -3462, -2970, -3050, -3464,
+    3168,  3138, -4936, -3406, -4962, -3503, -4146,  2829, -3063,  2971
+};
+
+const int OD_PRED_NPAIRS_4x4[OD_INTRA_NMODES]={
+  18, 22, 14, 16, 14, 17, 15, 19, 15, 17
+};
+
+const unsigned char OD_PRED_PAIR_INDEX_4x4[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][2]={
+  {
+    { 0, 2},{ 4, 5},{ 6, 7},{ 8, 9},{12,13},{16,17},
+    {18,19},{20,21},{24,28},{29,32},{33,34},{46,48},
+    {49,50},{60,61},{62,72},{73,74},{84,85},{86,86},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 1},{ 2, 3},{ 4, 5},{ 6, 7},{ 8,10},{11,16},
+    {17,24},{26,27},{28,29},{30,31},{32,34},{35,38},
+    {39,42},{43,46},{47,48},{49,50},{51,60},{61,62},
+    {63,72},{73,74},{75,84},{86,87}
+  },
+  {
+    { 0, 4},{ 8, 9},{12,16},{17,20},{28,29},{32,40},
+    {44,48},{49,50},{51,60},{61,62},{63,72},{73,74},
+    {75,84},{85,86},{ 0, 0},{ 0, 0},{ 0, 0},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 4},{ 5, 6},{ 7, 8},{19,24},{25,28},{29,36},
+    {37,40},{41,42},{48,49},{50,51},{60,61},{62,63},
+    {72,73},{74,75},{84,85},{86,87},{ 0, 0},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 1},{ 4, 5},{ 6,12},{13,16},{17,19},{24,25},
+    {28,29},{36,48},{49,50},{60,61},{62,72},{73,74},
+    {84,85},{86,86},{ 0, 0},{ 0, 0},{ 0, 0},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 1},{ 4, 5},{12,13},{16,17},{20,25},{28,29},
+    {30,32},{33,40},{41,44},{45,48},{49,50},{51,60},
+    {61,62},{63,72},{73,74},{84,85},{86,86},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 1},{ 2, 4},{ 5, 6},{ 7, 8},{12,13},{14,16},
+    {17,18},{19,29},{31,36},{40,44},{48,49},{50,51},
+    {60,61},{62,72},{73,73},{ 0, 0},{ 0, 0},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 2},{ 3, 4},{ 5, 6},{ 7,14},{16,17},{18,19},
+    {20,21},{22,28},{29,30},{31,36},{40,41},{42,43},
+    {46,48},{50,51},{60,62},{63,72},{74,75},{84,85},
+    {87,87},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 4},{ 5, 6},{ 7, 8},{ 9,10},{11,16},{17,18},
+    {19,20},{21,22},{28,29},{30,31},{32,33},{40,41},
+    {48,49},{50,60},{61,61},{ 0, 0},{ 0, 0},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  },
+  {
+    { 0, 4},{ 5, 6},{ 8, 9},{12,13},{16,17},{18,19},
+    {20,21},{22,28},{29,30},{32,33},{34,40},{48,49},
+    {50,51},{60,61},{62,63},{72,73},{84,84},{ 0, 0},
+    { 0, 0},{ 0, 0},{ 0, 0},{ 0, 0}
+  }
+};
+
+const ogg_int16_t OD_PRED_PAIR_WEIGHTS_4x4_Q12[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][4*4*2]={
+  {
+    {
+         922,  -830,     0,     0,     0,     0,     0,     0,
+        -428,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,  -189,  -965,     0,     0,     0,     0,
+        -285,     0,     0,  -589,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,  -494,     0,     0,  -523,
+           0,     0,     0,     0,  -533,     0,     0,  -471,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1146,  -728,     0,     0,     0,     0,     0,     0,
+         473,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+         808,     0,     0,   440,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1446,  -791,     0,   962,     0,     0,     0,     0,
+           0,     0,     0,   611,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,   613,     0,     0,   615,
+           0,     0,     0,     0,   536,     0,     0,   551,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,   987,     0,     0,     0,     0,     0,     0,
+        -904,  -632,   369,     0,     0,     0,     0,     0,
+           0,     0,     0,   343,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -649,  -737,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,   433,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  -967,     0,     0,     0,     0,     0,     0,
+           0,     0,  -534,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  -902,  -698,     0,  -511,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  2039,     0,   183,     0,     0,     0,     0,
+           0,   228,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,  -437,     0,     0,     0
+    },
+    {
+        3061, -1416,     0,     0,     0,   539,     0,     0,
+        -431,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2851,     0,     0,     0,     0,     0,     0,     0,
+        -658,   879,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0, -1289,   822,     0,   623,     0,     0,     0,
+           0,  -776,     0,  -515,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         824,     0,   663,   759,  -333,  1275,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+       -1191,   600,  -870,  1277,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   977,     0,   358,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+       -2121,  -409,   132,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         953,     0,     0,     0,  -721,     0,     0,  -454,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2251,     0,     0,  1989,   -88,     0,     0,     0,
+         274,     0,     0,   259,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,  2015,     0,     0,  1370,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         356,     0,  -233,     0,    88,  -490,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,   480,     0,     0,     0,     0,  -554,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  -179,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,   962,   666,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  -286,  -231,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   704,     0,     0,   611,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -1201,     0,     0, -1145,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,  -687,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,  -731,     0,     0,  -600,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        -356,     0,     0,     0,     0,   511,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,   606,     0,
+           0,     0,     0,     0,     0,   662,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0, -1213,   810,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,   733,  -744,     0
+    },
+    {
+           0,  3332,     0,   124,     0,     0,     0,     0,
+           0,  -228,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,   692,     0
+    },
+    {
+        1142, -1350,     0,     0,  -258,  -580,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0, -1370,     0,
+           0,  3182,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -660,     0,     0,     0,     0,     0,     0,     0,
+        1484, -1932,     0,     0,     0,     0,     0,   265,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+        1093,     0,     0,     0,     0,     0,  -643,     0,
+           0,  3037,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         506,  -899,     0,     0,     0, -1234,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0, -1584,     0,
+           0,  3634,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        -913,     0,     0,     0,  -739,     0,     0, -1202
+    }
+  },
+  {
+    {
+           0,  -746,     0,     0,     0,     0,     0,     0,
+        -161,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         622,  -806,     0,     0,     0,     0,     0,     0,
+         211,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         467,     0,     0,     0,     0,     0,     0,     0,
+           0,  -501,     0,     0,     0,     0,     0,     0,
+           0,  -410,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         877,  -702,     0,     0,     0,     0,     0,     0,
+         797,  -607,     0,     0,     0,     0,     0,     0,
+           0,  -251,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+         944, -1072,     0,     0,     0,     0,     0,     0,
+         971,  -754,     0,     0,     0,     0,     0,     0,
+         396,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+        1389,     0,     0,     0,     0,     0,     0,     0,
+         729,  -679,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  3487,     0,   114,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        -678,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -4545,     0, -1016,  2519,  -347,   801,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        3380, -2889, -2010,   344,  -795,     0,     0,     0,
+           0,  1898,     0,   270,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        7811, -7200,     0,     0,     0,     0,     0,     0,
+       -1797,     0,  -865,  1514,  -320,   696,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        4178,     0,  1322,     0,     0,     0,     0,     0,
+           0, -3579,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,   422,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -3379,  3646,     0,     0,     0,     0,     0,     0,
+        5349, -3763,     0,     0,     0,     0,     0,     0,
+           0,     0,  -719,  1092,  -270,   598,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -3365,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0, -1546,     0,     0,     0,     0,     0,     0,
+           0,  -838,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2194,     0,     0,     0,     0,     0,     0,     0,
+       -2314,  2544,     0,     0,     0,     0,     0,     0,
+        1435,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,   925,     0,   627,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+         168,  -169,     0,     0,     0,    44,     0,     0,
+         176,  -189,     0,     0,     0,     0,     0,     0,
+           0,   -58,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,  -285,     0,     0,     0,     0,     0,
+           0,     0,  -233,     0,     0,  -303,     0,     0,
+           0,     0,  -142,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,   -43,     0,     0,
+           0,     0,     0,     0,     0,     0,  -337,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  -453,     0,     0,     0,     0,   295,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         902,     0,     0,     0,     0,     0,     0,     0,
+           0,   535,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,   482,   584,     0,     0,     0,     0,     0,
+           0,     0,   301,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -973,     0,     0,     0,     0,     0,     0,     0,
+           0,  -470,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  -552,     0,     0,  -485,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        4140, -7259,     0,  -533,     0,  -328,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+          68,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        7590, -4866,  1546, -1507,   711,  -605,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+        3580, -4416,     0,  -563,     0,  -279,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+        3254, -1582,  1198, -1010,   642,  -458,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  1438,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        2823, -2723,     0,  -485,     0,  -227,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2639,  1916,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        1085,     0,   910,  -889,   470,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,   985,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        2322, -2732,   220,  -554,     0,  -218,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,   733,  -705,   380,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+        1378, -1225,  -173,     0,     0,     0,     0,     0,
+         842,  -685,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         -81,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -393,     0,     0,  -700,     0,     0,     0,     0,
+           0,   538,     0,  -523,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -1351,     0,     0,  -510,     0,     0,     0,
+           0, -1441,     0,     0,  -457,     0,     0,     0,
+           0,  -415,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1503,     0,     0,     0,     0,     0,     0,     0,
+        1263,     0,     0,     0,     0,     0,     0,     0,
+           0,  -353,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,   688,     0,     0,     0,     0,     0,
+       -1168,     0,   570,     0,     0,     0,     0,   552,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -1065,     0,     0,     0,     0,     0,     0,
+        1417,  -997,     0,     0,     0,     0,     0,     0,
+         992,  -709,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         672,   668,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  3084,     0,   169,     0,     0,     0,     0,
+           0,  -843,     0,     0,     0,     0,     0,     0,
+        -806,     0,     0,     0,     0,     0,     0,     0,
+           0,    82,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2882,     0,  -450,   792,  -243,   457,     0,     0,
+         994,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2277, -2328,     0,     0,     0,     0,     0,     0,
+         716,     0,   491,  -932,     0,     0,     0,     0,
+        -587,   509,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  2490,     0,     0,   500,     0,     0,     0,
+           0, -1281,     0,     0,     0,     0,     0,     0,
+           0,  -575,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+       -1660,     0,     0,     0,     0,     0,     0,     0,
+         747,     0,  -933,  1115,     0,   522,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         874,     0,     0,     0,     0,     0,     0,     0,
+       -1973,  1297,  -634, -1177,     0,  -408,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  1716,     0,   925,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+        1065, -1038,     0,     0,     0,     0,     0,     0,
+           0,     0,   285,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         503,   833,  -336,  -820,     0,     0,     0,     0,
+         886,     0,  -201,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -972,  1338,     0,     0,     0,     0,     0,     0,
+        -799,  1099,  -556,   934,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1093, -2333,     0,  1070,     0,     0,     0,     0,
+       -1803, -1430,   539,     0,     0,     0,     0,     0,
+        -387,     0,     0,  -447,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1059,     0,     0,     0,     0,     0,     0,     0,
+           0, -1307,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -4430,  2951,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         865,     0,     0,   892,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -2949,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  1337,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -1968,  6883,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2396,  3587,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2144,   966,     0,   660,     0,     0,     0,     0,
+           0,  -436,     0,  -176,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -7864, -1586,     0,  -329,   800,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       10298,  1890,     0,     0,     0,     0,     0,     0,
+           0, -1207,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -3103,  3499,     0,     0,     0,     0,     0,     0,
+        1048, -2277,  -779,     0,  -451,  1054,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+        2666,  2248,     0,     0,     0,     0,     0,     0,
+           0,  -808,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  3027,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         834,     0,     0,     0,     0,  1203,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  -649,   988,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  1402,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   704,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+        1300, -1364,   551,  -991,     0,  -241,     0,     0,
+           0,     0,   177,  -331,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  2762,  1452,  -987,   632,   125,     0,     0,
+           0,   196,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2590,     0,     0,  2245,  -461, -1288,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,   182,     0,  -126, -1181,    72,
+           0,     0,     0,     0,     0,     0,  -464,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -1964,  1997,  -602,   884,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -2119, -1216,   947,     0,     0,     0,     0,
+           0,     0,     0,     0,  -562,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2803,     0,     0, -1494,     0,   755,     0,     0,
+           0,     0,  -762,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,   786,     0,
+           0,     0,     0,   943,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,   572,     0,
+           0,   817,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+        1420,   666,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,   251,  -710,     0,  -372,   -72,     0,
+        -191,     0,  -179,   369,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,   925,     0,   921,  -815,   348,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1420, -1381,   592, -1343,     0,     0,     0,     0,
+       -1282,   999,  -467,   657,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,  1542,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  -468,     0,  -405,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+         602,     0,   527,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+           0,     0,   105,  -442,    81,     0,    46,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  4074,   450,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,  3810,     0,     0,  3208,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,   689,     0,   581,     0,     0,  3013,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -5550,     0,     0, -3688,     0,     0,     0,     0,
+        -722,     0,     0,  -510,     0,     0,     0,     0,
+        -260,     0,     0,  -254,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         613,     0,     0,     0, -2028,     0,     0, -1818,
+           0,     0,     0,     0,  -382,     0,     0,  -438,
+           0,     0,     0,     0,  -164,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         219,   440,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         774,  4788,     0,     0,     0,     0,     0,     0,
+           0,  1620,     0,     0,     0,     0,     0,     0,
+           0,   674,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,  2230,     0,     0,     0,     0,     0,
+           0,     0,  1024,     0,     0,   744,     0,     0,
+           0,     0,   504,     0,     0,   289,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,   494,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,  -279,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2427,     0,     0,  -844,     0,     0,     0,     0,
+       -1335,     0,     0,  -720,     0,     0,     0,     0,
+        -583,     0,     0,  -383,     0,     0,     0,     0,
+        -368,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,  -628,     0,     0,  -497,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,   -98,     0,   -84,     0,   -51,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   237,     0,     0,     0
+    },
+    {
+           0,     0,   475,  -458,   261,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,   516,  -102,   311,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  -473,     0,  -307,     0,     0,     0,
+           0,     0,     0,     0,     0,   -98,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,   363,  -440,   237,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,   285,  -185,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,  -449,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+           0,  2948,     0,   891,   -83,     0,     0,     0,
+           0,   176,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2435,     0,     0, -2021,   524, -1949,     0,     0,
+           0,     0,   391,     0,     0,     0,     0,   603,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  1148,     0,  -879,     0,    86, -1491,    72,
+           0,  -188,     0,     0,  -732,     0, -1258,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1646,     0, -1777, -1326,   591,   693,     0,     0,
+           0,     0,     0,     0,     0,   512,     0,  -440,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -4813,     0,  -945,     0,     0,     0,     0,
+           0,  -614,     0,     0,     0,     0,  -661,     0,
+           0,  -321,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        3788,     0,     0,  1477,     0,   915,     0,  -540,
+           0,     0,  -734,     0,     0,  -675,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -2717,     0,   777,     0,     0,  1259,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,  -465,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -3408, -1310,  1593,     0,  -496,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        3999, -3769,     0,     0,     0,     0,     0,     0,
+        1737,     0,     0,  1124,     0,     0,     0,     0,
+         636,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,  1658,
+           0,     0,     0,     0,   676,     0,     0,   720,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        2959,  2762,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -2335,  2646,     0,     0,     0,     0,     0,     0,
+       -1284,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,  -257,   -71,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  -721,     0,  -533,   678,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         932,     0,   795,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  },
+  {
+    {
+        -415,   569,     0,   372,     0,     0,     0,     0,
+           0,   518,     0,   248,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -1536,     0, -1373,     0,     0,     0,     0,     0,
+        -673,     0,     0,     0,     0,  -648,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        3054,  1900,  -608,     0,     0,     0,     0,     0,
+        -491,   606,  -238,  -833,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1261,  -956,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1617,  1914,     0,  1400,     0,     0,     0,     0,
+        -859,  1036,  -483,     0,     0,     0,     0,     0,
+        -355,     0,     0,  -362,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,   835,     0,     0,     0,
+           0,     0,  1202,     0,  1181,     0,     0,   898,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -3681,     0,   653,     0,     0,     0,     0,     0,
+           0, -1186,     0,  1235,     0,  -432,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0, -5329,     0,     0,     0,     0,     0,     0,
+           0,  1272,  1202,     0,     0,     0,     0,     0,
+           0,   616,     0,     0,  -478,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,   902,     0,     0,   647,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1587,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0, -1299,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  5757,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   642,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+         697,     0,   233, -1061,     0,  -401,     0,     0,
+           0,  -562,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,  1682,  2033,     0,  1032,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        -581,  1171,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,  -354,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,   880,  -880,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+       -1336,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,   976,     0,     0,     0,     0,
+           0,   717,     0,   670,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+        1698,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    },
+    {
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0,
+           0,     0,     0,     0,     0,     0,     0,     0
+    }
+  }
+};
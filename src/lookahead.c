@@ -0,0 +1,327 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "lookahead.h"
+
+/*The log of the factor the luma plane is decimated by in each direction.*/
+#define OD_LA_LOG_DEC (2)
+/*The log of the size of the blocks compared between frames, in decimated
+   pixels.*/
+#define OD_LA_LOG_BSZ (3)
+/*The largest motion searched for, in decimated pixels.*/
+#define OD_LA_RANGE (8)
+/*A frame is a scene cut if coding it as an inter frame saves less than
+   1 - OD_LA_CUT_NUM/OD_LA_CUT_DEN of its cost as a keyframe...*/
+#define OD_LA_CUT_NUM (7)
+#define OD_LA_CUT_DEN (8)
+/*...and the best matches in the previous frame differ from it by at least
+   this much per decimated pixel, so that noise in a flat scene does not look
+   like a cut.*/
+#define OD_LA_CUT_MIN_SAD (4)
+
+void od_la_init(od_lookahead *la, const od_state *state) {
+  memset(la, 0, sizeof(*la));
+  la->state = state;
+  la->since_key = -1;
+}
+
+static void od_la_free_frames(od_lookahead *la) {
+  int fi;
+  if (la->frames != NULL) {
+    for (fi = 0; fi <= la->depth; fi++) _ogg_free(la->frames[fi].buf);
+    _ogg_free(la->frames);
+  }
+  _ogg_free(la->small_buf[0]);
+  _ogg_free(la->small_buf[1]);
+  la->frames = NULL;
+  la->small_buf[0] = la->small_buf[1] = NULL;
+  la->depth = 0;
+}
+
+void od_la_clear(od_lookahead *la) {
+  od_la_free_frames(la);
+}
+
+/*Sets the number of frames to hold, and allocates space for them.
+  This can only be done while the queue is empty.*/
+int od_la_set_depth(od_lookahead *la, int depth) {
+  const daala_info *info;
+  size_t img_sz;
+  size_t small_sz;
+  int fi;
+  int pli;
+  if (depth < 0 || depth > OD_LA_DEPTH_MAX || la->nframes > 0) {
+    return OD_EINVAL;
+  }
+  od_la_free_frames(la);
+  if (depth == 0) return OD_SUCCESS;
+  info = &la->state->info;
+  img_sz = 0;
+  for (pli = 0; pli < info->nplanes; pli++) {
+    img_sz += (size_t)((info->pic_width
+     + (1 << info->plane_info[pli].xdec) - 1) >> info->plane_info[pli].xdec)
+     *((info->pic_height + (1 << info->plane_info[pli].ydec) - 1)
+     >> info->plane_info[pli].ydec);
+  }
+  la->small_w = la->state->frame_width
+   >> (OD_LA_LOG_DEC + info->plane_info[0].xdec);
+  la->small_h = la->state->frame_height
+   >> (OD_LA_LOG_DEC + info->plane_info[0].ydec);
+  la->small_stride = la->small_w + (OD_LA_RANGE << 1);
+  small_sz = la->small_stride*(size_t)(la->small_h + (OD_LA_RANGE << 1));
+  la->small_buf[0] = (unsigned char *)_ogg_malloc(small_sz);
+  la->small_buf[1] = (unsigned char *)_ogg_malloc(small_sz);
+  la->frames = (od_la_frame *)_ogg_calloc(depth + 1, sizeof(*la->frames));
+  la->depth = depth;
+  if (la->small_buf[0] == NULL || la->small_buf[1] == NULL
+   || la->frames == NULL) {
+    od_la_free_frames(la);
+    return OD_EFAULT;
+  }
+  for (fi = 0; fi <= depth; fi++) {
+    od_img *img;
+    unsigned char *data;
+    la->frames[fi].buf = (unsigned char *)_ogg_malloc(img_sz);
+    if (la->frames[fi].buf == NULL) {
+      od_la_free_frames(la);
+      return OD_EFAULT;
+    }
+    img = &la->frames[fi].img;
+    img->nplanes = info->nplanes;
+    img->width = info->pic_width;
+    img->height = info->pic_height;
+    data = la->frames[fi].buf;
+    for (pli = 0; pli < info->nplanes; pli++) {
+      od_img_plane *iplane;
+      iplane = img->planes + pli;
+      iplane->data = data;
+      iplane->xdec = info->plane_info[pli].xdec;
+      iplane->ydec = info->plane_info[pli].ydec;
+      iplane->xstride = 1;
+      iplane->ystride = (info->pic_width + (1 << iplane->xdec) - 1)
+       >> iplane->xdec;
+      data += iplane->ystride*(size_t)((info->pic_height
+       + (1 << iplane->ydec) - 1) >> iplane->ydec);
+    }
+  }
+  return OD_SUCCESS;
+}
+
+/*Decimates the luma plane of an image with a box filter, extending the edges
+   of the picture into the padding.*/
+static void od_la_decimate(od_lookahead *la, unsigned char *dst,
+ const od_img *img) {
+  const od_img_plane *iplane;
+  int w;
+  int h;
+  int x;
+  int y;
+  int i;
+  int j;
+  iplane = img->planes + 0;
+  w = (img->width + (1 << iplane->xdec) - 1) >> iplane->xdec;
+  h = (img->height + (1 << iplane->ydec) - 1) >> iplane->ydec;
+  for (y = -OD_LA_RANGE; y < la->small_h + OD_LA_RANGE; y++) {
+    unsigned char *drow;
+    drow = dst + y*la->small_stride;
+    for (x = -OD_LA_RANGE; x < la->small_w + OD_LA_RANGE; x++) {
+      int sum;
+      sum = 0;
+      for (j = 0; j < 1 << OD_LA_LOG_DEC; j++) {
+        const unsigned char *srow;
+        srow = iplane->data
+         + OD_CLAMPI(0, (y << OD_LA_LOG_DEC) + j, h - 1)*iplane->ystride;
+        for (i = 0; i < 1 << OD_LA_LOG_DEC; i++) {
+          sum += srow[OD_CLAMPI(0, (x << OD_LA_LOG_DEC) + i, w - 1)];
+        }
+      }
+      drow[x] = (unsigned char)((sum + (1 << (2*OD_LA_LOG_DEC - 1)))
+       >> 2*OD_LA_LOG_DEC);
+    }
+  }
+}
+
+/*Estimates the cost of coding a frame as a keyframe and as an inter frame
+   from its decimated luma plane, and decides if it is a scene cut.
+  Each block is compared against its own mean, as a stand-in for intra
+   prediction, and against the best match within OD_LA_RANGE pixels in the
+   previous frame.*/
+static void od_la_analyze(od_lookahead *la, od_la_frame *frame) {
+  const unsigned char *p[OD_MC_SAD_NREFS_MAX];
+  ogg_int32_t sads[OD_MC_SAD_NREFS_MAX];
+  unsigned char *cur;
+  const unsigned char *prev;
+  ogg_int32_t inter_sad;
+  int stride;
+  int nbx;
+  int nby;
+  int bx;
+  int by;
+  stride = la->small_stride;
+  cur = la->small_buf[la->nanalyzed & 1] + OD_LA_RANGE*stride + OD_LA_RANGE;
+  prev = la->small_buf[!(la->nanalyzed & 1)]
+   + OD_LA_RANGE*stride + OD_LA_RANGE;
+  od_la_decimate(la, cur, &frame->img);
+  nbx = la->small_w >> OD_LA_LOG_BSZ;
+  nby = la->small_h >> OD_LA_LOG_BSZ;
+  frame->intra_cost = 0;
+  frame->inter_cost = 0;
+  inter_sad = 0;
+  for (by = 0; by < nby; by++) {
+    for (bx = 0; bx < nbx; bx++) {
+      const unsigned char *src;
+      ogg_int32_t intra;
+      ogg_int32_t inter;
+      int mean;
+      int i;
+      int j;
+      src = cur + (by << OD_LA_LOG_BSZ)*stride + (bx << OD_LA_LOG_BSZ);
+      mean = 0;
+      for (j = 0; j < 1 << OD_LA_LOG_BSZ; j++) {
+        for (i = 0; i < 1 << OD_LA_LOG_BSZ; i++) mean += src[j*stride + i];
+      }
+      mean = (mean + (1 << (2*OD_LA_LOG_BSZ - 1))) >> 2*OD_LA_LOG_BSZ;
+      intra = 0;
+      for (j = 0; j < 1 << OD_LA_LOG_BSZ; j++) {
+        for (i = 0; i < 1 << OD_LA_LOG_BSZ; i++) {
+          intra += abs(src[j*stride + i] - mean);
+        }
+      }
+      frame->intra_cost += intra;
+      if (la->nanalyzed > 0) {
+        int dx;
+        int dy;
+        int np;
+        inter = 0x7FFFFFFF;
+        for (dy = -OD_LA_RANGE; dy <= OD_LA_RANGE; dy++) {
+          for (dx = -OD_LA_RANGE; dx <= OD_LA_RANGE; dx += np) {
+            np = OD_MINI(OD_LA_RANGE - dx + 1, OD_MC_SAD_NREFS_MAX);
+            for (i = 0; i < np; i++) {
+              p[i] = prev + ((by << OD_LA_LOG_BSZ) + dy)*stride
+               + (bx << OD_LA_LOG_BSZ) + dx + i;
+            }
+            (*la->state->opt_vtbl.mc_sad_multi8)(sads, src, stride, p, np,
+             stride, 1, OD_LA_LOG_BSZ);
+            for (i = 0; i < np; i++) inter = OD_MINI(inter, sads[i]);
+          }
+        }
+        inter_sad += inter;
+        frame->inter_cost += OD_MINI(intra, inter);
+      }
+    }
+  }
+  if (la->nanalyzed == 0) {
+    frame->inter_cost = frame->intra_cost;
+    frame->scene_cut = 0;
+  }
+  else {
+    frame->scene_cut = frame->inter_cost*(ogg_int64_t)OD_LA_CUT_DEN
+     > frame->intra_cost*(ogg_int64_t)OD_LA_CUT_NUM
+     && inter_sad >= (OD_LA_CUT_MIN_SAD*nbx*nby << 2*OD_LA_LOG_BSZ);
+  }
+  la->nanalyzed++;
+}
+
+/*Adds a copy of an image to the end of the queue and analyzes it.
+  The queue must not be full.*/
+void od_la_push(od_lookahead *la, const od_img *img, int duration) {
+  od_la_frame *frame;
+  int pli;
+  OD_ASSERT(la->depth > 0 && la->nframes <= la->depth);
+  frame = la->frames + (la->head + la->nframes) % (la->depth + 1);
+  for (pli = 0; pli < frame->img.nplanes; pli++) {
+    const od_img_plane *splane;
+    od_img_plane *dplane;
+    const unsigned char *src;
+    unsigned char *dst;
+    int plane_w;
+    int plane_h;
+    int x;
+    int y;
+    splane = img->planes + pli;
+    dplane = frame->img.planes + pli;
+    plane_w = (frame->img.width + (1 << dplane->xdec) - 1) >> dplane->xdec;
+    plane_h = (frame->img.height + (1 << dplane->ydec) - 1) >> dplane->ydec;
+    src = splane->data;
+    dst = dplane->data;
+    for (y = 0; y < plane_h; y++) {
+      if (splane->xstride == 1) memcpy(dst, src, plane_w);
+      else for (x = 0; x < plane_w; x++) dst[x] = src[x*splane->xstride];
+      src += splane->ystride;
+      dst += dplane->ystride;
+    }
+  }
+  frame->duration = duration;
+  od_la_analyze(la, frame);
+  la->nframes++;
+}
+
+/*Decides which of the frames in the queue should be keyframes, and fills in
+   their estimated costs.
+  A keyframe goes at every scene cut and keyframe_rate frames after the last
+   keyframe, except that a regular keyframe is put off if there is a scene cut
+   later in the queue, since that will need a keyframe anyway.
+  Returns the number of frames planned.*/
+int od_la_plan_frames(const od_lookahead *la, od_la_plan *plan) {
+  int keyframe_rate;
+  int since_key;
+  int fi;
+  int fj;
+  keyframe_rate = OD_MAXI(la->state->info.keyframe_rate, 1);
+  since_key = la->since_key;
+  for (fi = 0; fi < la->nframes; fi++) {
+    const od_la_frame *frame;
+    int is_keyframe;
+    frame = la->frames + (la->head + fi) % (la->depth + 1);
+    is_keyframe = since_key < 0 || frame->scene_cut;
+    if (!is_keyframe && since_key >= keyframe_rate) {
+      is_keyframe = 1;
+      for (fj = fi + 1; fj < la->nframes; fj++) {
+        if (la->frames[(la->head + fj) % (la->depth + 1)].scene_cut) {
+          is_keyframe = 0;
+          break;
+        }
+      }
+    }
+    plan[fi].is_keyframe = is_keyframe;
+    plan[fi].cost = is_keyframe ? frame->intra_cost : frame->inter_cost;
+    since_key = is_keyframe ? 1 : since_key + 1;
+  }
+  return la->nframes;
+}
+
+/*Removes the oldest frame from the queue, once it has been decided whether
+   it is a keyframe.
+  The frame stays valid until the next call to od_la_push().*/
+od_la_frame *od_la_pop(od_lookahead *la, int is_keyframe) {
+  od_la_frame *frame;
+  OD_ASSERT(la->nframes > 0);
+  frame = la->frames + la->head;
+  la->head = (la->head + 1) % (la->depth + 1);
+  la->nframes--;
+  la->since_key = is_keyframe ? 1 : la->since_key + 1;
+  return frame;
+}
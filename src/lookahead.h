@@ -0,0 +1,95 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#if !defined(_lookahead_H)
+# define _lookahead_H (1)
+# include "state.h"
+
+typedef struct od_la_plan od_la_plan;
+typedef struct od_la_frame od_la_frame;
+typedef struct od_lookahead od_lookahead;
+
+/*The most frames the lookahead can hold.*/
+# define OD_LA_DEPTH_MAX (32)
+
+/*The frame type and cost the lookahead plans for an upcoming frame.*/
+struct od_la_plan {
+  int is_keyframe;
+  /*An estimate of how many bits the frame takes, in arbitrary units.
+    This is only meaningful relative to other frames of the same type.*/
+  ogg_int32_t cost;
+};
+
+/*A frame waiting in the lookahead.*/
+struct od_la_frame {
+  /*A copy of the input image, at the picture size.*/
+  od_img img;
+  unsigned char *buf;
+  int duration;
+  /*The total SAD of the blocks of the decimated luma plane against their
+     means.*/
+  ogg_int32_t intra_cost;
+  /*The total SAD of the blocks against their best matches in the previous
+     frame, counting the SAD against the mean instead where it is smaller.*/
+  ogg_int32_t inter_cost;
+  /*Whether this frame starts a new scene.*/
+  int scene_cut;
+};
+
+/*A queue of input frames, analyzed at a reduced resolution as they arrive so
+   that keyframes can be placed at scene cuts and the rate control knows what
+   is coming.*/
+struct od_lookahead {
+  const od_state *state;
+  /*The number of frames to hold before coding the oldest one, or 0 to code
+     each frame as soon as it arrives.*/
+  int depth;
+  /*A ring buffer of depth + 1 frames.*/
+  od_la_frame *frames;
+  /*The index of the oldest frame.*/
+  int head;
+  /*The number of frames in the queue.*/
+  int nframes;
+  /*The luma planes of the newest frame and the one before it, decimated by
+     a factor of 4 in each direction, with room for the motion search around
+     the edges.*/
+  unsigned char *small_buf[2];
+  int small_w;
+  int small_h;
+  int small_stride;
+  /*The number of frames analyzed so far.*/
+  ogg_int64_t nanalyzed;
+  /*The number of frames from the last keyframe to the oldest frame in the
+     queue, or -1 before the first frame.*/
+  int since_key;
+};
+
+void od_la_init(od_lookahead *la, const od_state *state);
+void od_la_clear(od_lookahead *la);
+int od_la_set_depth(od_lookahead *la, int depth);
+void od_la_push(od_lookahead *la, const od_img *img, int duration);
+int od_la_plan_frames(const od_lookahead *la, od_la_plan *plan);
+od_la_frame *od_la_pop(od_lookahead *la, int is_keyframe);
+
+#endif
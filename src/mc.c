@@ -24,6 +24,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 #include <stdio.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include "logging.h"
 #include "mc.h"
 
@@ -271,6 +272,36 @@ static void od_mc_predict1fmv8(od_state *state, unsigned char *dst,
    log_xblk_sz, log_yblk_sz);
 }
 
+/*Computes the SAD of a square block of the input against a predictor.
+  The predictor samples are _rxstride bytes apart, so that blocks can be read
+   directly out of the upsampled reference images.*/
+ogg_int32_t od_mc_sad8_c(const unsigned char *src, int systride,
+ const unsigned char *ref, int rystride, int rxstride, int log_blk_sz) {
+  ogg_int32_t ret;
+  int blk_sz;
+  int i;
+  int j;
+  blk_sz = 1 << log_blk_sz;
+  ret = 0;
+  for (j = 0; j < blk_sz; j++) {
+    for (i = 0; i < blk_sz; i++) ret += abs(ref[i*rxstride] - src[i]);
+    src += systride;
+    ref += rystride;
+  }
+  return ret;
+}
+
+/*Computes the SADs of one block of the input against several predictors.*/
+void od_mc_sad_multi8_c(ogg_int32_t *sads, const unsigned char *src,
+ int systride, const unsigned char *const *ref, int nref, int rystride,
+ int rxstride, int log_blk_sz) {
+  int ri;
+  for (ri = 0; ri < nref; ri++) {
+    sads[ri] = od_mc_sad8_c(src, systride, ref[ri], rystride, rxstride,
+     log_blk_sz);
+  }
+}
+
 /*Perform normal bilinear blending.*/
 void od_mc_blend_full8_c(unsigned char *dst, int dystride,
  const unsigned char *src[4], int log_xblk_sz, int log_yblk_sz) {
@@ -522,7 +553,7 @@ static void od_mc_blend_multi8(unsigned char *dst, int dystride,
 #else
 
 /*Perform multiresolution bilinear blending.*/
-static void od_mc_blend_multi8(unsigned char *dst, int dystride,
+void od_mc_blend_multi8_c(unsigned char *dst, int dystride,
  const unsigned char *src[4], int log_xblk_sz, int log_yblk_sz) {
   unsigned char src_ll[4][8][8];
   int dst_ll[8][8];
@@ -593,16 +624,23 @@ static void od_mc_blend_multi8(unsigned char *dst, int dystride,
       }
     }
   }
-  /*Blend the low-pass bands.*/
-  for (j = 0; j < xblk_sz_2; j++) {
-    for (i = 0; i < xblk_sz_2; i++) {
+  /*Blend the low-pass bands.
+    The blocks are at least 4x4, so every entry the high-pass filtering reads
+     below is set.*/
+  OD_ASSERT(log_xblk_sz >= 2 && log_yblk_sz >= 2);
+  j = 0;
+  do {
+    i = 0;
+    do {
       a = (src_ll[0][j][i] << (log_xblk_sz - 1))
        + (src_ll[1][j][i] - src_ll[0][j][i])*i;
       b = (src_ll[3][j][i] << (log_xblk_sz - 1))
        + (src_ll[2][j][i] - src_ll[3][j][i])*i;
       dst_ll[j][i] = (a << (log_yblk_sz - 1)) + (b - a)*j;
     }
+    while (++i < xblk_sz_2);
   }
+  while (++j < yblk_sz_2);
   /*Perform the high-pass filtering for each quadrant.*/
   xblk_sz_4 = xblk_sz >> 2;
   yblk_sz_4 = yblk_sz >> 2;
@@ -2088,8 +2126,10 @@ static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
 }
 #else
 /*Sets up a second set of image pointers based on the given split state to
-   properly shift weight from one image to another.*/
-static void od_mc_setup_split_ptrs(const unsigned char *drc[4],
+   properly shift weight from one image to another.
+  Each predictor is averaged with that of the outside corner for the vertices
+   at the ends of an unsplit edge, or with itself otherwise.*/
+void od_mc_setup_split_ptrs(const unsigned char *drc[4],
  const unsigned char *src[4], int oc, int s) {
   int j;
   int k;
@@ -2105,7 +2145,7 @@ static void od_mc_setup_split_ptrs(const unsigned char *drc[4],
 }
 
 /*Perform multiresolution bilinear blending.*/
-static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
+void od_mc_blend_multi_split8_c(unsigned char *dst, int dystride,
  const unsigned char *src[4], int oc, int s,
  int log_xblk_sz, int log_yblk_sz) {
   unsigned char src_ll[4][8][8];
@@ -2174,7 +2214,7 @@ static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
       }
       p += xblk_sz;
       q += xblk_sz;
-      lh[j2 + 1][0] = p[0] << 2;
+      lh[j2 + 1][0] = (p[0] + q[0]) << 2;
       for (i = 1; i < xblk_sz_2; i++) {
         i2 = i << 1;
         lh[j2 + 1][i] = p[i2 - 1] + q[i2 - 1]
@@ -2188,16 +2228,23 @@ static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
       }
     }
   }
-  /*Blend the low-pass bands.*/
-  for (j = 0; j < xblk_sz_2; j++) {
-    for (i = 0; i < xblk_sz_2; i++) {
+  /*Blend the low-pass bands.
+    The blocks are at least 4x4, so every entry the high-pass filtering reads
+     below is set.*/
+  OD_ASSERT(log_xblk_sz >= 2 && log_yblk_sz >= 2);
+  j = 0;
+  do {
+    i = 0;
+    do {
       a = (src_ll[0][j][i] << (log_xblk_sz - 1))
        + (src_ll[1][j][i] - src_ll[0][j][i])*i;
       b = (src_ll[3][j][i] << (log_xblk_sz - 1))
        + (src_ll[2][j][i] - src_ll[3][j][i])*i;
       dst_ll[j][i] = (a << (log_yblk_sz - 1)) + (b - a)*j;
     }
+    while (++i < xblk_sz_2);
   }
+  while (++j < yblk_sz_2);
   /*Perform the high-pass filtering for each quadrant.*/
   xblk_sz_4 = xblk_sz >> 2;
   yblk_sz_4 = yblk_sz >> 2;
@@ -2348,10 +2395,10 @@ static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
     h = (3*(src_ll[2][j][i] + src_ll[2][j + 1][i])
      - (src_ll[2][j][i - 1] + src_ll[2][j + 1][i - 1])) << (log_blk_sz2 - 2);
     dst[i2] = OD_CLAMP255(
-     ((((src[2] + o)[i2] + (drc[2] + o)[i2 + 1]) << (log_blk_sz2 - 1))
+     ((((src[2] + o)[i2] + (drc[2] + o)[i2]) << (log_blk_sz2 - 1))
      + a - e + round) >> log_blk_sz2);
     dst[i2 + 1] = OD_CLAMP255(
-     ((((src[2] + o)[i2 + 1] + (drc[2] + o)[i2]) << (log_blk_sz2 - 1))
+     ((((src[2] + o)[i2 + 1] + (drc[2] + o)[i2 + 1]) << (log_blk_sz2 - 1))
      + b - f + round) >> log_blk_sz2);
     (dst + dystride)[i2] = OD_CLAMP255(((((src[2] + o + xblk_sz)[i2] +
      (drc[2] + o + xblk_sz)[i2]) << (log_blk_sz2 - 1))
@@ -2444,13 +2491,14 @@ static void od_mc_blend_multi_split8(unsigned char *dst, int dystride,
 static void od_mc_blend8(od_state *state, unsigned char *dst, int dystride,
  const unsigned char *src[4], int oc, int s,
  int log_xblk_sz, int log_yblk_sz) {
-  if (0 && log_xblk_sz > 1 && log_yblk_sz > 1) {
+  if (state->multires_blend && log_xblk_sz > 1 && log_yblk_sz > 1) {
     /*Perform multiresolution blending.*/
     if (s == 3) {
-      od_mc_blend_multi8(dst, dystride, src, log_xblk_sz, log_yblk_sz);
+      (*state->opt_vtbl.mc_blend_multi8)(dst, dystride, src,
+       log_xblk_sz, log_yblk_sz);
     }
     else {
-      od_mc_blend_multi_split8(dst, dystride, src,
+      (*state->opt_vtbl.mc_blend_multi_split8)(dst, dystride, src,
        oc, s, log_xblk_sz, log_yblk_sz);
     }
   }
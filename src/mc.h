@@ -158,5 +158,7 @@ void od_mc_predict8(od_state *state, unsigned char *dst, int dystride,
  const ogg_int32_t mvy[4], int interp_type, int oc, int s,
  int log_xblk_sz, int log_yblk_sz);
 void od_state_mvs_clear(od_state *state);
+void od_mc_setup_split_ptrs(const unsigned char *drc[4],
+ const unsigned char *src[4], int oc, int s);
 
 #endif
@@ -50,11 +50,16 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 #define OD_MC_USEV (1 << 1)
 /*Flag indicating we include the chroma planes in our SAD calculations.*/
 #define OD_MC_USE_CHROMA (1 << 2)
+/*Flag indicating we seed EPZS^2 with a coarse-to-fine pyramid search.*/
+#define OD_MC_USE_PYRAMID (1 << 3)
 
 typedef struct od_mv_node od_mv_node;
 typedef struct od_mv_dp_state od_mv_dp_state;
 typedef struct od_mv_dp_node od_mv_dp_node;
 typedef struct od_mv_err_node od_mv_err_node;
+typedef struct od_mv_est_worker od_mv_est_worker;
+typedef struct od_mv_est_job od_mv_est_job;
+typedef struct od_mv_pyr_plane od_mv_pyr_plane;
 
 #include "logging.h"
 #include "mc.h"
@@ -167,6 +172,36 @@ struct od_mv_dp_node {
   od_mv_node *predicted_mvs[OD_DP_NPREDICTED_MAX];
 };
 
+/*The number of decimated levels in the pyramid search.*/
+#define OD_MC_PYR_NLEVELS (2)
+/*The amount of edge extension around each decimated plane.*/
+#define OD_MC_PYR_PADDING (16)
+/*The largest MV searched at the coarsest pyramid level, in its own pixels.*/
+#define OD_MC_PYR_RANGE (8)
+
+/*A luma plane decimated by a power of two, with OD_MC_PYR_PADDING pixels of
+   edge extension on every side.*/
+struct od_mv_pyr_plane {
+  unsigned char *buf;
+  unsigned char *data;
+  int ystride;
+  int width;
+  int height;
+};
+
+/*The scratch space used by each thread running motion estimation.*/
+struct od_mv_est_worker {
+  /*Flags indicating which MVs have already been tested during the initial
+     EPZS^2 pass.*/
+  unsigned char hit_cache[64][64];
+  /*The flag used by the current EPZS^2 search iteration.*/
+  unsigned hit_bit;
+  /*Space for storing the Viterbi trellis used for DP refinment.*/
+  od_mv_dp_node *dp_nodes;
+  /*The total change in cost from the rows or columns this thread refined.*/
+  ogg_int32_t dcost;
+};
+
 struct od_mv_est_ctx {
   od_enc_ctx *enc;
   /*A cache of the SAD values used during decimation.
@@ -180,8 +215,16 @@ struct od_mv_est_ctx {
   /*A temporary copy of the decoder-side MV grid used to save-and-restore the
      MVs when attempting sub-pel refinement.*/
   od_mv_grid_pt **refine_grid;
-  /*Space for storing the Viterbi trellis used for DP refinment.*/
-  od_mv_dp_node *dp_nodes;
+  /*The scratch space for each thread.*/
+  od_mv_est_worker *workers;
+  int nworkers;
+  /*The progress of the initial EPZS^2 pass through each row of MVBs.*/
+  od_row_sync mvb_rows;
+  /*The input and reference luma planes decimated by 2 and 4 in each
+     direction, indexed by [level - 1][0 for input, 1 for reference].*/
+  od_mv_pyr_plane pyr[OD_MC_PYR_NLEVELS][2];
+  /*The whole-pel MV found by the pyramid search for each macro block.*/
+  od_offset **pyr_mvs;
   /*The decimation heap.*/
   od_mv_node **dec_heap;
   /*The number of vertices in the decimation heap.*/
@@ -196,11 +239,6 @@ struct od_mv_est_ctx {
   int thresh2_offs[3];
   /*The weights used to produce the accelerated MV predictor.*/
   ogg_int32_t mvapw[2][2];
-  /*Flags indicating which MVs have already been tested during the initial
-     EPZS^2 pass.*/
-  unsigned char hit_cache[64][64];
-  /*The flag used by the current EPZS search iteration.*/
-  unsigned hit_bit;
   /*The Lagrangian multiplier used for R-D optimization.*/
   int lambda;
   /*Configuration.*/
@@ -212,8 +250,42 @@ struct od_mv_est_ctx {
   int level_max;
   /*The shallowest level to decimate to (inclusive).*/
   int level_min;
+  /*The maximum number of refinement passes to make at each resolution.*/
+  int refine_max;
+  /*The number of bits to scale the EPZS^2 termination thresholds up by.*/
+  int thresh_shift;
 };
 
+/*The number of encoder speed settings.*/
+#define OD_MC_NSPEEDS (5)
+
+/*The motion estimation configuration for each encoder speed.*/
+static const struct {
+  int flags;
+  int mv_res_min;
+  int level_max;
+  int level_min;
+  int refine_max;
+  int thresh_shift;
+} OD_MC_SPEEDS[OD_MC_NSPEEDS] = {
+  /*Full search (the default).*/
+  { OD_MC_USEB | OD_MC_USE_CHROMA | OD_MC_USE_PYRAMID, 0, 2, 0, INT_MAX, 0 },
+  /*Luma only, and no 1/8 pel MVs.*/
+  { OD_MC_USEB | OD_MC_USE_PYRAMID, 1, 2, 0, 4, 0 },
+  /*Half pel MVs, and stop EPZS^2 earlier.*/
+  { OD_MC_USEB | OD_MC_USE_PYRAMID, 2, 2, 0, 2, 1 },
+  /*No 8x8 blocks.*/
+  { OD_MC_USEB | OD_MC_USE_PYRAMID, 2, 1, 0, 1, 2 },
+  /*Only 32x32 blocks, with a single pass of refinement.*/
+  { OD_MC_USEB | OD_MC_USE_PYRAMID, 2, 0, 0, 1, 3 }
+};
+
+/*The distance between rows (or columns) of the mesh that are refined at the
+   same time.
+  The DP for one row reads and writes MVs and blocks up to 12 rows away from
+   it, so this leaves a safe margin.*/
+#define OD_MC_REFINE_STRIDE (32)
+
 /*The number of bits to reduce chroma SADs by, if used.*/
 #define OD_MC_CHROMA_SCALE (2)
 
@@ -291,6 +363,29 @@ static const od_offset *OD_ANCESTORS[4][4] = {
   { OD_ANCESTORS4[6], OD_ANCESTORS3[2], OD_ANCESTORS4[7], OD_ANCESTORS3[3] }
 };
 
+/*Returns the log of the size of a block in the given plane, if it is square
+   and lies entirely inside the picture, or -1 if it has to be clipped.*/
+static int od_state_sad8_log_sz(od_state *state, int pli, int x, int y,
+ int log_blk_sz) {
+  od_img_plane *iplane;
+  int log_w;
+  iplane = state->input.planes + pli;
+  log_w = log_blk_sz - iplane->xdec;
+  if (log_w != log_blk_sz - iplane->ydec) return -1;
+  x >>= iplane->xdec;
+  y >>= iplane->ydec;
+  if (x < 0 || y < 0) return -1;
+  if (x + (1 << log_w) > ((state->info.pic_width + (1 << iplane->xdec) - 1)
+   >> iplane->xdec)) {
+    return -1;
+  }
+  if (y + (1 << log_w) > ((state->info.pic_height + (1 << iplane->ydec) - 1)
+   >> iplane->ydec)) {
+    return -1;
+  }
+  return log_w;
+}
+
 /*Computes the SAD of the input image against the given predictor.*/
 static ogg_int32_t od_state_sad8(od_state *state, const unsigned char *p,
  int pystride, int pxstride, int pli, int x, int y, int log_blk_sz) {
@@ -301,12 +396,20 @@ static ogg_int32_t od_state_sad8(od_state *state, const unsigned char *p,
   int clipy;
   int clipw;
   int cliph;
+  int log_sz;
   int w;
   int h;
   int i;
   int j;
   ogg_int32_t ret;
   iplane = state->input.planes + pli;
+  log_sz = od_state_sad8_log_sz(state, pli, x, y, log_blk_sz);
+  if (log_sz >= 0) {
+    /*Only blocks on the edge of the picture need the clipped path below.*/
+    return (*state->opt_vtbl.mc_sad8)(iplane->data
+     + (y >> iplane->ydec)*iplane->ystride + (x >> iplane->xdec),
+     iplane->ystride, p, pystride, pxstride, log_sz);
+  }
   /*Compute the block dimensions in the target image plane.*/
   x >>= iplane->xdec;
   y >>= iplane->ydec;
@@ -348,11 +451,75 @@ static ogg_int32_t od_state_sad8(od_state *state, const unsigned char *p,
   return ret;
 }
 
+/*Computes the SADs of one block of the input image against several
+   predictors at once.*/
+static void od_state_sad8_multi(od_state *state, ogg_int32_t *sads,
+ const unsigned char *const *p, int np, int pystride, int pxstride, int pli,
+ int x, int y, int log_blk_sz) {
+  od_img_plane *iplane;
+  int log_sz;
+  int pi;
+  iplane = state->input.planes + pli;
+  log_sz = od_state_sad8_log_sz(state, pli, x, y, log_blk_sz);
+  if (log_sz >= 0) {
+    (*state->opt_vtbl.mc_sad_multi8)(sads, iplane->data
+     + (y >> iplane->ydec)*iplane->ystride + (x >> iplane->xdec),
+     iplane->ystride, p, np, pystride, pxstride, log_sz);
+  }
+  else {
+    for (pi = 0; pi < np; pi++) {
+      sads[pi] = od_state_sad8(state, p[pi], pystride, pxstride, pli,
+       x, y, log_blk_sz);
+    }
+  }
+}
+
+static void od_mv_est_free_workers(od_mv_est_ctx *est) {
+  int ti;
+  for (ti = 0; ti < est->nworkers; ti++) _ogg_free(est->workers[ti].dp_nodes);
+  _ogg_free(est->workers);
+  est->workers = NULL;
+  est->nworkers = 0;
+}
+
+/*Makes sure there is scratch space for each of the encoder's threads.*/
+static void od_mv_est_alloc_workers(od_mv_est_ctx *est) {
+  int nthreads;
+  int nhmvbs;
+  int nvmvbs;
+  int ti;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
+  if (est->nworkers == nthreads) return;
+  od_mv_est_free_workers(est);
+  nhmvbs = (est->enc->state.nhmbs + 1) << 2;
+  nvmvbs = (est->enc->state.nvmbs + 1) << 2;
+  est->workers = (od_mv_est_worker *)_ogg_malloc(
+   sizeof(*est->workers)*nthreads);
+  for (ti = 0; ti < nthreads; ti++) {
+    est->workers[ti].hit_bit = 0;
+    est->workers[ti].dp_nodes = (od_mv_dp_node *)_ogg_malloc(
+     sizeof(od_mv_dp_node)*(OD_MAXI(nhmvbs, nvmvbs) + 1));
+  }
+  est->nworkers = nthreads;
+}
+
+/*Runs a job on each of the encoder's threads, or on this one if there are
+   none, and waits for it to finish.*/
+static void od_mv_est_run(od_mv_est_ctx *est, od_thread_func func, void *ctx) {
+  if (est->enc->threads != NULL) {
+    od_thread_pool_start(est->enc->threads, func, ctx);
+    od_thread_pool_join(est->enc->threads);
+  }
+  else (*func)(ctx, 0);
+}
+
 static void od_mv_est_init(od_mv_est_ctx *est, od_enc_ctx *enc) {
   int nhmvbs;
   int nvmvbs;
   int vx;
   int vy;
+  int li;
+  int ii;
   est->enc = enc;
   nhmvbs = (enc->state.nhmbs + 1) << 2;
   nvmvbs = (enc->state.nvmbs + 1) << 2;
@@ -364,8 +531,24 @@ static void od_mv_est_init(od_mv_est_ctx *est, od_enc_ctx *enc) {
    sizeof(est->mvs[0][0]));
   est->refine_grid = (od_mv_grid_pt **)od_malloc_2d(nvmvbs + 1, nhmvbs + 1,
    sizeof(est->refine_grid[0][0]));
-  est->dp_nodes = (od_mv_dp_node *)_ogg_malloc(
-   sizeof(od_mv_dp_node)*(OD_MAXI(nhmvbs, nvmvbs) + 1));
+  est->workers = NULL;
+  est->nworkers = 0;
+  od_row_sync_init(&est->mvb_rows, enc->state.nvmbs + 1);
+  for (li = 0; li < OD_MC_PYR_NLEVELS; li++) {
+    for (ii = 0; ii < 2; ii++) {
+      od_mv_pyr_plane *pplane;
+      pplane = est->pyr[li] + ii;
+      pplane->width = enc->state.frame_width >> (li + 1);
+      pplane->height = enc->state.frame_height >> (li + 1);
+      pplane->ystride = pplane->width + (OD_MC_PYR_PADDING << 1);
+      pplane->buf = (unsigned char *)_ogg_malloc(sizeof(*pplane->buf)
+       *pplane->ystride*(pplane->height + (OD_MC_PYR_PADDING << 1)));
+      pplane->data = pplane->buf
+       + OD_MC_PYR_PADDING*pplane->ystride + OD_MC_PYR_PADDING;
+    }
+  }
+  est->pyr_mvs = (od_offset **)od_malloc_2d(enc->state.nvmbs,
+   enc->state.nhmbs, sizeof(est->pyr_mvs[0][0]));
   est->row_counts =
    (unsigned *)_ogg_malloc(sizeof(*est->row_counts)*(nvmvbs + 1));
   est->col_counts =
@@ -380,19 +563,21 @@ static void od_mv_est_init(od_mv_est_ctx *est, od_enc_ctx *enc) {
   }
   est->dec_heap = (od_mv_node **)_ogg_malloc(
    sizeof(*est->dec_heap)*(nvmvbs + 1)*(nhmvbs + 1));
-  est->hit_bit = 0;
-  /*TODO: Allow configuration.*/
-  est->mv_res_min = 0;
-  est->flags = OD_MC_USEB | OD_MC_USE_CHROMA;
-  est->level_max = 2;
-  est->level_min = 0;
+  od_mv_est_set_speed(est, 0);
 }
 
 static void od_mv_est_clear(od_mv_est_ctx *est) {
+  int li;
   _ogg_free(est->dec_heap);
   _ogg_free(est->col_counts);
   _ogg_free(est->row_counts);
-  _ogg_free(est->dp_nodes);
+  od_free_2d(est->pyr_mvs);
+  for (li = 0; li < OD_MC_PYR_NLEVELS; li++) {
+    _ogg_free(est->pyr[li][0].buf);
+    _ogg_free(est->pyr[li][1].buf);
+  }
+  od_mv_est_free_workers(est);
+  od_row_sync_clear(&est->mvb_rows);
   od_free_2d(est->refine_grid);
   od_free_2d(est->mvs);
   od_free_2d(est->sad_cache[0]);
@@ -632,20 +817,27 @@ static const int OD_SEARCH_STATES[6][13] = {
 };
 #endif
 
-/*Clear the cache of motion vectors we've examined.*/
-static void od_mv_est_clear_hit_cache(od_mv_est_ctx *est) {
-  if (est->hit_bit++ == 0) memset(est->hit_cache, 0, sizeof(est->hit_cache));
-  else est->hit_bit &= UCHAR_MAX;
+/*Clear the cache of motion vectors we've examined.
+  A hit_bit of 0 would match every entry not marked since the last memset(),
+   so when the counter runs out, clear the cache and start again at 1.
+  This keeps the search for each block from depending on how many blocks the
+   same worker searched before it.*/
+static void od_mv_est_clear_hit_cache(od_mv_est_worker *worker) {
+  if (worker->hit_bit == 0 || worker->hit_bit >= UCHAR_MAX) {
+    memset(worker->hit_cache, 0, sizeof(worker->hit_cache));
+    worker->hit_bit = 1;
+  }
+  else worker->hit_bit++;
 }
 
 /*Test if a motion vector has been examined.*/
-static int od_mv_est_is_hit(od_mv_est_ctx *est, int mvx, int mvy) {
-  return est->hit_cache[mvy + 32][mvx + 32] == est->hit_bit;
+static int od_mv_est_is_hit(od_mv_est_worker *worker, int mvx, int mvy) {
+  return worker->hit_cache[mvy + 32][mvx + 32] == worker->hit_bit;
 }
 
 /*Mark a motion vector examined.*/
-static void od_mv_est_set_hit(od_mv_est_ctx *est, int mvx, int mvy) {
-  est->hit_cache[mvy + 32][mvx + 32] = (unsigned char)est->hit_bit;
+static void od_mv_est_set_hit(od_mv_est_worker *worker, int mvx, int mvy) {
+  worker->hit_cache[mvy + 32][mvx + 32] = (unsigned char)worker->hit_bit;
 }
 
 /*Gets the predictor for a given MV node at the given MV resolution.*/
@@ -825,6 +1017,44 @@ static ogg_int32_t od_mv_est_bma_sad8(od_mv_est_ctx *est,
   return ret;
 }
 
+/*Computes the SADs of a whole-pel BMA block for several MVs at once.*/
+static void od_mv_est_bma_sads8(od_mv_est_ctx *est, ogg_int32_t *sads,
+ int ref, int bx, int by, const int (*mvs)[2], int nmvs, int log_mvb_sz) {
+  od_state *state;
+  od_img_plane *iplane;
+  const unsigned char *p[OD_MC_SAD_NREFS_MAX];
+  ogg_int32_t psads[OD_MC_SAD_NREFS_MAX];
+  int refi;
+  int pbx;
+  int pby;
+  int pli;
+  int mvi;
+  OD_ASSERT(nmvs <= OD_MC_SAD_NREFS_MAX);
+  state = &est->enc->state;
+  refi = state->ref_imgi[ref];
+  for (pli = 0; pli < state->input.nplanes; pli++) {
+    if (pli > 0 && !(est->flags & OD_MC_USE_CHROMA)) break;
+    iplane = state->ref_imgs[refi].planes + pli;
+    pbx = (bx + (1 << iplane->xdec) - 1) & ~((1 << iplane->xdec) - 1);
+    pby = (by + (1 << iplane->ydec) - 1) & ~((1 << iplane->ydec) - 1);
+    for (mvi = 0; mvi < nmvs; mvi++) {
+      int dx;
+      int dy;
+      dx = (pbx << 1 >> iplane->xdec)
+       + OD_DIV_POW2_RE(mvs[mvi][0] << 1, iplane->xdec);
+      dy = (pby << 1 >> iplane->ydec)
+       + OD_DIV_POW2_RE(mvs[mvi][1] << 1, iplane->ydec);
+      p[mvi] = iplane->data + dy*iplane->ystride + dx;
+    }
+    od_state_sad8_multi(state, psads, p, nmvs, iplane->ystride << 1, 2, pli,
+     pbx, pby, log_mvb_sz + 2);
+    for (mvi = 0; mvi < nmvs; mvi++) {
+      if (pli == 0) sads[mvi] = psads[mvi];
+      else sads[mvi] += psads[mvi] >> OD_MC_CHROMA_SCALE;
+    }
+  }
+}
+
 /*Computes the SAD of a block with the given parameters.*/
 static ogg_int32_t od_mv_est_sad8(od_mv_est_ctx *est,
  int ref, int vx, int vy, int oc, int s, int log_mvb_sz) {
@@ -959,7 +1189,8 @@ void od_mv_est_check_rd_state(od_mv_est_ctx *est, int ref, int mv_res) {
 static const unsigned char OD_YCbCr_MVCAND[3] = { 210, 16, 214 };
 #endif
 
-static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
+static void od_mv_est_init_mv(od_mv_est_ctx *est, od_mv_est_worker *worker,
+ int ref, int vx, int vy) {
   od_state *state;
   od_mv_grid_pt *mvg;
   od_mv_node *mv;
@@ -969,7 +1200,7 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
   ogg_int32_t best_sad;
   ogg_int32_t best_cost;
   int best_rate;
-  int cands[6][2];
+  int cands[7][2];
   int best_vec[2];
   int a[4][2];
   int level;
@@ -1092,7 +1323,7 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
     candx = OD_CLAMPI(mvxmin, a[1][0], mvxmax);
     candy = OD_CLAMPI(mvymin, a[1][1], mvymax);
   }
-  od_mv_est_clear_hit_cache(est);
+  od_mv_est_clear_hit_cache(worker);
 #if defined(OD_DUMP_IMAGES) && defined(OD_ANIMATE)
   if (animating) {
     od_img_draw_line(&state->vis_img, x0, y0,
@@ -1104,13 +1335,14 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
   best_cost = (best_sad << OD_LAMBDA_SCALE) + best_rate*est->lambda;
   OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG,
           "Median predictor: (%i, %i)   Cost: %i\n", candx, candy, best_cost));
-  od_mv_est_set_hit(est, candx, candy);
+  od_mv_est_set_hit(worker, candx, candy);
   best_vec[0] = candx;
   best_vec[1] = candy;
   OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Threshold: %i\n", est->thresh1[log_mvb_sz]));
   if (best_sad > est->thresh1[log_mvb_sz]) {
-    ogg_int32_t sad;
+    ogg_int32_t sads[OD_MC_SAD_NREFS_MAX];
     ogg_int32_t cost;
+    int ncands;
     int rate;
     /*Compute the early termination threshold for set B.*/
     t2 = mv->bma_sad;
@@ -1133,28 +1365,50 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
     cands[ncns][0] = 0;
     cands[ncns][1] = 0;
     ncns++;
+    /*Coarse-to-fine pyramid predictor.
+      Only level 0 blocks line up with the macro blocks the pyramid search
+       used; the finer levels pick its MVs up from their spatial predictors.*/
+    if ((est->flags & OD_MC_USE_PYRAMID) && level == 0) {
+      const int *pyr_mv;
+      pyr_mv = est->pyr_mvs[OD_MINI((vy >> 2) - 1, state->nvmbs - 1)]
+       [OD_MINI((vx >> 2) - 1, state->nhmbs - 1)];
+      cands[ncns][0] = OD_CLAMPI(mvxmin, pyr_mv[0], mvxmax);
+      cands[ncns][1] = OD_CLAMPI(mvymin, pyr_mv[1], mvymax);
+      ncns++;
+    }
     /*Examine the candidates in Set B.*/
+    ncands = 0;
     for (ci = 0; ci < ncns; ci++) {
       candx = cands[ci][0];
       candy = cands[ci][1];
       OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Set B predictor %i: (%i, %i) ", ci, candx, candy));
-      if (od_mv_est_is_hit(est, candx, candy)) {
+      if (od_mv_est_is_hit(worker, candx, candy)) {
         OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "...Skipping.\n"));
         continue;
       }
-      od_mv_est_set_hit(est, candx, candy);
+      OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "\n"));
+      od_mv_est_set_hit(worker, candx, candy);
 #if defined(OD_DUMP_IMAGES) && defined(OD_ANIMATE)
       if (animating) {
         od_img_draw_line(&state->vis_img, x0, y0,
          x0 + (candx << 1), y0 + (candy << 1), OD_YCbCr_MVCAND);
       }
 #endif
-      sad = od_mv_est_bma_sad8(est, ref, bx, by, candx, candy, log_mvb_sz);
+      cands[ncands][0] = candx;
+      cands[ncands][1] = candy;
+      ncands++;
+    }
+    /*Score all of the new candidates in a single pass over the block.*/
+    od_mv_est_bma_sads8(est, sads, ref, bx, by,
+     (const int (*)[2])cands, ncands, log_mvb_sz);
+    for (ci = 0; ci < ncands; ci++) {
+      candx = cands[ci][0];
+      candy = cands[ci][1];
       rate = od_mv_est_bits(candx << 1, candy << 1, predx, predy);
-      cost = (sad << OD_LAMBDA_SCALE) + rate*est->lambda;
-      OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "   Cost: %i\n", cost));
+      cost = (sads[ci] << OD_LAMBDA_SCALE) + rate*est->lambda;
+      OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Set B (%i, %i) Cost: %i\n", candx, candy, cost));
       if (cost < best_cost) {
-        best_sad = sad;
+        best_sad = sads[ci];
         best_rate = rate;
         best_cost = cost;
         best_vec[0] = candx;
@@ -1178,28 +1432,37 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
        OD_DIV_ROUND_POW2(mv->mvs[1][ref][1]*est->mvapw[ref][0]
        - mv->mvs[2][ref][1]*est->mvapw[ref][1], 16, 0x8000), mvymax);
       /*Examine the candidates in Set C.*/
+      ncands = 0;
       for (ci = 0; ci < 5; ci++) {
         candx = cands[ci][0];
         candy = cands[ci][1];
         OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Set C predictor %i: (%i, %i) ", ci, candx, candy));
-        if (od_mv_est_is_hit(est, candx, candy)) {
+        if (od_mv_est_is_hit(worker, candx, candy)) {
           OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "...Skipping.\n"));
           continue;
         }
-        /*if (od_mv_est_is_hit(est, candx, candy)) continue;*/
-        od_mv_est_set_hit(est, candx, candy);
+        OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "\n"));
+        od_mv_est_set_hit(worker, candx, candy);
 #if defined(OD_DUMP_IMAGES) && defined(OD_ANIMATE)
         if (animating) {
           od_img_draw_line(&state->vis_img, x0, y0,
            x0 + (candx << 1), y0 + (candy << 1), OD_YCbCr_MVCAND);
         }
 #endif
-        sad = od_mv_est_bma_sad8(est, ref, bx, by, candx, candy, log_mvb_sz);
+        cands[ncands][0] = candx;
+        cands[ncands][1] = candy;
+        ncands++;
+      }
+      od_mv_est_bma_sads8(est, sads, ref, bx, by,
+       (const int (*)[2])cands, ncands, log_mvb_sz);
+      for (ci = 0; ci < ncands; ci++) {
+        candx = cands[ci][0];
+        candy = cands[ci][1];
         rate = od_mv_est_bits(candx << 1, candy << 1, predx, predy);
-        cost = (sad << OD_LAMBDA_SCALE) + rate*est->lambda;
-        OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "   Cost: %i\n", cost));
+        cost = (sads[ci] << OD_LAMBDA_SCALE) + rate*est->lambda;
+        OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Set C (%i, %i) Cost: %i\n", candx, candy, cost));
         if (cost < best_cost) {
-          best_sad = sad;
+          best_sad = sads[ci];
           best_rate = rate;
           best_cost = cost;
           best_vec[0] = candx;
@@ -1210,6 +1473,8 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
       OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Threshold: %i\n", t2));
       if (best_sad > t2) {
         const int *pattern;
+        int pcands[OD_MC_SAD_NREFS_MAX][2];
+        int sites[OD_MC_SAD_NREFS_MAX];
         int mvstate;
         int best_site;
         int nsites;
@@ -1224,6 +1489,7 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
            (best_vec[1] <= mvymin) << 2 | (best_vec[1] >= mvymax) << 3;
           pattern = OD_SEARCH_SITES[mvstate][b];
           nsites = OD_SEARCH_NSITES[mvstate][b];
+          ncands = 0;
           for (sitei = 0; sitei < nsites; sitei++) {
             site = pattern[sitei];
             candx = best_vec[0] + OD_SITE_DX[site];
@@ -1240,27 +1506,35 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
             }
             OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Pattern search %i: (%i, %i) ",
              site, candx, candy));
-            if (od_mv_est_is_hit(est, candx, candy)) {
+            if (od_mv_est_is_hit(worker, candx, candy)) {
               OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "...Skipping.\n"));
               continue;
             }
-            od_mv_est_set_hit(est, candx, candy);
+            OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "\n"));
+            od_mv_est_set_hit(worker, candx, candy);
 #if defined(OD_DUMP_IMAGES) && defined(OD_ANIMATE)
             if (animating) {
               od_img_draw_line(&state->vis_img, x0, y0,
                x0 + (candx << 1), y0 + (candy << 1), OD_YCbCr_MVCAND);
             }
 #endif
-            sad = od_mv_est_bma_sad8(est,
-             ref, bx, by, candx, candy, log_mvb_sz);
-            rate = od_mv_est_bits(candx << 1, candy << 1, predx, predy);
-            cost = (sad << OD_LAMBDA_SCALE) + rate*est->lambda;
-            OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "   Cost: %i\n", cost));
+            sites[ncands] = site;
+            pcands[ncands][0] = candx;
+            pcands[ncands][1] = candy;
+            ncands++;
+          }
+          od_mv_est_bma_sads8(est, sads, ref, bx, by,
+           (const int (*)[2])pcands, ncands, log_mvb_sz);
+          for (ci = 0; ci < ncands; ci++) {
+            rate = od_mv_est_bits(pcands[ci][0] << 1, pcands[ci][1] << 1,
+             predx, predy);
+            cost = (sads[ci] << OD_LAMBDA_SCALE) + rate*est->lambda;
+            OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "Pattern search %i Cost: %i\n", sites[ci], cost));
             if (cost < best_cost) {
-              best_sad = sad;
+              best_sad = sads[ci];
               best_rate = rate;
               best_cost = cost;
-              best_site = site;
+              best_site = sites[ci];
             }
           }
           mvstate = OD_SEARCH_STATES[mvstate][best_site];
@@ -1318,8 +1592,287 @@ static void od_mv_est_init_mv(od_mv_est_ctx *est, int ref, int vx, int vy) {
   }*/
 }
 
+/*Initializes the MVs of one MVB.*/
+static void od_mv_est_init_mvb(od_mv_est_ctx *est, od_mv_est_worker *worker,
+ int ref, int vx, int vy) {
+  od_state *state;
+  int nhmvbs;
+  int nvmvbs;
+  int b;
+  state = &est->enc->state;
+  nhmvbs = (state->nhmbs + 1) << 2;
+  nvmvbs = (state->nvmbs + 1) << 2;
+  /*Keep track of what edges we're on.
+    We only need to know about the bottom/right to start with, since the
+     top/left are already initialized (or do not need to be).*/
+  b = (vx < nhmvbs) << 1 | (vy < nvmvbs) << 3;
+  /*Initialization MUST proceed in order by level to ensure the necessary
+     predictors are available.
+    Order within a level does not matter, except for level 0.
+    Level 0 is the only level to use predictors outside the current MVB,
+     and must proceed in raster order.*/
+  /*Level 0 vertex.*/
+  if ((b & 0xA) == 0xA) od_mv_est_init_mv(est, worker, ref, vx, vy);
+  if (est->level_max < 1) return;
+  /*Level 1 vertex.*/
+  od_mv_est_init_mv(est, worker, ref, vx - 2, vy - 2);
+  if (est->level_max < 2) return;
+  /*Level 2 vertices.*/
+  if (b & 2) od_mv_est_init_mv(est, worker, ref, vx, vy - 2);
+  if (b & 8) od_mv_est_init_mv(est, worker, ref, vx - 2, vy);
+  if (est->level_max < 3) return;
+  /*Level 3 vertices.*/
+  /*Add in flags for the top/left edges.*/
+  b |= (vx > 4) | (vy > 4) << 2;
+  if (b & 4) {
+    if (b & 1) od_mv_est_init_mv(est, worker, ref, vx - 3, vy - 3);
+    if (b & 2) od_mv_est_init_mv(est, worker, ref, vx - 1, vy - 3);
+  }
+  if (b & 8) {
+    if (b & 1) od_mv_est_init_mv(est, worker, ref, vx - 3, vy - 1);
+    if (b & 2) od_mv_est_init_mv(est, worker, ref, vx - 1, vy - 1);
+  }
+  if (est->level_max < 4) return;
+  /*Level 4 vertices.*/
+  if (b & 1) od_mv_est_init_mv(est, worker, ref, vx - 3, vy - 2);
+  if (b & 2) od_mv_est_init_mv(est, worker, ref, vx - 1, vy - 2);
+  if (b & 4) {
+    od_mv_est_init_mv(est, worker, ref, vx - 2, vy - 3);
+    if (b & 2) od_mv_est_init_mv(est, worker, ref, vx, vy - 3);
+  }
+  if (b & 8) {
+    od_mv_est_init_mv(est, worker, ref, vx - 2, vy - 1);
+    if (b & 1) od_mv_est_init_mv(est, worker, ref, vx - 3, vy);
+    if (b & 2) {
+      od_mv_est_init_mv(est, worker, ref, vx, vy - 1);
+      od_mv_est_init_mv(est, worker, ref, vx - 1, vy);
+    }
+  }
+}
+
+/*The parameters of a job run on each thread by od_mv_est_run().*/
+struct od_mv_est_job {
+  od_mv_est_ctx *est;
+  int ref;
+  /*The remaining parameters are only used by refinement.*/
+  int log_dsz;
+  int mv_res;
+  const int *pattern_nsites;
+  const od_pattern *pattern;
+  /*The row (or column) to start with, mod OD_MC_REFINE_STRIDE.*/
+  int phase;
+};
+
+/*Initializes every nthreads'th row of MVBs, starting with row _ti.
+  Level 0 MVs are predicted from the row above, up to one MVB to the right,
+   so each row runs as a wavefront behind the previous one.
+  Every MV then sees the same predictors as in raster order, and the result
+   does not depend on the number of threads.*/
+static void od_mv_est_init_mvb_rows(void *_ctx, int _ti) {
+  od_mv_est_job *job;
+  od_mv_est_ctx *est;
+  int nthreads;
+  int nhmbs;
+  int nvmbs;
+  int mbx;
+  int mby;
+  job = (od_mv_est_job *)_ctx;
+  est = job->est;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
+  nhmbs = est->enc->state.nhmbs;
+  nvmbs = est->enc->state.nvmbs;
+  for (mby = _ti; mby <= nvmbs; mby += nthreads) {
+    for (mbx = 0; mbx <= nhmbs; mbx++) {
+      od_row_sync_wait(&est->mvb_rows, mby - 1, OD_MINI(mbx + 2, nhmbs + 1));
+      /*We initialize MVs a MVB at a time for cache coherency.
+        Proceeding level-by-level would involve less branching and less
+         complex code, but the SADs dominate.*/
+      od_mv_est_init_mvb(est, est->workers + _ti, job->ref,
+       (mbx + 1) << 2, (mby + 1) << 2);
+      od_row_sync_post(&est->mvb_rows, mby, mbx + 1);
+    }
+  }
+}
+
+/*Decimates a plane by two in each direction with a 2x2 box filter.
+  The edge extension of the destination is filled in by clamping to the
+   source.*/
+static void od_mv_est_pyr_downsample(od_mv_pyr_plane *dst,
+ const unsigned char *src, int systride, int sxstride, int sw, int sh) {
+  int x;
+  int y;
+  for (y = -OD_MC_PYR_PADDING; y < dst->height + OD_MC_PYR_PADDING; y++) {
+    const unsigned char *srow0;
+    const unsigned char *srow1;
+    unsigned char *drow;
+    srow0 = src + OD_CLAMPI(0, 2*y, sh - 1)*systride;
+    srow1 = src + OD_CLAMPI(0, 2*y + 1, sh - 1)*systride;
+    drow = dst->data + y*dst->ystride;
+    for (x = -OD_MC_PYR_PADDING; x < dst->width + OD_MC_PYR_PADDING; x++) {
+      int sx0;
+      int sx1;
+      sx0 = OD_CLAMPI(0, 2*x, sw - 1)*sxstride;
+      sx1 = OD_CLAMPI(0, 2*x + 1, sw - 1)*sxstride;
+      drow[x] = (unsigned char)((srow0[sx0] + srow0[sx1]
+       + srow1[sx0] + srow1[sx1] + 2) >> 2);
+    }
+  }
+}
+
+/*Builds the decimated input and reference planes for the pyramid search.*/
+static void od_mv_est_pyr_init(od_mv_est_ctx *est, int ref) {
+  od_state *state;
+  od_img_plane *iplane;
+  int li;
+  int ii;
+  state = &est->enc->state;
+  iplane = state->io_imgs[OD_FRAME_INPUT].planes + 0;
+  od_mv_est_pyr_downsample(est->pyr[0] + 0, iplane->data, iplane->ystride,
+   iplane->xstride, state->frame_width, state->frame_height);
+  /*The reference images are upsampled by two, so only use the whole-pel
+     pixels.*/
+  iplane = state->ref_imgs[state->ref_imgi[ref]].planes + 0;
+  od_mv_est_pyr_downsample(est->pyr[0] + 1, iplane->data,
+   iplane->ystride << 1, 2, state->frame_width, state->frame_height);
+  for (li = 1; li < OD_MC_PYR_NLEVELS; li++) {
+    for (ii = 0; ii < 2; ii++) {
+      od_mv_pyr_plane *src;
+      src = est->pyr[li - 1] + ii;
+      od_mv_est_pyr_downsample(est->pyr[li] + ii, src->data, src->ystride, 1,
+       src->width, src->height);
+    }
+  }
+}
+
+/*Finds the lowest cost MV for a block of one level of the pyramid from a
+   list of candidates.
+  The cost is the SAD plus the length of the MV, which favors short MVs in
+   flat regions.
+  pyr: The decimated input and reference planes.
+  best: Returns the best MV.
+  x: The horizontal position of the block.
+  y: The vertical position of the block.
+  log_blk_sz: The log of the size of the block.
+  cands: The candidate MVs.
+  ncands: The number of candidates.*/
+static void od_mv_est_pyr_best(od_state *state, const od_mv_pyr_plane *pyr,
+ int best[2], int x, int y, int log_blk_sz, const int (*cands)[2],
+ int ncands) {
+  const unsigned char *p[OD_MC_SAD_NREFS_MAX];
+  ogg_int32_t sads[OD_MC_SAD_NREFS_MAX];
+  ogg_int32_t best_cost;
+  ogg_int32_t cost;
+  int np;
+  int ci;
+  int pi;
+  best_cost = 0x7FFFFFFF;
+  for (ci = 0; ci < ncands; ci += np) {
+    np = OD_MINI(ncands - ci, OD_MC_SAD_NREFS_MAX);
+    for (pi = 0; pi < np; pi++) {
+      p[pi] = pyr[1].data + (y + cands[ci + pi][1])*pyr[1].ystride
+       + x + cands[ci + pi][0];
+    }
+    (*state->opt_vtbl.mc_sad_multi8)(sads,
+     pyr[0].data + y*pyr[0].ystride + x, pyr[0].ystride, p, np,
+     pyr[1].ystride, 1, log_blk_sz);
+    for (pi = 0; pi < np; pi++) {
+      cost = sads[pi] + abs(cands[ci + pi][0]) + abs(cands[ci + pi][1]);
+      if (cost < best_cost) {
+        best_cost = cost;
+        best[0] = cands[ci + pi][0];
+        best[1] = cands[ci + pi][1];
+      }
+    }
+  }
+}
+
+/*Runs the pyramid search for a band of macro block rows.
+  Each macro block is searched independently, so the bands can be split
+   between threads any way we like.*/
+static void od_mv_est_pyr_search_band(void *_ctx, int _ti) {
+  int cands[(2*OD_MC_PYR_RANGE + 1)*(2*OD_MC_PYR_RANGE + 1)][2];
+  od_mv_est_job *job;
+  od_mv_est_ctx *est;
+  od_state *state;
+  int nthreads;
+  int ncands;
+  int best[2];
+  int mby0;
+  int mby1;
+  int mbx;
+  int mby;
+  int dx;
+  int dy;
+  job = (od_mv_est_job *)_ctx;
+  est = job->est;
+  state = &est->enc->state;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
+  mby0 = state->nvmbs*_ti/nthreads;
+  mby1 = state->nvmbs*(_ti + 1)/nthreads;
+  for (mby = mby0; mby < mby1; mby++) {
+    for (mbx = 0; mbx < state->nhmbs; mbx++) {
+      /*Do a full search at the coarsest level.
+        The block is twice the size of the macro block, centered on it, to
+         make the match less sensitive to noise.*/
+      ncands = 0;
+      for (dy = -OD_MC_PYR_RANGE; dy <= OD_MC_PYR_RANGE; dy++) {
+        for (dx = -OD_MC_PYR_RANGE; dx <= OD_MC_PYR_RANGE; dx++) {
+          cands[ncands][0] = dx;
+          cands[ncands][1] = dy;
+          ncands++;
+        }
+      }
+      od_mv_est_pyr_best(state, est->pyr[1], best,
+       (mbx << 2) - 2, (mby << 2) - 2, 3, (const int (*)[2])cands, ncands);
+      /*Refine it by a pixel in each direction at the next finer level.*/
+      ncands = 0;
+      for (dy = -1; dy <= 1; dy++) {
+        for (dx = -1; dx <= 1; dx++) {
+          cands[ncands][0] = OD_CLAMPI(-2*OD_MC_PYR_RANGE, 2*best[0] + dx,
+           2*OD_MC_PYR_RANGE);
+          cands[ncands][1] = OD_CLAMPI(-2*OD_MC_PYR_RANGE, 2*best[1] + dy,
+           2*OD_MC_PYR_RANGE);
+          ncands++;
+        }
+      }
+      od_mv_est_pyr_best(state, est->pyr[0], best,
+       mbx << 3, mby << 3, 3, (const int (*)[2])cands, ncands);
+      est->pyr_mvs[mby][mbx][0] = best[0] << 1;
+      est->pyr_mvs[mby][mbx][1] = best[1] << 1;
+    }
+  }
+}
+
+/*Finds a whole-pel MV for each macro block with a coarse-to-fine search of
+   the input and reference frames decimated by 4 and 2.
+  This catches large motion that none of the EPZS^2 predictors point to.*/
+static void od_mv_est_pyr_search(od_mv_est_ctx *est, int ref) {
+  od_state *state;
+  od_img_plane *iplane;
+  od_mv_est_job job;
+  int mbx;
+  int mby;
+  state = &est->enc->state;
+  iplane = state->input.planes + 0;
+  if (iplane->xdec || iplane->ydec) {
+    /*The pyramid is only built for a full resolution luma plane.
+      Otherwise, fall back to the zero MV, which EPZS^2 already tries.*/
+    for (mby = 0; mby < state->nvmbs; mby++) {
+      for (mbx = 0; mbx < state->nhmbs; mbx++) {
+        est->pyr_mvs[mby][mbx][0] = est->pyr_mvs[mby][mbx][1] = 0;
+      }
+    }
+    return;
+  }
+  od_mv_est_pyr_init(est, ref);
+  job.est = est;
+  job.ref = ref;
+  od_mv_est_run(est, od_mv_est_pyr_search_band, &job);
+}
+
 static void od_mv_est_init_mvs(od_mv_est_ctx *est, int ref) {
   od_state *state;
+  od_mv_est_job job;
   int nhmvbs;
   int nvmvbs;
   int vx;
@@ -1335,60 +1888,11 @@ static void od_mv_est_init_mvs(od_mv_est_ctx *est, int ref) {
       memmove(mv->mvs + 1, mv->mvs + 0, sizeof(mv->mvs[0]) << 1);
     }
   }
-  /*We initialize MVs a MVB at a time for cache coherency.
-    Proceeding level-by-level would involve less branching and less complex
-     code, but the SADs dominate.*/
-  for (vy = 4; vy <= nvmvbs; vy += 4) {
-    for (vx = 4; vx <= nhmvbs; vx += 4) {
-      int b;
-      /*Keep track of what edges we're on.
-        We only need to know about the bottom/right to start with, since the
-         top/left are already initialized (or do not need to be).*/
-      b = (vx < nhmvbs) << 1 | (vy < nvmvbs) << 3;
-      /*Initialization MUST proceed in order by level to ensure the necessary
-         predictors are available.
-        Order within a level does not matter, except for level 0.
-        Level 0 is the only level to use predictors outside the current MVB,
-         and must proceed in raster order.*/
-      /*Level 0 vertex.*/
-      if ((b & 0xA) == 0xA) od_mv_est_init_mv(est, ref, vx, vy);
-      if (est->level_max < 1) continue;
-      /*Level 1 vertex.*/
-      od_mv_est_init_mv(est, ref, vx - 2, vy - 2);
-      if (est->level_max < 2) continue;
-      /*Level 2 vertices.*/
-      if (b & 2) od_mv_est_init_mv(est, ref, vx, vy - 2);
-      if (b & 8) od_mv_est_init_mv(est, ref, vx - 2, vy);
-      if (est->level_max < 3) continue;
-      /*Level 3 vertices.*/
-      /*Add in flags for the top/left edges.*/
-      b |= (vx > 4) | (vy > 4) << 2;
-      if (b & 4) {
-        if (b & 1) od_mv_est_init_mv(est, ref, vx - 3, vy - 3);
-        if (b & 2) od_mv_est_init_mv(est, ref, vx - 1, vy - 3);
-      }
-      if (b & 8) {
-        if (b & 1) od_mv_est_init_mv(est, ref, vx - 3, vy - 1);
-        if (b & 2) od_mv_est_init_mv(est, ref, vx - 1, vy - 1);
-      }
-      if (est->level_max < 4) continue;
-      /*Level 4 vertices.*/
-      if (b & 1) od_mv_est_init_mv(est, ref, vx - 3, vy - 2);
-      if (b & 2) od_mv_est_init_mv(est, ref, vx - 1, vy - 2);
-      if (b & 4) {
-        od_mv_est_init_mv(est, ref, vx - 2, vy - 3);
-        if (b & 2) od_mv_est_init_mv(est, ref, vx, vy - 3);
-      }
-      if (b & 8) {
-        od_mv_est_init_mv(est, ref, vx - 2, vy - 1);
-        if (b & 1) od_mv_est_init_mv(est, ref, vx - 3, vy);
-        if (b & 2) {
-          od_mv_est_init_mv(est, ref, vx, vy - 1);
-          od_mv_est_init_mv(est, ref, vx - 1, vy);
-        }
-      }
-    }
-  }
+  if (est->flags & OD_MC_USE_PYRAMID) od_mv_est_pyr_search(est, ref);
+  od_row_sync_reset(&est->mvb_rows);
+  job.est = est;
+  job.ref = ref;
+  od_mv_est_run(est, od_mv_est_init_mvb_rows, &job);
 }
 
 /*STAGE 2: DECIMATION.*/
@@ -1769,21 +2273,32 @@ static void od_mv_est_init_nodes(od_mv_est_ctx *est) {
 /*Computes the SAD of all blocks at all scales with all possible edge
    splittings, using OBMC.
   These are what will drive the error of the adaptive subdivision process.*/
-static void od_mv_est_calc_sads(od_mv_est_ctx *est, int ref) {
+/*Fills in the SAD cache for one horizontal band of the frame.
+  Every block is independent, so the frame is split into one band per
+   thread.*/
+static void od_mv_est_calc_sads_band(void *_ctx, int _ti) {
+  od_mv_est_job *job;
+  od_mv_est_ctx *est;
   od_state *state;
+  int nthreads;
   int nhmvbs;
   int nvmvbs;
+  int ref;
   int vx;
   int vy;
   int oc;
   int s;
+  job = (od_mv_est_job *)_ctx;
+  est = job->est;
+  ref = job->ref;
   state = &est->enc->state;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
   /*TODO: Interleaved evaluation would probably provide better cache
      coherency.*/
   nhmvbs = (state->nhmbs + 1) << 2;
   nvmvbs = (state->nvmbs + 1) << 2;
   if (est->level_max >= 3) {
-    for (vy = 0; vy < nvmvbs; vy++) {
+    for (vy = nvmvbs*_ti/nthreads; vy < nvmvbs*(_ti + 1)/nthreads; vy++) {
       od_mv_node *mv_row;
       mv_row = est->mvs[vy];
       for (vx = 0; vx < nhmvbs; vx++) {
@@ -1810,7 +2325,7 @@ static void od_mv_est_calc_sads(od_mv_est_ctx *est, int ref) {
   nvmvbs >>= 1;
   if (est->level_max >= 1) {
     if (est->level_min < 3) {
-      for(vy=0;vy<nvmvbs;vy++) {
+      for (vy = nvmvbs*_ti/nthreads; vy < nvmvbs*(_ti + 1)/nthreads; vy++) {
         od_mv_node *mv_row;
         mv_row = est->mvs[vy << 1];
         for (vx = 0; vx < nhmvbs; vx++) {
@@ -1842,7 +2357,7 @@ static void od_mv_est_calc_sads(od_mv_est_ctx *est, int ref) {
   else {
     nhmvbs >>= 1;
     nvmvbs >>= 1;
-    for (vy = 0; vy < nvmvbs; vy++) {
+    for (vy = nvmvbs*_ti/nthreads; vy < nvmvbs*(_ti + 1)/nthreads; vy++) {
       od_mv_node *mv_row;
       mv_row = est->mvs[vy << 2];
       for (vx = 0; vx < nhmvbs; vx++) {
@@ -1856,6 +2371,13 @@ static void od_mv_est_calc_sads(od_mv_est_ctx *est, int ref) {
   }
 }
 
+static void od_mv_est_calc_sads(od_mv_est_ctx *est, int ref) {
+  od_mv_est_job job;
+  job.est = est;
+  job.ref = ref;
+  od_mv_est_run(est, od_mv_est_calc_sads_band, &job);
+}
+
 static void od_mv_est_init_du(od_mv_est_ctx *est, int ref, int vx, int vy) {
   od_state *state;
   od_mv_node *dec;
@@ -3122,8 +3644,8 @@ static void od_mv_dp_install_row_state(od_mv_dp_node *dp, int prevsi) {
 }
 
 static ogg_int32_t od_mv_est_refine_row(od_mv_est_ctx *est,
- int ref, int vy, int log_dsz, int mv_res, const int *pattern_nsites,
- const od_pattern *pattern) {
+ od_mv_est_worker *worker, int ref, int vy, int log_dsz, int mv_res,
+ const int *pattern_nsites, const od_pattern *pattern) {
   od_state *state;
   od_mv_grid_pt *grid;
   od_mv_grid_pt *pmvg;
@@ -3175,7 +3697,7 @@ static ogg_int32_t od_mv_est_refine_row(od_mv_est_ctx *est,
     mvg = grid + vx;
     curx = mvg->mv[0];
     cury = mvg->mv[1];
-    dp_node = est->dp_nodes;
+    dp_node = worker->dp_nodes;
     od_mv_dp_row_init(est, dp_node, vx, vy, NULL);
     od_mv_dp_first_row_block_setup(est, dp_node, vx, vy);
     OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "TESTING block SADs:\n"));
@@ -3449,7 +3971,6 @@ static ogg_int32_t od_mv_est_refine_row(od_mv_est_ctx *est,
       dcost += best_cost;
     }
   }
-  od_mv_est_check_rd_state(est, ref, mv_res);
   return dcost;
 }
 
@@ -3840,8 +4361,8 @@ static void od_mv_dp_install_col_state(od_mv_dp_node *dp, int prevsi) {
 }
 
 static ogg_int32_t od_mv_est_refine_col(od_mv_est_ctx *est,
- int ref, int vx, int log_dsz, int mv_res, const int *pattern_nsites,
- const od_pattern *pattern) {
+ od_mv_est_worker *worker, int ref, int vx, int log_dsz, int mv_res,
+ const int *pattern_nsites, const od_pattern *pattern) {
   od_state *state;
   od_mv_grid_pt **grid;
   od_mv_grid_pt *pmvg;
@@ -3893,7 +4414,7 @@ static ogg_int32_t od_mv_est_refine_col(od_mv_est_ctx *est,
     mvg = grid[vy] + vx;
     curx = mvg->mv[0];
     cury = mvg->mv[1];
-    dp_node = est->dp_nodes;
+    dp_node = worker->dp_nodes;
     od_mv_dp_col_init(est, dp_node, vx, vy, NULL);
     od_mv_dp_first_col_block_setup(est, dp_node, vx, vy);
     OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG, "TESTING block SADs:\n"));
@@ -4169,7 +4690,6 @@ static ogg_int32_t od_mv_est_refine_col(od_mv_est_ctx *est,
       dcost += best_cost;
     }
   }
-  od_mv_est_check_rd_state(est, ref, mv_res);
   return dcost;
 }
 
@@ -4777,33 +5297,88 @@ static void od_mv_est_refine_col(od_mv_est_ctx *est, int ref, int vx,
 }
 #endif
 
+/*Refines every nthreads'th row in the current phase, starting with the
+   _ti'th one.*/
+static void od_mv_est_refine_rows(void *_ctx, int _ti) {
+  od_mv_est_job *job;
+  od_mv_est_ctx *est;
+  od_mv_est_worker *worker;
+  int nthreads;
+  int nvmvbs;
+  int vy;
+  job = (od_mv_est_job *)_ctx;
+  est = job->est;
+  worker = est->workers + _ti;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
+  nvmvbs = (est->enc->state.nvmbs + 1) << 2;
+  for (vy = job->phase + _ti*OD_MC_REFINE_STRIDE; vy <= nvmvbs;
+   vy += nthreads*OD_MC_REFINE_STRIDE) {
+    if (est->row_counts[vy]) {
+      worker->dcost += od_mv_est_refine_row(est, worker, job->ref, vy,
+       job->log_dsz, job->mv_res, job->pattern_nsites, job->pattern);
+    }
+  }
+}
+
+/*Refines every nthreads'th column in the current phase, starting with the
+   _ti'th one.*/
+static void od_mv_est_refine_cols(void *_ctx, int _ti) {
+  od_mv_est_job *job;
+  od_mv_est_ctx *est;
+  od_mv_est_worker *worker;
+  int nthreads;
+  int nhmvbs;
+  int vx;
+  job = (od_mv_est_job *)_ctx;
+  est = job->est;
+  worker = est->workers + _ti;
+  nthreads = od_thread_pool_nthreads(est->enc->threads);
+  nhmvbs = (est->enc->state.nhmbs + 1) << 2;
+  for (vx = job->phase + _ti*OD_MC_REFINE_STRIDE; vx <= nhmvbs;
+   vx += nthreads*OD_MC_REFINE_STRIDE) {
+    if (est->col_counts[vx]) {
+      worker->dcost += od_mv_est_refine_col(est, worker, job->ref, vx,
+       job->log_dsz, job->mv_res, job->pattern_nsites, job->pattern);
+    }
+  }
+}
+
 static ogg_int32_t od_mv_est_refine(od_mv_est_ctx *est, int ref, int log_dsz,
  int mv_res, const int *pattern_nsites, const od_pattern *pattern) {
   od_state *state;
+  od_mv_est_job job;
   ogg_int32_t dcost;
   int nhmvbs;
   int nvmvbs;
-  int vx;
-  int vy;
+  int ti;
   state = &est->enc->state;
   nhmvbs = (state->nhmbs + 1) << 2;
   nvmvbs = (state->nvmbs + 1) << 2;
   OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG,
         "Refining with displacements of %0g and 1/%i pel MV resolution.\n",
         (1 << log_dsz)*0.125, 1 << (3 - mv_res)));
-  dcost = 0;
-  for (vy = 0; vy <= nvmvbs; vy++) {
-    if (est->row_counts[vy]) {
-      dcost += od_mv_est_refine_row(est, ref, vy, log_dsz, mv_res,
-       pattern_nsites, pattern);
-    }
+  job.est = est;
+  job.ref = ref;
+  job.log_dsz = log_dsz;
+  job.mv_res = mv_res;
+  job.pattern_nsites = pattern_nsites;
+  job.pattern = pattern;
+  for (ti = 0; ti < est->nworkers; ti++) est->workers[ti].dcost = 0;
+  /*Rows this far apart do not touch any of the same MVs or blocks, so each
+     pass refines all of the rows in one phase at once, one phase after
+     another.
+    The order is the same no matter how many threads there are.*/
+  for (job.phase = 0; job.phase < OD_MINI(OD_MC_REFINE_STRIDE, nvmvbs + 1);
+   job.phase++) {
+    od_mv_est_run(est, od_mv_est_refine_rows, &job);
   }
-  for (vx = 0; vx <= nhmvbs; vx++) {
-    if (est->col_counts[vx]) {
-      dcost += od_mv_est_refine_col(est, ref, vx, log_dsz, mv_res,
-       pattern_nsites, pattern);
-    }
+  for (job.phase = 0; job.phase < OD_MINI(OD_MC_REFINE_STRIDE, nhmvbs + 1);
+   job.phase++) {
+    od_mv_est_run(est, od_mv_est_refine_cols, &job);
   }
+  od_mv_est_check_rd_state(est, ref, mv_res);
+  dcost = 0;
+  for (ti = 0; ti < est->nworkers; ti++) dcost += est->workers[ti].dcost;
   return dcost;
 }
 
@@ -4866,6 +5441,17 @@ int od_mv_est_update_mv_rates(od_mv_est_ctx *est, int mv_res) {
 }
 
 
+int od_mv_est_set_speed(od_mv_est_ctx *est, int speed) {
+  if (speed < 0 || speed >= OD_MC_NSPEEDS) return OD_EINVAL;
+  est->flags = OD_MC_SPEEDS[speed].flags;
+  est->mv_res_min = OD_MC_SPEEDS[speed].mv_res_min;
+  est->level_max = OD_MC_SPEEDS[speed].level_max;
+  est->level_min = OD_MC_SPEEDS[speed].level_min;
+  est->refine_max = OD_MC_SPEEDS[speed].refine_max;
+  est->thresh_shift = OD_MC_SPEEDS[speed].thresh_shift;
+  return OD_SUCCESS;
+}
+
 od_mv_est_ctx *od_mv_est_alloc(od_enc_ctx *enc) {
   od_mv_est_ctx *ret;
   ret = (od_mv_est_ctx *)_ogg_malloc(sizeof(*ret));
@@ -4889,6 +5475,7 @@ void od_mv_subpel_refine(od_mv_est_ctx *est, int ref, int cost_thresh) {
   int nvmvbs;
   int mv_res;
   int best_mv_res;
+  int npasses;
   state = &est->enc->state;
   nhmvbs = (state->nhmbs + 1) << 2;
   nvmvbs = (state->nvmbs + 1) << 2;
@@ -4896,11 +5483,12 @@ void od_mv_subpel_refine(od_mv_est_ctx *est, int ref, int cost_thresh) {
     We could also try rounding the results after refinement, I guess.
     I'm not sure it makes much difference*/
   od_mv_est_update_fullpel_mvs(est, ref);
+  npasses = 0;
   do {
     dcost = od_mv_est_refine(est, ref, 2, 2,
      OD_DIAMOND_NSITES, OD_DIAMOND_SITES);
   }
-  while (dcost < cost_thresh);
+  while (dcost < cost_thresh && ++npasses < est->refine_max);
   for (best_mv_res = mv_res = 2; mv_res-- > est->mv_res_min;) {
     subpel_cost = od_mv_est_update_mv_rates(est, mv_res)*est->lambda;
     /*If the rate penalty for refining is small, bump the termination threshold
@@ -4911,12 +5499,13 @@ void od_mv_subpel_refine(od_mv_est_ctx *est, int ref, int cost_thresh) {
      -OD_MAXI(subpel_cost, 16 << OD_LAMBDA_SCALE));
     memcpy(est->refine_grid[0], state->mv_grid[0],
      sizeof(**state->mv_grid)*(nhmvbs + 1)*(nvmvbs + 1));
+    npasses = 0;
     do {
       dcost = od_mv_est_refine(est, ref, mv_res, mv_res,
        OD_DIAMOND_NSITES, OD_DIAMOND_SITES);
       subpel_cost += dcost;
     }
-    while (dcost < cost_thresh);
+    while (dcost < cost_thresh && ++npasses < est->refine_max);
     if (subpel_cost > 0) {
       OD_LOG((OD_LOG_MOTION_ESTIMATION, OD_LOG_DEBUG,
        "1/%i refinement FAILED:    dopt %7i\n",
@@ -4943,6 +5532,7 @@ void od_mv_est(od_mv_est_ctx *est, int ref, int lambda) {
   int cost_thresh;
   int nhmvbs;
   int nvmvbs;
+  int npasses;
   int pli;
   state = &est->enc->state;
   nhmvbs = (state->nhmbs + 1) << 2;
@@ -4970,6 +5560,10 @@ void od_mv_est(od_mv_est_ctx *est, int ref, int lambda) {
        256 >> (iplane->xdec + iplane->ydec + OD_MC_CHROMA_SCALE);
     }
   }
+  /*At faster speeds, accept worse matches to stop the search sooner.*/
+  est->thresh1[0] <<= est->thresh_shift;
+  est->thresh1[1] <<= est->thresh_shift;
+  est->thresh1[2] <<= est->thresh_shift;
   est->thresh2_offs[0] = est->thresh1[0] >> 1;
   est->thresh2_offs[1] = est->thresh1[1] >> 1;
   est->thresh2_offs[2] = est->thresh1[2] >> 1;
@@ -4986,6 +5580,7 @@ void od_mv_est(od_mv_est_ctx *est, int ref, int lambda) {
     od_state_mvs_clear(&est->enc->state);
   }
 #endif
+  od_mv_est_alloc_workers(est);
   od_mv_est_init_mvs(est, ref);
   od_mv_est_decimate(est, ref);
   /*This threshold is somewhat arbitrary.
@@ -5013,11 +5608,12 @@ void od_mv_est(od_mv_est_ctx *est, int ref, int lambda) {
   /*Diamond search.
     This appears to give the same quality as the logarithmic search, but at
      nearly 10 times the speed.*/
+  npasses = 0;
   do {
     dcost = od_mv_est_refine(est, ref, 3, 2,
      OD_DIAMOND_NSITES, OD_DIAMOND_SITES);
   }
-  while (dcost < cost_thresh);
+  while (dcost < cost_thresh && ++npasses < est->refine_max);
 #endif
   od_mv_subpel_refine(est, ref, cost_thresh);
   {
@@ -711,7 +711,25 @@ void od_bin_idct16x16(od_coeff *_x,int _xstride,
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#if defined(OD_X86ASM)
+# include "x86/cpu.h"
+# include "x86/x86int.h"
+#endif
 
+/*The transforms checked by the IEEE1180 tests.
+  These start out as the C versions, and are replaced by any optimized
+   versions the CPU supports once those have been tested.*/
+static od_dct_func_2d test_fdct_2d[OD_NBSIZES]={
+  od_bin_fdct4x4,
+  od_bin_fdct8x8,
+  od_bin_fdct16x16
+};
+
+static od_dct_func_2d test_idct_2d[OD_NBSIZES]={
+  od_bin_idct4x4,
+  od_bin_idct8x8,
+  od_bin_idct16x16
+};
 
 /*The auto-correlation coefficent. 0.95 is a common value.*/
 #define INPUT_AUTOCORR (0.95)
@@ -914,7 +932,7 @@ static void ieee1180_test_block4(long _sumerrs[4][4],long _sumsqerrs[4][4],
   int      j;
   for(i=0;i<4;i++)for(j=0;j<4;j++)block[i][j]=ieee1180_rand(_l,_h)*_sign;
   /*Modification of IEEE1180: use our integerized DCT, not a true DCT.*/
-  od_bin_fdct4x4(refcoefs[0],4,block[0],4);
+  (*test_fdct_2d[0])(refcoefs[0],4,block[0],4);
   /*Modification of IEEE1180: no rounding or range clipping (coefficients
      are always in range with our integerized DCT).*/
   for(i=0;i<4;i++)for(j=0;j<4;j++){
@@ -934,7 +952,7 @@ static void ieee1180_test_block4(long _sumerrs[4][4],long _sumsqerrs[4][4],
     if(refout[i][j]>255)refout[i][j]=255;
     else if(refout[i][j]<-256)refout[i][j]=-256;
   }
-  od_bin_idct4x4(testout[0],4,refcoefs[0],4);
+  (*test_idct_2d[0])(testout[0],4,refcoefs[0],4);
   for(i=0;i<4;i++){
     for(j=0;j<4;j++){
       if(testout[i][j]!=block[i][j]){
@@ -1342,7 +1360,7 @@ static void ieee1180_test_block8(long _sumerrs[8][8],long _sumsqerrs[8][8],
   int      j;
   for(i=0;i<8;i++)for(j=0;j<8;j++)block[i][j]=ieee1180_rand(_l,_h)*_sign;
   /*Modification of IEEE1180: use our integerized DCT, not a true DCT.*/
-  od_bin_fdct8x8(refcoefs[0],8,block[0],8);
+  (*test_fdct_2d[1])(refcoefs[0],8,block[0],8);
   /*Modification of IEEE1180: no rounding or range clipping (coefficients
      are always in range with our integerized DCT).*/
   for(i=0;i<8;i++)for(j=0;j<8;j++){
@@ -1362,7 +1380,7 @@ static void ieee1180_test_block8(long _sumerrs[8][8],long _sumsqerrs[8][8],
     if(refout[i][j]>255)refout[i][j]=255;
     else if(refout[i][j]<-256)refout[i][j]=-256;
   }
-  od_bin_idct8x8(testout[0],8,refcoefs[0],8);
+  (*test_idct_2d[1])(testout[0],8,refcoefs[0],8);
   for(i=0;i<8;i++){
     for(j=0;j<8;j++){
       if(testout[i][j]!=block[i][j]){
@@ -1975,7 +1993,7 @@ static void ieee1180_test_block16(long _sumerrs[16][16],
   int      j;
   for(i=0;i<16;i++)for(j=0;j<16;j++)block[i][j]=ieee1180_rand(_l,_h)*_sign;
   /*Modification of IEEE1180: use our integerized DCT, not a true DCT.*/
-  od_bin_fdct16x16(refcoefs[0],16,block[0],16);
+  (*test_fdct_2d[2])(refcoefs[0],16,block[0],16);
   /*Modification of IEEE1180: no rounding or range clipping (coefficients
      are always in range with our integerized DCT).*/
   for(i=0;i<16;i++)for(j=0;j<16;j++){
@@ -1995,7 +2013,7 @@ static void ieee1180_test_block16(long _sumerrs[16][16],
     if(refout[i][j]>255)refout[i][j]=255;
     else if(refout[i][j]<-256)refout[i][j]=-256;
   }
-  od_bin_idct16x16(testout[0],16,refcoefs[0],16);
+  (*test_idct_2d[2])(testout[0],16,refcoefs[0],16);
   for(i=0;i<16;i++){
     for(j=0;j<16;j++){
       if(testout[i][j]!=block[i][j]){
@@ -2371,10 +2389,65 @@ static void check16(void){
 }
 
 
+#if defined(OD_X86ASM)
+/*Checks that an optimized transform produces exactly the same output as the
+   C version on random input.*/
+static int check_bitexact(od_dct_func_2d _ref,od_dct_func_2d _test,int _n,
+ const char *_name){
+  od_coeff in[16*16];
+  od_coeff refout[16*16];
+  od_coeff testout[16*16];
+  int      nmismatches;
+  int      i;
+  int      j;
+  ieee1180_srand(1);
+  nmismatches=0;
+  for(i=0;i<IEEE1180_NBLOCKS;i++){
+    for(j=0;j<_n*_n;j++)in[j]=ieee1180_rand(32768,32767);
+    (*_ref)(refout,_n,in,_n);
+    (*_test)(testout,_n,in,_n);
+    if(memcmp(refout,testout,_n*_n*sizeof(*refout))!=0)nmismatches++;
+  }
+  printf("%s: %i mismatches in %i blocks.\n",_name,nmismatches,
+   IEEE1180_NBLOCKS);
+  return nmismatches==0;
+}
+
+# if defined(__SSE2__)
+static void check_sse2(void){
+  int ok;
+  ok=check_bitexact(od_bin_fdct4x4,od_bin_fdct4x4_sse2,4,"fdct4x4_sse2");
+  ok&=check_bitexact(od_bin_idct4x4,od_bin_idct4x4_sse2,4,"idct4x4_sse2");
+  ok&=check_bitexact(od_bin_fdct8x8,od_bin_fdct8x8_sse2,8,"fdct8x8_sse2");
+  ok&=check_bitexact(od_bin_idct8x8,od_bin_idct8x8_sse2,8,"idct8x8_sse2");
+  ok&=check_bitexact(od_bin_fdct16x16,od_bin_fdct16x16_sse2,16,
+   "fdct16x16_sse2");
+  ok&=check_bitexact(od_bin_idct16x16,od_bin_idct16x16_sse2,16,
+   "idct16x16_sse2");
+  if(!ok)printf("SSE2 transforms are NOT bit-exact.\n");
+  test_fdct_2d[0]=od_bin_fdct4x4_sse2;
+  test_idct_2d[0]=od_bin_idct4x4_sse2;
+  test_fdct_2d[1]=od_bin_fdct8x8_sse2;
+  test_idct_2d[1]=od_bin_idct8x8_sse2;
+  test_fdct_2d[2]=od_bin_fdct16x16_sse2;
+  test_idct_2d[2]=od_bin_idct16x16_sse2;
+  printf("IEEE1180 tests of the SSE2 transforms:\n\n");
+  ieee1180_test4();
+  ieee1180_test8();
+  ieee1180_test16();
+}
+# endif
+#endif
+
 int main(void){
   check4();
   check8();
   check16();
+#if defined(OD_X86ASM)
+# if defined(__SSE2__)
+  if(od_cpu_flags_get()&OD_CPU_X86_SSE2)check_sse2();
+# endif
+#endif
   return 0;
 }
 #endif
@@ -802,6 +802,310 @@ int quant_pvq(ogg_int32_t *_x,const ogg_int32_t *_r,
   return m;
 }
 
+/*Fixed-point versions of the gain companding and search in quant_pvq().
+  These use only integer arithmetic, so the encoder makes the same decisions
+   no matter which compiler or CPU it runs on.*/
+
+/*The number of fractional bits in a companded gain.*/
+#define OD_CGAIN_SHIFT (8)
+
+/*(1+i/32)**(3/8) in Q15, for i=0...32.*/
+static const ogg_int32_t OD_PVQ_POW38_MANT[33]={
+  32768,33148,33521,33888,34248,34601,34949,35291,
+  35628,35959,36286,36607,36924,37237,37545,37849,
+  38149,38445,38738,39026,39312,39593,39872,40147,
+  40419,40689,40955,41218,41479,41737,41992,42245,
+  42495
+};
+
+/*2**(3*i/8) in Q15, for i=0...7.*/
+static const ogg_int32_t OD_PVQ_POW38_EXP[8]={
+  32768,42495,55109,71468,92682,120194,155872,202141
+};
+
+/*log2(1+i/32) in Q12, for i=0...32.*/
+static const ogg_int32_t OD_PVQ_LOG2_MANT[33]={
+     0, 182, 358, 530, 696, 858,1016,1169,
+  1319,1465,1607,1746,1882,2015,2145,2272,
+  2396,2518,2637,2754,2869,2982,3092,3200,
+  3307,3412,3514,3615,3715,3812,3908,4003,
+  4096
+};
+
+static int od_pvq_ilog64(ogg_int64_t _v){
+  ogg_uint32_t hi;
+  hi=(ogg_uint32_t)(_v>>32);
+  return hi?32+OD_ILOG_NZ(hi):OD_ILOG((ogg_uint32_t)_v);
+}
+
+/*Returns the top 16 bits of _v, which must be positive, as a mantissa in
+   [32768,65536), and stores the position of the top bit in _e.*/
+static ogg_int32_t od_pvq_mant(ogg_int64_t _v,int *_e){
+  int e;
+  e=od_pvq_ilog64(_v)-1;
+  *_e=e;
+  return (ogg_int32_t)(e>=15?_v>>(e-15):_v<<(15-e));
+}
+
+/*Interpolates one of the 33-entry tables above at the mantissa _m.*/
+static ogg_int32_t od_pvq_interp(const ogg_int32_t *_table,ogg_int32_t _m){
+  int i;
+  int frac;
+  i=(_m-32768)>>10;
+  frac=(_m-32768)&1023;
+  return _table[i]+((_table[i+1]-_table[i])*frac+512>>10);
+}
+
+/*Computes log2(_v) in Q12, for _v>0.*/
+static ogg_int32_t od_pvq_log2(ogg_uint32_t _v){
+  ogg_int32_t m;
+  int         e;
+  m=od_pvq_mant(_v,&e);
+  return (e<<12)+od_pvq_interp(OD_PVQ_LOG2_MANT,m);
+}
+
+static ogg_uint32_t od_pvq_isqrt(ogg_uint32_t _v){
+  ogg_uint32_t r;
+  ogg_uint32_t b;
+  r=0;
+  for(b=(ogg_uint32_t)1<<30;b>_v;b>>=2);
+  for(;b;b>>=2){
+    if(_v>=r+b){
+      _v-=r+b;
+      r=(r>>1)+b;
+    }
+    else r>>=1;
+  }
+  return r;
+}
+
+/*Computes the companded gain (_g2/(1.3*_q)**2)**(3/8) in Q8, where _g2 is
+   the squared L2-norm of a band.
+  This is the same as pow(sqrt(_g2),GAIN_EXP_1)/Q in quant_pvq().*/
+static ogg_int32_t od_pvq_compand(ogg_int64_t _g2,int _q){
+  ogg_int64_t num;
+  ogg_int64_t v;
+  ogg_int32_t c;
+  int         s;
+  int         e;
+  int         a;
+  num=_g2*100;
+  if(num<=0)return 0;
+  /*Compute the ratio with as many fractional bits as fit.*/
+  s=62-od_pvq_ilog64(num);
+  v=(num<<s)/(169*(ogg_int64_t)_q*_q);
+  if(v<=0)return 0;
+  c=od_pvq_interp(OD_PVQ_POW38_MANT,od_pvq_mant(v,&e));
+  /*The ratio is m*2**(e-s), and we split the exponent e-s into 8*a+b.*/
+  e-=s;
+  a=e>>3;
+  c=(ogg_int32_t)((ogg_int64_t)c*OD_PVQ_POW38_EXP[e&7]>>15);
+  /*c is now in Q15, and still needs to be scaled by 2**(3*a).*/
+  a=3*a-(15-OD_CGAIN_SHIFT);
+  if(a>=0)return c<<a;
+  return a>-31?c+(1<<-a>>1)>>-a:0;
+}
+
+/*Shifts _x into _y so that the largest magnitude is less than 2**12.
+  This keeps every product and sum of squares below in range.*/
+static void od_pvq_normalize(ogg_int32_t *_y,const ogg_int64_t *_x,int _n){
+  ogg_int64_t maxx;
+  int         s;
+  int         i;
+  maxx=0;
+  for(i=0;i<_n;i++)maxx=OD_MAXI(maxx,_x[i]<0?-_x[i]:_x[i]);
+  s=od_pvq_ilog64(maxx)-12;
+  for(i=0;i<_n;i++){
+    _y[i]=(ogg_int32_t)(s>0?_x[i]>>s:_x[i]<<-s);
+  }
+}
+
+/*A fixed-point version of the search in pvq_search_rdo() with lambda=0.
+  _x must have been normalized by od_pvq_normalize().*/
+static void od_pvq_search_fixed(const ogg_int32_t *_x,int _n,int _k,int *_y,
+ int _m){
+  ogg_int32_t a[MAXN];
+  ogg_int32_t rem[MAXN];
+  int         s[MAXN];
+  ogg_int64_t l1;
+  ogg_int64_t xy;
+  ogg_int64_t yy;
+  int         left;
+  int         i;
+  int         j;
+  l1=0;
+  for(i=0;i<_n;i++){
+    s[i]=_x[i]>0?1:-1;
+    a[i]=abs(_x[i]);
+    l1+=a[i];
+  }
+  if(l1==0){
+    /*There is no direction to follow, so put every pulse where the
+       prediction would have.*/
+    for(i=0;i<_n;i++)_y[i]=0;
+    _y[_m]=_k;
+    return;
+  }
+  left=_k;
+  xy=0;
+  yy=0;
+  /*Find the first pulses based on the projection.*/
+  for(i=0;i<_n;i++){
+    ogg_int64_t p;
+    p=(ogg_int64_t)_k*a[i];
+    _y[i]=(int)(p/l1);
+    rem[i]=(ogg_int32_t)(p-_y[i]*l1);
+    left-=_y[i];
+    xy+=(ogg_int64_t)a[i]*_y[i];
+    yy+=(ogg_int64_t)_y[i]*_y[i];
+  }
+  /*Add all but one of the remaining pulses where the projection was rounded
+     down the most.*/
+  while(left>1){
+    int best_id;
+    best_id=-1;
+    for(j=0;j<_n;j++){
+      if(rem[j]>=0&&(best_id<0||rem[j]>rem[best_id]))best_id=j;
+    }
+    rem[best_id]=-1;
+    _y[best_id]++;
+    left--;
+    xy+=a[best_id];
+    yy+=2*_y[best_id]-1;
+  }
+  /*Find the last pulse "the long way" by maximizing xy^2/yy.*/
+  if(left>0){
+    ogg_int64_t best_score;
+    int         best_id;
+    int         sh;
+    yy++;
+    sh=OD_MAXI(0,62-2*od_pvq_ilog64(xy+4096));
+    best_score=-1;
+    best_id=0;
+    for(j=0;j<_n;j++){
+      ogg_int64_t tmp_xy;
+      ogg_int64_t score;
+      tmp_xy=xy+a[j];
+      score=(tmp_xy*tmp_xy<<sh)/(yy+2*_y[j]);
+      if(score>best_score){
+        best_score=score;
+        best_id=j;
+      }
+    }
+    _y[best_id]++;
+  }
+  for(i=0;i<_n;i++)_y[i]*=s[i];
+}
+
+/** Fixed-point PVQ quantizer based on a reference
+ *
+ * This makes the same kind of decisions as quant_pvq(), but uses table-based
+ * gain companding and integer arithmetic for the gain RDO, the reflection
+ * and the pulse search. The number of pulses is still taken from
+ * pvq_unquant_k(), which uses floating point, exactly as the decoder
+ * computes it.
+ * Unlike quant_pvq(), _x is left unchanged: the caller reconstructs it from
+ * _y with dequant_pvq().
+ *
+ * @param [in]     _x     coefficients being quantized
+ * @param [in]     _r     reference
+ * @param [in]     _scale quantization matrix (unused for now)
+ * @param [out]    _y     quantization output (to be encoded)
+ * @param [in]     N      length of vectors _x, _y, and _scale
+ * @param [in]     Q      quantization resolution (lower means higher quality)
+ * @param [out]    qg     quantized gain (to be encoded)
+ *
+ * @retval position that should have the most pulses in _y
+ */
+int quant_pvq_fixed(const ogg_int32_t *_x,const ogg_int32_t *_r,
+    ogg_int16_t *_scale,int *y,int N,int _Q,int *qg){
+  ogg_int64_t  t[MAXN];
+  ogg_int32_t  x[MAXN];
+  ogg_int32_t  v[MAXN];
+  ogg_int64_t  g2;
+  ogg_int64_t  gr2;
+  ogg_int64_t  l2v;
+  ogg_int64_t  proj;
+  ogg_uint32_t vv;
+  ogg_int32_t  cg;
+  ogg_int32_t  cgr;
+  ogg_int32_t  cgq;
+  ogg_int32_t  log2_cgq;
+  ogg_int32_t  maxr;
+  int          i;
+  int          m;
+  int          s;
+  int          K;
+  int          ym;
+  int          q;
+  OD_ASSERT(N>1);
+  OD_ASSERT(N<=MAXN);
+  (void)_scale;
+  q=OD_MAXI(_Q,1);
+  g2=0;
+  gr2=0;
+  for(i=0;i<N;i++){
+    g2+=(ogg_int64_t)_x[i]*_x[i];
+    gr2+=(ogg_int64_t)_r[i]*_r[i];
+  }
+  /* compand gain of x and subtract a constant for "pseudo-RDO" purposes */
+  cg=od_pvq_compand(g2,q);
+  /* FIXME: Make that 0.2 adaptive */
+  cgr=od_pvq_compand(gr2,q)+(1<<OD_CGAIN_SHIFT)/5;
+  /* Doing some RDO on the gain, start by rounding down */
+  *qg=(cg-cgr)>>OD_CGAIN_SHIFT;
+  cgq=OD_MAXI(cgr+(*qg<<OD_CGAIN_SHIFT),1);
+  /* Cost difference between rounding up or down, with lambda/(Q*Q)=0.1 */
+  log2_cgq=od_pvq_log2(cgq+(1<<OD_CGAIN_SHIFT))-od_pvq_log2(cgq);
+  if(2*(cgq-cg)+(1<<OD_CGAIN_SHIFT)
+   +(205*((2<<12)+(ogg_int64_t)(N-1)*log2_cgq)+(1<<14)>>15)<0){
+    (*qg)++;
+  }
+  /* Use the same number of pulses as the decoder */
+  K=pvq_unquant_k(_r,N,*qg,_Q);
+  /* Pick component with largest magnitude. */
+  m=0;
+  maxr=-1;
+  for(i=0;i<N;i++){
+    if(abs(_r[i])>maxr){
+      maxr=abs(_r[i]);
+      m=i;
+    }
+  }
+  s=_r[m]>0?1:-1;
+  if(K==0){
+    for(i=0;i<N;i++)y[i]=0;
+  }
+  else{
+    /* Turn r into a Householder reflection vector that would reflect the
+       original r[] to e_m. */
+    for(i=0;i<N;i++)t[i]=_r[i];
+    od_pvq_normalize(v,t,N);
+    vv=0;
+    for(i=0;i<N;i++)vv+=(ogg_uint32_t)(v[i]*v[i]);
+    v[m]+=s*(ogg_int32_t)od_pvq_isqrt(vv);
+    /* Apply the reflection. The result is only correct up to a positive
+       scale factor, which does not change the search. */
+    for(i=0;i<N;i++)t[i]=_x[i];
+    od_pvq_normalize(x,t,N);
+    l2v=0;
+    proj=0;
+    for(i=0;i<N;i++){
+      l2v+=(ogg_int64_t)v[i]*v[i];
+      proj+=(ogg_int64_t)v[i]*x[i];
+    }
+    for(i=0;i<N;i++)t[i]=l2v>0?l2v*x[i]-2*proj*v[i]:x[i];
+    od_pvq_normalize(x,t,N);
+    od_pvq_search_fixed(x,N,K,y,m);
+  }
+  /* Move y[m] to the front */
+  ym=y[m];
+  for(i=m;i>=1;i--)y[i]=y[i-1];
+  /* Make y[0] positive when prediction is good  */
+  y[0]=-ym*s;
+  return m;
+}
+
 int pvq_unquant_k(const ogg_int32_t *_r,int _n,int _qg, int _scale){
   int    i;
   int    vk;
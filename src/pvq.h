@@ -46,6 +46,9 @@ int pvq_unquant_k(const ogg_int32_t *_r,int _n,int _qg, int _scale);
 int quant_pvq(ogg_int32_t *_x,const ogg_int32_t *_r,
     ogg_int16_t *_scale,int *y,int N,int Q,int *qg);
 
+int quant_pvq_fixed(const ogg_int32_t *_x,const ogg_int32_t *_r,
+    ogg_int16_t *_scale,int *y,int N,int Q,int *qg);
+
 void dequant_pvq(ogg_int32_t *_x,const ogg_int32_t *_r,
     ogg_int16_t *_scale,int N,int _Q,int qg);
 
@@ -0,0 +1,369 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include <math.h>
+#include <string.h>
+#include "ratectrl.h"
+#include "../include/daala/daalaenc.h"
+
+/*The exponents of the rate model for keyframes and inter frames.
+  Measured on test clips, the bits a frame takes fall off slightly faster
+   than the inverse of the quantizer scale for keyframes, and about as fast
+   for inter frames.*/
+static const double OD_RC_EXP[OD_RC_NFRAME_TYPES] = { 1.1, 1.0 };
+
+/*The bits per pixel the model starts out predicting for each frame type at a
+   scale of 10, before it has seen any frames.*/
+static const double OD_RC_INIT_BPP[OD_RC_NFRAME_TYPES] = { 2.0, 0.5 };
+
+/*The most frames we look ahead to budget bits in a single pass.*/
+#define OD_RC_HORIZON_MAX (256)
+/*The number of seconds over which an average bitrate encoder pays back what
+   it has over or under spent.*/
+#define OD_RC_ABR_DRAIN_SECS (4)
+/*The default buffer size, in seconds at the target bitrate.*/
+#define OD_RC_BUF_SECS_DEFAULT (1)
+
+#define OD_RC_SCALE_MIN (1)
+#define OD_RC_SCALE_MAX (511)
+
+static const unsigned char OD_RC_2PASS_MAGIC[4] = { 'O', 'D', '2', 'P' };
+#define OD_RC_2PASS_VERSION (1)
+
+/*Returns the size of the buffer in bits, for OD_RC_CBR.*/
+static double od_rc_buf_bits(const od_rc_state *rc) {
+  return rc->buf_sz > 0 ? rc->buf_sz
+   : (double)rc->target_bitrate*OD_RC_BUF_SECS_DEFAULT;
+}
+
+static void od_rc_reset_buffer(od_rc_state *rc) {
+  rc->bits_per_frame = rc->target_bitrate*rc->frame_time;
+  if (rc->mode == OD_RC_CBR) {
+    /*Start with a full buffer and try to keep it full, so that the bits it
+       holds are only spent on frames that need more than their share, like
+       keyframes.*/
+    rc->fullness = od_rc_buf_bits(rc);
+    rc->target_fullness = rc->fullness;
+  }
+  else {
+    rc->fullness = 0;
+    rc->target_fullness = 0;
+  }
+}
+
+void od_rc_init(od_rc_state *rc, const daala_info *info) {
+  double npixels;
+  int t;
+  memset(rc, 0, sizeof(*rc));
+  rc->mode = OD_RC_ABR;
+  rc->keyframe_rate = OD_MAXI(info->keyframe_rate, 1);
+  rc->frame_duration = info->frame_duration > 0 ? info->frame_duration : 1;
+  rc->frame_time = info->timebase_numerator > 0 ?
+   rc->frame_duration*(double)info->timebase_denominator/
+   info->timebase_numerator : 1.0/30;
+  npixels = 1.5*info->pic_width*info->pic_height;
+  for (t = 0; t < OD_RC_NFRAME_TYPES; t++) {
+    rc->exp[t] = OD_RC_EXP[t];
+    rc->log_scale[t] = log(OD_RC_INIT_BPP[t]*npixels) + rc->exp[t]*log(10);
+  }
+}
+
+void od_rc_clear(od_rc_state *rc) {
+  _ogg_free(rc->frames);
+}
+
+int od_rc_set_bitrate(od_rc_state *rc, ogg_int32_t bitrate) {
+  if (bitrate < 0) return OD_EINVAL;
+  rc->target_bitrate = bitrate;
+  od_rc_reset_buffer(rc);
+  return 0;
+}
+
+int od_rc_set_mode(od_rc_state *rc, int mode) {
+  if (mode != OD_RC_ABR && mode != OD_RC_CBR) return OD_EINVAL;
+  rc->mode = mode;
+  od_rc_reset_buffer(rc);
+  return 0;
+}
+
+int od_rc_set_buffer(od_rc_state *rc, ogg_int32_t buf_sz) {
+  if (buf_sz < 0) return OD_EINVAL;
+  rc->buf_sz = buf_sz;
+  od_rc_reset_buffer(rc);
+  return 0;
+}
+
+/*Starts collecting first pass statistics, if we have not yet.
+  Returns the statistics that have not been returned yet: the header the
+   first time, and then those of the frames coded since the last call.*/
+int od_rc_2pass_out(od_rc_state *rc, unsigned char **buf) {
+  int nbytes;
+  if (!rc->twopass_out) {
+    /*The statistics must cover every frame.*/
+    if (rc->nframes[0] + rc->nframes[1] > 0) return OD_EINVAL;
+    rc->twopass_out = 1;
+    memcpy(rc->twopass_buf, OD_RC_2PASS_MAGIC, 4);
+    rc->twopass_buf[4] = OD_RC_2PASS_VERSION;
+    rc->twopass_buf[5] = rc->twopass_buf[6] = rc->twopass_buf[7] = 0;
+    rc->twopass_nbytes = OD_RC_2PASS_HDR_SZ;
+  }
+  *buf = rc->twopass_buf;
+  nbytes = rc->twopass_nbytes;
+  rc->twopass_nbytes = 0;
+  return nbytes;
+}
+
+/*Returns whether there is room for the first pass statistics of another
+   frame, i.e., whether the caller has retrieved the earlier ones.*/
+int od_rc_2pass_ready(const od_rc_state *rc) {
+  return !rc->twopass_out || rc->twopass_nbytes + OD_RC_2PASS_FRAME_SZ
+   <= (int)sizeof(rc->twopass_buf);
+}
+
+/*Loads the statistics of every frame from a first pass, for a second pass.*/
+int od_rc_2pass_in(od_rc_state *rc, const unsigned char *buf,
+ size_t buf_sz) {
+  od_rc_2pass_frame *frames;
+  int nframes;
+  int fi;
+  int t;
+  if (buf_sz < OD_RC_2PASS_HDR_SZ || memcmp(buf, OD_RC_2PASS_MAGIC, 4) != 0
+   || buf[4] != OD_RC_2PASS_VERSION
+   || (buf_sz - OD_RC_2PASS_HDR_SZ) % OD_RC_2PASS_FRAME_SZ != 0) {
+    return OD_EINVAL;
+  }
+  nframes = (int)((buf_sz - OD_RC_2PASS_HDR_SZ)/OD_RC_2PASS_FRAME_SZ);
+  frames = (od_rc_2pass_frame *)_ogg_malloc(
+   OD_MAXI(nframes, 1)*sizeof(*frames));
+  if (frames == NULL) return OD_EFAULT;
+  for (t = 0; t < OD_RC_NFRAME_TYPES; t++) {
+    rc->twopass_rem[t] = 0;
+    rc->log_corr[t] = 0;
+  }
+  buf += OD_RC_2PASS_HDR_SZ;
+  for (fi = 0; fi < nframes; fi++) {
+    const unsigned char *p;
+    p = buf + fi*OD_RC_2PASS_FRAME_SZ;
+    frames[fi].is_keyframe = p[0] & 1;
+    frames[fi].scale = OD_MAXI(p[2] | p[3] << 8, 1);
+    frames[fi].bits = OD_MAXI((ogg_uint32_t)p[4] | (ogg_uint32_t)p[5] << 8
+     | (ogg_uint32_t)p[6] << 16 | (ogg_uint32_t)p[7] << 24, 1);
+    t = !frames[fi].is_keyframe;
+    rc->twopass_rem[t] +=
+     frames[fi].bits*pow(frames[fi].scale, rc->exp[t]);
+  }
+  _ogg_free(rc->frames);
+  rc->frames = frames;
+  rc->nframes_in = nframes;
+  rc->framei = 0;
+  return 0;
+}
+
+/*Picks the quantizer scale for the next frame.
+  The frame is of type t, and the model predicts it takes exp(log_cur) bits
+   at a scale of 1.
+  The frames we are budgeting for, including this one, are predicted to take
+   w[t]*scale**-exp[t] bits in total for each type t.*/
+static int od_rc_solve(od_rc_state *rc, int t, double log_cur,
+ const double *w, double budget) {
+  double lo;
+  double hi;
+  double x;
+  double max_bits;
+  int i;
+  /*The total is decreasing in the scale, so we bisect on log(scale).*/
+  lo = log(OD_RC_SCALE_MIN);
+  hi = log(OD_RC_SCALE_MAX);
+  for (i = 0; i < 24; i++) {
+    double total;
+    int u;
+    x = .5*(lo + hi);
+    total = 0;
+    for (u = 0; u < OD_RC_NFRAME_TYPES; u++) total += w[u]*exp(-rc->exp[u]*x);
+    if (total > budget) lo = x;
+    else hi = x;
+  }
+  x = hi;
+  if (rc->mode == OD_RC_CBR) {
+    /*Never let a frame empty the buffer.*/
+    max_bits = OD_MAXF(.875*rc->fullness, .25*rc->bits_per_frame);
+    if (log_cur - rc->exp[t]*x > log(max_bits)) {
+      x = (log_cur - log(max_bits))/rc->exp[t];
+    }
+  }
+  return OD_CLAMPI(OD_RC_SCALE_MIN, (int)floor(exp(x) + .5),
+   OD_RC_SCALE_MAX);
+}
+
+/*Returns the log of the cost the lookahead estimated for a frame, relative
+   to the average for frames of its type.*/
+static double od_rc_log_cplx(const od_rc_state *rc, const od_la_plan *plan) {
+  int t;
+  t = !plan->is_keyframe;
+  if (rc->ncosts[t] == 0) return 0;
+  return log(OD_MAXI(plan->cost, 1)) - rc->log_cost[t];
+}
+
+/*If nplan > 0, plan holds the types and costs the lookahead planned for the
+   current frame and the nplan - 1 frames after it.*/
+int od_rc_select_scale(od_rc_state *rc, int is_keyframe,
+ ogg_int64_t cur_time, const od_la_plan *plan, int nplan) {
+  double w[OD_RC_NFRAME_TYPES];
+  double budget;
+  double log_cur;
+  int t;
+  OD_ASSERT(rc->target_bitrate > 0);
+  OD_ASSERT(nplan == 0 || plan[0].is_keyframe == is_keyframe);
+  t = !is_keyframe;
+  rc->cur_cost = 0;
+  rc->log_cplx = 0;
+  if (rc->frames != NULL && rc->framei < rc->nframes_in) {
+    const od_rc_2pass_frame *frame;
+    int u;
+    int nrem;
+    /*Spend what is left of the budget on the rest of the file, using the
+       first pass to predict how much each frame takes.*/
+    frame = rc->frames + rc->framei;
+    rc->log_pred = log(frame->bits) + rc->exp[t]*log(frame->scale);
+    log_cur = rc->log_pred + rc->log_corr[t];
+    for (u = 0; u < OD_RC_NFRAME_TYPES; u++) {
+      w[u] = rc->twopass_rem[u]*exp(rc->log_corr[u]);
+    }
+    nrem = rc->nframes_in - rc->framei;
+    budget = nrem*rc->bits_per_frame + rc->fullness - rc->target_fullness;
+    budget = OD_MAXF(budget, .125*nrem*rc->bits_per_frame);
+  }
+  else {
+    double drain;
+    int horizon;
+    int n[OD_RC_NFRAME_TYPES];
+    int i;
+    /*Budget for the frames up to the next keyframe.*/
+    horizon = OD_MINI(rc->keyframe_rate, OD_RC_HORIZON_MAX);
+    if (nplan > 0) {
+      int key;
+      /*Use the frame types and costs the lookahead planned, and after that,
+         assume a keyframe every keyframe_rate frames.*/
+      w[0] = w[1] = 0;
+      key = -rc->since_key;
+      for (i = 0; i < horizon; i++) {
+        double cplx;
+        int u;
+        if (i < nplan) {
+          u = !plan[i].is_keyframe;
+          cplx = exp(od_rc_log_cplx(rc, plan + i));
+        }
+        else {
+          u = (i - key) % rc->keyframe_rate != 0;
+          cplx = 1;
+        }
+        if (u == 0) key = i;
+        w[u] += cplx*exp(rc->log_scale[u]);
+      }
+      rc->cur_cost = OD_MAXI(plan[0].cost, 1);
+      rc->log_cplx = od_rc_log_cplx(rc, plan);
+      rc->log_pred = log_cur = rc->log_scale[t] + rc->log_cplx;
+    }
+    else {
+      n[0] = n[1] = 0;
+      n[t]++;
+      for (i = 1; i < horizon; i++) {
+        n[(cur_time + i*(ogg_int64_t)rc->frame_duration)
+         % rc->keyframe_rate != 0]++;
+      }
+      rc->log_pred = log_cur = rc->log_scale[t];
+      w[0] = n[0]*exp(rc->log_scale[0]);
+      w[1] = n[1]*exp(rc->log_scale[1]);
+    }
+    drain = horizon;
+    if (rc->mode == OD_RC_ABR) {
+      drain = OD_MAXF(drain, OD_RC_ABR_DRAIN_SECS/rc->frame_time);
+    }
+    budget = horizon*rc->bits_per_frame
+     + (rc->fullness - rc->target_fullness)*horizon/drain;
+    budget = OD_MAXF(budget, .125*horizon*rc->bits_per_frame);
+  }
+  return od_rc_solve(rc, t, log_cur, w, budget);
+}
+
+/*Updates the model and the buffer with the bits a frame actually took.*/
+void od_rc_update(od_rc_state *rc, int is_keyframe, int scale,
+ ogg_uint32_t bits) {
+  double log_bits;
+  double alpha;
+  double cost_alpha;
+  int t;
+  t = !is_keyframe;
+  bits = OD_MAXI(bits, 1);
+  log_bits = log(bits);
+  /*Weigh the first few frames of each type more heavily, so that we quickly
+     get away from the initial guess, and then follow changes in the content
+     with a leaky average.
+    The correction to the first pass statistics is updated for every frame and
+     shares this weight, but the lookahead cost only counts the frames that had
+     one, so it gets its own.*/
+  alpha = OD_MAXF(1.0/(rc->nframes[t] + 1), t == 0 ? .5 : .25);
+  rc->log_scale[t] += alpha*(log_bits + rc->exp[t]*log(OD_MAXI(scale, 1))
+   - rc->log_cplx - rc->log_scale[t]);
+  rc->nframes[t]++;
+  if (rc->cur_cost > 0) {
+    cost_alpha = OD_MAXF(1.0/(rc->ncosts[t] + 1), t == 0 ? .5 : .25);
+    rc->log_cost[t] += cost_alpha*(log(rc->cur_cost) - rc->log_cost[t]);
+    rc->ncosts[t]++;
+  }
+  rc->since_key = is_keyframe ? 1 : rc->since_key + 1;
+  if (rc->target_bitrate > 0) {
+    if (rc->frames != NULL && rc->framei < rc->nframes_in) {
+      const od_rc_2pass_frame *frame;
+      int u;
+      frame = rc->frames + rc->framei;
+      rc->log_corr[t] += alpha*(log_bits
+       - (rc->log_pred - rc->exp[t]*log(OD_MAXI(scale, 1))) - rc->log_corr[t]);
+      u = !frame->is_keyframe;
+      rc->twopass_rem[u] -= frame->bits*pow(frame->scale, rc->exp[u]);
+      rc->twopass_rem[u] = OD_MAXF(rc->twopass_rem[u], 0);
+      rc->framei++;
+    }
+    rc->fullness += rc->bits_per_frame - bits;
+    if (rc->mode == OD_RC_CBR) {
+      /*Whatever the buffer cannot hold is wasted.*/
+      rc->fullness = OD_MINF(rc->fullness, od_rc_buf_bits(rc));
+    }
+  }
+  if (rc->twopass_out) {
+    unsigned char *p;
+    /*The encoder refuses to code a frame there is no room for.*/
+    OD_ASSERT(od_rc_2pass_ready(rc));
+    p = rc->twopass_buf + rc->twopass_nbytes;
+    p[0] = (unsigned char)is_keyframe;
+    p[1] = 0;
+    p[2] = (unsigned char)(scale & 0xFF);
+    p[3] = (unsigned char)(scale >> 8 & 0xFF);
+    p[4] = (unsigned char)(bits & 0xFF);
+    p[5] = (unsigned char)(bits >> 8 & 0xFF);
+    p[6] = (unsigned char)(bits >> 16 & 0xFF);
+    p[7] = (unsigned char)(bits >> 24 & 0xFF);
+    rc->twopass_nbytes += OD_RC_2PASS_FRAME_SZ;
+  }
+}
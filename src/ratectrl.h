@@ -0,0 +1,130 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#if !defined(_ratectrl_H)
+# define _ratectrl_H (1)
+# include "internal.h"
+# include "lookahead.h"
+# include "../include/daala/codec.h"
+
+typedef struct od_rc_state od_rc_state;
+
+/*The number of frame types the rate model tracks separately: keyframes and
+   inter frames.*/
+# define OD_RC_NFRAME_TYPES (2)
+
+/*The size in bytes of the header at the start of the 2-pass statistics.*/
+# define OD_RC_2PASS_HDR_SZ (8)
+/*The size in bytes of the statistics for each frame.*/
+# define OD_RC_2PASS_FRAME_SZ (8)
+
+/*The statistics the first pass collects about one frame.*/
+typedef struct {
+  int is_keyframe;
+  /*The quantizer scale the frame was coded with.*/
+  int scale;
+  /*The number of bits the frame took.*/
+  ogg_uint32_t bits;
+} od_rc_2pass_frame;
+
+/*The rate control state.
+  We model the number of bits a frame takes as
+   log(bits) = log_scale[t] + log(cplx) - exp[t]*log(scale),
+   where t is the frame type, and cplx is its cost estimated by the lookahead
+   relative to the average for that type, or 1 without a lookahead.
+  Before each frame we pick the single quantizer scale that the model says
+   spends the bits budgeted for the next few frames (or the rest of the file
+   in the second pass), and afterwards we update log_scale[t] with what the
+   frame actually took.*/
+struct od_rc_state {
+  /*The target bitrate in bits per second, or 0 if rate control is off.*/
+  ogg_int32_t target_bitrate;
+  /*OD_RC_ABR or OD_RC_CBR.*/
+  int mode;
+  /*The size of the buffer in bits, for OD_RC_CBR.*/
+  ogg_int32_t buf_sz;
+  /*The keyframe interval and the duration of each frame, in time units.*/
+  int keyframe_rate;
+  ogg_uint32_t frame_duration;
+  /*The number of seconds each frame lasts.*/
+  double frame_time;
+  /*The number of bits the target bitrate allows each frame.*/
+  double bits_per_frame;
+  /*For OD_RC_ABR, the total number of bits we are under budget so far.
+    For OD_RC_CBR, the number of bits in the decoder's buffer.*/
+  double fullness;
+  /*The fullness we try to return to.*/
+  double target_fullness;
+  double log_scale[OD_RC_NFRAME_TYPES];
+  double exp[OD_RC_NFRAME_TYPES];
+  /*The number of frames of each type coded so far.*/
+  int nframes[OD_RC_NFRAME_TYPES];
+  /*The average of the log of the lookahead cost of the frames of each type,
+     and the number of frames it was taken over.*/
+  double log_cost[OD_RC_NFRAME_TYPES];
+  int ncosts[OD_RC_NFRAME_TYPES];
+  /*The lookahead cost of the current frame, or 0 if there is none, and the
+     log of its cplx in the model.*/
+  ogg_int32_t cur_cost;
+  double log_cplx;
+  /*The number of frames from the last keyframe to the current frame.*/
+  int since_key;
+  /*The model's prediction of the log of the bits the current frame takes,
+     with no second pass correction.*/
+  double log_pred;
+  /*Whether we are collecting statistics for a first pass.*/
+  int twopass_out;
+  /*The first pass statistics not yet returned by od_rc_2pass_out().
+    With a lookahead, the frames left in it are all coded at the end of the
+     stream before they can be returned.*/
+  unsigned char twopass_buf[OD_RC_2PASS_HDR_SZ
+   + OD_RC_2PASS_FRAME_SZ*(OD_LA_DEPTH_MAX + 1)];
+  int twopass_nbytes;
+  /*The first pass statistics of every frame, for the second pass, or NULL.*/
+  od_rc_2pass_frame *frames;
+  int nframes_in;
+  /*The index of the current frame in frames.*/
+  int framei;
+  /*The sum of bits*scale**exp[t] over the remaining first pass frames of
+     each type: this is the number of bits they take at a scale of 1.*/
+  double twopass_rem[OD_RC_NFRAME_TYPES];
+  /*The log of the ratio between the bits the second pass spends and what
+     the first pass predicted, for each frame type.*/
+  double log_corr[OD_RC_NFRAME_TYPES];
+};
+
+void od_rc_init(od_rc_state *rc, const daala_info *info);
+void od_rc_clear(od_rc_state *rc);
+int od_rc_set_bitrate(od_rc_state *rc, ogg_int32_t bitrate);
+int od_rc_set_mode(od_rc_state *rc, int mode);
+int od_rc_set_buffer(od_rc_state *rc, ogg_int32_t buf_sz);
+int od_rc_2pass_out(od_rc_state *rc, unsigned char **buf);
+int od_rc_2pass_ready(const od_rc_state *rc);
+int od_rc_2pass_in(od_rc_state *rc, const unsigned char *buf, size_t buf_sz);
+int od_rc_select_scale(od_rc_state *rc, int is_keyframe,
+ ogg_int64_t cur_time, const od_la_plan *plan, int nplan);
+void od_rc_update(od_rc_state *rc, int is_keyframe, int scale,
+ ogg_uint32_t bits);
+
+#endif
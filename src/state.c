@@ -23,6 +23,7 @@ OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 
 #include <stddef.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -39,7 +40,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
    (relatively) unrestricted motion vectors without special casing reading
    outside the image boundary.
   If chroma is decimated in either direction, the padding is reduced by an
-   appropriate factor on the appropriate sides.*/
+   appropriate factor on the appropriate sides.
+  If _state->native_refs is set, the reference images are instead stored at
+   their native resolution with no padding at all, since motion compensation
+   reads them through od_state_upsample_patch8(), which clamps every access
+   to the frame.*/
 static void od_state_ref_imgs_init(od_state *_state,int _nrefs,int _nio){
   daala_info    *info;
   od_img        *img;
@@ -63,7 +68,11 @@ static void od_state_ref_imgs_init(od_state *_state,int _nrefs,int _nio){
      >>info->plane_info[pli].xdec;
     plane_buf_height=_state->frame_height+(OD_UMV_PADDING<<1)
      >>info->plane_info[pli].ydec;
-    data_sz+=plane_buf_width*plane_buf_height*_nrefs<<2;
+    if(_state->native_refs){
+      data_sz+=(_state->frame_width>>info->plane_info[pli].xdec)*
+       (size_t)(_state->frame_height>>info->plane_info[pli].ydec)*_nrefs;
+    }
+    else data_sz+=plane_buf_width*plane_buf_height*_nrefs<<2;
 #if defined(OD_DUMP_IMAGES)
     /*Reserve space for this plane in 1 visualization image.*/
     data_sz+=plane_buf_width*plane_buf_height<<2;
@@ -74,21 +83,29 @@ static void od_state_ref_imgs_init(od_state *_state,int _nrefs,int _nio){
   /*Reserve space for the line buffer in the up-sampler.*/
   data_sz+=(_state->frame_width+(OD_UMV_PADDING<<1)<<1)*8;
   _state->ref_img_data=ref_img_data=(unsigned char *)_ogg_malloc(data_sz);
+  if(ref_img_data==NULL)return;
   /*Fill in the reference image structures.*/
   for(imgi=0;imgi<_nrefs;imgi++){
     img=_state->ref_imgs+imgi;
     img->nplanes=info->nplanes;
-    img->width=_state->frame_width<<1;
-    img->height=_state->frame_height<<1;
+    img->width=_state->frame_width<<!_state->native_refs;
+    img->height=_state->frame_height<<!_state->native_refs;
     for(pli=0;pli<img->nplanes;pli++){
-      plane_buf_width=(_state->frame_width+(OD_UMV_PADDING<<1)<<1)
-       >>info->plane_info[pli].xdec;
-      plane_buf_height=(_state->frame_height+(OD_UMV_PADDING<<1)<<1)
-       >>info->plane_info[pli].ydec;
       iplane=img->planes+pli;
-      iplane->data=ref_img_data
-       +((OD_UMV_PADDING<<1)>>info->plane_info[pli].xdec)
-       +plane_buf_width*((OD_UMV_PADDING<<1)>>info->plane_info[pli].ydec);
+      if(_state->native_refs){
+        plane_buf_width=_state->frame_width>>info->plane_info[pli].xdec;
+        plane_buf_height=_state->frame_height>>info->plane_info[pli].ydec;
+        iplane->data=ref_img_data;
+      }
+      else{
+        plane_buf_width=(_state->frame_width+(OD_UMV_PADDING<<1)<<1)
+         >>info->plane_info[pli].xdec;
+        plane_buf_height=(_state->frame_height+(OD_UMV_PADDING<<1)<<1)
+         >>info->plane_info[pli].ydec;
+        iplane->data=ref_img_data
+         +((OD_UMV_PADDING<<1)>>info->plane_info[pli].xdec)
+         +plane_buf_width*((OD_UMV_PADDING<<1)>>info->plane_info[pli].ydec);
+      }
       ref_img_data+=plane_buf_width*plane_buf_height;
       iplane->xdec=info->plane_info[pli].xdec;
       iplane->ydec=info->plane_info[pli].ydec;
@@ -155,10 +172,25 @@ static void od_state_mvs_init(od_state *_state){
 }
 
 void od_state_opt_vtbl_init_c(od_state *_state){
+  int bsi;
   _state->opt_vtbl.mc_predict1imv8=od_mc_predict1imv8_c;
   _state->opt_vtbl.mc_predict1fmv8=od_mc_predict1fmv8_c;
   _state->opt_vtbl.mc_blend_full8=od_mc_blend_full8_c;
   _state->opt_vtbl.mc_blend_full_split8=od_mc_blend_full_split8_c;
+  _state->opt_vtbl.mc_blend_multi8=od_mc_blend_multi8_c;
+  _state->opt_vtbl.mc_blend_multi_split8=od_mc_blend_multi_split8_c;
+  _state->opt_vtbl.upsample_hrow8=od_upsample_hrow8_c;
+  _state->opt_vtbl.upsample_vrow8=od_upsample_vrow8_c;
+  _state->opt_vtbl.mc_sad8=od_mc_sad8_c;
+  _state->opt_vtbl.mc_sad_multi8=od_mc_sad_multi8_c;
+  _state->opt_vtbl.block_var4_row8=od_block_var4_row8_c;
+  for(bsi=0;bsi<OD_NBSIZES;bsi++){
+    _state->opt_vtbl.fdct_2d[bsi]=OD_FDCT_2D[bsi];
+    _state->opt_vtbl.idct_2d[bsi]=OD_IDCT_2D[bsi];
+    _state->opt_vtbl.intra_get[bsi]=OD_INTRA_GET[bsi];
+    _state->opt_vtbl.intra_dist[bsi]=OD_INTRA_DIST[bsi];
+  }
+  _state->opt_vtbl.filter=OD_FILTER_VTBL_C;
 }
 
 static void od_state_opt_vtbl_init(od_state *_state){
@@ -203,6 +235,19 @@ int od_state_init(od_state *_state,const daala_info *_info){
   return 0;
 }
 
+/*Selects whether reference images are stored at their native resolution
+   (_native_refs non-zero) or upsampled by a factor of two in each direction.
+  This reallocates all of the image buffers, so it may only be done before
+   the first frame is coded.*/
+int od_state_set_native_refs(od_state *_state,int _native_refs){
+  _native_refs=!!_native_refs;
+  if(_native_refs==_state->native_refs)return 0;
+  _ogg_free(_state->ref_img_data);
+  _state->native_refs=_native_refs;
+  od_state_ref_imgs_init(_state,4,2);
+  return _state->ref_img_data==NULL?OD_EFAULT:0;
+}
+
 void od_state_clear(od_state *_state){
   int nplanes;
   int pli;
@@ -317,20 +362,85 @@ void od_state_upsample8(od_state *_state,int _refi){
   }
 }
 #else
-/*Upsamples the reconstructed image to a reference image.
-  TODO: Pipeline with reconstruction.*/
-void od_state_upsample8(od_state *_state,od_img *_dst,const od_img *_src){
+/*Upsamples _n pixels of one row by a factor of two: each pixel is followed
+   by the half-pel sample between it and the next one.
+  This reads _src[-2..._n+2].*/
+void od_upsample_hrow8_c(unsigned char *_dst,const unsigned char *_src,
+ int _n){
+  int x;
+  for(x=0;x<_n;x++){
+    _dst[x<<1]=_src[x];
+    _dst[x<<1|1]=OD_CLAMP255(20*(_src[x]+_src[x+1])-
+     5*(_src[x-1]+_src[x+2])+_src[x-2]+_src[x+3]+16>>5);
+  }
+}
+
+/*Computes _n samples of the half-pel row between _src[2] and _src[3].*/
+void od_upsample_vrow8_c(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n){
+  int x;
+  for(x=0;x<_n;x++){
+    _dst[x]=OD_CLAMP255(20*(_src[2][x]+_src[3][x])-
+     5*(_src[1][x]+_src[4][x])+_src[0][x]+_src[5][x]+16>>5);
+  }
+}
+
+/*Horizontally upsamples one row of a plane of width _w into _buf, including
+   _xpad pixels of padding on either side.
+  Only the pixels near the edges are special-cased here; the rest are left
+   to the accelerated row filter.*/
+static void od_state_upsample_hrow8(od_state *_state,unsigned char *_buf,
+ const unsigned char *_src,int _w,int _xpad){
+  int x;
+  memset(_buf-(_xpad<<1),_src[0],_xpad-2<<1);
+  *(_buf-4)=_src[0];
+  *(_buf-3)=OD_CLAMP255(31*_src[0]+_src[1]+16>>5);
+  *(_buf-2)=_src[0];
+  *(_buf-1)=OD_CLAMP255(36*_src[0]-5*_src[1]+_src[1]+16>>5);
+  _buf[0]=_src[0];
+  _buf[1]=OD_CLAMP255(20*(_src[0]+_src[1])-
+   5*(_src[0]+_src[2])+_src[0]+_src[3]+16>>5);
+  _buf[2]=_src[1];
+  _buf[3]=OD_CLAMP255(20*(_src[1]+_src[2])-
+   5*(_src[0]+_src[3])+_src[0]+_src[4]+16>>5);
+  (*_state->opt_vtbl.upsample_hrow8)(_buf+4,_src+2,_w-5);
+  x=_w-3;
+  _buf[x<<1]=_src[x];
+  _buf[x<<1|1]=OD_CLAMP255(20*(_src[x]+_src[x+1])-
+   5*(_src[x-1]+_src[x+2])+_src[x-2]+_src[x+2]+16>>5);
+  x++;
+  _buf[x<<1]=_src[x];
+  _buf[x<<1|1]=OD_CLAMP255(20*(_src[x]+_src[x+1])-
+   5*(_src[x-1]+_src[x+1])+_src[x-2]+_src[x+1]+16>>5);
+  x++;
+  _buf[x<<1]=_src[x];
+  _buf[x<<1|1]=OD_CLAMP255(36*_src[x]-5*_src[x-1]+_src[x-2]+16>>5);
+  x++;
+  _buf[x<<1]=_src[_w-1];
+  _buf[x<<1|1]=OD_CLAMP255(31*_src[_w-1]+_src[_w-2]+16>>5);
+  memset(_buf+(++x<<1),_src[_w-1],_xpad-1<<1);
+}
+
+/*Upsamples rows [_y0,_y1) of the reconstructed image (in luma units) to a
+   reference image, along with the padding to their left and right.
+  If _y0 is 0 or _y1 is the height of the image, the padding above or below
+   it is filled in as well.
+  Each output row depends on the 3 source rows below it, so those must be
+   final too.
+  This uses _state->ref_line_buf, so only one thread may call it at a time.*/
+void od_state_upsample8_rows(od_state *_state,od_img *_dst,
+ const od_img *_src,int _y0,int _y1){
   int pli;
-  for(pli=0;pli<_state->io_imgs[OD_FRAME_REC].nplanes;pli++){
+  for(pli=0;pli<_src->nplanes;pli++){
     const od_img_plane  *siplane;
     od_img_plane        *diplane;
-    const unsigned char *src;
     unsigned char       *dst;
     int                  xpad;
     int                  ypad;
     int                  w;
     int                  h;
-    int                  x;
+    int                  y0;
+    int                  y1;
     int                  y;
     siplane=_src->planes+pli;
     diplane=_dst->planes+pli;
@@ -338,99 +448,211 @@ void od_state_upsample8(od_state *_state,od_img *_dst,const od_img *_src){
     ypad=OD_UMV_PADDING>>siplane->ydec;
     w=_src->width>>siplane->xdec;
     h=_src->height>>siplane->ydec;
-    src=siplane->data;
-    dst=diplane->data-(diplane->ystride<<1)*ypad;
-    for(y=-ypad;y<h+ypad+3;y++){
-      /*Horizontal filtering:*/
-      if(y<h+ypad){
-        unsigned char *buf;
-        buf=_state->ref_line_buf[y&7];
-        memset(buf-(xpad<<1),src[0],xpad-2<<1);
-        /*for(x=-xpad;x<-2;x++){
-          *(buf+(x<<1))=src[0];
-          *(buf+(x<<1|1))=src[0];
-        }*/
-        *(buf-4)=src[0];
-        *(buf-3)=OD_CLAMP255(31*src[0]+src[1]+16>>5);
-        *(buf-2)=src[0];
-        *(buf-1)=OD_CLAMP255(36*src[0]-5*src[1]+src[1]+16>>5);
-        buf[0]=src[0];
-        buf[1]=OD_CLAMP255(20*(src[0]+src[1])-
-         5*(src[0]+src[2])+src[0]+src[3]+16>>5);
-        buf[2]=src[1];
-        buf[3]=OD_CLAMP255(20*(src[1]+src[2])-
-         5*(src[0]+src[3])+src[0]+src[4]+16>>5);
-        for(x=2;x<w-3;x++){
-          buf[x<<1]=src[x];
-          buf[x<<1|1]=OD_CLAMP255(20*(src[x]+src[x+1])-
-           5*(src[x-1]+src[x+2])+src[x-2]+src[x+3]+16>>5);
-        }
-        buf[x<<1]=src[x];
-        buf[x<<1|1]=OD_CLAMP255(20*(src[x]+src[x+1])-
-         5*(src[x-1]+src[x+2])+src[x-2]+src[x+2]+16>>5);
-        x++;
-        buf[x<<1]=src[x];
-        buf[x<<1|1]=OD_CLAMP255(20*(src[x]+src[x+1])-
-         5*(src[x-1]+src[x+1])+src[x-2]+src[x+1]+16>>5);
-        x++;
-        buf[x<<1]=src[x];
-        buf[x<<1|1]=OD_CLAMP255(36*src[x]-5*src[x-1]+src[x-2]+16>>5);
-        x++;
-        buf[x<<1]=src[w-1];
-        buf[x<<1|1]=OD_CLAMP255(31*src[w-1]+src[w-2]+16>>5);
-        memset(buf+(++x<<1),src[w-1],xpad-1<<1);
-        /*for(x++;x<w+xpad;x++){
-          buf[x<<1]=src[w-1];
-          buf[x<<1|1]=src[w-1];
-        }*/
-        if(y>=0&&y+1<h)src+=siplane->ystride;
-      }
+    y0=_y0>0?_y0>>siplane->ydec:-ypad;
+    y1=_y1<_src->height?_y1>>siplane->ydec:h+ypad;
+    if(y0>=y1)continue;
+    /*Horizontally filter the rows above the first one we output.*/
+    for(y=y0-2;y<y0+3;y++){
+      od_state_upsample_hrow8(_state,_state->ref_line_buf[y&7],
+       siplane->data+OD_CLAMPI(0,y,h-1)*siplane->ystride,w,xpad);
+    }
+    dst=diplane->data+(diplane->ystride<<1)*y0;
+    for(y=y0;y<y1;y++){
+      od_state_upsample_hrow8(_state,_state->ref_line_buf[y+3&7],
+       siplane->data+OD_CLAMPI(0,y+3,h-1)*siplane->ystride,w,xpad);
+      memcpy(dst-(xpad<<1),_state->ref_line_buf[y&7]-(xpad<<1),
+       w+(xpad<<1)<<1);
+      dst+=diplane->ystride;
       /*Vertical filtering:*/
-      if(y>=-ypad+3){
-        if(y<1||y>h+3){
-          memcpy(dst-(xpad<<1),_state->ref_line_buf[y-3&7]-(xpad<<1),
-           w+(xpad<<1)<<1);
-          /*fprintf(stderr,"%3i: ",y-3<<1);
-          for(x=-xpad<<1;x<w+xpad<<1;x++)fprintf(stderr,"%02X",*(dst+x));
-          fprintf(stderr,"\n");*/
-          dst+=diplane->ystride;
-          memcpy(dst-(xpad<<1),_state->ref_line_buf[y-3&7]-(xpad<<1),
-           w+(xpad<<1)<<1);
-          /*fprintf(stderr,"%3i: ",y-3<<1|1);
-          for(x=-xpad<<1;x<w+xpad<<1;x++)fprintf(stderr,"%02X",*(dst+x));
-          fprintf(stderr,"\n");*/
-          dst+=diplane->ystride;
-        }
-        else{
-          unsigned char *buf[6];
-          buf[0]=_state->ref_line_buf[y-5&7];
-          buf[1]=_state->ref_line_buf[y-4&7];
-          buf[2]=_state->ref_line_buf[y-3&7];
-          buf[3]=_state->ref_line_buf[y-2&7];
-          buf[4]=_state->ref_line_buf[y-1&7];
-          buf[5]=_state->ref_line_buf[y-0&7];
-          memcpy(dst-(xpad<<1),_state->ref_line_buf[y-3&7]-(xpad<<1),
-           w+(xpad<<1)<<1);
-          /*fprintf(stderr,"%3i: ",y-3<<1);
-          for(x=-xpad<<1;x<w+xpad<<1;x++)fprintf(stderr,"%02X",*(dst+x));
-          fprintf(stderr,"\n");*/
-          dst+=diplane->ystride;
-          for(x=-xpad<<1;x<w+xpad<<1;x++){
-            *(dst+x)=OD_CLAMP255(20*(*(buf[2]+x)+*(buf[3]+x))-
-             5*(*(buf[1]+x)+*(buf[4]+x))+
-             *(buf[0]+x)+*(buf[5]+x)+16>>5);
-          }
-          /*fprintf(stderr,"%3i: ",y-3<<1|1);
-          for(x=-xpad<<1;x<w+xpad<<1;x++)fprintf(stderr,"%02X",*(dst+x));
-          fprintf(stderr,"\n");*/
-          dst+=diplane->ystride;
-        }
+      if(y<-2||y>h){
+        /*Every tap reads the same clamped row.*/
+        memcpy(dst-(xpad<<1),_state->ref_line_buf[y&7]-(xpad<<1),
+         w+(xpad<<1)<<1);
+      }
+      else{
+        const unsigned char *buf[6];
+        int                  k;
+        for(k=0;k<6;k++)buf[k]=_state->ref_line_buf[y-2+k&7]-(xpad<<1);
+        (*_state->opt_vtbl.upsample_vrow8)(dst-(xpad<<1),buf,w+(xpad<<1)<<1);
       }
+      dst+=diplane->ystride;
     }
   }
 }
+
+/*Upsamples the reconstructed image to a reference image.*/
+void od_state_upsample8(od_state *_state,od_img *_dst,const od_img *_src){
+  od_state_upsample8_rows(_state,_dst,_src,0,_src->height);
+}
 #endif
 
+/*Computes sample _x of the horizontally upsampled version of row _src of
+   width _w, with exactly the edge handling used by od_state_upsample8().
+  _x is in upsampled units and may lie anywhere, even outside the padding.*/
+static unsigned char od_upsample_sample8(const unsigned char *_src,int _w,
+ int _x){
+  int x;
+  x=_x>>1;
+  if(!(_x&1))return _src[OD_CLAMPI(0,x,_w-1)];
+  if(x<-2)return _src[0];
+  if(x==-2)return (unsigned char)OD_CLAMP255(31*_src[0]+_src[1]+16>>5);
+  if(x==-1)return (unsigned char)OD_CLAMP255(36*_src[0]-4*_src[1]+16>>5);
+  if(x==_w)return (unsigned char)OD_CLAMP255(31*_src[_w-1]+_src[_w-2]+16>>5);
+  if(x>_w)return _src[_w-1];
+  return (unsigned char)OD_CLAMP255(
+   20*(_src[x]+_src[OD_MINI(x+1,_w-1)])
+   -5*(_src[OD_MAXI(x-1,0)]+_src[OD_MINI(x+2,_w-1)])
+   +_src[OD_MAXI(x-2,0)]+_src[OD_MINI(x+3,_w-1)]+16>>5);
+}
+
+/*Horizontally upsamples the _n samples of row _src starting at _x0.*/
+static void od_upsample_row8(unsigned char *_dst,const unsigned char *_src,
+ int _w,int _x0,int _n){
+  int i;
+  for(i=0;i<_n;i++){
+    int x;
+    x=_x0+i>>1;
+    if(x>=2&&x<_w-3){
+      _dst[i]=(unsigned char)(_x0+i&1?OD_CLAMP255(20*(_src[x]+_src[x+1])-
+       5*(_src[x-1]+_src[x+2])+_src[x-2]+_src[x+3]+16>>5):_src[x]);
+    }
+    else _dst[i]=od_upsample_sample8(_src,_w,_x0+i);
+  }
+}
+
+/*Fills in the _pw by _ph rectangle at (_x0,_y0) (in upsampled units) of the
+   upsampled version of a native-resolution reference plane.
+  The result is bit-exact with what od_state_upsample8() would have stored at
+   the same positions, so the motion compensation kernels can run on it
+   unchanged.
+  _hbuf: Scratch space for ((_ph+1>>1)+6)*_pw horizontally filtered
+          samples.*/
+static void od_state_upsample_patch8(unsigned char *_dst,int _dystride,
+ unsigned char *_hbuf,const od_img_plane *_iplane,int _w,int _h,
+ int _x0,int _y0,int _pw,int _ph){
+  int r0;
+  int r1;
+  int r;
+  int y;
+  int x;
+  /*Horizontally filter every source row that the vertical filter touches.*/
+  r0=(_y0>>1)-2;
+  r1=(_y0+_ph-1>>1)+3;
+  for(r=r0;r<=r1;r++){
+    od_upsample_row8(_hbuf+(r-r0)*_pw,
+     _iplane->data+OD_CLAMPI(0,r,_h-1)*_iplane->ystride,_w,_x0,_pw);
+  }
+  for(y=_y0;y<_y0+_ph;y++){
+    const unsigned char *buf;
+    buf=_hbuf+((y>>1)-r0)*_pw;
+    if(!(y&1))memcpy(_dst,buf,_pw);
+    else{
+      for(x=0;x<_pw;x++){
+        _dst[x]=(unsigned char)OD_CLAMP255(20*(buf[x]+buf[_pw+x])-
+         5*(buf[x-_pw]+buf[2*_pw+x])+buf[x-2*_pw]+buf[3*_pw+x]+16>>5);
+      }
+    }
+    _dst+=_dystride;
+  }
+}
+
+/*Fills in a patch exactly like od_state_upsample_patch8(), but with the
+   accelerated row filters used by od_state_upsample8_rows().
+  Those work on whole rows, so this is only worthwhile for patches that span
+   most of the width of the plane.
+  _hbuf: Scratch space for od_state_upsample_band8_hbuf_sz() bytes.*/
+static void od_state_upsample_band8(od_state *_state,unsigned char *_dst,
+ int _dystride,unsigned char *_hbuf,const od_img_plane *_iplane,int _w,int _h,
+ int _x0,int _y0,int _pw,int _ph){
+  int xpad;
+  int hstride;
+  int r0;
+  int r1;
+  int r;
+  int y;
+  /*Pad the horizontally filtered rows far enough to cover the patch.*/
+  xpad=OD_MAXI(OD_MAXI(2,1-_x0>>1),_x0+_pw-(_w<<1)+1>>1);
+  hstride=_w+(xpad<<1)<<1;
+  r0=(_y0>>1)-2;
+  r1=(_y0+_ph-1>>1)+3;
+  for(r=r0;r<=r1;r++){
+    od_state_upsample_hrow8(_state,_hbuf+(r-r0)*hstride+(xpad<<1),
+     _iplane->data+OD_CLAMPI(0,r,_h-1)*_iplane->ystride,_w,xpad);
+  }
+  /*Point at sample _x0 of the first row.*/
+  _hbuf+=(xpad<<1)+_x0;
+  for(y=_y0;y<_y0+_ph;y++){
+    const unsigned char *buf;
+    buf=_hbuf+((y>>1)-r0)*hstride;
+    if(!(y&1))memcpy(_dst,buf,_pw);
+    else{
+      const unsigned char *src[6];
+      int                  k;
+      for(k=0;k<6;k++)src[k]=buf+(k-2)*hstride;
+      (*_state->opt_vtbl.upsample_vrow8)(_dst,src,_pw);
+    }
+    _dst+=_dystride;
+  }
+}
+
+/*Returns the size of the scratch space od_state_upsample_band8() needs.*/
+static size_t od_state_upsample_band8_hbuf_sz(int _w,int _x0,int _y0,
+ int _pw,int _ph){
+  int xpad;
+  xpad=OD_MAXI(OD_MAXI(2,1-_x0>>1),_x0+_pw-(_w<<1)+1>>1);
+  return ((_y0+_ph-1>>1)-(_y0>>1)+6)*(size_t)(_w+(xpad<<1)<<1);
+}
+
+/*Stores rows [_y0,_y1) of the reconstructed frame (in luma units) in the
+   reference image _refi, with the same conventions as
+   od_state_upsample8_rows().
+  Normally this upsamples them, but if _state->native_refs is set, they are
+   copied as is and upsampled on the fly during motion compensation.*/
+void od_state_store_ref8_rows(od_state *_state,int _refi,int _y0,int _y1){
+  od_img *dst;
+  od_img *src;
+  int     pli;
+  int     y;
+  dst=_state->ref_imgs+_refi;
+  src=_state->io_imgs+OD_FRAME_REC;
+  if(!_state->native_refs){
+    od_state_upsample8_rows(_state,dst,src,_y0,_y1);
+    return;
+  }
+  for(pli=0;pli<src->nplanes;pli++){
+    od_img_plane *siplane;
+    od_img_plane *diplane;
+    int           w;
+    int           y1;
+    siplane=src->planes+pli;
+    diplane=dst->planes+pli;
+    w=src->width>>siplane->xdec;
+    y1=OD_MINI(_y1,src->height)>>siplane->ydec;
+    for(y=OD_MAXI(_y0,0)>>siplane->ydec;y<y1;y++){
+      memcpy(diplane->data+y*diplane->ystride,
+       siplane->data+y*siplane->ystride,w);
+    }
+  }
+}
+
+/*Stores the rows of the reconstructed frame in the reference image _refi
+   that become final once super block row _sby has been finished.
+  The rows must be finished in order.*/
+void od_state_store_ref8_sb_row(od_state *_state,int _refi,int _sby){
+  int y0;
+  int y1;
+  /*Stay 8 luma rows behind the finished rows, so that the upsampler can
+     read the 3 rows below each output row even in a decimated plane.*/
+  y0=_sby>0?(_sby<<5)-8:0;
+  y1=_sby+1<_state->nvsb?(_sby+1<<5)-8:_state->frame_height;
+  od_state_store_ref8_rows(_state,_refi,y0,y1);
+}
+
+/*Stores the whole reconstructed frame in the reference image _refi.*/
+void od_state_store_ref8(od_state *_state,int _refi){
+  od_state_store_ref8_rows(_state,_refi,0,_state->frame_height);
+}
+
 /*The data used to build the following two arrays.*/
 const int OD_VERT_D[22]={
 /*0 1     4 5     8 9     12 13      17 18*/
@@ -467,8 +689,106 @@ const int *const OD_VERT_SETUP_DY[4][4]={
 };
 
 
-void od_state_pred_block_from_setup(od_state *_state,unsigned char *_buf,
- int _ystride,int _ref,int _pli,int _vx,int _vy,int _c,int _s,int _log_mvb_sz){
+/*The size of the stack buffer used to hold the upsampled patch of a
+   native-resolution reference plane (and its scratch rows) for one block.
+  This is enough for 16x16 blocks whose corner vectors differ by up to about
+   40 pixels; blocks with larger differences use the heap.*/
+#define OD_MC_PATCH_BUF_SZ (32768)
+
+/*How many times faster od_state_upsample_band8() fills in a sample than
+   od_state_upsample_patch8(), roughly.
+  A row's blocks share one band unless it has more than this many times as
+   many samples as their separate patches.*/
+#define OD_REF_BAND_SPEEDUP (4)
+
+/*A patch of the upsampled version of a native-resolution reference plane,
+   filled in once and shared by all the blocks of a row that fit inside it.
+  The coordinates are in upsampled units, as for od_state_upsample_patch8().*/
+typedef struct od_ref_band od_ref_band;
+
+struct od_ref_band{
+  unsigned char *data;
+  int            stride;
+  int            x0;
+  int            y0;
+  int            w;
+  int            h;
+};
+
+/*Forms the prediction for a block from a native-resolution reference plane.
+  We upsample just the patch of the reference that the block's four motion
+   vectors can touch, and then run the usual motion compensation kernels on
+   it, so the result is identical to predicting from an upsampled reference.
+  If that patch lies inside _band, we use the samples already there
+   instead.*/
+static void od_state_pred_block_native8(od_state *_state,unsigned char *_buf,
+ int _ystride,const od_img_plane *_iplane,ogg_int32_t _mvx[4],
+ ogg_int32_t _mvy[4],int _etype,int _c,int _s,int _vx,int _vy,
+ int _log_mvb_sz,const od_ref_band *_band){
+  unsigned char  patch_buf[OD_MC_PATCH_BUF_SZ];
+  unsigned char *patch;
+  size_t         patch_sz;
+  int            log_xblk_sz;
+  int            log_yblk_sz;
+  int            xmin;
+  int            xmax;
+  int            ymin;
+  int            ymax;
+  int            x0;
+  int            y0;
+  int            pw;
+  int            ph;
+  int            k;
+  log_xblk_sz=_log_mvb_sz+2-_iplane->xdec;
+  log_yblk_sz=_log_mvb_sz+2-_iplane->ydec;
+  xmin=xmax=_mvx[0]>>16;
+  ymin=ymax=_mvy[0]>>16;
+  for(k=1;k<4;k++){
+    xmin=OD_MINI(xmin,_mvx[k]>>16);
+    xmax=OD_MAXI(xmax,_mvx[k]>>16);
+    ymin=OD_MINI(ymin,_mvy[k]>>16);
+    ymax=OD_MAXI(ymax,_mvy[k]>>16);
+  }
+  /*The kernels read 2 samples per output pixel plus one more for the
+     bilinear filter, and interpolated vectors may round slightly outside the
+     range of the corners, so add a margin of 2 on each side.*/
+  xmin-=2;
+  ymin-=2;
+  pw=xmax-xmin+(2<<log_xblk_sz)+3;
+  ph=ymax-ymin+(2<<log_yblk_sz)+3;
+  x0=(_vx-2<<3-_iplane->xdec)+xmin;
+  y0=(_vy-2<<3-_iplane->ydec)+ymin;
+  /*Make the vectors relative to the patch.*/
+  for(k=0;k<4;k++){
+    _mvx[k]-=(ogg_int32_t)xmin<<16;
+    _mvy[k]-=(ogg_int32_t)ymin<<16;
+  }
+  if(_band!=NULL&&x0>=_band->x0&&y0>=_band->y0&&
+   x0+pw<=_band->x0+_band->w&&y0+ph<=_band->y0+_band->h){
+    od_mc_predict8(_state,_buf,_ystride,
+     _band->data+(y0-_band->y0)*_band->stride+x0-_band->x0,_band->stride,
+     _mvx,_mvy,_etype,_c,_s,log_xblk_sz,log_yblk_sz);
+    return;
+  }
+  patch_sz=pw*(size_t)ph+((ph+1>>1)+6)*(size_t)pw;
+  patch=patch_sz>sizeof(patch_buf)?
+   (unsigned char *)_ogg_malloc(patch_sz):patch_buf;
+  if(patch==NULL){
+    /*We have no way to report the failure from here.*/
+    for(k=0;k<1<<log_yblk_sz;k++)memset(_buf+k*_ystride,128,1<<log_xblk_sz);
+    return;
+  }
+  od_state_upsample_patch8(patch,pw,patch+pw*ph,_iplane,
+   _state->frame_width>>_iplane->xdec,_state->frame_height>>_iplane->ydec,
+   x0,y0,pw,ph);
+  od_mc_predict8(_state,_buf,_ystride,patch,pw,_mvx,_mvy,_etype,_c,_s,
+   log_xblk_sz,log_yblk_sz);
+  if(patch!=patch_buf)_ogg_free(patch);
+}
+
+static void od_state_pred_block_from_setup_band(od_state *_state,
+ unsigned char *_buf,int _ystride,int _ref,int _pli,int _vx,int _vy,int _c,
+ int _s,int _log_mvb_sz,const od_ref_band *_band){
   od_img_plane  *iplane;
   od_mv_grid_pt *grid[4];
   ogg_int32_t    mvx[4];
@@ -515,14 +835,26 @@ void od_state_pred_block_from_setup(od_state *_state,unsigned char *_buf,
   }
   /*fprintf(stderr,"interpolation type: %c%c%c%c (0x%X) ",
    etype&1?'V':'B',etype&2?'V':'B',etype&4?'V':'B',etype&8?'V':'B',etype);*/
+  if(_state->native_refs){
+    od_state_pred_block_native8(_state,_buf,_ystride,iplane,mvx,mvy,etype,
+     _c,_s,_vx,_vy,_log_mvb_sz,_band);
+    return;
+  }
   od_mc_predict8(_state,_buf,_ystride,iplane->data+
    (_vy-2<<3-iplane->ydec)*iplane->ystride+(_vx-2<<3-iplane->xdec),
    iplane->ystride,mvx,mvy,etype,_c,_s,_log_mvb_sz+2-iplane->xdec,
    _log_mvb_sz+2-iplane->ydec);
 }
 
-void od_state_pred_block(od_state *_state,unsigned char *_buf,int _ystride,
- int _ref,int _pli,int _vx,int _vy,int _log_mvb_sz){
+void od_state_pred_block_from_setup(od_state *_state,unsigned char *_buf,
+ int _ystride,int _ref,int _pli,int _vx,int _vy,int _c,int _s,int _log_mvb_sz){
+  od_state_pred_block_from_setup_band(_state,_buf,_ystride,_ref,_pli,
+   _vx,_vy,_c,_s,_log_mvb_sz,NULL);
+}
+
+static void od_state_pred_block_band(od_state *_state,unsigned char *_buf,
+ int _ystride,int _ref,int _pli,int _vx,int _vy,int _log_mvb_sz,
+ const od_ref_band *_band){
   int half_mvb_sz;
   half_mvb_sz=1<<_log_mvb_sz-1;
   if(_log_mvb_sz>0&&_state->mv_grid[_vy+half_mvb_sz][_vx+half_mvb_sz].valid){
@@ -532,14 +864,14 @@ void od_state_pred_block(od_state *_state,unsigned char *_buf,int _ystride,
     iplane=_state->ref_imgs[_state->ref_imgi[_ref]].planes+_pli;
     half_xblk_sz=1<<_log_mvb_sz+1-iplane->xdec;
     half_yblk_sz=1<<_log_mvb_sz+1-iplane->ydec;
-    od_state_pred_block(_state,_buf,
-     _ystride,_ref,_pli,_vx,_vy,_log_mvb_sz-1);
-    od_state_pred_block(_state,_buf+half_xblk_sz,
-     _ystride,_ref,_pli,_vx+half_mvb_sz,_vy,_log_mvb_sz-1);
-    od_state_pred_block(_state,_buf+half_yblk_sz*_ystride,
-     _ystride,_ref,_pli,_vx,_vy+half_mvb_sz,_log_mvb_sz-1);
-    od_state_pred_block(_state,_buf+half_yblk_sz*_ystride+half_xblk_sz,
-     _ystride,_ref,_pli,_vx+half_mvb_sz,_vy+half_mvb_sz,_log_mvb_sz-1);
+    od_state_pred_block_band(_state,_buf,
+     _ystride,_ref,_pli,_vx,_vy,_log_mvb_sz-1,_band);
+    od_state_pred_block_band(_state,_buf+half_xblk_sz,
+     _ystride,_ref,_pli,_vx+half_mvb_sz,_vy,_log_mvb_sz-1,_band);
+    od_state_pred_block_band(_state,_buf+half_yblk_sz*_ystride,
+     _ystride,_ref,_pli,_vx,_vy+half_mvb_sz,_log_mvb_sz-1,_band);
+    od_state_pred_block_band(_state,_buf+half_yblk_sz*_ystride+half_xblk_sz,
+     _ystride,_ref,_pli,_vx+half_mvb_sz,_vy+half_mvb_sz,_log_mvb_sz-1,_band);
   }
   else{
     int c;
@@ -558,9 +890,105 @@ void od_state_pred_block(od_state *_state,unsigned char *_buf,int _ystride,
       c=0;
       s=3;
     }
-    od_state_pred_block_from_setup(_state,_buf,_ystride,_ref,_pli,
-     _vx,_vy,c,s,_log_mvb_sz);
+    od_state_pred_block_from_setup_band(_state,_buf,_ystride,_ref,_pli,
+     _vx,_vy,c,s,_log_mvb_sz,_band);
+  }
+}
+
+void od_state_pred_block(od_state *_state,unsigned char *_buf,int _ystride,
+ int _ref,int _pli,int _vx,int _vy,int _log_mvb_sz){
+  od_state_pred_block_band(_state,_buf,_ystride,_ref,_pli,_vx,_vy,
+   _log_mvb_sz,NULL);
+}
+
+/*Upsamples the band of plane _pli of reference _ref that the blocks of the
+   row at _vy can read, so that horizontally adjacent blocks share the samples
+   they have in common instead of each upsampling its own patch.
+  This is only done when the band costs less to fill in than all those
+   patches, which may not be the case if the vertical spread of the motion
+   vectors across the row is much larger than within each block.
+  The blocks check that their patch lies inside the band, so the extents
+   computed here need not be exact.
+  Return: The buffer holding the band, which the caller must free, or NULL if
+   the blocks should upsample their own patches.*/
+static unsigned char *od_state_ref_band_init(od_state *_state,
+ od_ref_band *_band,int _ref,int _pli,int _vy){
+  od_img_plane  *iplane;
+  unsigned char *band_buf;
+  size_t         patch_cost;
+  size_t         band_cost;
+  int            nhmvbs;
+  int            xmin;
+  int            xmax;
+  int            ymin;
+  int            ymax;
+  int            xdec;
+  int            ydec;
+  int            bw;
+  int            bh;
+  int            vx;
+  iplane=_state->ref_imgs[_state->ref_imgi[_ref]].planes+_pli;
+  xdec=iplane->xdec;
+  ydec=iplane->ydec;
+  nhmvbs=_state->nhmbs+1<<2;
+  xmin=ymin=INT_MAX;
+  xmax=ymax=INT_MIN;
+  patch_cost=0;
+  for(vx=0;vx<nhmvbs;vx+=4){
+    int bxmin;
+    int bxmax;
+    int bymin;
+    int bymax;
+    int pw;
+    int ph;
+    int i;
+    int j;
+    bxmin=bymin=INT_MAX;
+    bxmax=bymax=INT_MIN;
+    for(j=_vy;j<=_vy+4;j++){
+      for(i=vx;i<=vx+4;i++){
+        od_mv_grid_pt *mvp;
+        int            x;
+        int            y;
+        mvp=_state->mv_grid[j]+i;
+        if(!mvp->valid)continue;
+        x=(ogg_int32_t)mvp->mv[0]<<14-xdec>>16;
+        y=(ogg_int32_t)mvp->mv[1]<<14-ydec>>16;
+        bxmin=OD_MINI(bxmin,x);
+        bxmax=OD_MAXI(bxmax,x);
+        bymin=OD_MINI(bymin,y);
+        bymax=OD_MAXI(bymax,y);
+      }
+    }
+    if(bxmin>bxmax)continue;
+    /*This matches the patch size in od_state_pred_block_native8().*/
+    pw=bxmax-bxmin+(32>>xdec)+5;
+    ph=bymax-bymin+(32>>ydec)+5;
+    patch_cost+=pw*(size_t)ph+((ph+1>>1)+6)*(size_t)pw;
+    xmin=OD_MINI(xmin,bxmin);
+    xmax=OD_MAXI(xmax,bxmax);
+    ymin=OD_MINI(ymin,bymin);
+    ymax=OD_MAXI(ymax,bymax);
   }
+  if(xmin>xmax)return NULL;
+  bw=(nhmvbs<<3-xdec)+xmax-xmin+5;
+  bh=(32>>ydec)+ymax-ymin+5;
+  band_cost=bw*(size_t)bh+((bh+1>>1)+6)*(size_t)bw;
+  if(band_cost>=patch_cost*OD_REF_BAND_SPEEDUP)return NULL;
+  _band->stride=bw;
+  _band->x0=xmin-2-(2<<3-xdec);
+  _band->y0=(_vy-2<<3-ydec)+ymin-2;
+  _band->w=bw;
+  _band->h=bh;
+  band_buf=(unsigned char *)_ogg_malloc(bw*(size_t)bh+
+   od_state_upsample_band8_hbuf_sz(_state->frame_width>>xdec,
+   _band->x0,_band->y0,bw,bh));
+  if(band_buf==NULL)return NULL;
+  _band->data=band_buf;
+  od_state_upsample_band8(_state,band_buf,bw,band_buf+bw*bh,iplane,
+   _state->frame_width>>xdec,_state->frame_height>>ydec,
+   _band->x0,_band->y0,bw,bh);
+  return band_buf;
 }
 
 int od_state_dump_yuv(od_state *_state,od_img *_img,const char *_suf){
@@ -1016,62 +1444,87 @@ int od_state_dump_img(od_state *_state,od_img *_img,const char *_suf){
 }
 #endif
 
-void od_state_mc_predict(od_state *state, int ref) {
+/*Predicts one row of 16x16 blocks into the reconstruction buffer.
+  _vy is the vertical index of the top row of motion vectors for the blocks,
+   which must be a multiple of 4.
+  Blocks that lie entirely inside the image are predicted straight into it;
+   only those on the edges go through a scratch buffer to be clipped.
+  Different rows write disjoint parts of the image, so they may be predicted
+   in any order, or in parallel.*/
+void od_state_mc_predict_row(od_state *state, int ref, int vy) {
   unsigned char  __attribute__((aligned(16))) buf[16][16];
   od_img *img;
   int nhmvbs;
-  int nvmvbs;
   int pli;
   int vx;
-  int vy;
   nhmvbs = (state->nhmbs + 1) << 2;
-  nvmvbs = (state->nvmbs + 1) << 2;
   img = state->io_imgs + OD_FRAME_REC;
-  for (vy = 0; vy < nvmvbs; vy += 4) {
+  for (pli = 0; pli < img->nplanes; pli++) {
+    od_img_plane *iplane;
+    od_ref_band band;
+    const od_ref_band *bandp;
+    unsigned char *band_buf;
+    int w;
+    int h;
+    iplane = img->planes + pli;
+    w = img->width >> iplane->xdec;
+    h = img->height >> iplane->ydec;
+    band_buf = NULL;
+    if (state->native_refs) {
+      band_buf = od_state_ref_band_init(state, &band, ref, pli, vy);
+    }
+    bandp = band_buf != NULL ? &band : NULL;
     for (vx = 0; vx < nhmvbs; vx += 4) {
-      for (pli = 0; pli < img->nplanes; pli++) {
-        od_img_plane *iplane;
-        unsigned char *p;
-        int blk_w;
-        int blk_h;
-        int blk_x;
-        int blk_y;
-        int y;
-        od_state_pred_block(state, buf[0], sizeof(buf[0]), ref, pli, vx, vy,
-         2);
-        /*Copy the predictor into the image, with clipping.*/
-        iplane = img->planes + pli;
-        blk_w = 16 >> iplane->xdec;
-        blk_h = 16 >> iplane->ydec;
-        blk_x = (vx - 2) << (2 - iplane->xdec);
-        blk_y = (vy - 2) << (2 - iplane->ydec);
-        p = buf[0];
-        if (blk_x < 0) {
-          blk_w += blk_x;
-          p -= blk_x;
-          blk_x = 0;
-        }
-        if (blk_y < 0) {
-          blk_h += blk_y;
-          p -= blk_y*sizeof(buf[0]);
-          blk_y = 0;
-        }
-        if (blk_x + blk_w > img->width >> iplane->xdec) {
-          blk_w = (img->width >> iplane->xdec) - blk_x;
-        }
-        if (blk_y + blk_h > img->height >> iplane->ydec) {
-          blk_h = (img->height >> iplane->ydec) - blk_y;
-        }
-        for (y = blk_y; y < blk_y + blk_h; y++) {
-          memcpy(iplane->data + y*iplane->ystride + blk_x,
-           p, blk_w);
-          p += sizeof(buf[0]);
-        }
+      unsigned char *p;
+      int blk_w;
+      int blk_h;
+      int blk_x;
+      int blk_y;
+      int y;
+      blk_w = 16 >> iplane->xdec;
+      blk_h = 16 >> iplane->ydec;
+      blk_x = (vx - 2) << (2 - iplane->xdec);
+      blk_y = (vy - 2) << (2 - iplane->ydec);
+      if (blk_x >= 0 && blk_y >= 0 && blk_x + blk_w <= w
+       && blk_y + blk_h <= h) {
+        od_state_pred_block_band(state,
+         iplane->data + blk_y*iplane->ystride + blk_x, iplane->ystride,
+         ref, pli, vx, vy, 2, bandp);
+        continue;
+      }
+      od_state_pred_block_band(state, buf[0], sizeof(buf[0]), ref, pli,
+       vx, vy, 2, bandp);
+      /*Copy the predictor into the image, with clipping.*/
+      p = buf[0];
+      if (blk_x < 0) {
+        blk_w += blk_x;
+        p -= blk_x;
+        blk_x = 0;
+      }
+      if (blk_y < 0) {
+        blk_h += blk_y;
+        p -= blk_y*sizeof(buf[0]);
+        blk_y = 0;
+      }
+      if (blk_x + blk_w > w) blk_w = w - blk_x;
+      if (blk_y + blk_h > h) blk_h = h - blk_y;
+      for (y = blk_y; y < blk_y + blk_h; y++) {
+        memcpy(iplane->data + y*iplane->ystride + blk_x,
+         p, blk_w);
+        p += sizeof(buf[0]);
       }
     }
+    if (band_buf != NULL) _ogg_free(band_buf);
   }
 }
 
+void od_state_mc_predict(od_state *state, int ref) {
+  int nvmvbs;
+  int vy;
+  nvmvbs = (state->nvmbs + 1) << 2;
+  for (vy = 0; vy < nvmvbs; vy += 4) od_state_mc_predict_row(state, ref, vy);
+}
+
 
 ogg_int64_t daala_granule_basetime(void *_encdec,ogg_int64_t _granpos){
   od_state *state;
@@ -1098,6 +1551,82 @@ double daala_granule_time(void *_encdec,ogg_int64_t _granpos){
   return -1;
 }
 
+int od_frame_bufs_init(od_frame_bufs *_bufs,const od_state *_state){
+  const daala_info *info;
+  unsigned char    *data;
+  size_t            data_sz;
+  size_t            plane_sz[OD_NPLANES_MAX];
+  int               pli;
+  int               plj;
+  info=&_state->info;
+  memset(_bufs,0,sizeof(*_bufs));
+  /*Work out which planes need their own subsampled luma buffer.*/
+  data_sz=0;
+  for(pli=0;pli<info->nplanes;pli++){
+    int xdec;
+    int ydec;
+    xdec=info->plane_info[pli].xdec;
+    ydec=info->plane_info[pli].ydec;
+    plane_sz[pli]=(size_t)(_state->frame_width>>xdec)*
+     (_state->frame_height>>ydec)*sizeof(od_coeff);
+    data_sz+=plane_sz[pli]<<2;
+    if(pli>0&&(xdec||ydec)){
+      for(plj=1;plj<pli;plj++){
+        if(xdec==info->plane_info[plj].xdec&&ydec==info->plane_info[plj].ydec){
+          break;
+        }
+      }
+      if(plj>=pli)data_sz+=plane_sz[pli];
+    }
+  }
+  data_sz+=(size_t)(_state->frame_width>>2)*(_state->frame_height>>2)*
+   sizeof(*_bufs->modes);
+  _bufs->data=data=(unsigned char *)_ogg_malloc(data_sz);
+  if(data==NULL)return OD_EFAULT;
+  /*Every plane is a multiple of 16x16 coefficients, so each buffer stays
+     16-byte aligned.*/
+  for(pli=0;pli<info->nplanes;pli++){
+    int xdec;
+    int ydec;
+    xdec=info->plane_info[pli].xdec;
+    ydec=info->plane_info[pli].ydec;
+    _bufs->ctmp[pli]=(od_coeff *)data;
+    data+=plane_sz[pli];
+    _bufs->dtmp[pli]=(od_coeff *)data;
+    data+=plane_sz[pli];
+    _bufs->mctmp[pli]=(od_coeff *)data;
+    data+=plane_sz[pli];
+    _bufs->mdtmp[pli]=(od_coeff *)data;
+    data+=plane_sz[pli];
+    /*We predict chroma planes from the luma plane.
+      Since chroma can be subsampled, we cache subsampled versions of the
+       luma plane in the frequency domain.
+      We can share buffers with the same subsampling.*/
+    if(pli>0){
+      if(xdec||ydec){
+        for(plj=1;plj<pli;plj++){
+          if(xdec==info->plane_info[plj].xdec
+           &&ydec==info->plane_info[plj].ydec){
+            _bufs->lbuf[pli]=_bufs->lbuf[plj];
+            break;
+          }
+        }
+        if(plj>=pli){
+          _bufs->lbuf[pli]=_bufs->ltmp[pli]=(od_coeff *)data;
+          data+=plane_sz[pli];
+        }
+      }
+      else _bufs->lbuf[pli]=_bufs->ctmp[pli];
+    }
+  }
+  _bufs->modes=(signed char *)data;
+  return 0;
+}
+
+void od_frame_bufs_clear(od_frame_bufs *_bufs){
+  _ogg_free(_bufs->data);
+}
+
 void od_extract_bsize(unsigned char *_bsize_out,int _bstride_out,
  const unsigned char *_bsize_in,int _bstride_in,int _dec){
   int j;
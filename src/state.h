@@ -29,9 +29,13 @@ typedef struct od_state_opt_vtbl od_state_opt_vtbl;
 typedef struct od_state          od_state;
 
 # include "internal.h"
+# include "filter.h"
+# include "dct.h"
+# include "intra.h"
 # include "mc.h"
 # include "pvq_code.h"
 #include "adapt.h"
+# include "block_size.h"
 
 /*The golden reference frame.*/
 #define OD_FRAME_GOLD (0)
@@ -75,6 +79,9 @@ extern const int *const OD_VERT_SETUP_DY[4][4];
 
 #define OD_SUPERBLOCK_SIZE (32)
 
+/*The largest number of predictors mc_sad_multi8 can score at once.*/
+#define OD_MC_SAD_NREFS_MAX (8)
+
 
 /*The shared (encoder and decoder) functions that have accelerated variants.*/
 struct od_state_opt_vtbl{
@@ -90,6 +97,28 @@ struct od_state_opt_vtbl{
   void (*mc_blend_full_split8)(unsigned char *_dst,int _dystride,
    const unsigned char *_src[4],int _c,int _s,
    int _log_xblk_sz,int _log_yblk_sz);
+  void (*mc_blend_multi8)(unsigned char *_dst,int _dystride,
+   const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
+  void (*mc_blend_multi_split8)(unsigned char *_dst,int _dystride,
+   const unsigned char *_src[4],int _c,int _s,
+   int _log_xblk_sz,int _log_yblk_sz);
+  void (*upsample_hrow8)(unsigned char *_dst,const unsigned char *_src,
+   int _n);
+  void (*upsample_vrow8)(unsigned char *_dst,
+   const unsigned char *const _src[6],int _n);
+  ogg_int32_t (*mc_sad8)(const unsigned char *_src,int _systride,
+   const unsigned char *_ref,int _rystride,int _rxstride,int _log_blk_sz);
+  void (*mc_sad_multi8)(ogg_int32_t *_sads,const unsigned char *_src,
+   int _systride,const unsigned char *const *_ref,int _nref,int _rystride,
+   int _rxstride,int _log_blk_sz);
+  od_block_var4_row_func block_var4_row8;
+  /*The 2-D forward and inverse transforms, indexed by block size.*/
+  od_dct_func_2d fdct_2d[OD_NBSIZES];
+  od_dct_func_2d idct_2d[OD_NBSIZES];
+  od_filter_vtbl filter;
+  /*The intra predictors and mode search, indexed by block size.*/
+  od_intra_get_func intra_get[OD_NBSIZES];
+  od_intra_dist_func intra_dist[OD_NBSIZES];
 };
 
 
@@ -110,6 +139,9 @@ struct od_state{
   od_img              io_imgs[2];
   unsigned char      *ref_line_buf[8];
   unsigned char      *ref_img_data;
+  /** If non-zero, the reference images are stored at their native
+      resolution and upsampled on the fly during motion compensation. */
+  int                 native_refs;
   /** Increments by 1 for each frame. */
   ogg_int64_t         cur_time;
   od_mv_grid_pt     **mv_grid;
@@ -122,6 +154,11 @@ struct od_state{
   int                 nvsb;
   unsigned char      *bsize;
   int                 mv_res;
+  /** If non-zero, blocks of 4x4 and larger are blended with the
+      multiresolution blend, which keeps the high frequencies of each
+      quadrant's own prediction.
+      This is signaled in each inter frame. */
+  int                 multires_blend;
   int                 bstride;
 #if defined(OD_DUMP_IMAGES)
   od_img              vis_img;
@@ -131,16 +168,45 @@ struct od_state{
 #endif
 };
 
+/*Scratch buffers used to code a single frame.
+  These are carved out of a single block of memory, which is allocated once
+   and reused for every frame.*/
+typedef struct od_frame_bufs od_frame_bufs;
+
+struct od_frame_bufs{
+  unsigned char *data;
+  /*The spatial and frequency domain coefficients of each plane.*/
+  od_coeff      *ctmp[OD_NPLANES_MAX];
+  od_coeff      *dtmp[OD_NPLANES_MAX];
+  /*The same, for the motion-compensated prediction of each plane.*/
+  od_coeff      *mctmp[OD_NPLANES_MAX];
+  od_coeff      *mdtmp[OD_NPLANES_MAX];
+  /*The subsampled luma coefficients used to predict each chroma plane.
+    Planes with the same subsampling share the buffer owned by the first
+     of them, whose ltmp entry is non-NULL; lbuf points to the buffer to use.
+    Planes that are not subsampled use their own coefficients.*/
+  od_coeff      *ltmp[OD_NPLANES_MAX];
+  od_coeff      *lbuf[OD_NPLANES_MAX];
+  /*The intra prediction mode of each 4x4 luma block.*/
+  signed char   *modes;
+};
 
 int  od_state_init(od_state *_state,const daala_info *_info);
 void od_state_clear(od_state *_state);
+int od_state_set_native_refs(od_state *_state,int _native_refs);
 
 void od_state_pred_block_from_setup(od_state *_state,unsigned char *_buf,
  int _ystride,int _ref,int _pli,int _vx,int _vy,int _c,int _s,int _log_mvb_sz);
 void od_state_pred_block(od_state *_state,unsigned char *_buf,int _ystride,
  int _ref,int _pli,int _vx,int _vy,int _log_mvb_sz);
+void od_state_mc_predict_row(od_state *_state,int _ref,int _vy);
 void od_state_mc_predict(od_state *_state,int _ref);
 void od_state_upsample8(od_state *_state,od_img *_dst,const od_img *_src);
+void od_state_upsample8_rows(od_state *_state,od_img *_dst,
+ const od_img *_src,int _y0,int _y1);
+void od_state_store_ref8_rows(od_state *_state,int _refi,int _y0,int _y1);
+void od_state_store_ref8_sb_row(od_state *_state,int _refi,int _sby);
+void od_state_store_ref8(od_state *_state,int _refi);
 int od_state_dump_yuv(od_state *_state,od_img *_img,const char *_suf);
 #if defined(OD_DUMP_IMAGES)
 int od_state_dump_img(od_state *_state,od_img *_img,const char *_suf);
@@ -153,6 +219,9 @@ void od_state_draw_mvs(od_state *_state);
 void od_state_fill_vis(od_state *_state);
 #endif
 
+int od_frame_bufs_init(od_frame_bufs *_bufs,const od_state *_state);
+void od_frame_bufs_clear(od_frame_bufs *_bufs);
+
 void od_extract_bsize(unsigned char *_bsize_out,int _bstride_out,
  const unsigned char *_bsize_in,int _bstride_in,int _dec);
 
@@ -170,6 +239,19 @@ void od_mc_blend_full8_c(unsigned char *_dst,int _dystride,
  const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
 void od_mc_blend_full_split8_c(unsigned char *_dst,int _dystride,
  const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_multi8_c(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_multi_split8_c(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz);
+void od_upsample_hrow8_c(unsigned char *_dst,const unsigned char *_src,
+ int _n);
+void od_upsample_vrow8_c(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n);
+ogg_int32_t od_mc_sad8_c(const unsigned char *_src,int _systride,
+ const unsigned char *_ref,int _rystride,int _rxstride,int _log_blk_sz);
+void od_mc_sad_multi8_c(ogg_int32_t *_sads,const unsigned char *_src,
+ int _systride,const unsigned char *const *_ref,int _nref,int _rystride,
+ int _rxstride,int _log_blk_sz);
 
 void od_state_opt_vtbl_init_c(od_state *_state);
 
@@ -0,0 +1,178 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+/*Checks that the encoder produces the same packets with and without a
+   lookahead, for input images whose samples are not packed together.*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../include/daala/daalaenc.h"
+
+#define NFRAMES (6)
+#define WIDTH (160)
+#define HEIGHT (96)
+#define XSTRIDE (2)
+#define MAX_BYTES (1 << 20)
+
+static const int DEPTHS[] = { 1, 4, 8 };
+
+static unsigned char ref_data[MAX_BYTES];
+static unsigned char data[MAX_BYTES];
+
+/*Fills in a textured frame with a moving bright disc and a little noise.
+  The samples in between the ones read by the encoder are set to garbage.*/
+static void fill_frame(od_img *img, int f) {
+  unsigned seed;
+  int pli;
+  int x;
+  int y;
+  seed = 12345 + 7*f;
+  for (pli = 0; pli < img->nplanes; pli++) {
+    od_img_plane *plane;
+    int xdec;
+    int ydec;
+    plane = img->planes + pli;
+    xdec = plane->xdec;
+    ydec = plane->ydec;
+    for (y = 0; y < img->height >> ydec; y++) {
+      for (x = 0; x < img->width >> xdec; x++) {
+        unsigned char *p;
+        int xx;
+        int yy;
+        int v;
+        xx = (x << xdec) + 3*f;
+        yy = (y << ydec) + f;
+        v = 78 + 60*((7*xx + 3*yy) % 37)/37 + ((xx/9 + yy/7) & 1)*40;
+        if (pli == 0
+         && (xx - 40)*(xx - 40) + (yy - 30)*(yy - 30) < 300) {
+          v = 230 - ((xx + yy) & 15);
+        }
+        seed = seed*1103515245 + 12345;
+        v += (int)(seed >> 16 & 7) - 3;
+        if (pli > 0) v = (v + 3*128)/4 + 5*pli;
+        p = plane->data + y*plane->ystride + x*plane->xstride;
+        p[0] = (unsigned char)(v < 0 ? 0 : v > 255 ? 255 : v);
+        if (plane->xstride > 1) p[1] = (unsigned char)(seed >> 8);
+      }
+    }
+  }
+}
+
+/*Encodes NFRAMES frames with the given lookahead depth and stores all of the
+   packets one after the other in _data.
+  Returns the number of bytes stored, or a negative value on error.*/
+static long encode(unsigned char *_data, int _depth) {
+  daala_info di;
+  daala_enc_ctx *enc;
+  od_img img;
+  unsigned char *bufs[3];
+  long nbytes;
+  int quant;
+  int done;
+  int pli;
+  int f;
+  daala_info_init(&di);
+  di.pic_width = WIDTH;
+  di.pic_height = HEIGHT;
+  di.timebase_numerator = 30;
+  di.timebase_denominator = 1;
+  di.frame_duration = 1;
+  di.pixel_aspect_numerator = 1;
+  di.pixel_aspect_denominator = 1;
+  di.keyframe_rate = 256;
+  di.nplanes = 3;
+  di.plane_info[0].xdec = di.plane_info[0].ydec = 0;
+  di.plane_info[1].xdec = di.plane_info[1].ydec = 1;
+  di.plane_info[2].xdec = di.plane_info[2].ydec = 1;
+  enc = daala_encode_create(&di);
+  if (enc == NULL) return -1;
+  quant = 20;
+  daala_encode_ctl(enc, OD_SET_QUANT, &quant, sizeof(quant));
+  if (daala_encode_ctl(enc, OD_SET_LOOKAHEAD, &_depth, sizeof(_depth)) < 0) {
+    daala_encode_free(enc);
+    return -1;
+  }
+  img.nplanes = 3;
+  img.width = WIDTH;
+  img.height = HEIGHT;
+  for (pli = 0; pli < 3; pli++) {
+    int dec;
+    dec = pli > 0;
+    bufs[pli] = (unsigned char *)malloc(
+     XSTRIDE*(WIDTH >> dec)*(HEIGHT >> dec));
+    img.planes[pli].data = bufs[pli];
+    img.planes[pli].xdec = img.planes[pli].ydec = (unsigned char)dec;
+    img.planes[pli].xstride = XSTRIDE;
+    img.planes[pli].ystride = XSTRIDE*(WIDTH >> dec);
+  }
+  nbytes = 0;
+  done = 0;
+  for (f = 0; !done && nbytes >= 0; f++) {
+    ogg_packet op;
+    if (f < NFRAMES) {
+      fill_frame(&img, f);
+      if (daala_encode_img_in(enc, &img, 0) < 0) nbytes = -1;
+    }
+    while (nbytes >= 0 && daala_encode_packet_out(enc, f >= NFRAMES - 1,
+     &op) > 0) {
+      if (nbytes + op.bytes > MAX_BYTES) nbytes = -1;
+      else {
+        memcpy(_data + nbytes, op.packet, op.bytes);
+        nbytes += op.bytes;
+      }
+      if (op.e_o_s) done = 1;
+    }
+    /*Give up if the lookahead never flushes.*/
+    if (f > NFRAMES + _depth) nbytes = -1;
+  }
+  for (pli = 0; pli < 3; pli++) free(bufs[pli]);
+  daala_encode_free(enc);
+  return nbytes;
+}
+
+int main(void) {
+  long ref_nbytes;
+  int failed;
+  int di;
+  failed = 0;
+  ref_nbytes = encode(ref_data, 0);
+  if (ref_nbytes < 0) {
+    fprintf(stderr, "Encoding without a lookahead failed.\n");
+    return EXIT_FAILURE;
+  }
+  for (di = 0; di < (int)(sizeof(DEPTHS)/sizeof(*DEPTHS)); di++) {
+    long nbytes;
+    nbytes = encode(data, DEPTHS[di]);
+    if (nbytes < 0) {
+      fprintf(stderr, "Encoding with a lookahead of %i failed.\n", DEPTHS[di]);
+      failed = 1;
+    }
+    else if (nbytes != ref_nbytes || memcmp(data, ref_data, nbytes) != 0) {
+      fprintf(stderr, "A lookahead of %i differs from none.\n", DEPTHS[di]);
+      failed = 1;
+    }
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
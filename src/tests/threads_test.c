@@ -0,0 +1,179 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+/*Checks that the encoder produces the same packets no matter how many
+   threads it uses.*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../include/daala/daalaenc.h"
+
+#define NFRAMES (6)
+#define MAX_THREADS (4)
+#define MAX_BYTES (1 << 20)
+
+/*Sizes chosen so that the motion search for some blocks runs long enough to
+   wrap the per-thread caches at a different point in each worker.*/
+static const int SIZES[][2] = {
+  { 160, 96 },
+  { 224, 128 },
+  { 320, 192 }
+};
+
+static unsigned char ref_data[MAX_BYTES];
+static unsigned char data[MAX_BYTES];
+
+/*Fills in a textured frame with a moving bright disc and a little noise.*/
+static void fill_frame(od_img *img, int f) {
+  unsigned seed;
+  int pli;
+  int x;
+  int y;
+  seed = 12345 + 7*f;
+  for (pli = 0; pli < img->nplanes; pli++) {
+    od_img_plane *plane;
+    int xdec;
+    int ydec;
+    plane = img->planes + pli;
+    xdec = plane->xdec;
+    ydec = plane->ydec;
+    for (y = 0; y < img->height >> ydec; y++) {
+      for (x = 0; x < img->width >> xdec; x++) {
+        int xx;
+        int yy;
+        int v;
+        xx = (x << xdec) + 3*f;
+        yy = (y << ydec) + f;
+        v = 78 + 60*((7*xx + 3*yy) % 37)/37 + ((xx/9 + yy/7) & 1)*40;
+        if (pli == 0
+         && (xx - 40)*(xx - 40) + (yy - 30)*(yy - 30) < 300) {
+          v = 230 - ((xx + yy) & 15);
+        }
+        seed = seed*1103515245 + 12345;
+        v += (int)(seed >> 16 & 7) - 3;
+        if (pli > 0) v = (v + 3*128)/4 + 5*pli;
+        plane->data[y*plane->ystride + x] =
+         (unsigned char)(v < 0 ? 0 : v > 255 ? 255 : v);
+      }
+    }
+  }
+}
+
+/*Encodes NFRAMES frames with the given number of threads and stores all of
+   the packets one after the other in _data.
+  Returns the number of bytes stored, or a negative value on error.*/
+static long encode(unsigned char *_data, int _width, int _height,
+ int _nthreads) {
+  daala_info di;
+  daala_enc_ctx *enc;
+  od_img img;
+  unsigned char *bufs[3];
+  long nbytes;
+  int quant;
+  int pli;
+  int f;
+  daala_info_init(&di);
+  di.pic_width = _width;
+  di.pic_height = _height;
+  di.timebase_numerator = 30;
+  di.timebase_denominator = 1;
+  di.frame_duration = 1;
+  di.pixel_aspect_numerator = 1;
+  di.pixel_aspect_denominator = 1;
+  di.keyframe_rate = 256;
+  di.nplanes = 3;
+  di.plane_info[0].xdec = di.plane_info[0].ydec = 0;
+  di.plane_info[1].xdec = di.plane_info[1].ydec = 1;
+  di.plane_info[2].xdec = di.plane_info[2].ydec = 1;
+  enc = daala_encode_create(&di);
+  if (enc == NULL) return -1;
+  quant = 20;
+  daala_encode_ctl(enc, OD_SET_QUANT, &quant, sizeof(quant));
+  if (daala_encode_ctl(enc, OD_SET_THREADS, &_nthreads,
+   sizeof(_nthreads)) < 0) {
+    daala_encode_free(enc);
+    return -1;
+  }
+  img.nplanes = 3;
+  img.width = _width;
+  img.height = _height;
+  for (pli = 0; pli < 3; pli++) {
+    int dec;
+    dec = pli > 0;
+    bufs[pli] = (unsigned char *)malloc((_width >> dec)*(_height >> dec));
+    img.planes[pli].data = bufs[pli];
+    img.planes[pli].xdec = img.planes[pli].ydec = (unsigned char)dec;
+    img.planes[pli].xstride = 1;
+    img.planes[pli].ystride = _width >> dec;
+  }
+  nbytes = 0;
+  for (f = 0; f < NFRAMES && nbytes >= 0; f++) {
+    ogg_packet op;
+    fill_frame(&img, f);
+    if (daala_encode_img_in(enc, &img, 0) < 0) nbytes = -1;
+    while (nbytes >= 0 && daala_encode_packet_out(enc, f == NFRAMES - 1,
+     &op) > 0) {
+      if (nbytes + op.bytes > MAX_BYTES) nbytes = -1;
+      else {
+        memcpy(_data + nbytes, op.packet, op.bytes);
+        nbytes += op.bytes;
+      }
+    }
+  }
+  for (pli = 0; pli < 3; pli++) free(bufs[pli]);
+  daala_encode_free(enc);
+  return nbytes;
+}
+
+int main(void) {
+  int failed;
+  int si;
+  failed = 0;
+  for (si = 0; si < (int)(sizeof(SIZES)/sizeof(*SIZES)); si++) {
+    long ref_nbytes;
+    int nthreads;
+    ref_nbytes = encode(ref_data, SIZES[si][0], SIZES[si][1], 1);
+    if (ref_nbytes < 0) {
+      fprintf(stderr, "Encoding %ix%i with 1 thread failed.\n",
+       SIZES[si][0], SIZES[si][1]);
+      return EXIT_FAILURE;
+    }
+    for (nthreads = 2; nthreads <= MAX_THREADS; nthreads++) {
+      long nbytes;
+      nbytes = encode(data, SIZES[si][0], SIZES[si][1], nthreads);
+      if (nbytes < 0) {
+        fprintf(stderr, "Encoding with %i threads is not available.\n",
+         nthreads);
+        return EXIT_SUCCESS;
+      }
+      if (nbytes != ref_nbytes || memcmp(data, ref_data, nbytes) != 0) {
+        fprintf(stderr, "%ix%i with %i threads differs from 1 thread.\n",
+         SIZES[si][0], SIZES[si][1], nthreads);
+        failed = 1;
+      }
+    }
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,246 @@
+/*Daala video codec
+Copyright (c) 2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include <string.h>
+#include "thread.h"
+
+int od_row_sync_init(od_row_sync *_sync,int _nrows){
+  _sync->progress=(int *)_ogg_calloc(_nrows,sizeof(*_sync->progress));
+  if(_sync->progress==NULL)return OD_EFAULT;
+  _sync->nrows=_nrows;
+#if defined(OD_ENABLE_THREADS)
+  pthread_mutex_init(&_sync->mutex,NULL);
+  pthread_cond_init(&_sync->cond,NULL);
+#endif
+  return 0;
+}
+
+void od_row_sync_clear(od_row_sync *_sync){
+#if defined(OD_ENABLE_THREADS)
+  pthread_cond_destroy(&_sync->cond);
+  pthread_mutex_destroy(&_sync->mutex);
+#endif
+  _ogg_free(_sync->progress);
+}
+
+/*Marks every row as not started.
+  This must not be called while any thread is using _sync.*/
+void od_row_sync_reset(od_row_sync *_sync){
+  memset(_sync->progress,0,_sync->nrows*sizeof(*_sync->progress));
+}
+
+/*Records that the first _count units of row _row are complete.*/
+void od_row_sync_post(od_row_sync *_sync,int _row,int _count){
+  OD_ASSERT(_row>=0&&_row<_sync->nrows);
+#if defined(OD_ENABLE_THREADS)
+  pthread_mutex_lock(&_sync->mutex);
+  _sync->progress[_row]=_count;
+  pthread_cond_broadcast(&_sync->cond);
+  pthread_mutex_unlock(&_sync->mutex);
+#else
+  _sync->progress[_row]=_count;
+#endif
+}
+
+/*Blocks until the first _count units of row _row are complete.
+  Rows outside the frame never have to be waited for.*/
+void od_row_sync_wait(od_row_sync *_sync,int _row,int _count){
+  if(_row<0||_row>=_sync->nrows)return;
+#if defined(OD_ENABLE_THREADS)
+  pthread_mutex_lock(&_sync->mutex);
+  while(_sync->progress[_row]<_count){
+    pthread_cond_wait(&_sync->cond,&_sync->mutex);
+  }
+  pthread_mutex_unlock(&_sync->mutex);
+#else
+  OD_ASSERT(_sync->progress[_row]>=_count);
+#endif
+}
+
+#if defined(OD_ENABLE_THREADS)
+
+typedef struct od_thread_worker od_thread_worker;
+
+struct od_thread_worker{
+  od_thread_pool *pool;
+  pthread_t       thread;
+  int             ti;
+};
+
+struct od_thread_pool{
+  pthread_mutex_t   mutex;
+  /*Signaled when a new job is started or the pool is shutting down.*/
+  pthread_cond_t    start_cond;
+  /*Signaled when the last worker finishes the current job.*/
+  pthread_cond_t    done_cond;
+  od_thread_worker *workers;
+  od_thread_func    func;
+  void             *ctx;
+  int               nthreads;
+  /*Incremented each time a new job is started.*/
+  unsigned          generation;
+  /*The number of workers that have not yet finished the current job.*/
+  int               nbusy;
+  int               quit;
+};
+
+static void *od_thread_worker_main(void *_arg){
+  od_thread_worker *worker;
+  od_thread_pool   *pool;
+  unsigned          generation;
+  worker=(od_thread_worker *)_arg;
+  pool=worker->pool;
+  /*The pool starts at generation 0, and a job may be started before we get
+     here, so we cannot just read the current generation.*/
+  generation=0;
+  pthread_mutex_lock(&pool->mutex);
+  for(;;){
+    od_thread_func  func;
+    void           *ctx;
+    while(pool->generation==generation&&!pool->quit){
+      pthread_cond_wait(&pool->start_cond,&pool->mutex);
+    }
+    if(pool->quit)break;
+    generation=pool->generation;
+    func=pool->func;
+    ctx=pool->ctx;
+    pthread_mutex_unlock(&pool->mutex);
+    (*func)(ctx,worker->ti);
+    pthread_mutex_lock(&pool->mutex);
+    if(--pool->nbusy==0)pthread_cond_signal(&pool->done_cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+
+od_thread_pool *od_thread_pool_alloc(int _nthreads){
+  od_thread_pool *pool;
+  int             ti;
+  OD_ASSERT(_nthreads>0);
+  pool=(od_thread_pool *)_ogg_malloc(sizeof(*pool));
+  if(pool==NULL)return NULL;
+  pool->workers=(od_thread_worker *)_ogg_malloc(
+   _nthreads*sizeof(*pool->workers));
+  if(pool->workers==NULL){
+    _ogg_free(pool);
+    return NULL;
+  }
+  pthread_mutex_init(&pool->mutex,NULL);
+  pthread_cond_init(&pool->start_cond,NULL);
+  pthread_cond_init(&pool->done_cond,NULL);
+  pool->func=NULL;
+  pool->ctx=NULL;
+  pool->generation=0;
+  pool->nbusy=0;
+  pool->quit=0;
+  for(ti=0;ti<_nthreads;ti++){
+    pool->workers[ti].pool=pool;
+    pool->workers[ti].ti=ti;
+    if(pthread_create(&pool->workers[ti].thread,NULL,
+     od_thread_worker_main,pool->workers+ti)!=0){
+      break;
+    }
+  }
+  pool->nthreads=ti;
+  if(ti<_nthreads){
+    od_thread_pool_free(pool);
+    return NULL;
+  }
+  return pool;
+}
+
+void od_thread_pool_free(od_thread_pool *_pool){
+  int ti;
+  if(_pool==NULL)return;
+  pthread_mutex_lock(&_pool->mutex);
+  _pool->quit=1;
+  pthread_cond_broadcast(&_pool->start_cond);
+  pthread_mutex_unlock(&_pool->mutex);
+  for(ti=0;ti<_pool->nthreads;ti++){
+    pthread_join(_pool->workers[ti].thread,NULL);
+  }
+  pthread_cond_destroy(&_pool->done_cond);
+  pthread_cond_destroy(&_pool->start_cond);
+  pthread_mutex_destroy(&_pool->mutex);
+  _ogg_free(_pool->workers);
+  _ogg_free(_pool);
+}
+
+int od_thread_pool_nthreads(const od_thread_pool *_pool){
+  return _pool!=NULL?_pool->nthreads:1;
+}
+
+/*Runs _func(_ctx,ti) on every worker in the pool, without waiting for them
+   to finish.
+  Every job must be finished with od_thread_pool_join() before the next one is
+   started.*/
+void od_thread_pool_start(od_thread_pool *_pool,od_thread_func _func,
+ void *_ctx){
+  pthread_mutex_lock(&_pool->mutex);
+  OD_ASSERT(_pool->nbusy==0);
+  _pool->func=_func;
+  _pool->ctx=_ctx;
+  _pool->nbusy=_pool->nthreads;
+  _pool->generation++;
+  pthread_cond_broadcast(&_pool->start_cond);
+  pthread_mutex_unlock(&_pool->mutex);
+}
+
+/*Waits for every worker to finish the current job.*/
+void od_thread_pool_join(od_thread_pool *_pool){
+  pthread_mutex_lock(&_pool->mutex);
+  while(_pool->nbusy>0)pthread_cond_wait(&_pool->done_cond,&_pool->mutex);
+  pthread_mutex_unlock(&_pool->mutex);
+}
+
+#else
+
+od_thread_pool *od_thread_pool_alloc(int _nthreads){
+  (void)_nthreads;
+  return NULL;
+}
+
+void od_thread_pool_free(od_thread_pool *_pool){
+  OD_ASSERT(_pool==NULL);
+  (void)_pool;
+}
+
+int od_thread_pool_nthreads(const od_thread_pool *_pool){
+  (void)_pool;
+  return 1;
+}
+
+void od_thread_pool_start(od_thread_pool *_pool,od_thread_func _func,
+ void *_ctx){
+  (void)_pool;
+  (void)_func;
+  (void)_ctx;
+  OD_ASSERT2(0,"Built without thread support.");
+}
+
+void od_thread_pool_join(od_thread_pool *_pool){
+  (void)_pool;
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*Daala video codec
+Copyright (c) 2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#if !defined(_thread_H)
+# define _thread_H (1)
+# include "internal.h"
+# if defined(OD_ENABLE_THREADS)
+#  include <pthread.h>
+# endif
+
+typedef struct od_thread_pool od_thread_pool;
+typedef struct od_row_sync    od_row_sync;
+
+/*A job run by every worker in a thread pool.
+  _ti is the index of the worker running it, in the range [0,nthreads).*/
+typedef void (*od_thread_func)(void *_ctx,int _ti);
+
+/*Tracks how many units (e.g., macro blocks) of each row of a frame are
+   complete, so that a thread working on one row can wait for the parts of
+   other rows it depends on.
+  When built without thread support, the rows must be processed in an order
+   that never has to wait, and waiting merely asserts that this is so.*/
+struct od_row_sync{
+# if defined(OD_ENABLE_THREADS)
+  pthread_mutex_t  mutex;
+  pthread_cond_t   cond;
+# endif
+  int             *progress;
+  int              nrows;
+};
+
+int od_row_sync_init(od_row_sync *_sync,int _nrows);
+void od_row_sync_clear(od_row_sync *_sync);
+void od_row_sync_reset(od_row_sync *_sync);
+void od_row_sync_post(od_row_sync *_sync,int _row,int _count);
+void od_row_sync_wait(od_row_sync *_sync,int _row,int _count);
+
+/*Returns NULL if the library was built without thread support.*/
+od_thread_pool *od_thread_pool_alloc(int _nthreads);
+void od_thread_pool_free(od_thread_pool *_pool);
+int od_thread_pool_nthreads(const od_thread_pool *_pool);
+void od_thread_pool_start(od_thread_pool *_pool,od_thread_func _func,
+ void *_ctx);
+void od_thread_pool_join(od_thread_pool *_pool);
+
+#endif
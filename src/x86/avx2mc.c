@@ -0,0 +1,536 @@
+/*Daala video codec
+Copyright (c) 2006-2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86_AVX2)
+# include <string.h>
+# include <immintrin.h>
+# include "../mc.h"
+# if defined(OD_CHECKASM)
+#  include <stdio.h>
+# endif
+
+/*AVX2 versions of the motion compensation kernels in sse2mc.c.
+  Each works on 16 output pixels at a time, in 16-bit lanes, and hands
+   blocks smaller than that (or narrower than its layout supports) to the
+   SSE2 version.
+  All of them produce exactly the same output as the SSE2 versions, which is
+   what x86 builds have always used, even where that differs from the C
+   versions: the predictors repeat the SSE2 arithmetic step for step, and
+   the split blend averages two normal blends, as the SSE2 one does, instead
+   of adjusting the weights.
+  The normal blend also matches the C version.*/
+
+#if defined(OD_CHECKASM)
+static void od_mc_avx2_check(const char *_name,const unsigned char *_dst,
+ int _dystride,const unsigned char *_ref,int _log_xblk_sz,int _log_yblk_sz){
+  int xblk_sz;
+  int yblk_sz;
+  int failed;
+  int i;
+  int j;
+  xblk_sz=1<<_log_xblk_sz;
+  yblk_sz=1<<_log_yblk_sz;
+  failed=0;
+  for(j=0;j<yblk_sz;j++){
+    for(i=0;i<xblk_sz;i++){
+      if(_ref[i+(j<<_log_xblk_sz)]!=(_dst+j*_dystride)[i]){
+        fprintf(stderr,"ASM mismatch: 0x%02X!=0x%02X @ (%2i,%2i)\n",
+         _ref[i+(j<<_log_xblk_sz)],(_dst+j*_dystride)[i],i,j);
+        failed=1;
+      }
+    }
+  }
+  if(failed){
+    fprintf(stderr,"%s %ix%i check failed.\n",_name,xblk_sz,yblk_sz);
+  }
+}
+#endif
+
+/*Computes _p+((_q-_p)*_w>>16) in each 16-bit lane, for 8-bit _p and _q and
+   an unsigned 16-bit weight _w.
+  pmulhuw treats the difference as unsigned, which adds an extra copy of _w
+   when it is negative, so we subtract that back off, as the SSE2 version of
+   od_mc_predict1imv8() does.*/
+static OD_TARGET_AVX2 __m256i od_mc_lerp16_avx2(__m256i _p,__m256i _q,
+ __m256i _w){
+  __m256i d;
+  d=_mm256_sub_epi16(_q,_p);
+  return _mm256_sub_epi16(_mm256_add_epi16(_p,_mm256_mulhi_epu16(d,_w)),
+   _mm256_and_si256(_mm256_cmpgt_epi16(_mm256_setzero_si256(),d),_w));
+}
+
+/*Packs 16 16-bit values between 0 and 255, in order, into 16 bytes.*/
+static OD_TARGET_AVX2 __m128i od_mc_pack16_avx2(__m256i _v){
+  return _mm_packus_epi16(_mm256_castsi256_si128(_v),
+   _mm256_extracti128_si256(_v,1));
+}
+
+/*Loads the 32 bytes of upsampled reference behind 16 output pixels of a
+   block 8 or 16 pixels wide: one row of 16, or two rows of 8, _ystride bytes
+   apart.*/
+static OD_TARGET_AVX2 __m256i od_mc_load32_avx2(const unsigned char *_src,
+ int _ystride,int _log_xblk_sz){
+  if(_log_xblk_sz>=4)return _mm256_loadu_si256((const __m256i *)_src);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(
+   _mm_loadu_si128((const __m128i *)_src)),
+   _mm_loadu_si128((const __m128i *)(_src+_ystride)),1);
+}
+
+/*Predicts 16 pixels of a block 8 or 16 pixels wide with a fixed motion
+   vector.
+  The pixels lie on the even bytes of the upsampled reference.
+  This repeats the SSE2 arithmetic step for step.
+  In particular, like the 8x2 and 16x1 SSE2 kernels, it only clears the extra
+   copy of the weight pmulhuw leaves in the upper byte of each lane after
+   filtering the second row, not the first.*/
+static OD_TARGET_AVX2 __m256i od_mc_predict1fmv8_16_avx2(
+ const unsigned char *_src,int _systride,int _log_xblk_sz,
+ __m256i _hscale,__m256i _vscale,int _mvxf,int _mvyf){
+  __m256i mask;
+  __m256i r0;
+  __m256i r1;
+  __m256i e0;
+  __m256i e1;
+  mask=_mm256_set1_epi16(0xFF);
+  r0=od_mc_load32_avx2(_src,_systride<<1,_log_xblk_sz);
+  e0=_mm256_and_si256(r0,mask);
+  if(_mvyf){
+    r1=od_mc_load32_avx2(_src+_systride,_systride<<1,_log_xblk_sz);
+    e1=_mm256_and_si256(r1,mask);
+    if(_mvxf){
+      e0=_mm256_add_epi16(e0,_mm256_mulhi_epu16(
+       _mm256_sub_epi16(_mm256_srli_epi16(r0,8),e0),_hscale));
+      e1=_mm256_and_si256(_mm256_add_epi16(e1,_mm256_mulhi_epu16(
+       _mm256_sub_epi16(_mm256_srli_epi16(r1,8),e1),_hscale)),mask);
+    }
+    return _mm256_and_si256(_mm256_add_epi16(e0,
+     _mm256_mulhi_epu16(_mm256_sub_epi16(e1,e0),_vscale)),mask);
+  }
+  if(_mvxf){
+    return _mm256_and_si256(_mm256_add_epi16(e0,_mm256_mulhi_epu16(
+     _mm256_sub_epi16(_mm256_srli_epi16(r0,8),e0),_hscale)),mask);
+  }
+  return e0;
+}
+
+OD_TARGET_AVX2 void od_mc_predict1fmv8_avx2(unsigned char *_dst,
+ const unsigned char *_src,int _systride,ogg_int32_t _mvx,ogg_int32_t _mvy,
+ int _log_xblk_sz,int _log_yblk_sz){
+  const unsigned char *src;
+  __m256i              hscale;
+  __m256i              vscale;
+  int                  mvxf;
+  int                  mvyf;
+  int                  ystep;
+  int                  n;
+  int                  k;
+  if(_log_xblk_sz<3||_log_xblk_sz+_log_yblk_sz<4){
+    od_mc_predict1fmv8_sse2(_dst,_src,_systride,_mvx,_mvy,
+     _log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  src=_src+(_mvx>>16)+_systride*(_mvy>>16);
+  mvxf=_mvx&0xFFFF;
+  mvyf=_mvy&0xFFFF;
+  hscale=_mm256_set1_epi16((short)mvxf);
+  vscale=_mm256_set1_epi16((short)mvyf);
+  /*The offset of the upsampled reference between two 16-pixel groups.*/
+  ystep=_systride<<5-_log_xblk_sz;
+  n=1<<_log_xblk_sz+_log_yblk_sz;
+  for(k=0;k<n;k+=32){
+    __m256i p;
+    __m256i q;
+    p=od_mc_predict1fmv8_16_avx2(src,_systride,_log_xblk_sz,
+     hscale,vscale,mvxf,mvyf);
+    if(k+16<n){
+      q=od_mc_predict1fmv8_16_avx2(src+ystep,_systride,_log_xblk_sz,
+       hscale,vscale,mvxf,mvyf);
+      /*packuswb interleaves the 128-bit halves; put them back in order.*/
+      _mm256_storeu_si256((__m256i *)(_dst+k),
+       _mm256_permute4x64_epi64(_mm256_packus_epi16(p,q),0xD8));
+    }
+    else _mm_storeu_si128((__m128i *)(_dst+k),od_mc_pack16_avx2(p));
+    src+=ystep<<1;
+  }
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    od_mc_predict1fmv8_sse2(ref,_src,_systride,_mvx,_mvy,
+     _log_xblk_sz,_log_yblk_sz);
+    od_mc_avx2_check("od_mc_predict1fmv8",_dst,1<<_log_xblk_sz,ref,
+     _log_xblk_sz,_log_yblk_sz);
+  }
+#endif
+}
+
+/*Stores the source offsets and the bilinear weights for 8 samples of an
+   interpolated motion vector field, given the 16.16 positions of the
+   samples in the upsampled reference.
+  As in the SSE2 version, the vertical position is saturated to 16 bits
+   before it is scaled by the stride.*/
+static OD_TARGET_AVX2 void od_mc_interp_mv8_avx2(int *_off,int *_hscale,
+ int *_vscale,__m256i _x,__m256i _y,__m256i _systride){
+  __m256i y;
+  y=_mm256_max_epi32(_mm256_min_epi32(_mm256_srai_epi32(_y,16),
+   _mm256_set1_epi32(32767)),_mm256_set1_epi32(-32768));
+  _mm256_store_si256((__m256i *)_off,_mm256_add_epi32(
+   _mm256_srai_epi32(_x,16),_mm256_mullo_epi32(y,_systride)));
+  _mm256_store_si256((__m256i *)_hscale,
+   _mm256_and_si256(_x,_mm256_set1_epi32(0xFFFF)));
+  _mm256_store_si256((__m256i *)_vscale,
+   _mm256_and_si256(_y,_mm256_set1_epi32(0xFFFF)));
+}
+
+/*Interpolates the motion vector field across a block, in raster order.
+  Blocks at least 8 pixels wide are done a row at a time; narrower ones fit
+   several rows in each group of 8 samples, which then all advance by the
+   same number of rows.
+  All of the arithmetic wraps modulo 1<<32, just like the incremental
+   updates the SSE2 version uses.*/
+static OD_TARGET_AVX2 void od_mc_interp_mv_avx2(int *_off,int *_hscale,
+ int *_vscale,const ogg_int32_t _dmvx[4],const ogg_int32_t _dmvy[4],
+ int _systride,int _log_xblk_sz,int _log_yblk_sz){
+  __m256i systride;
+  __m256i lane;
+  __m256i x;
+  __m256i y;
+  __m256i dx;
+  __m256i dy;
+  int     xblk_sz;
+  int     n;
+  int     k;
+  systride=_mm256_set1_epi32(_systride);
+  lane=_mm256_setr_epi32(0,1,2,3,4,5,6,7);
+  xblk_sz=1<<_log_xblk_sz;
+  n=1<<_log_xblk_sz+_log_yblk_sz;
+  if(_log_xblk_sz>=3){
+    int i;
+    int j;
+    k=0;
+    for(j=0;j<1<<_log_yblk_sz;j++){
+      ogg_uint32_t x0;
+      ogg_uint32_t y0;
+      ogg_uint32_t dxdi;
+      ogg_uint32_t dydi;
+      /*The start of this row and the derivatives along it.*/
+      x0=(ogg_uint32_t)_dmvx[0]+j*(ogg_uint32_t)_dmvx[2];
+      y0=(ogg_uint32_t)_dmvy[0]+j*(ogg_uint32_t)_dmvy[2];
+      dxdi=(ogg_uint32_t)_dmvx[1]+j*(ogg_uint32_t)_dmvx[3];
+      dydi=(ogg_uint32_t)_dmvy[1]+j*(ogg_uint32_t)_dmvy[3];
+      x=_mm256_add_epi32(_mm256_set1_epi32((int)x0),
+       _mm256_mullo_epi32(lane,_mm256_set1_epi32((int)dxdi)));
+      y=_mm256_add_epi32(_mm256_set1_epi32((int)y0),
+       _mm256_mullo_epi32(lane,_mm256_set1_epi32((int)dydi)));
+      dx=_mm256_set1_epi32((int)(dxdi<<3));
+      dy=_mm256_set1_epi32((int)(dydi<<3));
+      for(i=0;i<xblk_sz;i+=8){
+        od_mc_interp_mv8_avx2(_off+k,_hscale+k,_vscale+k,x,y,systride);
+        x=_mm256_add_epi32(x,dx);
+        y=_mm256_add_epi32(y,dy);
+        k+=8;
+      }
+    }
+  }
+  else{
+    __m256i i;
+    __m256i j;
+    __m256i shift;
+    i=_mm256_and_si256(lane,_mm256_set1_epi32(xblk_sz-1));
+    j=_mm256_srli_epi32(lane,_log_xblk_sz);
+    shift=_mm256_set1_epi32(3-_log_xblk_sz);
+    /*The derivatives along each column, scaled by the rows in a group.*/
+    dx=_mm256_add_epi32(_mm256_set1_epi32(_dmvx[2]),
+     _mm256_mullo_epi32(i,_mm256_set1_epi32(_dmvx[3])));
+    dy=_mm256_add_epi32(_mm256_set1_epi32(_dmvy[2]),
+     _mm256_mullo_epi32(i,_mm256_set1_epi32(_dmvy[3])));
+    x=_mm256_add_epi32(_mm256_add_epi32(_mm256_set1_epi32(_dmvx[0]),
+     _mm256_mullo_epi32(i,_mm256_set1_epi32(_dmvx[1]))),
+     _mm256_mullo_epi32(j,dx));
+    y=_mm256_add_epi32(_mm256_add_epi32(_mm256_set1_epi32(_dmvy[0]),
+     _mm256_mullo_epi32(i,_mm256_set1_epi32(_dmvy[1]))),
+     _mm256_mullo_epi32(j,dy));
+    dx=_mm256_sllv_epi32(dx,shift);
+    dy=_mm256_sllv_epi32(dy,shift);
+    for(k=0;k<n;k+=8){
+      od_mc_interp_mv8_avx2(_off+k,_hscale+k,_vscale+k,x,y,systride);
+      x=_mm256_add_epi32(x,dx);
+      y=_mm256_add_epi32(y,dy);
+    }
+  }
+}
+
+/*Loads the pairs of horizontally adjacent bytes at 16 offsets into 16-bit
+   lanes, in the order packusdw leaves two 8-lane registers.
+  This loads 4 bytes per offset, so it reads up to 2 bytes past the last
+   sample the block actually uses.
+  The reference buffers all have data or scratch space after them.*/
+static OD_TARGET_AVX2 __m256i od_mc_gather16_avx2(const unsigned char *_src,
+ __m256i _off0,__m256i _off1){
+  __m256i mask;
+  mask=_mm256_set1_epi32(0xFFFF);
+  return _mm256_packus_epi32(
+   _mm256_and_si256(_mm256_i32gather_epi32((const int *)_src,_off0,1),mask),
+   _mm256_and_si256(_mm256_i32gather_epi32((const int *)_src,_off1,1),mask));
+}
+
+OD_TARGET_AVX2 void od_mc_predict1imv8_avx2(unsigned char *_dst,
+ int _dystride,const unsigned char *_src,int _systride,
+ const ogg_int32_t _mvx[4],const ogg_int32_t _mvy[4],const int _m[4],int _r,
+ int _log_xblk_sz,int _log_yblk_sz){
+  const unsigned char                       *src;
+  unsigned char                             *dst;
+  unsigned char __attribute__((aligned(32))) buf[16*16];
+  int __attribute__((aligned(32)))           hscale[16*16];
+  int __attribute__((aligned(32)))           vscale[16*16];
+  int __attribute__((aligned(32)))           off[16*16];
+  ogg_int32_t                                dmvx[4];
+  ogg_int32_t                                dmvy[4];
+  __m256i                                    mask;
+  int                                        xblk_sz;
+  int                                        n;
+  int                                        k;
+  /*The SSE2 version falls back to C for these, too.*/
+  if(_log_xblk_sz+_log_yblk_sz<4){
+    od_mc_predict1imv8_sse2(_dst,_dystride,_src,_systride,_mvx,_mvy,
+     _m,_r,_log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  od_mc_setup_mvc(dmvx,_mvx,_m,_r,_log_xblk_sz,_log_yblk_sz);
+  od_mc_setup_mvc(dmvy,_mvy,_m,_r,_log_xblk_sz,_log_yblk_sz);
+  xblk_sz=1<<_log_xblk_sz;
+  dst=_dystride!=xblk_sz?buf:_dst;
+  n=1<<_log_xblk_sz+_log_yblk_sz;
+  if(!dmvx[1]&&!dmvy[1]&&!dmvx[2]&&!dmvy[2]&&!dmvx[3]&&!dmvy[3]){
+    od_mc_predict1fmv8_avx2(dst,_src,_systride,dmvx[0],dmvy[0],
+     _log_xblk_sz,_log_yblk_sz);
+  }
+  else{
+    src=_src+_systride*(dmvy[0]>>16)+(dmvx[0]>>16);
+    dmvx[0]&=0xFFFF;
+    dmvy[0]&=0xFFFF;
+    dmvx[1]+=1<<17;
+    dmvy[2]+=1<<17;
+    od_mc_interp_mv_avx2(off,hscale,vscale,dmvx,dmvy,_systride,
+     _log_xblk_sz,_log_yblk_sz);
+    mask=_mm256_set1_epi16(0xFF);
+    for(k=0;k<n;k+=16){
+      __m256i off0;
+      __m256i off1;
+      __m256i p;
+      __m256i q;
+      __m256i hs;
+      __m256i vs;
+      off0=_mm256_load_si256((const __m256i *)(off+k));
+      off1=_mm256_load_si256((const __m256i *)(off+k+8));
+      hs=_mm256_packus_epi32(_mm256_load_si256((const __m256i *)(hscale+k)),
+       _mm256_load_si256((const __m256i *)(hscale+k+8)));
+      vs=_mm256_packus_epi32(_mm256_load_si256((const __m256i *)(vscale+k)),
+       _mm256_load_si256((const __m256i *)(vscale+k+8)));
+      p=od_mc_gather16_avx2(src,off0,off1);
+      q=od_mc_gather16_avx2(src+_systride,off0,off1);
+      p=od_mc_lerp16_avx2(_mm256_and_si256(p,mask),_mm256_srli_epi16(p,8),hs);
+      q=od_mc_lerp16_avx2(_mm256_and_si256(q,mask),_mm256_srli_epi16(q,8),hs);
+      p=od_mc_lerp16_avx2(p,q,vs);
+      _mm_storeu_si128((__m128i *)(dst+k),
+       od_mc_pack16_avx2(_mm256_permute4x64_epi64(p,0xD8)));
+    }
+  }
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    od_mc_predict1imv8_sse2(ref,xblk_sz,_src,_systride,_mvx,_mvy,
+     _m,_r,_log_xblk_sz,_log_yblk_sz);
+    od_mc_avx2_check("od_mc_predict1imv8",dst,xblk_sz,ref,
+     _log_xblk_sz,_log_yblk_sz);
+  }
+#endif
+  if(dst!=_dst){
+    for(k=0;k<1<<_log_yblk_sz;k++){
+      memcpy(_dst+k*_dystride,dst+(k<<_log_xblk_sz),xblk_sz);
+    }
+  }
+}
+
+/*Computes the bilinear blend of 16 pixels of a block at least 4 pixels wide,
+   scaled by 1<<_log_xblk_sz+_log_yblk_sz and unrounded.
+  _i and _j hold the column and row of each pixel.
+  The result fits in 16 bits for blocks up to 16x16, so it is exact, even
+   though the intermediate terms wrap.*/
+static OD_TARGET_AVX2 __m256i od_mc_blend_full16_avx2(
+ const unsigned char *_src[4],int _o,__m256i _i,__m256i _j,
+ __m128i _log_xblk_sz,__m128i _log_yblk_sz){
+  __m256i s0;
+  __m256i s1;
+  __m256i s2;
+  __m256i s3;
+  __m256i a;
+  __m256i b;
+  s0=_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(_src[0]+_o)));
+  s1=_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(_src[1]+_o)));
+  s2=_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(_src[2]+_o)));
+  s3=_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(_src[3]+_o)));
+  a=_mm256_add_epi16(_mm256_sll_epi16(s0,_log_xblk_sz),
+   _mm256_mullo_epi16(_mm256_sub_epi16(s1,s0),_i));
+  b=_mm256_add_epi16(_mm256_sll_epi16(s3,_log_xblk_sz),
+   _mm256_mullo_epi16(_mm256_sub_epi16(s2,s3),_i));
+  return _mm256_add_epi16(_mm256_sll_epi16(a,_log_yblk_sz),
+   _mm256_mullo_epi16(_mm256_sub_epi16(b,a),_j));
+}
+
+/*Stores 16 pixels of a block 4, 8 or 16 pixels wide.*/
+static OD_TARGET_AVX2 void od_mc_blend_store16_avx2(unsigned char *_dst,
+ int _dystride,__m128i _v,int _log_xblk_sz){
+  int v;
+  int j;
+  switch(_log_xblk_sz){
+    case 2:{
+      for(j=0;j<4;j++){
+        v=_mm_cvtsi128_si32(_v);
+        memcpy(_dst+j*_dystride,&v,sizeof(v));
+        _v=_mm_srli_si128(_v,4);
+      }
+    }break;
+    case 3:{
+      _mm_storel_epi64((__m128i *)_dst,_v);
+      _mm_storel_epi64((__m128i *)(_dst+_dystride),_mm_srli_si128(_v,8));
+    }break;
+    default:_mm_storeu_si128((__m128i *)_dst,_v);
+  }
+}
+
+/*Perform normal bilinear blending.*/
+OD_TARGET_AVX2 void od_mc_blend_full8_avx2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz){
+  __m256i lane;
+  __m256i i;
+  __m256i j;
+  __m256i dj;
+  __m256i round;
+  __m128i log_xblk_sz;
+  __m128i log_yblk_sz;
+  __m128i log_blk_sz2;
+  int     n;
+  int     k;
+  if(_log_xblk_sz<2||_log_xblk_sz+_log_yblk_sz<4){
+    od_mc_blend_full8_sse2(_dst,_dystride,_src,_log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  lane=_mm256_setr_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+  log_xblk_sz=_mm_cvtsi32_si128(_log_xblk_sz);
+  log_yblk_sz=_mm_cvtsi32_si128(_log_yblk_sz);
+  log_blk_sz2=_mm_cvtsi32_si128(_log_xblk_sz+_log_yblk_sz);
+  i=_mm256_and_si256(lane,_mm256_set1_epi16((1<<_log_xblk_sz)-1));
+  j=_mm256_srl_epi16(lane,log_xblk_sz);
+  dj=_mm256_set1_epi16(16>>_log_xblk_sz);
+  round=_mm256_set1_epi16(1<<_log_xblk_sz+_log_yblk_sz-1);
+  n=1<<_log_xblk_sz+_log_yblk_sz;
+  for(k=0;k<n;k+=16){
+    __m256i p;
+    p=od_mc_blend_full16_avx2(_src,k,i,j,log_xblk_sz,log_yblk_sz);
+    p=_mm256_srl_epi16(_mm256_add_epi16(p,round),log_blk_sz2);
+    od_mc_blend_store16_avx2(_dst,_dystride,od_mc_pack16_avx2(p),
+     _log_xblk_sz);
+    _dst+=_dystride<<4-_log_xblk_sz;
+    j=_mm256_add_epi16(j,dj);
+  }
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    od_mc_blend_full8_c(ref,1<<_log_xblk_sz,_src,_log_xblk_sz,_log_yblk_sz);
+    od_mc_avx2_check("od_mc_blend_full8",_dst-(_dystride<<_log_yblk_sz),
+     _dystride,ref,_log_xblk_sz,_log_yblk_sz);
+  }
+#endif
+}
+
+/*Perform normal blending with bilinear weights modified for unsplit edges.
+  Like the SSE2 version, this averages a normal bilinear blend of the four
+   predictors with one where the predictors across each unsplit edge are
+   substituted for each other.
+  The C version adjusts the weights instead, which can round differently.*/
+OD_TARGET_AVX2 void od_mc_blend_full_split8_avx2(unsigned char *_dst,
+ int _dystride,const unsigned char *_src[4],int _c,int _s,
+ int _log_xblk_sz,int _log_yblk_sz){
+  const unsigned char *drc[4];
+  __m256i              lane;
+  __m256i              i;
+  __m256i              j;
+  __m256i              dj;
+  __m256i              one;
+  __m256i              round;
+  __m128i              log_xblk_sz;
+  __m128i              log_yblk_sz;
+  __m128i              log_blk_sz2;
+  int                  n;
+  int                  k;
+  if(_log_xblk_sz<2||_log_xblk_sz+_log_yblk_sz<4){
+    od_mc_blend_full_split8_sse2(_dst,_dystride,_src,_c,_s,
+     _log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  od_mc_setup_split_ptrs(drc,_src,_c,_s);
+  lane=_mm256_setr_epi16(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+  log_xblk_sz=_mm_cvtsi32_si128(_log_xblk_sz);
+  log_yblk_sz=_mm_cvtsi32_si128(_log_yblk_sz);
+  log_blk_sz2=_mm_cvtsi32_si128(_log_xblk_sz+_log_yblk_sz);
+  i=_mm256_and_si256(lane,_mm256_set1_epi16((1<<_log_xblk_sz)-1));
+  j=_mm256_srl_epi16(lane,log_xblk_sz);
+  dj=_mm256_set1_epi16(16>>_log_xblk_sz);
+  one=_mm256_set1_epi16(1);
+  round=_mm256_set1_epi16(1<<_log_xblk_sz+_log_yblk_sz-1);
+  n=1<<_log_xblk_sz+_log_yblk_sz;
+  for(k=0;k<n;k+=16){
+    __m256i p;
+    __m256i q;
+    p=od_mc_blend_full16_avx2(_src,k,i,j,log_xblk_sz,log_yblk_sz);
+    q=od_mc_blend_full16_avx2(drc,k,i,j,log_xblk_sz,log_yblk_sz);
+    /*The sum of the two blends can overflow 16 bits, but since the result
+       is rounded with a larger power of two, halving it first (rounding
+       down) gives the same answer.*/
+    p=_mm256_sub_epi16(_mm256_avg_epu16(p,q),
+     _mm256_and_si256(_mm256_xor_si256(p,q),one));
+    p=_mm256_srl_epi16(_mm256_add_epi16(p,round),log_blk_sz2);
+    od_mc_blend_store16_avx2(_dst,_dystride,od_mc_pack16_avx2(p),
+     _log_xblk_sz);
+    _dst+=_dystride<<4-_log_xblk_sz;
+    j=_mm256_add_epi16(j,dj);
+  }
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    /*The SSE2 version only handles blocks up to 8x8.*/
+    if(_log_xblk_sz<4&&_log_yblk_sz<4){
+      od_mc_blend_full_split8_sse2(ref,1<<_log_xblk_sz,_src,_c,_s,
+       _log_xblk_sz,_log_yblk_sz);
+      od_mc_avx2_check("od_mc_blend_full_split8",
+       _dst-(_dystride<<_log_yblk_sz),_dystride,ref,
+       _log_xblk_sz,_log_yblk_sz);
+    }
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*Daala video codec
+Copyright (c) 2006-2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86_AVX2)&&defined(__SSE2__)
+# include <immintrin.h>
+
+/*AVX2 versions of the SAD functions used by motion estimation.
+  Like those in avx2mc.c, they are picked at run time, and they hand what
+   they do not handle to the SSE2 versions, which need the compiler to target
+   SSE2.
+  Only 16x16 and 32x32 blocks are handled here, in units of 16 pixels
+   across: two rows at once when the predictor is contiguous, or one row
+   widened to 16 bits when its pixels are 2 bytes apart.
+  The odd bytes of the predictor are masked off in that case, which makes
+   them match the zeros in the input.*/
+
+static OD_TARGET_AVX2 __m256i od_sad_load_src_avx2(
+ const unsigned char *_src,int _systride,int _rxstride){
+  if(_rxstride==1){
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(
+     _mm_loadu_si128((const __m128i *)_src)),
+     _mm_loadu_si128((const __m128i *)(_src+_systride)),1);
+  }
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)_src));
+}
+
+static OD_TARGET_AVX2 __m256i od_sad_load_ref_avx2(
+ const unsigned char *_ref,int _rystride,int _rxstride){
+  if(_rxstride==1)return od_sad_load_src_avx2(_ref,_rystride,1);
+  return _mm256_and_si256(_mm256_loadu_si256((const __m256i *)_ref),
+   _mm256_set1_epi16(0xFF));
+}
+
+static OD_TARGET_AVX2 ogg_int32_t od_sad_hsum_avx2(__m256i _sad){
+  __m128i sad;
+  sad=_mm_add_epi32(_mm256_castsi256_si128(_sad),
+   _mm256_extracti128_si256(_sad,1));
+  return _mm_cvtsi128_si32(_mm_add_epi32(sad,_mm_unpackhi_epi64(sad,sad)));
+}
+
+OD_TARGET_AVX2 ogg_int32_t od_mc_sad8_avx2(const unsigned char *_src,
+ int _systride,const unsigned char *_ref,int _rystride,int _rxstride,
+ int _log_blk_sz){
+  __m256i sad;
+  int blk_sz;
+  int i;
+  int j;
+  if(_log_blk_sz<4||_log_blk_sz>5||_rxstride>2){
+    return od_mc_sad8_sse2(_src,_systride,_ref,_rystride,_rxstride,
+     _log_blk_sz);
+  }
+  blk_sz=1<<_log_blk_sz;
+  sad=_mm256_setzero_si256();
+  for(j=0;j<blk_sz;j+=3-_rxstride){
+    for(i=0;i<blk_sz;i+=16){
+      sad=_mm256_add_epi32(sad,_mm256_sad_epu8(
+       od_sad_load_src_avx2(_src+j*_systride+i,_systride,_rxstride),
+       od_sad_load_ref_avx2(_ref+j*_rystride+i*_rxstride,_rystride,
+       _rxstride)));
+    }
+  }
+  return od_sad_hsum_avx2(sad);
+}
+
+OD_TARGET_AVX2 void od_mc_sad_multi8_avx2(ogg_int32_t *_sads,
+ const unsigned char *_src,int _systride,const unsigned char *const *_ref,
+ int _nref,int _rystride,int _rxstride,int _log_blk_sz){
+  __m256i sad[OD_MC_SAD_NREFS_MAX];
+  int blk_sz;
+  int ri;
+  int i;
+  int j;
+  if(_log_blk_sz<4||_log_blk_sz>5||_rxstride>2){
+    od_mc_sad_multi8_sse2(_sads,_src,_systride,_ref,_nref,_rystride,
+     _rxstride,_log_blk_sz);
+    return;
+  }
+  OD_ASSERT(_nref<=OD_MC_SAD_NREFS_MAX);
+  blk_sz=1<<_log_blk_sz;
+  for(ri=0;ri<_nref;ri++)sad[ri]=_mm256_setzero_si256();
+  for(j=0;j<blk_sz;j+=3-_rxstride){
+    for(i=0;i<blk_sz;i+=16){
+      __m256i s;
+      s=od_sad_load_src_avx2(_src+j*_systride+i,_systride,_rxstride);
+      for(ri=0;ri<_nref;ri++){
+        sad[ri]=_mm256_add_epi32(sad[ri],_mm256_sad_epu8(s,
+         od_sad_load_ref_avx2(_ref[ri]+j*_rystride+i*_rxstride,_rystride,
+         _rxstride)));
+      }
+    }
+  }
+  for(ri=0;ri<_nref;ri++)_sads[ri]=od_sad_hsum_avx2(sad[ri]);
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*Daala video codec
+Copyright (c) 2006-2010 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "x86int.h"
+
+#if defined(OD_X86_AVX2)&&defined(__SSE2__)
+# include <immintrin.h>
+
+/*AVX2 versions of the row filters used by od_state_upsample8_rows().
+  Like those in avx2mc.c, they are picked at run time, and they hand the
+   pixels left over to the SSE2 versions, which need the compiler to target
+   SSE2.
+  They work like the SSE2 versions in sse2upsample.c, on twice as many pixels
+   at a time.*/
+
+static OD_TARGET_AVX2 __m256i od_upsample_filter16_avx2(__m256i _p0,
+ __m256i _p1,__m256i _p2,__m256i _p3,__m256i _p4,__m256i _p5){
+  __m256i a;
+  __m256i b;
+  a=_mm256_add_epi16(_p2,_p3);
+  b=_mm256_add_epi16(_p1,_p4);
+  a=_mm256_sub_epi16(_mm256_slli_epi16(a,2),b);
+  a=_mm256_add_epi16(a,_mm256_slli_epi16(a,2));
+  a=_mm256_add_epi16(a,_mm256_add_epi16(_p0,_p5));
+  return _mm256_srai_epi16(_mm256_add_epi16(a,_mm256_set1_epi16(16)),5);
+}
+
+static OD_TARGET_AVX2 __m256i od_load16_epi16(const unsigned char *_p){
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)_p));
+}
+
+OD_TARGET_AVX2 void od_upsample_hrow8_avx2(unsigned char *_dst,
+ const unsigned char *_src,int _n){
+  int x;
+  for(x=0;x+16<=_n;x+=16){
+    __m256i s;
+    __m256i h;
+    s=od_load16_epi16(_src+x);
+    h=od_upsample_filter16_avx2(od_load16_epi16(_src+x-2),
+     od_load16_epi16(_src+x-1),s,od_load16_epi16(_src+x+1),
+     od_load16_epi16(_src+x+2),od_load16_epi16(_src+x+3));
+    /*Clamp the half-pel samples and put each one in the high byte of the
+       pixel before it, which interleaves them in memory.*/
+    h=_mm256_min_epi16(_mm256_max_epi16(h,_mm256_setzero_si256()),
+     _mm256_set1_epi16(255));
+    _mm256_storeu_si256((__m256i *)(_dst+(x<<1)),
+     _mm256_or_si256(s,_mm256_slli_epi16(h,8)));
+  }
+  if(x<_n)od_upsample_hrow8_sse2(_dst+(x<<1),_src+x,_n-x);
+}
+
+OD_TARGET_AVX2 void od_upsample_vrow8_avx2(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n){
+  __m256i zero;
+  int     x;
+  zero=_mm256_setzero_si256();
+  for(x=0;x+32<=_n;x+=32){
+    __m256i p[6];
+    __m256i lo;
+    __m256i hi;
+    int     k;
+    for(k=0;k<6;k++)p[k]=_mm256_loadu_si256((const __m256i *)(_src[k]+x));
+    /*The unpacks and the pack all work within 128-bit lanes, so the bytes
+       come back out in their original order.*/
+    lo=od_upsample_filter16_avx2(_mm256_unpacklo_epi8(p[0],zero),
+     _mm256_unpacklo_epi8(p[1],zero),_mm256_unpacklo_epi8(p[2],zero),
+     _mm256_unpacklo_epi8(p[3],zero),_mm256_unpacklo_epi8(p[4],zero),
+     _mm256_unpacklo_epi8(p[5],zero));
+    hi=od_upsample_filter16_avx2(_mm256_unpackhi_epi8(p[0],zero),
+     _mm256_unpackhi_epi8(p[1],zero),_mm256_unpackhi_epi8(p[2],zero),
+     _mm256_unpackhi_epi8(p[3],zero),_mm256_unpackhi_epi8(p[4],zero),
+     _mm256_unpackhi_epi8(p[5],zero));
+    _mm256_storeu_si256((__m256i *)(_dst+x),_mm256_packus_epi16(lo,hi));
+  }
+  if(x<_n){
+    const unsigned char *src[6];
+    int                  k;
+    for(k=0;k<6;k++)src[k]=_src[k]+x;
+    od_upsample_vrow8_sse2(_dst+x,src,_n-x);
+  }
+}
+
+#endif
@@ -35,6 +35,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
            :[eax]"=a"(_eax),[ebx]"=b"(_ebx),[ecx]"=c"(_ecx),[edx]"=d"(_edx) \
            :"a"(_op) \
           )
+/*Leaves 4 and up also take a sub-leaf in %ecx.*/
+#  define cpuid_count(_op,_subop,_eax,_ebx,_ecx,_edx) \
+    __asm__ __volatile__( \
+           "cpuid\n\t" \
+           :[eax]"=a"(_eax),[ebx]"=b"(_ebx),[ecx]"=c"(_ecx),[edx]"=d"(_edx) \
+           :"a"(_op),"c"(_subop) \
+          )
 # else
 /*On x86-32, not so much.*/
 #  define cpuid(_op,_eax,_ebx,_ecx,_edx) \
@@ -45,14 +52,57 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
            :[eax]"=a"(_eax),[ebx]"=r"(_ebx),[ecx]"=c"(_ecx),[edx]"=d"(_edx) \
            :"a"(_op) \
           )
+#  define cpuid_count(_op,_subop,_eax,_ebx,_ecx,_edx) \
+    __asm__ __volatile__( \
+           "xchgl %%ebx,%[ebx]\n\t" \
+           "cpuid\n\t" \
+           "xchgl %%ebx,%[ebx]\n\t" \
+           :[eax]"=a"(_eax),[ebx]"=r"(_ebx),[ecx]"=c"(_ecx),[edx]"=d"(_edx) \
+           :"a"(_op),"c"(_subop) \
+          )
 # endif
 
+/*Reads the XCR0 register, which says which register states the OS saves.
+  The instruction is spelled out in bytes for assemblers that predate it.*/
+# define xgetbv(_eax,_edx) \
+  __asm__ __volatile__( \
+         ".byte 0x0f,0x01,0xd0\n\t" \
+         :[eax]"=a"(_eax),[edx]"=d"(_edx) \
+         :"c"(0) \
+        )
+
+/*Checks for the extensions that Intel and AMD report the same way.
+  _max_leaf: The largest standard cpuid leaf supported.
+  _ecx:      The contents of %ecx from leaf 1.*/
+static ogg_uint32_t od_cpu_flags_get_ext(ogg_uint32_t _max_leaf,
+ ogg_uint32_t _ecx){
+  ogg_uint32_t eax;
+  ogg_uint32_t ebx;
+  ogg_uint32_t ecx;
+  ogg_uint32_t edx;
+  ogg_uint32_t flags;
+  flags=0;
+  if(_ecx&0x00000200)flags|=OD_CPU_X86_SSSE3;
+  if(_ecx&0x00080000)flags|=OD_CPU_X86_SSE4_1;
+  /*AVX2 instructions fault unless the OS has enabled the AVX state (both
+     OSXSAVE and AVX set, and bits 1 and 2 of XCR0), whatever the CPU says.*/
+  if((_ecx&0x18000000)==0x18000000&&_max_leaf>=7){
+    xgetbv(eax,edx);
+    if((eax&0x6)==0x6){
+      cpuid_count(7,0,eax,ebx,ecx,edx);
+      if(ebx&0x00000020)flags|=OD_CPU_X86_AVX2;
+    }
+  }
+  return flags;
+}
+
 ogg_uint32_t od_cpu_flags_get(void){
   ogg_uint32_t eax;
   ogg_uint32_t ebx;
   ogg_uint32_t ecx;
   ogg_uint32_t edx;
   ogg_uint32_t flags;
+  ogg_uint32_t max_leaf;
 #if !defined(__amd64__)&&!defined(__x86_64__)
   /*x86-32: Check to see if we have the cpuid instruction.
     This is done by attempting to flip the ID bit in the rFLAGS register.
@@ -76,6 +126,7 @@ ogg_uint32_t od_cpu_flags_get(void){
   /*x86-64: All CPUs support cpuid, so there's no need to check.*/
 #endif
   cpuid(0,eax,ebx,ecx,edx);
+  max_leaf=eax;
   /*         l e t n          I e n i          u n e G*/
   if(ecx==0x6C65746E&&edx==0x49656E69&&ebx==0x756E6547){
     /*Intel:*/
@@ -86,6 +137,7 @@ ogg_uint32_t od_cpu_flags_get(void){
     if(edx&0x02000000)flags|=OD_CPU_X86_MMXEXT|OD_CPU_X86_SSE;
     if(edx&0x04000000)flags|=OD_CPU_X86_SSE2;
     if(ecx&0x00000001)flags|=OD_CPU_X86_PNI;
+    flags|=od_cpu_flags_get_ext(max_leaf,ecx);
   }
   /*Also          R E T T          E B S I            D M A
      is found in some engineering samples c. 1994.
@@ -119,6 +171,7 @@ ogg_uint32_t od_cpu_flags_get(void){
     }
     if(edx&0x04000000)flags|=OD_CPU_X86_SSE2;
     if(ecx&0x00000001)flags|=OD_CPU_X86_PNI;
+    flags|=od_cpu_flags_get_ext(max_leaf,ecx);
   }
   /*Unhandled processor manufacturers.*/
   /*Transmeta:
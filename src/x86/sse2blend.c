@@ -0,0 +1,367 @@
+/*Daala video codec
+Copyright (c) 2006-2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <string.h>
+# include <emmintrin.h>
+# if defined(OD_CHECKASM)
+#  include <stdio.h>
+# endif
+
+/*SSE2 versions of the multiresolution blends, for blocks 8 or 16 pixels
+   wide and 4 to 16 pixels tall.
+  These produce exactly the same output as od_mc_blend_multi8_c() and
+   od_mc_blend_multi_split8_c(), but are organized differently:
+  - The low-pass band of each predictor is computed a whole row at a time,
+     with 16-bit lanes.
+  - The blended low-pass band minus that of the predictor each quadrant
+     takes its high frequencies from is then formed for each quadrant, as
+     32-bit values.
+    The C versions extrapolate the last row and column of both bands
+     separately; since the extrapolation is linear, we extrapolate their
+     difference once instead.
+  - Each quadrant is then the predictor plus this difference, upsampled
+     bilinearly with the same rounding.*/
+
+/*The largest number of low-pass samples in a row or column, plus one for the
+   extrapolated one.*/
+# define OD_BLEND_LL_SZ (9)
+
+/*Loads 1<<_log_n (4 to 16) bytes into the low bytes of a register.*/
+static __m128i od_blend_load_sse2(const unsigned char *_p,int _log_n){
+  int v;
+  switch(_log_n){
+    case 2:{
+      memcpy(&v,_p,sizeof(v));
+      return _mm_cvtsi32_si128(v);
+    }
+    case 3:return _mm_loadl_epi64((const __m128i *)_p);
+    default:return _mm_loadu_si128((const __m128i *)_p);
+  }
+}
+
+/*Stores the low 1<<_log_n (4 or 8) bytes of a register.*/
+static void od_blend_store_sse2(unsigned char *_p,__m128i _v,int _log_n){
+  int v;
+  switch(_log_n){
+    case 2:{
+      v=_mm_cvtsi128_si32(_v);
+      memcpy(_p,&v,sizeof(v));
+    }break;
+    default:_mm_storel_epi64((__m128i *)_p,_v);
+  }
+}
+
+/*Filters a row of 1<<_log_xblk_sz pixels with [1 2 1] centered on the even
+   ones, using 4 times the first pixel in place of the first sum, as 16-bit
+   values.
+  If _q is not NULL, the same row of it is filtered and added in.*/
+static __m128i od_blend_hfilter_sse2(const unsigned char *_p,
+ const unsigned char *_q,int _log_xblk_sz){
+  __m128i v;
+  __m128i e;
+  __m128i o;
+  __m128i p;
+  v=od_blend_load_sse2(_p,_log_xblk_sz);
+  e=_mm_and_si128(v,_mm_set1_epi16(0xFF));
+  o=_mm_srli_epi16(v,8);
+  if(_q!=NULL){
+    v=od_blend_load_sse2(_q,_log_xblk_sz);
+    e=_mm_add_epi16(e,_mm_and_si128(v,_mm_set1_epi16(0xFF)));
+    o=_mm_add_epi16(o,_mm_srli_epi16(v,8));
+  }
+  e=_mm_add_epi16(e,e);
+  /*The odd pixel before each even one, with 2*p[0]-p[1] before the first.*/
+  p=_mm_and_si128(_mm_sub_epi16(e,o),_mm_cvtsi32_si128(0xFFFF));
+  p=_mm_or_si128(_mm_slli_si128(o,2),p);
+  return _mm_add_epi16(_mm_add_epi16(e,o),p);
+}
+
+/*Computes the low-pass band of a predictor, or of the average of two
+   predictors if _q is not NULL, one row of up to 8 16-bit values at a
+   time.*/
+static void od_blend_lowpass_sse2(__m128i _ll[8],const unsigned char *_p,
+ const unsigned char *_q,int _log_xblk_sz,int _log_yblk_sz){
+  __m128i rnd;
+  __m128i shift;
+  __m128i prev;
+  __m128i cur;
+  __m128i next;
+  int     xblk_sz;
+  int     yblk_sz_2;
+  int     sh;
+  int     j;
+  xblk_sz=1<<_log_xblk_sz;
+  yblk_sz_2=1<<_log_yblk_sz-1;
+  sh=4+(_q!=NULL);
+  rnd=_mm_set1_epi16(1<<sh-1);
+  shift=_mm_cvtsi32_si128(sh);
+  cur=od_blend_hfilter_sse2(_p,_q,_log_xblk_sz);
+  _ll[0]=_mm_sra_epi16(_mm_add_epi16(_mm_slli_epi16(cur,2),rnd),shift);
+  prev=od_blend_hfilter_sse2(_p+xblk_sz,_q!=NULL?_q+xblk_sz:NULL,
+   _log_xblk_sz);
+  for(j=1;j<yblk_sz_2;j++){
+    _p+=xblk_sz<<1;
+    if(_q!=NULL)_q+=xblk_sz<<1;
+    cur=od_blend_hfilter_sse2(_p,_q,_log_xblk_sz);
+    next=od_blend_hfilter_sse2(_p+xblk_sz,_q!=NULL?_q+xblk_sz:NULL,
+     _log_xblk_sz);
+    cur=_mm_add_epi16(_mm_add_epi16(prev,next),_mm_add_epi16(cur,cur));
+    _ll[j]=_mm_sra_epi16(_mm_add_epi16(cur,rnd),shift);
+    prev=next;
+  }
+}
+
+/*Stores 8 16-bit values as 32-bit ones.*/
+static void od_blend_store_epi32_sse2(ogg_int32_t *_p,__m128i _v){
+  _mm_storeu_si128((__m128i *)_p,
+   _mm_srai_epi32(_mm_unpacklo_epi16(_v,_v),16));
+  _mm_storeu_si128((__m128i *)(_p+4),
+   _mm_srai_epi32(_mm_unpackhi_epi16(_v,_v),16));
+}
+
+/*Blends the low-pass bands of the 4 predictors, and for each quadrant,
+   subtracts the band of the predictor it keeps the high frequencies of,
+   scaled to match.
+  The result for quadrant k is stored in _e[k], with an extra row or column
+   extrapolated past the bottom and right edges of the block where needed.*/
+static void od_blend_ll_diff_sse2(
+ ogg_int32_t _e[4][OD_BLEND_LL_SZ][OD_BLEND_LL_SZ],__m128i _ll[4][8],
+ int _log_xblk_sz,int _log_yblk_sz){
+  __m128i idx;
+  __m128i xshift;
+  __m128i yshift;
+  __m128i eshift;
+  __m128i a;
+  __m128i b;
+  __m128i d;
+  int     xblk_sz_2;
+  int     yblk_sz_2;
+  int     i;
+  int     j;
+  int     k;
+  xblk_sz_2=1<<_log_xblk_sz-1;
+  yblk_sz_2=1<<_log_yblk_sz-1;
+  idx=_mm_setr_epi16(0,1,2,3,4,5,6,7);
+  xshift=_mm_cvtsi32_si128(_log_xblk_sz-1);
+  yshift=_mm_cvtsi32_si128(_log_yblk_sz-1);
+  eshift=_mm_cvtsi32_si128(_log_xblk_sz+_log_yblk_sz-2);
+  for(j=0;j<yblk_sz_2;j++){
+    a=_mm_add_epi16(_mm_sll_epi16(_ll[0][j],xshift),
+     _mm_mullo_epi16(_mm_sub_epi16(_ll[1][j],_ll[0][j]),idx));
+    b=_mm_add_epi16(_mm_sll_epi16(_ll[3][j],xshift),
+     _mm_mullo_epi16(_mm_sub_epi16(_ll[2][j],_ll[3][j]),idx));
+    d=_mm_add_epi16(_mm_sll_epi16(a,yshift),
+     _mm_mullo_epi16(_mm_sub_epi16(b,a),_mm_set1_epi16((short)j)));
+    for(k=0;k<4;k++){
+      od_blend_store_epi32_sse2(_e[k][j],
+       _mm_sub_epi16(d,_mm_sll_epi16(_ll[k][j],eshift)));
+    }
+  }
+  /*The right quadrants need a column past the edge.
+    The lower-left one gets it too, since the row below reads its corner.*/
+  for(k=1;k<4;k++){
+    for(j=0;j<yblk_sz_2;j++){
+      _e[k][j][xblk_sz_2]=2*_e[k][j][xblk_sz_2-1]-_e[k][j][xblk_sz_2-2];
+    }
+  }
+  /*The bottom quadrants need a row past the edge.*/
+  for(k=2;k<4;k++){
+    for(i=0;i<=xblk_sz_2;i++){
+      _e[k][yblk_sz_2][i]=2*_e[k][yblk_sz_2-1][i]-_e[k][yblk_sz_2-2][i];
+    }
+  }
+}
+
+/*Adds the upsampled difference from od_blend_ll_diff_sse2() to one quadrant
+   of a predictor, or to the average of two predictors if _drc is not NULL.
+  _e points to the difference for the top-left corner of the quadrant.*/
+static void od_blend_quadrant_sse2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src,const unsigned char *_drc,
+ const ogg_int32_t (*_e)[OD_BLEND_LL_SZ],int _log_xblk_sz,int _log_yblk_sz){
+  __m128i rnd;
+  __m128i shift;
+  __m128i zero;
+  int     xblk_sz;
+  int     yblk_sz_4;
+  int     j;
+  xblk_sz=1<<_log_xblk_sz;
+  yblk_sz_4=1<<_log_yblk_sz-2;
+  rnd=_mm_set1_epi32(1<<_log_xblk_sz+_log_yblk_sz-1);
+  shift=_mm_cvtsi32_si128(_log_xblk_sz+_log_yblk_sz-(_drc!=NULL));
+  zero=_mm_setzero_si128();
+  for(j=0;j<yblk_sz_4;j++){
+    __m128i a;
+    __m128i b;
+    __m128i c;
+    __m128i d;
+    __m128i even;
+    __m128i odd;
+    __m128i s;
+    int     r;
+    a=_mm_loadu_si128((const __m128i *)_e[j]);
+    b=_mm_loadu_si128((const __m128i *)(_e[j]+1));
+    c=_mm_loadu_si128((const __m128i *)_e[j+1]);
+    d=_mm_loadu_si128((const __m128i *)(_e[j+1]+1));
+    for(r=0;r<2;r++){
+      if(r==0){
+        even=_mm_slli_epi32(a,2);
+        odd=_mm_slli_epi32(_mm_add_epi32(a,b),1);
+      }
+      else{
+        even=_mm_slli_epi32(_mm_add_epi32(a,c),1);
+        odd=_mm_add_epi32(_mm_add_epi32(a,b),_mm_add_epi32(c,d));
+      }
+      even=_mm_sra_epi32(_mm_add_epi32(even,rnd),shift);
+      odd=_mm_sra_epi32(_mm_add_epi32(odd,rnd),shift);
+      even=_mm_packs_epi32(even,even);
+      odd=_mm_packs_epi32(odd,odd);
+      s=_mm_unpacklo_epi8(od_blend_load_sse2(_src,_log_xblk_sz-1),zero);
+      if(_drc!=NULL){
+        s=_mm_add_epi16(s,
+         _mm_unpacklo_epi8(od_blend_load_sse2(_drc,_log_xblk_sz-1),zero));
+        _drc+=xblk_sz;
+      }
+      s=_mm_adds_epi16(s,_mm_unpacklo_epi16(even,odd));
+      if(_drc!=NULL)s=_mm_srai_epi16(s,1);
+      od_blend_store_sse2(_dst,_mm_packus_epi16(s,s),_log_xblk_sz-1);
+      _src+=xblk_sz;
+      _dst+=_dystride;
+    }
+  }
+}
+
+/*Performs multiresolution blending of the 4 predictors, each averaged with
+   the one in _drc if it is not NULL.*/
+static void od_mc_blend_multi8_sse2_impl(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],const unsigned char *_drc[4],
+ int _log_xblk_sz,int _log_yblk_sz){
+  __m128i     ll[4][8];
+  ogg_int32_t e[4][OD_BLEND_LL_SZ][OD_BLEND_LL_SZ];
+  ptrdiff_t   xoff;
+  ptrdiff_t   yoff;
+  int         xblk_sz_4;
+  int         yblk_sz_4;
+  int         k;
+  for(k=0;k<4;k++){
+    od_blend_lowpass_sse2(ll[k],_src[k],_drc!=NULL?_drc[k]:NULL,
+     _log_xblk_sz,_log_yblk_sz);
+  }
+  od_blend_ll_diff_sse2(e,ll,_log_xblk_sz,_log_yblk_sz);
+  xblk_sz_4=1<<_log_xblk_sz-2;
+  yblk_sz_4=1<<_log_yblk_sz-2;
+  /*The offsets of the right and bottom quadrants in each predictor.*/
+  xoff=xblk_sz_4<<1;
+  yoff=(ptrdiff_t)(yblk_sz_4<<1)<<_log_xblk_sz;
+  od_blend_quadrant_sse2(_dst,_dystride,_src[0],
+   _drc!=NULL?_drc[0]:NULL,(const ogg_int32_t (*)[OD_BLEND_LL_SZ])e[0],
+   _log_xblk_sz,_log_yblk_sz);
+  od_blend_quadrant_sse2(_dst+xoff,_dystride,_src[1]+xoff,
+   _drc!=NULL?_drc[1]+xoff:NULL,
+   (const ogg_int32_t (*)[OD_BLEND_LL_SZ])(e[1][0]+xblk_sz_4),
+   _log_xblk_sz,_log_yblk_sz);
+  _dst+=(yblk_sz_4<<1)*_dystride;
+  od_blend_quadrant_sse2(_dst,_dystride,_src[3]+yoff,
+   _drc!=NULL?_drc[3]+yoff:NULL,
+   (const ogg_int32_t (*)[OD_BLEND_LL_SZ])e[3][yblk_sz_4],
+   _log_xblk_sz,_log_yblk_sz);
+  od_blend_quadrant_sse2(_dst+xoff,_dystride,_src[2]+yoff+xoff,
+   _drc!=NULL?_drc[2]+yoff+xoff:NULL,
+   (const ogg_int32_t (*)[OD_BLEND_LL_SZ])(e[2][yblk_sz_4]+xblk_sz_4),
+   _log_xblk_sz,_log_yblk_sz);
+}
+
+#if defined(OD_CHECKASM)
+static void od_mc_blend_multi8_check(const unsigned char *_dst,int _dystride,
+ const unsigned char *_ref,int _log_xblk_sz,int _log_yblk_sz){
+  int xblk_sz;
+  int yblk_sz;
+  int failed;
+  int i;
+  int j;
+  xblk_sz=1<<_log_xblk_sz;
+  yblk_sz=1<<_log_yblk_sz;
+  failed=0;
+  for(j=0;j<yblk_sz;j++){
+    for(i=0;i<xblk_sz;i++){
+      if(_ref[i+(j<<_log_xblk_sz)]!=(_dst+j*_dystride)[i]){
+        fprintf(stderr,"ASM mismatch: 0x%02X!=0x%02X @ (%2i,%2i)\n",
+         _ref[i+(j<<_log_xblk_sz)],(_dst+j*_dystride)[i],i,j);
+        failed=1;
+      }
+    }
+  }
+  if(failed){
+    fprintf(stderr,"od_mc_blend_multi8 %ix%i check failed.\n",
+     xblk_sz,yblk_sz);
+  }
+}
+#endif
+
+/*Perform multiresolution bilinear blending.*/
+void od_mc_blend_multi8_sse2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz){
+  /*Quadrants only 2 pixels wide are not worth vectorizing.*/
+  if(_log_xblk_sz<3){
+    od_mc_blend_multi8_c(_dst,_dystride,_src,_log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  od_mc_blend_multi8_sse2_impl(_dst,_dystride,_src,NULL,
+   _log_xblk_sz,_log_yblk_sz);
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    od_mc_blend_multi8_c(ref,1<<_log_xblk_sz,_src,_log_xblk_sz,_log_yblk_sz);
+    od_mc_blend_multi8_check(_dst,_dystride,ref,_log_xblk_sz,_log_yblk_sz);
+  }
+#endif
+}
+
+/*Perform multiresolution blending with bilinear weights modified for unsplit
+   edges.*/
+void od_mc_blend_multi_split8_sse2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _c,int _s,
+ int _log_xblk_sz,int _log_yblk_sz){
+  const unsigned char *drc[4];
+  if(_log_xblk_sz<3){
+    od_mc_blend_multi_split8_c(_dst,_dystride,_src,_c,_s,
+     _log_xblk_sz,_log_yblk_sz);
+    return;
+  }
+  od_mc_setup_split_ptrs(drc,_src,_c,_s);
+  od_mc_blend_multi8_sse2_impl(_dst,_dystride,_src,drc,
+   _log_xblk_sz,_log_yblk_sz);
+#if defined(OD_CHECKASM)
+  {
+    unsigned char ref[16*16];
+    od_mc_blend_multi_split8_c(ref,1<<_log_xblk_sz,_src,_c,_s,
+     _log_xblk_sz,_log_yblk_sz);
+    od_mc_blend_multi8_check(_dst,_dystride,ref,_log_xblk_sz,_log_yblk_sz);
+  }
+#endif
+}
+
+#endif
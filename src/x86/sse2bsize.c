@@ -0,0 +1,106 @@
+/*Daala video codec
+Copyright (c) 2006-2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <emmintrin.h>
+# include "../block_size.h"
+
+/*SSE2 version of the 4x4 block statistics used by the block-size decision.
+  Eight blocks, starting on every other pixel, are done at once from two
+   overlapping loads per row: the pixels from each load are added up two at a
+   time, which gives the left and the right half of each block.
+  Any left over blocks are done by the C version.*/
+void od_block_var4_row8_sse2(ogg_int32_t *_var,ogg_int32_t *_inv_var,
+ ogg_int32_t *_sx,ogg_int32_t *_sxx,const unsigned char *_img,int _stride,
+ int _n){
+  __m128i zero;
+  __m128i ones;
+  __m128i four;
+  __m128 scale;
+  int     j;
+  zero=_mm_setzero_si128();
+  ones=_mm_set1_epi16(1);
+  four=_mm_set1_epi32(4);
+  scale=_mm_set1_ps(16384);
+  for(j=0;j+8<=_n;j+=8){
+    __m128i sl;
+    __m128i sh;
+    __m128i sxx[2];
+    __m128i sx[2];
+    int     k;
+    sl=sh=zero;
+    sxx[0]=sxx[1]=zero;
+    for(k=0;k<4;k++){
+      const unsigned char *row;
+      __m128i a;
+      __m128i b;
+      __m128i al;
+      __m128i ah;
+      __m128i bl;
+      __m128i bh;
+      row=_img+k*_stride+2*j;
+      a=_mm_loadu_si128((const __m128i *)row);
+      b=_mm_loadu_si128((const __m128i *)(row+2));
+      al=_mm_unpacklo_epi8(a,zero);
+      ah=_mm_unpackhi_epi8(a,zero);
+      bl=_mm_unpacklo_epi8(b,zero);
+      bh=_mm_unpackhi_epi8(b,zero);
+      /*Each 16-bit sum is at most 8*255.*/
+      sl=_mm_add_epi16(sl,_mm_add_epi16(al,bl));
+      sh=_mm_add_epi16(sh,_mm_add_epi16(ah,bh));
+      sxx[0]=_mm_add_epi32(sxx[0],
+       _mm_add_epi32(_mm_madd_epi16(al,al),_mm_madd_epi16(bl,bl)));
+      sxx[1]=_mm_add_epi32(sxx[1],
+       _mm_add_epi32(_mm_madd_epi16(ah,ah),_mm_madd_epi16(bh,bh)));
+    }
+    sx[0]=_mm_madd_epi16(sl,ones);
+    sx[1]=_mm_madd_epi16(sh,ones);
+    for(k=0;k<2;k++){
+      __m128i v;
+      __m128i v_floor;
+      __m128i m;
+      /*The sums fit in 16 bits, so they can be squared with pmaddwd.*/
+      v=_mm_srai_epi32(_mm_sub_epi32(sxx[k],
+       _mm_srai_epi32(_mm_madd_epi16(sx[k],sx[k]),4)),5);
+      v_floor=_mm_add_epi32(four,_mm_srai_epi32(sx[k],8));
+      m=_mm_cmpgt_epi32(v_floor,v);
+      v=_mm_or_si128(_mm_and_si128(m,v_floor),_mm_andnot_si128(m,v));
+      _mm_storeu_si128((__m128i *)(_sx+j+4*k),sx[k]);
+      _mm_storeu_si128((__m128i *)(_sxx+j+4*k),sxx[k]);
+      _mm_storeu_si128((__m128i *)(_var+j+4*k),v);
+      /*v is less than 2**24, so the float quotient is close enough to the
+         exact one that truncating it always gives the integer quotient.*/
+      _mm_storeu_si128((__m128i *)(_inv_var+j+4*k),
+       _mm_cvttps_epi32(_mm_div_ps(scale,_mm_cvtepi32_ps(v))));
+    }
+  }
+  if(j<_n){
+    od_block_var4_row8_c(_var+j,_inv_var+j,_sx+j,_sxx+j,_img+2*j,_stride,
+     _n-j);
+  }
+}
+
+#endif
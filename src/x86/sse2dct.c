@@ -0,0 +1,630 @@
+/*Daala video codec
+Copyright (c) 2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+#include "cpu.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include "sse2int.h"
+
+/*SSE2 versions of the 2-D integer transforms in newdct.c.
+  Each 1-D transform below is a line-for-line copy of the C version, with every
+   int replaced by a vector of four 32-bit values, so that four rows or columns
+   are transformed at once with exactly the same rounding.
+  Unlike the rest of the x86 code, these use compiler intrinsics instead of
+   inline assembly: the lifting steps need far more registers than we could
+   name by hand on x86-32, and the compiler does a better job of scheduling
+   them.*/
+
+/*Computes _a*_b+(1<<_q>>1)>>_q in each lane, i.e., the "multiply" in each
+   lifting step.*/
+static __m128i od_dct_mul_sse2(__m128i _a,int _b,int _q){
+  return _mm_srai_epi32(_mm_add_epi32(od_mullo_epi32_sse2(_a,_b),
+   _mm_set1_epi32(1<<_q>>1)),_q);
+}
+
+/*Computes OD_DCT_RSHIFT(_a,1) in each lane, rounding towards zero.*/
+static __m128i od_dct_rshift1_sse2(__m128i _a){
+  return _mm_srai_epi32(_mm_add_epi32(_a,_mm_srli_epi32(_a,31)),1);
+}
+
+static void od_fdct4_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t2;
+  __m128i t2h;
+  __m128i t3;
+  t0=_x[0];
+  t2=_x[1];
+  t1=_x[2];
+  t3=_x[3];
+  t3=_mm_sub_epi32(t0,t3);
+  t2=_mm_add_epi32(t2,t1);
+  t2h=od_dct_rshift1_sse2(t2);
+  t1=_mm_sub_epi32(t2h,t1);
+  t0=_mm_sub_epi32(t0,od_dct_rshift1_sse2(t3));
+  t0=_mm_add_epi32(t0,t2h);
+  t2=_mm_sub_epi32(t0,t2);
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t1,23013,15));
+  t1=_mm_add_epi32(t1,od_dct_mul_sse2(t3,21407,15));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t1,18293,14));
+  _x[0]=t0;
+  _x[1]=t1;
+  _x[2]=t2;
+  _x[3]=t3;
+}
+
+static void od_idct4_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t2;
+  __m128i t2h;
+  __m128i t3;
+  t0=_x[0];
+  t1=_x[1];
+  t2=_x[2];
+  t3=_x[3];
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t1,18293,14));
+  t1=_mm_sub_epi32(t1,od_dct_mul_sse2(t3,21407,15));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t1,23013,15));
+  t2=_mm_sub_epi32(t0,t2);
+  t2h=od_dct_rshift1_sse2(t2);
+  t0=_mm_sub_epi32(t0,_mm_sub_epi32(t2h,od_dct_rshift1_sse2(t3)));
+  t1=_mm_sub_epi32(t2h,t1);
+  _x[0]=t0;
+  _x[1]=_mm_sub_epi32(t2,t1);
+  _x[2]=t1;
+  _x[3]=_mm_sub_epi32(t0,t3);
+}
+
+static void od_fdct8_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t1h;
+  __m128i t2;
+  __m128i t3;
+  __m128i t4;
+  __m128i t4h;
+  __m128i t5;
+  __m128i t6;
+  __m128i t6h;
+  __m128i t7;
+  t0=_x[0];
+  t4=_x[1];
+  t2=_x[2];
+  t6=_x[3];
+  t7=_x[4];
+  t3=_x[5];
+  t5=_x[6];
+  t1=_x[7];
+  t1=_mm_sub_epi32(t0,t1);
+  t1h=od_dct_rshift1_sse2(t1);
+  t0=_mm_sub_epi32(t0,t1h);
+  t4=_mm_add_epi32(t4,t5);
+  t4h=od_dct_rshift1_sse2(t4);
+  t5=_mm_sub_epi32(t5,t4h);
+  t3=_mm_sub_epi32(t2,t3);
+  t2=_mm_sub_epi32(t2,od_dct_rshift1_sse2(t3));
+  t6=_mm_add_epi32(t6,t7);
+  t6h=od_dct_rshift1_sse2(t6);
+  t7=_mm_sub_epi32(t6h,t7);
+  t0=_mm_add_epi32(t0,t6h);
+  t6=_mm_sub_epi32(t0,t6);
+  t2=_mm_sub_epi32(t4h,t2);
+  t4=_mm_sub_epi32(t2,t4);
+  t0=_mm_sub_epi32(t0,od_dct_mul_sse2(t4,13573,15));
+  t4=_mm_add_epi32(t4,od_dct_mul_sse2(t0,11585,14));
+  t0=_mm_sub_epi32(t0,od_dct_mul_sse2(t4,13573,15));
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(t2,21895,15));
+  t2=_mm_add_epi32(t2,od_dct_mul_sse2(t6,15137,14));
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(t2,21895,15));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t5,19195,15));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(t3,11585,14));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t5,29957,15));
+  t7=_mm_sub_epi32(od_dct_rshift1_sse2(t5),t7);
+  t5=_mm_sub_epi32(t5,t7);
+  t3=_mm_sub_epi32(t1h,t3);
+  t1=_mm_sub_epi32(t1,t3);
+  t7=_mm_add_epi32(t7,od_dct_mul_sse2(t1,3227,15));
+  t1=_mm_sub_epi32(t1,od_dct_mul_sse2(t7,6393,15));
+  t7=_mm_add_epi32(t7,od_dct_mul_sse2(t1,3227,15));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(t3,2485,13));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t5,18205,15));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(t3,2485,13));
+  _x[0]=t0;
+  _x[1]=t1;
+  _x[2]=t2;
+  _x[3]=t3;
+  _x[4]=t4;
+  _x[5]=t5;
+  _x[6]=t6;
+  _x[7]=t7;
+}
+
+static void od_idct8_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t1h;
+  __m128i t2;
+  __m128i t3;
+  __m128i t4;
+  __m128i t4h;
+  __m128i t5;
+  __m128i t6;
+  __m128i t6h;
+  __m128i t7;
+  t0=_x[0];
+  t1=_x[1];
+  t2=_x[2];
+  t3=_x[3];
+  t4=_x[4];
+  t5=_x[5];
+  t6=_x[6];
+  t7=_x[7];
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(t3,2485,13));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t5,18205,15));
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(t3,2485,13));
+  t7=_mm_sub_epi32(t7,od_dct_mul_sse2(t1,3227,15));
+  t1=_mm_add_epi32(t1,od_dct_mul_sse2(t7,6393,15));
+  t7=_mm_sub_epi32(t7,od_dct_mul_sse2(t1,3227,15));
+  t1=_mm_add_epi32(t1,t3);
+  t1h=od_dct_rshift1_sse2(t1);
+  t3=_mm_sub_epi32(t1h,t3);
+  t5=_mm_add_epi32(t5,t7);
+  t7=_mm_sub_epi32(od_dct_rshift1_sse2(t5),t7);
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t5,29957,15));
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(t3,11585,14));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t5,19195,15));
+  t6=_mm_add_epi32(t6,od_dct_mul_sse2(t2,21895,15));
+  t2=_mm_sub_epi32(t2,od_dct_mul_sse2(t6,15137,14));
+  t6=_mm_add_epi32(t6,od_dct_mul_sse2(t2,21895,15));
+  t0=_mm_add_epi32(t0,od_dct_mul_sse2(t4,13573,15));
+  t4=_mm_sub_epi32(t4,od_dct_mul_sse2(t0,11585,14));
+  t0=_mm_add_epi32(t0,od_dct_mul_sse2(t4,13573,15));
+  t4=_mm_sub_epi32(t2,t4);
+  t4h=od_dct_rshift1_sse2(t4);
+  t2=_mm_sub_epi32(t4h,t2);
+  t6=_mm_sub_epi32(t0,t6);
+  t6h=od_dct_rshift1_sse2(t6);
+  t0=_mm_sub_epi32(t0,t6h);
+  t7=_mm_sub_epi32(t6h,t7);
+  t6=_mm_sub_epi32(t6,t7);
+  t2=_mm_add_epi32(t2,od_dct_rshift1_sse2(t3));
+  t3=_mm_sub_epi32(t2,t3);
+  t5=_mm_add_epi32(t5,t4h);
+  t4=_mm_sub_epi32(t4,t5);
+  t0=_mm_add_epi32(t0,t1h);
+  t1=_mm_sub_epi32(t0,t1);
+  _x[0]=t0;
+  _x[1]=t4;
+  _x[2]=t2;
+  _x[3]=t6;
+  _x[4]=t7;
+  _x[5]=t3;
+  _x[6]=t5;
+  _x[7]=t1;
+}
+
+static void od_fdct16_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t1h;
+  __m128i t2;
+  __m128i t2h;
+  __m128i t3;
+  __m128i t4;
+  __m128i t5;
+  __m128i t6;
+  __m128i t7;
+  __m128i t8;
+  __m128i t8h;
+  __m128i t9;
+  __m128i ta;
+  __m128i tah;
+  __m128i tb;
+  __m128i tbh;
+  __m128i tc;
+  __m128i tch;
+  __m128i td;
+  __m128i tdh;
+  __m128i te;
+  __m128i tf;
+  __m128i tfh;
+  t0=_x[0];
+  t8=_x[1];
+  t4=_x[2];
+  tc=_x[3];
+  te=_x[4];
+  ta=_x[5];
+  t6=_x[6];
+  t2=_x[7];
+  t3=_x[8];
+  td=_x[9];
+  t9=_x[10];
+  tf=_x[11];
+  t1=_x[12];
+  t7=_x[13];
+  tb=_x[14];
+  t5=_x[15];
+  t5=_mm_sub_epi32(t0,t5);
+  t8=_mm_add_epi32(t8,tb);
+  t7=_mm_sub_epi32(t4,t7);
+  tc=_mm_add_epi32(tc,t1);
+  tf=_mm_sub_epi32(te,tf);
+  ta=_mm_add_epi32(ta,t9);
+  td=_mm_sub_epi32(t6,td);
+  t2=_mm_add_epi32(t2,t3);
+  t0=_mm_sub_epi32(t0,od_dct_rshift1_sse2(t5));
+  t8h=od_dct_rshift1_sse2(t8);
+  tb=_mm_sub_epi32(t8h,tb);
+  t4=_mm_sub_epi32(t4,od_dct_rshift1_sse2(t7));
+  tch=od_dct_rshift1_sse2(tc);
+  t1=_mm_sub_epi32(tch,t1);
+  te=_mm_sub_epi32(te,od_dct_rshift1_sse2(tf));
+  tah=od_dct_rshift1_sse2(ta);
+  t9=_mm_sub_epi32(tah,t9);
+  t6=_mm_sub_epi32(t6,od_dct_rshift1_sse2(td));
+  t2h=od_dct_rshift1_sse2(t2);
+  t3=_mm_sub_epi32(t2h,t3);
+  t0=_mm_add_epi32(t0,t2h);
+  t6=_mm_sub_epi32(t8h,t6);
+  t4=_mm_add_epi32(t4,tah);
+  te=_mm_sub_epi32(tch,te);
+  t2=_mm_sub_epi32(t0,t2);
+  t8=_mm_sub_epi32(t8,t6);
+  ta=_mm_sub_epi32(t4,ta);
+  tc=_mm_sub_epi32(tc,te);
+  tc=_mm_sub_epi32(t0,tc);
+  t8=_mm_add_epi32(t8,t4);
+  t8h=od_dct_rshift1_sse2(t8);
+  t4=_mm_sub_epi32(t8h,t4);
+  t0=_mm_sub_epi32(t0,od_dct_rshift1_sse2(tc));
+  t0=_mm_add_epi32(t0,t8h);
+  t8=_mm_sub_epi32(t0,t8);
+  tc=_mm_sub_epi32(tc,od_dct_mul_sse2(t4,23013,15));
+  t4=_mm_add_epi32(t4,od_dct_mul_sse2(tc,21407,15));
+  tc=_mm_sub_epi32(tc,od_dct_mul_sse2(t4,18293,14));
+  t6=_mm_add_epi32(t6,od_dct_mul_sse2(ta,13573,15));
+  ta=_mm_sub_epi32(ta,od_dct_mul_sse2(t6,11585,14));
+  t6=_mm_add_epi32(t6,od_dct_mul_sse2(ta,13573,15));
+  ta=_mm_add_epi32(ta,te);
+  t2=_mm_add_epi32(t2,t6);
+  te=_mm_sub_epi32(od_dct_rshift1_sse2(ta),te);
+  t6=_mm_sub_epi32(od_dct_rshift1_sse2(t2),t6);
+  te=_mm_add_epi32(te,od_dct_mul_sse2(t2,2275,11));
+  t2=_mm_sub_epi32(t2,od_dct_mul_sse2(te,9041,15));
+  te=_mm_sub_epi32(te,od_dct_mul_sse2(t2,2873,11));
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(ta,17185,15));
+  ta=_mm_add_epi32(ta,od_dct_mul_sse2(t6,12873,14));
+  t6=_mm_add_epi32(t6,od_dct_mul_sse2(ta,7335,15));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t5,1035,11));
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(t3,14699,14));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t5,851,13));
+  tb=_mm_add_epi32(tb,od_dct_mul_sse2(td,17515,15));
+  td=_mm_sub_epi32(td,od_dct_mul_sse2(tb,40869,15));
+  tb=_mm_add_epi32(tb,od_dct_mul_sse2(td,4379,14));
+  t9=_mm_add_epi32(t9,od_dct_mul_sse2(t7,25809,15));
+  t7=_mm_sub_epi32(t7,od_dct_mul_sse2(t9,3363,13));
+  t9=_mm_sub_epi32(t9,od_dct_mul_sse2(t7,14101,14));
+  t1=_mm_add_epi32(t1,od_dct_mul_sse2(tf,21669,15));
+  tf=_mm_sub_epi32(tf,od_dct_mul_sse2(t1,23059,14));
+  t1=_mm_add_epi32(t1,od_dct_mul_sse2(tf,20055,15));
+  tf=_mm_sub_epi32(t3,tf);
+  td=_mm_add_epi32(td,t9);
+  tfh=od_dct_rshift1_sse2(tf);
+  t3=_mm_sub_epi32(t3,tfh);
+  tdh=od_dct_rshift1_sse2(td);
+  t9=_mm_sub_epi32(tdh,t9);
+  t1=_mm_add_epi32(t1,t5);
+  tb=_mm_sub_epi32(t7,tb);
+  t1h=od_dct_rshift1_sse2(t1);
+  t5=_mm_sub_epi32(t1h,t5);
+  tbh=od_dct_rshift1_sse2(tb);
+  t7=_mm_sub_epi32(t7,tbh);
+  t3=_mm_add_epi32(t3,tbh);
+  t5=_mm_sub_epi32(tdh,t5);
+  t9=_mm_add_epi32(t9,tfh);
+  t7=_mm_sub_epi32(t1h,t7);
+  tb=_mm_sub_epi32(tb,t3);
+  td=_mm_sub_epi32(td,t5);
+  tf=_mm_sub_epi32(t9,tf);
+  t1=_mm_sub_epi32(t1,t7);
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(tb,21895,15));
+  tb=_mm_add_epi32(tb,od_dct_mul_sse2(t5,15137,14));
+  t5=_mm_sub_epi32(t5,od_dct_mul_sse2(tb,21895,15));
+  td=_mm_add_epi32(td,od_dct_mul_sse2(t3,21895,15));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(td,15137,14));
+  td=_mm_add_epi32(td,od_dct_mul_sse2(t3,21895,15));
+  t1=_mm_sub_epi32(t1,od_dct_mul_sse2(tf,13573,15));
+  tf=_mm_add_epi32(tf,od_dct_mul_sse2(t1,11585,14));
+  t1=_mm_sub_epi32(t1,od_dct_mul_sse2(tf,13573,15));
+  _x[0]=t0;
+  _x[1]=t1;
+  _x[2]=t2;
+  _x[3]=t3;
+  _x[4]=t4;
+  _x[5]=t5;
+  _x[6]=t6;
+  _x[7]=t7;
+  _x[8]=t8;
+  _x[9]=t9;
+  _x[10]=ta;
+  _x[11]=tb;
+  _x[12]=tc;
+  _x[13]=td;
+  _x[14]=te;
+  _x[15]=tf;
+}
+
+static void od_idct16_kernel_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t1h;
+  __m128i t2;
+  __m128i t2h;
+  __m128i t3;
+  __m128i t4;
+  __m128i t5;
+  __m128i t6;
+  __m128i t7;
+  __m128i t8;
+  __m128i t8h;
+  __m128i t9;
+  __m128i ta;
+  __m128i tah;
+  __m128i tb;
+  __m128i tbh;
+  __m128i tc;
+  __m128i tch;
+  __m128i td;
+  __m128i tdh;
+  __m128i te;
+  __m128i tf;
+  __m128i tfh;
+  t0=_x[0];
+  t1=_x[1];
+  t2=_x[2];
+  t3=_x[3];
+  t4=_x[4];
+  t5=_x[5];
+  t6=_x[6];
+  t7=_x[7];
+  t8=_x[8];
+  t9=_x[9];
+  ta=_x[10];
+  tb=_x[11];
+  tc=_x[12];
+  td=_x[13];
+  te=_x[14];
+  tf=_x[15];
+  t1=_mm_add_epi32(t1,od_dct_mul_sse2(tf,13573,15));
+  tf=_mm_sub_epi32(tf,od_dct_mul_sse2(t1,11585,14));
+  t1=_mm_add_epi32(t1,_mm_add_epi32(od_dct_mul_sse2(tf,13573,15),t7));
+  td=_mm_sub_epi32(td,od_dct_mul_sse2(t3,21895,15));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(td,15137,14));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(tb,21895,15));
+  tb=_mm_sub_epi32(tb,od_dct_mul_sse2(t5,15137,14));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(tb,21895,15));
+  td=_mm_add_epi32(td,_mm_sub_epi32(t5,od_dct_mul_sse2(t3,21895,15)));
+  tf=_mm_sub_epi32(t9,tf);
+  tb=_mm_add_epi32(tb,t3);
+  tfh=od_dct_rshift1_sse2(tf);
+  t9=_mm_sub_epi32(t9,tfh);
+  tbh=od_dct_rshift1_sse2(tb);
+  t3=_mm_add_epi32(t3,_mm_sub_epi32(tfh,tbh));
+  t1h=od_dct_rshift1_sse2(t1);
+  t7=_mm_add_epi32(_mm_sub_epi32(t1h,t7),tbh);
+  tdh=od_dct_rshift1_sse2(td);
+  t5=_mm_add_epi32(t5,_mm_sub_epi32(t1h,tdh));
+  t9=_mm_sub_epi32(tdh,t9);
+  td=_mm_sub_epi32(td,t9);
+  tf=_mm_sub_epi32(t3,tf);
+  t1=_mm_sub_epi32(t1,_mm_add_epi32(t5,od_dct_mul_sse2(tf,20055,15)));
+  tf=_mm_add_epi32(tf,od_dct_mul_sse2(t1,23059,14));
+  t1=_mm_sub_epi32(t1,od_dct_mul_sse2(tf,21669,15));
+  tb=_mm_sub_epi32(t7,tb);
+  t9=_mm_add_epi32(t9,od_dct_mul_sse2(t7,14101,14));
+  t7=_mm_add_epi32(t7,od_dct_mul_sse2(t9,3363,13));
+  t9=_mm_sub_epi32(t9,od_dct_mul_sse2(t7,25809,15));
+  tb=_mm_sub_epi32(tb,od_dct_mul_sse2(td,4379,14));
+  td=_mm_add_epi32(td,od_dct_mul_sse2(tb,40869,15));
+  tb=_mm_sub_epi32(tb,od_dct_mul_sse2(td,17515,15));
+  t3=_mm_add_epi32(t3,od_dct_mul_sse2(t5,851,13));
+  t5=_mm_add_epi32(t5,od_dct_mul_sse2(t3,14699,14));
+  t3=_mm_sub_epi32(t3,od_dct_mul_sse2(t5,1035,11));
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(ta,7335,15));
+  ta=_mm_sub_epi32(ta,od_dct_mul_sse2(t6,12873,14));
+  te=_mm_add_epi32(te,od_dct_mul_sse2(t2,2873,11));
+  t2=_mm_add_epi32(t2,od_dct_mul_sse2(te,9041,15));
+  t6=_mm_sub_epi32(_mm_sub_epi32(od_dct_rshift1_sse2(t2),t6),od_dct_mul_sse2(ta,17185,15));
+  te=_mm_add_epi32(_mm_sub_epi32(od_dct_rshift1_sse2(ta),te),od_dct_mul_sse2(t2,2275,11));
+  t2=_mm_sub_epi32(t2,t6);
+  ta=_mm_sub_epi32(ta,te);
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(ta,13573,15));
+  ta=_mm_add_epi32(ta,od_dct_mul_sse2(t6,11585,14));
+  t6=_mm_sub_epi32(t6,od_dct_mul_sse2(ta,13573,15));
+  tc=_mm_add_epi32(tc,od_dct_mul_sse2(t4,18293,14));
+  t4=_mm_sub_epi32(t4,od_dct_mul_sse2(tc,21407,15));
+  tc=_mm_add_epi32(tc,od_dct_mul_sse2(t4,23013,15));
+  t8=_mm_sub_epi32(t0,t8);
+  t8h=od_dct_rshift1_sse2(t8);
+  t0=_mm_sub_epi32(t0,_mm_sub_epi32(t8h,od_dct_rshift1_sse2(tc)));
+  t4=_mm_sub_epi32(t8h,t4);
+  t8=_mm_add_epi32(t8,_mm_sub_epi32(t6,t4));
+  tc=_mm_add_epi32(_mm_sub_epi32(t0,tc),te);
+  ta=_mm_sub_epi32(t4,ta);
+  t2=_mm_sub_epi32(t0,t2);
+  tch=od_dct_rshift1_sse2(tc);
+  te=_mm_sub_epi32(tch,te);
+  tah=od_dct_rshift1_sse2(ta);
+  t4=_mm_sub_epi32(t4,tah);
+  t8h=od_dct_rshift1_sse2(t8);
+  t6=_mm_sub_epi32(t8h,t6);
+  t2h=od_dct_rshift1_sse2(t2);
+  t0=_mm_sub_epi32(t0,t2h);
+  t3=_mm_sub_epi32(t2h,t3);
+  t6=_mm_add_epi32(t6,od_dct_rshift1_sse2(td));
+  t9=_mm_sub_epi32(tah,t9);
+  te=_mm_add_epi32(te,od_dct_rshift1_sse2(tf));
+  t1=_mm_sub_epi32(tch,t1);
+  t4=_mm_add_epi32(t4,od_dct_rshift1_sse2(t7));
+  tb=_mm_sub_epi32(t8h,tb);
+  t0=_mm_add_epi32(t0,od_dct_rshift1_sse2(t5));
+  _x[0]=t0;
+  _x[1]=_mm_sub_epi32(t8,tb);
+  _x[2]=t4;
+  _x[3]=_mm_sub_epi32(tc,t1);
+  _x[4]=te;
+  _x[5]=_mm_sub_epi32(ta,t9);
+  _x[6]=t6;
+  _x[7]=_mm_sub_epi32(t2,t3);
+  _x[8]=t3;
+  _x[9]=_mm_sub_epi32(t6,td);
+  _x[10]=t9;
+  _x[11]=_mm_sub_epi32(te,tf);
+  _x[12]=t1;
+  _x[13]=_mm_sub_epi32(t4,t7);
+  _x[14]=tb;
+  _x[15]=_mm_sub_epi32(t0,t5);
+}
+
+typedef void (*od_dct_kernel_sse2)(__m128i *_x);
+
+/*Transposes the 4x4 matrix of 32-bit values in _x[0...3] in place.*/
+static void od_transpose4_sse2(__m128i *_x){
+  __m128i t0;
+  __m128i t1;
+  __m128i t2;
+  __m128i t3;
+  t0=_mm_unpacklo_epi32(_x[0],_x[1]);
+  t1=_mm_unpacklo_epi32(_x[2],_x[3]);
+  t2=_mm_unpackhi_epi32(_x[0],_x[1]);
+  t3=_mm_unpackhi_epi32(_x[2],_x[3]);
+  _x[0]=_mm_unpacklo_epi64(t0,t1);
+  _x[1]=_mm_unpackhi_epi64(t0,t1);
+  _x[2]=_mm_unpacklo_epi64(t2,t3);
+  _x[3]=_mm_unpackhi_epi64(t2,t3);
+}
+
+/*Transposes an _n x _n block in place.
+  The block is stored as _n/4 groups of 4 columns, with row k of group g in
+   _x[g*_n+k].*/
+static void od_transpose_sse2(__m128i *_x,int _n){
+  int g;
+  int r;
+  for(g=0;g<_n>>2;g++){
+    for(r=0;r<_n>>2;r++)od_transpose4_sse2(_x+g*_n+(r<<2));
+    for(r=0;r<g;r++){
+      int     i;
+      for(i=0;i<4;i++){
+        __m128i t;
+        t=_x[g*_n+(r<<2)+i];
+        _x[g*_n+(r<<2)+i]=_x[r*_n+(g<<2)+i];
+        _x[r*_n+(g<<2)+i]=t;
+      }
+    }
+  }
+}
+
+static void od_load_block_sse2(__m128i *_x,const od_coeff *_c,int _stride,
+ int _n){
+  int g;
+  int k;
+  for(g=0;g<_n>>2;g++){
+    for(k=0;k<_n;k++){
+      _x[g*_n+k]=_mm_loadu_si128((const __m128i *)(_c+k*_stride+(g<<2)));
+    }
+  }
+}
+
+static void od_store_block_sse2(od_coeff *_c,int _stride,const __m128i *_x,
+ int _n){
+  int g;
+  int k;
+  for(g=0;g<_n>>2;g++){
+    for(k=0;k<_n;k++){
+      _mm_storeu_si128((__m128i *)(_c+k*_stride+(g<<2)),_x[g*_n+k]);
+    }
+  }
+}
+
+/*The C versions transform the columns and then the rows.
+  We transform four columns at a time, transpose, and do the same again.*/
+static void od_bin_fdct_2d_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride,int _n,od_dct_kernel_sse2 _kernel){
+  __m128i t[16*4];
+  int     g;
+  od_load_block_sse2(t,_x,_xstride,_n);
+  for(g=0;g<_n>>2;g++)(*_kernel)(t+g*_n);
+  od_transpose_sse2(t,_n);
+  for(g=0;g<_n>>2;g++)(*_kernel)(t+g*_n);
+  od_transpose_sse2(t,_n);
+  od_store_block_sse2(_y,_ystride,t,_n);
+}
+
+/*The C versions inverse transform the rows and then the columns, so we
+   transpose first.*/
+static void od_bin_idct_2d_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride,int _n,od_dct_kernel_sse2 _kernel){
+  __m128i t[16*4];
+  int     g;
+  od_load_block_sse2(t,_y,_ystride,_n);
+  od_transpose_sse2(t,_n);
+  for(g=0;g<_n>>2;g++)(*_kernel)(t+g*_n);
+  od_transpose_sse2(t,_n);
+  for(g=0;g<_n>>2;g++)(*_kernel)(t+g*_n);
+  od_store_block_sse2(_x,_xstride,t,_n);
+}
+
+void od_bin_fdct4x4_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride){
+  od_bin_fdct_2d_sse2(_y,_ystride,_x,_xstride,4,od_fdct4_kernel_sse2);
+}
+
+void od_bin_idct4x4_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride){
+  od_bin_idct_2d_sse2(_x,_xstride,_y,_ystride,4,od_idct4_kernel_sse2);
+}
+
+void od_bin_fdct8x8_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride){
+  od_bin_fdct_2d_sse2(_y,_ystride,_x,_xstride,8,od_fdct8_kernel_sse2);
+}
+
+void od_bin_idct8x8_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride){
+  od_bin_idct_2d_sse2(_x,_xstride,_y,_ystride,8,od_idct8_kernel_sse2);
+}
+
+void od_bin_fdct16x16_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride){
+  od_bin_fdct_2d_sse2(_y,_ystride,_x,_xstride,16,od_fdct16_kernel_sse2);
+}
+
+void od_bin_idct16x16_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride){
+  od_bin_idct_2d_sse2(_x,_xstride,_y,_ystride,16,od_idct16_kernel_sse2);
+}
+
+#endif
@@ -0,0 +1,185 @@
+/*Daala video codec
+Copyright (c) 2006-2010 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+#include "cpu.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include "sse2int.h"
+
+/*SSE2 versions of the lapping filters in filter.c.
+  These filter four columns across a horizontal block edge at once, with one
+   column in each 32-bit lane, and produce exactly the same output as the C
+   versions.
+  We do not use them across vertical edges: there the C versions already
+   work on contiguous samples, and with the transposes and the lack of a
+   32-bit multiply, SSE2 is no faster.
+  The kernels are written once for every size, following the type-3 lifting
+   structure described in filter.c, and take their parameters from the same
+   tables as the C versions.*/
+
+typedef void (*od_filter_kernel_sse2)(__m128i *_x,int _n,const int *_params);
+
+/*Computes _a*_b+32>>6 in each lane, i.e., one lifting step.*/
+static __m128i od_filter_mul_sse2(__m128i _a,int _b){
+  return _mm_srai_epi32(_mm_add_epi32(od_mullo_epi32_sse2(_a,_b),
+   _mm_set1_epi32(32)),6);
+}
+
+/*Computes t=_a*_s>>6; t+=-t>>(OD_COEFF_BITS-1)&1 in each lane.*/
+static __m128i od_filter_scale_sse2(__m128i _a,int _s){
+  __m128i t;
+  t=_mm_srai_epi32(od_mullo_epi32_sse2(_a,_s),6);
+  return _mm_add_epi32(t,
+   _mm_srli_epi32(_mm_sub_epi32(_mm_setzero_si128(),t),OD_COEFF_BITS-1));
+}
+
+/*Computes (_a<<6)/_s in each lane, rounding towards zero.
+  SSE2 has no integer division, so we divide in double precision.
+  The quotient of a 32-bit integer by a divisor no larger than 128 is either
+   exact or at least 1/128 away from an integer, far more than the rounding
+   error, so truncating it gives the same result as the integer division.*/
+static __m128i od_filter_unscale_sse2(__m128i _a,int _s){
+  __m128d s;
+  __m128d lo;
+  __m128d hi;
+  _a=_mm_slli_epi32(_a,6);
+  s=_mm_set1_pd(_s);
+  lo=_mm_div_pd(_mm_cvtepi32_pd(_a),s);
+  hi=_mm_div_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(_a,_MM_SHUFFLE(1,0,3,2))),
+   s);
+  return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo),_mm_cvttpd_epi32(hi));
+}
+
+/*The parameters of an _n-point filter are stored as the _n/2 scale factors
+   s, followed by the _n/2-1 rotation factors p, and then the _n/2-1 rotation
+   factors u.*/
+static void od_pre_filter_kernel_sse2(__m128i *_x,int _n,const int *_params){
+  __m128i    t[16];
+  const int *s;
+  const int *p;
+  const int *u;
+  int        k;
+  int        i;
+  k=_n>>1;
+  s=_params;
+  p=s+k;
+  u=p+k-1;
+  /*+1/-1 butterflies (required for FIR, PR, LP).*/
+  for(i=0;i<k;i++)t[_n-1-i]=_mm_sub_epi32(_x[i],_x[_n-1-i]);
+  for(i=0;i<k;i++){
+    t[i]=_mm_sub_epi32(_x[i],_mm_srai_epi32(t[_n-1-i],1));
+  }
+  /*Scaling factors: the biorthogonal part.*/
+  for(i=0;i<k;i++)if(s[i]!=64)t[k+i]=od_filter_scale_sse2(t[k+i],s[i]);
+  /*Rotations:*/
+  for(i=k-1;i-->0;){
+    t[k+i+1]=_mm_add_epi32(t[k+i+1],od_filter_mul_sse2(t[k+i],p[i]));
+    t[k+i]=_mm_add_epi32(t[k+i],od_filter_mul_sse2(t[k+i+1],u[i]));
+  }
+  /*More +1/-1 butterflies (required for FIR, PR, LP).*/
+  for(i=0;i<k;i++){
+    t[i]=_mm_add_epi32(t[i],_mm_srai_epi32(t[_n-1-i],1));
+    _x[i]=t[i];
+    _x[_n-1-i]=_mm_sub_epi32(t[i],t[_n-1-i]);
+  }
+}
+
+static void od_post_filter_kernel_sse2(__m128i *_x,int _n,const int *_params){
+  __m128i    t[16];
+  const int *s;
+  const int *p;
+  const int *u;
+  int        k;
+  int        i;
+  k=_n>>1;
+  s=_params;
+  p=s+k;
+  u=p+k-1;
+  for(i=0;i<k;i++)t[_n-1-i]=_mm_sub_epi32(_x[i],_x[_n-1-i]);
+  for(i=0;i<k;i++){
+    t[i]=_mm_sub_epi32(_x[i],_mm_srai_epi32(t[_n-1-i],1));
+  }
+  for(i=0;i<k-1;i++){
+    t[k+i]=_mm_sub_epi32(t[k+i],od_filter_mul_sse2(t[k+i+1],u[i]));
+    t[k+i+1]=_mm_sub_epi32(t[k+i+1],od_filter_mul_sse2(t[k+i],p[i]));
+  }
+  for(i=k;i-->0;)if(s[i]!=64)t[k+i]=od_filter_unscale_sse2(t[k+i],s[i]);
+  for(i=0;i<k;i++){
+    t[i]=_mm_add_epi32(t[i],_mm_srai_epi32(t[_n-1-i],1));
+    _x[i]=t[i];
+    _x[_n-1-i]=_mm_sub_epi32(t[i],t[_n-1-i]);
+  }
+}
+
+/*Filters _n columns across a horizontal edge, four at a time.*/
+static void od_filter_cols_sse2(od_coeff *_c,int _stride,int _n,int _f,
+ od_filter_kernel_sse2 _kernel,const int *_params){
+  __m128i x[16];
+  int     n;
+  int     i;
+  int     j;
+  OD_ASSERT(!(_n&3));
+  n=4<<_f;
+  _c-=(n>>1)*_stride;
+  for(i=0;i<_n;i+=4){
+    for(j=0;j<n;j++){
+      x[j]=_mm_loadu_si128((const __m128i *)(_c+j*_stride+i));
+    }
+    (*_kernel)(x,n,_params);
+    for(j=0;j<n;j++)_mm_storeu_si128((__m128i *)(_c+j*_stride+i),x[j]);
+  }
+}
+
+void od_pre_filter_cols4_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,0,od_pre_filter_kernel_sse2,
+   OD_FILTER_PARAMS4);
+}
+
+void od_pre_filter_cols8_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,1,od_pre_filter_kernel_sse2,
+   OD_FILTER_PARAMS8);
+}
+
+void od_pre_filter_cols16_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,2,od_pre_filter_kernel_sse2,
+   OD_FILTER_PARAMS16);
+}
+
+void od_post_filter_cols4_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,0,od_post_filter_kernel_sse2,
+   OD_FILTER_PARAMS4);
+}
+
+void od_post_filter_cols8_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,1,od_post_filter_kernel_sse2,
+   OD_FILTER_PARAMS8);
+}
+
+void od_post_filter_cols16_sse2(od_coeff *_c,int _stride,int _n){
+  od_filter_cols_sse2(_c,_stride,_n,2,od_post_filter_kernel_sse2,
+   OD_FILTER_PARAMS16);
+}
+
+#endif
@@ -0,0 +1,48 @@
+/*Daala video codec
+Copyright (c) 2006-2010 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#if !defined(_x86_sse2int_H)
+# define _x86_sse2int_H (1)
+# include <emmintrin.h>
+
+/*Helpers shared by the SSE2 intrinsic kernels.
+  These must only be included when the compiler targets SSE2.*/
+
+/*Computes the low 32 bits of _a*_b in each lane.
+  SSE2 has no 32x32-bit multiply with a 32-bit result (pmulld is SSE4.1), so
+   we multiply the even and odd lanes separately with pmuludq.
+  The low 32 bits of the product are the same whether it is signed or
+   unsigned.*/
+static __m128i od_mullo_epi32_sse2(__m128i _a,int _b){
+  __m128i b;
+  __m128i lo;
+  __m128i hi;
+  b=_mm_set1_epi32(_b);
+  lo=_mm_mul_epu32(_a,b);
+  hi=_mm_mul_epu32(_mm_srli_epi64(_a,32),b);
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(lo,_MM_SHUFFLE(0,0,2,0)),
+   _mm_shuffle_epi32(hi,_MM_SHUFFLE(0,0,2,0)));
+}
+
+#endif
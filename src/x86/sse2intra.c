@@ -0,0 +1,168 @@
+/*Daala video codec
+Copyright (c) 2006-2010 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <emmintrin.h>
+
+/*SSE2 versions of the 4x4 fixed-point intra predictors in intra.c.
+  These use the transposed taps in OD_PRED_PAIR_WEIGHTS_4x4_Q12: each pair of
+   neighbors a mode uses is broadcast across a register and multiplied against
+   the weights for all 16 coefficients with pmaddwd.
+  They produce exactly the same output as the C versions.*/
+
+/*The largest magnitude a neighbor can have for the 16-bit multiply-adds to be
+   exact.
+  The magnitudes of the weights of any one 4x4 coefficient sum to less than
+   17, so the 32-bit sums cannot overflow either.*/
+# define OD_INTRA_SSE2_MAX (1<<14)
+
+/*Packs the neighbors into 16-bit lanes, laid out as for
+   od_intra_pred_gather().
+  Return: 1 if every neighbor was small enough, or 0 if the C version must be
+   used instead.*/
+static int od_intra_pred4x4_gather_sse2(ogg_int16_t _buf[8*12],
+ od_coeff *_neighbors[4],int _neighbor_strides[4]){
+  __m128i m;
+  int     j;
+  m=_mm_setzero_si128();
+  for(j=0;j<4;j++){
+    __m128i ul;
+    __m128i u;
+    __m128i ur;
+    __m128i l;
+    ul=_mm_loadu_si128((const __m128i *)(_neighbors[0]
+     +_neighbor_strides[0]*j));
+    u=_mm_loadu_si128((const __m128i *)(_neighbors[1]
+     +_neighbor_strides[1]*j));
+    ur=_mm_loadu_si128((const __m128i *)(_neighbors[2]
+     +_neighbor_strides[2]*j));
+    l=_mm_loadu_si128((const __m128i *)(_neighbors[3]
+     +_neighbor_strides[3]*j));
+    /*Accumulate the magnitudes (less one, for negative values) to check the
+       range once at the end.*/
+    m=_mm_or_si128(m,_mm_xor_si128(ul,_mm_srai_epi32(ul,31)));
+    m=_mm_or_si128(m,_mm_xor_si128(u,_mm_srai_epi32(u,31)));
+    m=_mm_or_si128(m,_mm_xor_si128(ur,_mm_srai_epi32(ur,31)));
+    m=_mm_or_si128(m,_mm_xor_si128(l,_mm_srai_epi32(l,31)));
+    _mm_storeu_si128((__m128i *)(_buf+12*j),_mm_packs_epi32(ul,u));
+    _mm_storel_epi64((__m128i *)(_buf+12*j+8),_mm_packs_epi32(ur,ur));
+    _mm_storel_epi64((__m128i *)(_buf+12*(4+j)),_mm_packs_epi32(l,l));
+  }
+  m=_mm_srli_epi32(m,14);
+  return _mm_movemask_epi8(_mm_cmpeq_epi32(m,_mm_setzero_si128()))==0xFFFF;
+}
+
+/*Computes the prediction for mode _mode, with one row in each register.*/
+static void od_intra_pred4x4_fixed_sse2(__m128i _p[4],
+ const ogg_int16_t _buf[8*12],int _mode){
+  const unsigned char *index;
+  const ogg_int16_t   *weights_q12;
+  __m128i              p0;
+  __m128i              p1;
+  __m128i              p2;
+  __m128i              p3;
+  int                  npairs;
+  int                  pi;
+  index=OD_PRED_PAIR_INDEX_4x4[_mode][0];
+  weights_q12=OD_PRED_PAIR_WEIGHTS_4x4_Q12[_mode][0];
+  npairs=OD_PRED_NPAIRS_4x4[_mode];
+  p0=p1=p2=p3=_mm_set1_epi32(1<<OD_INTRA_PRED_SHIFT-1);
+  for(pi=0;pi<npairs;pi++){
+    __m128i x;
+    x=_mm_unpacklo_epi16(_mm_cvtsi32_si128(_buf[index[2*pi]]),
+     _mm_cvtsi32_si128(_buf[index[2*pi+1]]));
+    x=_mm_shuffle_epi32(x,_MM_SHUFFLE(0,0,0,0));
+    p0=_mm_add_epi32(p0,_mm_madd_epi16(x,
+     _mm_loadu_si128((const __m128i *)weights_q12+0)));
+    p1=_mm_add_epi32(p1,_mm_madd_epi16(x,
+     _mm_loadu_si128((const __m128i *)weights_q12+1)));
+    p2=_mm_add_epi32(p2,_mm_madd_epi16(x,
+     _mm_loadu_si128((const __m128i *)weights_q12+2)));
+    p3=_mm_add_epi32(p3,_mm_madd_epi16(x,
+     _mm_loadu_si128((const __m128i *)weights_q12+3)));
+    weights_q12+=4*4*2;
+  }
+  _p[0]=_mm_srai_epi32(p0,OD_INTRA_PRED_SHIFT);
+  _p[1]=_mm_srai_epi32(p1,OD_INTRA_PRED_SHIFT);
+  _p[2]=_mm_srai_epi32(p2,OD_INTRA_PRED_SHIFT);
+  _p[3]=_mm_srai_epi32(p3,OD_INTRA_PRED_SHIFT);
+}
+
+void od_intra_pred4x4_get_sse2(od_coeff *_out,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode){
+  ogg_int16_t __attribute__((aligned(16))) buf[8*12];
+  __m128i                                  p[4];
+  int                                      i;
+  if(!od_intra_pred4x4_gather_sse2(buf,_neighbors,_neighbor_strides)){
+    od_intra_pred4x4_get(_out,_neighbors,_neighbor_strides,_mode);
+    return;
+  }
+  od_intra_pred4x4_fixed_sse2(p,buf,_mode);
+  for(i=0;i<4;i++)_mm_storeu_si128((__m128i *)(_out+4*i),p[i]);
+}
+
+void od_intra_pred4x4_dist_sse2(ogg_uint32_t *_dist,
+ const od_coeff *_c,int _stride,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli){
+  ogg_int16_t __attribute__((aligned(16))) buf[8*12];
+  __m128i                                  c[4];
+  __m128i                                  w[4];
+  __m128i                                  zero;
+  int                                      mode;
+  int                                      i;
+  if(!od_intra_pred4x4_gather_sse2(buf,_neighbors,_neighbor_strides)){
+    od_intra_pred4x4_dist(_dist,_c,_stride,_neighbors,_neighbor_strides,_pli);
+    return;
+  }
+  zero=_mm_setzero_si128();
+  for(i=0;i<4;i++){
+    c[i]=_mm_loadu_si128((const __m128i *)(_c+_stride*i));
+    w[i]=_mm_unpacklo_epi16(_mm_loadl_epi64(
+     (const __m128i *)(OD_SATD_WEIGHTS_4x4_Q8[_pli]+4*i)),zero);
+  }
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    __m128i p[4];
+    __m128i satd;
+    od_intra_pred4x4_fixed_sse2(p,buf,mode);
+    satd=zero;
+    for(i=0;i<4;i++){
+      __m128i d;
+      __m128i s;
+      d=_mm_sub_epi32(c[i],p[i]);
+      s=_mm_srai_epi32(d,31);
+      d=_mm_sub_epi32(_mm_xor_si128(d,s),s);
+      /*Sum the even and odd lanes as 64-bit products; only the low 32 bits
+         are kept, as in the C version.*/
+      satd=_mm_add_epi64(satd,_mm_mul_epu32(d,w[i]));
+      satd=_mm_add_epi64(satd,_mm_mul_epu32(_mm_srli_epi64(d,32),
+       _mm_srli_epi64(w[i],32)));
+    }
+    satd=_mm_add_epi64(satd,_mm_unpackhi_epi64(satd,satd));
+    _dist[mode]=(ogg_uint32_t)_mm_cvtsi128_si32(satd)>>8;
+  }
+}
+
+#endif
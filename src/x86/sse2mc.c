@@ -207,9 +207,9 @@ void od_mc_predict1imv8_check(unsigned char *_dst,int _dystride,
   "movd %[dxdj],%%xmm1\n\t" \
   "pshufd $0x11,%%xmm1,%%xmm7\n\t" \
   "movd %[x0],%%xmm0\n\t" \
+  "pshufd $0x05,%%xmm1,%%xmm6\n\t" \
   "pshufd $0x00,%%xmm1,%%xmm1\n\t" \
   "pshufd $0x00,%%xmm0,%%xmm0\n\t" \
-  "pshufd $0x05,%%xmm1,%%xmm6\n\t" \
   "movdqa %%xmm1,%%xmm2\n\t" \
   "paddd %%xmm6,%%xmm6\n\t" \
   "pslld $2,%%xmm1\n\t" \
@@ -579,7 +579,7 @@ static void od_mc_block_copy16(unsigned char *_dst,int _dystride,
   for(row=_nrows;row-->0;){
     __asm__ __volatile__(
       "movdqa %[src],%%xmm0\n\t"
-      "movdqa %%xmm0,%[dst]\n\t"
+      "movdqu %%xmm0,%[dst]\n\t"
       :
       :[src]"m"(*_src),[dst]"m"(*_dst)
     );
@@ -807,7 +807,7 @@ void od_mc_predict1imv8_sse2(unsigned char *_dst,int _dystride,
       }
 #else
       /*We can do better than the compiler with asm since we can guarantee
-         alignment.
+         the alignment of the source.
         This also generates much smaller code.*/
       static const od_mc_block_copy_func VTBL[5]={
         od_mc_block_copy1,od_mc_block_copy2,od_mc_block_copy4,
@@ -1868,7 +1868,7 @@ static void od_mc_predict1fmv8_16x2(unsigned char *_dst,
       for(row=0;row<0x20;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8HV_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride),
@@ -1885,7 +1885,7 @@ static void od_mc_predict1fmv8_16x2(unsigned char *_dst,
       for(row=0;row<0x20;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8H_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -1903,7 +1903,7 @@ static void od_mc_predict1fmv8_16x2(unsigned char *_dst,
       for(row=0;row<0x20;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8V_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -1918,7 +1918,7 @@ static void od_mc_predict1fmv8_16x2(unsigned char *_dst,
       for(row=0;row<0x20;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -1943,7 +1943,7 @@ static void od_mc_predict1fmv8_16x4(unsigned char *_dst,
       for(row=0;row<0x40;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8HV_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride),
@@ -1960,7 +1960,7 @@ static void od_mc_predict1fmv8_16x4(unsigned char *_dst,
       for(row=0;row<0x40;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8H_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -1978,7 +1978,7 @@ static void od_mc_predict1fmv8_16x4(unsigned char *_dst,
       for(row=0;row<0x40;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8V_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -1993,7 +1993,7 @@ static void od_mc_predict1fmv8_16x4(unsigned char *_dst,
       for(row=0;row<0x40;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -2018,7 +2018,7 @@ static void od_mc_predict1fmv8_16x8(unsigned char *_dst,
       for(row=0;row<0x80;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8HV_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride),
@@ -2035,7 +2035,7 @@ static void od_mc_predict1fmv8_16x8(unsigned char *_dst,
       for(row=0;row<0x80;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8H_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -2053,7 +2053,7 @@ static void od_mc_predict1fmv8_16x8(unsigned char *_dst,
       for(row=0;row<0x80;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8V_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -2068,7 +2068,7 @@ static void od_mc_predict1fmv8_16x8(unsigned char *_dst,
       for(row=0;row<0x80;row+=0x10){
         __asm__ __volatile__(
           OD_MC_PREDICT1FMV8_16x1("movdqu")
-          "lea (%[src],%[systride]),%[src]\n\t"
+          "lea (%[src],%[systride],2),%[src]\n\t"
           "movdqa %%xmm0,(%[dst],%[row])\n\t"
           :[src]"+r"(_src),[a]"=&r"(a),[row]"+r"(row)
           :[dst]"r"(_dst),[systride]"r"((ptrdiff_t)_systride)
@@ -2343,7 +2343,7 @@ static void od_mc_blend_full8_check(unsigned char *_dst,int _dystride,
   "lea %[OD_BIL4V],%[a]\n\t" \
   "psllw $" #_log_yblk_sz "+1,%%xmm7\n\t" \
   OD_IM_BLEND("%%xmm0","%%xmm4","%%xmm2","%%xmm5","$" #_log_yblk_sz, \
-   "(%[a],%[row])","0x10(%[a],%[row])") \
+   "(%[a],%[row],2)","0x10(%[a],%[row],2)") \
   OD_IM_PACK("%%xmm0","%%xmm4","%%xmm7","$" #_log_yblk_sz "+2") \
   /*Get it back out to memory. \
     We have to do this 4 bytes at a time because the destination will not in \
@@ -2416,8 +2416,10 @@ static void od_mc_blend_full8_check(unsigned char *_dst,int _dystride,
   OD_IM_BLEND("%%xmm0","%%xmm4","%%xmm2","%%xmm5","$" #_log_yblk_sz, \
    "%%xmm6","%%xmm6") \
   OD_IM_PACK("%%xmm0","%%xmm4","%%xmm7","$" #_log_yblk_sz "+4") \
-  /*Get it back out to memory.*/ \
-  "movdqa %%xmm0,(%[dst])\n\t" \
+  /*Get it back out to memory. \
+    The destination may be a row of the image itself, which is only 8-byte \
+     aligned.*/ \
+  "movdqu %%xmm0,(%[dst])\n\t" \
 
 #if 0
 /*Defines a pure-C implementation with hard-coded loop limits for block sizes
@@ -2831,7 +2833,7 @@ void od_mc_blend_full_split8_check(unsigned char *_dst,int _dystride,
   "psllw $" #_log_yblk_sz "+2,%%xmm7\n\t" \
   "lea %[OD_BIL4V],%[a]\n\t" \
   OD_IM_BLEND("%%xmm0","%%xmm4","%%xmm2","%%xmm5","$" #_log_yblk_sz, \
-   "(%[a],%[row])","0x10(%[a],%[row])") \
+   "(%[a],%[row],2)","0x10(%[a],%[row],2)") \
   OD_IM_PACK("%%xmm0","%%xmm4","%%xmm7","$" #_log_yblk_sz "+3") \
   /*Get it back out to memory. \
     We have to do this 4 bytes at a time because the destination will not in \
@@ -3018,7 +3020,7 @@ static void od_mc_blend_full_split8_4x8(unsigned char *_dst,int _dystride,
   for(row=0;row<0x20;row+=0x10){
     __asm__ __volatile__(
       OD_MC_BLEND_FULL_SPLIT8_4x4(3)
-      "lea (%[dst],%[dystride],2),%[dst]\t\n"
+      "lea (%[dst],%[dystride],4),%[dst]\t\n"
       :[dst]"+r"(_dst),[row]"+r"(row),[a]"=&r"(a)
       :[src]"r"(_src),[dystride]"r"((ptrdiff_t)_dystride),
        [OD_BIL4H]"m"(*OD_BIL4H),[OD_BIL4V]"m"(*OD_BIL4V),[OD_BILV]"m"(*OD_BILV),
@@ -3079,23 +3081,6 @@ typedef void (*od_mc_blend_full_split8_fixed_func)(unsigned char *_dst,
 
 
 
-/*Sets up a second set of image pointers based on the given split state to
-   properly shift weight from one image to another.*/
-static void od_mc_setup_split_ptrs(const unsigned char *_drc[4],
- const unsigned char *_src[4],int _c,int _s){
-  int j;
-  int k;
-  _drc[_c]=_src[_c];
-  j=_c+(_s&1)&3;
-  k=_c+1&3;
-  _drc[k]=_src[j];
-  j=_c+(_s&2)+((_s&2)>>1)&3;
-  k=_c+3&3;
-  _drc[k]=_src[j];
-  k=_c^2;
-  _drc[k]=_src[k];
-}
-
 /*Perform normal bilinear blending.*/
 void od_mc_blend_full_split8_sse2(unsigned char *_dst,int _dystride,
  const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz){
@@ -0,0 +1,150 @@
+/*Daala video codec
+Copyright (c) 2006-2013 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+#include "x86int.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <string.h>
+# include <emmintrin.h>
+
+/*SSE2 versions of the SAD functions used by motion estimation.
+  Blocks of 4x4 through 32x32 are handled here, and anything smaller falls
+   back to the C versions.
+  A row is gathered into the low bytes of a register, with any unused bytes
+   left zero in both the input and the predictor, so they add nothing to the
+   SAD.*/
+
+static __m128i od_sad_load4_sse2(const unsigned char *_p){
+  int v;
+  memcpy(&v,_p,sizeof(v));
+  return _mm_cvtsi32_si128(v);
+}
+
+/*Loads 1<<_log_w input pixels (up to 16).*/
+static __m128i od_sad_load_src_sse2(const unsigned char *_src,int _log_w){
+  switch(_log_w){
+    case 2:return od_sad_load4_sse2(_src);
+    case 3:return _mm_loadl_epi64((const __m128i *)_src);
+    default:return _mm_loadu_si128((const __m128i *)_src);
+  }
+}
+
+/*Loads 1<<_log_w predictor pixels (up to 16), which are _rxstride bytes
+   apart.
+  With a stride of 2, the even bytes of a full row are extracted, which reads
+   one byte past the last pixel used.*/
+static __m128i od_sad_load_ref_sse2(const unsigned char *_ref,int _rxstride,
+ int _log_w){
+  __m128i mask;
+  __m128i a;
+  __m128i b;
+  if(_rxstride==1)return od_sad_load_src_sse2(_ref,_log_w);
+  mask=_mm_set1_epi16(0xFF);
+  switch(_log_w){
+    case 2:{
+      a=_mm_and_si128(_mm_loadl_epi64((const __m128i *)_ref),mask);
+      return _mm_packus_epi16(a,_mm_setzero_si128());
+    }
+    case 3:{
+      a=_mm_and_si128(_mm_loadu_si128((const __m128i *)_ref),mask);
+      return _mm_packus_epi16(a,_mm_setzero_si128());
+    }
+    default:{
+      a=_mm_and_si128(_mm_loadu_si128((const __m128i *)_ref),mask);
+      b=_mm_and_si128(_mm_loadu_si128((const __m128i *)(_ref+16)),mask);
+      return _mm_packus_epi16(a,b);
+    }
+  }
+}
+
+/*Returns the two partial sums of the SAD of one row.*/
+static __m128i od_sad_row_sse2(const unsigned char *_src,
+ const unsigned char *_ref,int _rxstride,int _log_blk_sz){
+  __m128i sad;
+  if(_log_blk_sz<5){
+    return _mm_sad_epu8(od_sad_load_src_sse2(_src,_log_blk_sz),
+     od_sad_load_ref_sse2(_ref,_rxstride,_log_blk_sz));
+  }
+  sad=_mm_sad_epu8(od_sad_load_src_sse2(_src,4),
+   od_sad_load_ref_sse2(_ref,_rxstride,4));
+  return _mm_add_epi32(sad,_mm_sad_epu8(od_sad_load_src_sse2(_src+16,4),
+   od_sad_load_ref_sse2(_ref+16*_rxstride,_rxstride,4)));
+}
+
+static ogg_int32_t od_sad_hsum_sse2(__m128i _sad){
+  return _mm_cvtsi128_si32(_mm_add_epi32(_sad,_mm_unpackhi_epi64(_sad,_sad)));
+}
+
+ogg_int32_t od_mc_sad8_sse2(const unsigned char *_src,int _systride,
+ const unsigned char *_ref,int _rystride,int _rxstride,int _log_blk_sz){
+  __m128i sad;
+  int blk_sz;
+  int j;
+  if(_log_blk_sz<2||_log_blk_sz>5){
+    return od_mc_sad8_c(_src,_systride,_ref,_rystride,_rxstride,_log_blk_sz);
+  }
+  blk_sz=1<<_log_blk_sz;
+  sad=_mm_setzero_si128();
+  for(j=0;j<blk_sz;j++){
+    sad=_mm_add_epi32(sad,od_sad_row_sse2(_src,_ref,_rxstride,_log_blk_sz));
+    _src+=_systride;
+    _ref+=_rystride;
+  }
+  return od_sad_hsum_sse2(sad);
+}
+
+void od_mc_sad_multi8_sse2(ogg_int32_t *_sads,const unsigned char *_src,
+ int _systride,const unsigned char *const *_ref,int _nref,int _rystride,
+ int _rxstride,int _log_blk_sz){
+  __m128i sad[OD_MC_SAD_NREFS_MAX];
+  int log_w;
+  int blk_sz;
+  int ri;
+  int i;
+  int j;
+  if(_log_blk_sz<2||_log_blk_sz>5){
+    od_mc_sad_multi8_c(_sads,_src,_systride,_ref,_nref,_rystride,_rxstride,
+     _log_blk_sz);
+    return;
+  }
+  OD_ASSERT(_nref<=OD_MC_SAD_NREFS_MAX);
+  blk_sz=1<<_log_blk_sz;
+  log_w=OD_MINI(_log_blk_sz,4);
+  for(ri=0;ri<_nref;ri++)sad[ri]=_mm_setzero_si128();
+  for(i=0;i<blk_sz;i+=1<<log_w){
+    for(j=0;j<blk_sz;j++){
+      __m128i s;
+      /*Each input row is loaded once and compared against every
+         predictor.*/
+      s=od_sad_load_src_sse2(_src+j*_systride+i,log_w);
+      for(ri=0;ri<_nref;ri++){
+        sad[ri]=_mm_add_epi32(sad[ri],_mm_sad_epu8(s,od_sad_load_ref_sse2(
+         _ref[ri]+j*_rystride+i*_rxstride,_rxstride,log_w)));
+      }
+    }
+  }
+  for(ri=0;ri<_nref;ri++)_sads[ri]=od_sad_hsum_sse2(sad[ri]);
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*Daala video codec
+Copyright (c) 2006-2010 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+#include "x86int.h"
+
+#if defined(OD_X86ASM)&&defined(__SSE2__)
+# include <emmintrin.h>
+
+/*SSE2 versions of the row filters used by od_state_upsample8_rows().
+  Every intermediate sum fits in a signed 16-bit lane, and packing with
+   unsigned saturation clamps exactly like OD_CLAMP255, so these produce the
+   same output as the C versions.*/
+
+/*Applies the 6-tap half-pel filter to 16-bit lanes.*/
+static __m128i od_upsample_filter8_sse2(__m128i _p0,__m128i _p1,__m128i _p2,
+ __m128i _p3,__m128i _p4,__m128i _p5){
+  __m128i a;
+  __m128i b;
+  a=_mm_add_epi16(_p2,_p3);
+  b=_mm_add_epi16(_p1,_p4);
+  /*20*a-5*b=(4*a-b)*5.*/
+  a=_mm_sub_epi16(_mm_slli_epi16(a,2),b);
+  a=_mm_add_epi16(a,_mm_slli_epi16(a,2));
+  a=_mm_add_epi16(a,_mm_add_epi16(_p0,_p5));
+  return _mm_srai_epi16(_mm_add_epi16(a,_mm_set1_epi16(16)),5);
+}
+
+static __m128i od_load8_epi16(const unsigned char *_p){
+  return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)_p),
+   _mm_setzero_si128());
+}
+
+void od_upsample_hrow8_sse2(unsigned char *_dst,const unsigned char *_src,
+ int _n){
+  int x;
+  for(x=0;x+8<=_n;x+=8){
+    __m128i s;
+    __m128i h;
+    s=od_load8_epi16(_src+x);
+    h=od_upsample_filter8_sse2(od_load8_epi16(_src+x-2),
+     od_load8_epi16(_src+x-1),s,od_load8_epi16(_src+x+1),
+     od_load8_epi16(_src+x+2),od_load8_epi16(_src+x+3));
+    /*Clamp the half-pel samples and put each one in the high byte of the
+       pixel before it, which interleaves them in memory.*/
+    h=_mm_packus_epi16(h,h);
+    h=_mm_unpacklo_epi8(_mm_packus_epi16(s,s),h);
+    _mm_storeu_si128((__m128i *)(_dst+(x<<1)),h);
+  }
+  if(x<_n)od_upsample_hrow8_c(_dst+(x<<1),_src+x,_n-x);
+}
+
+void od_upsample_vrow8_sse2(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n){
+  __m128i zero;
+  int     x;
+  zero=_mm_setzero_si128();
+  for(x=0;x+16<=_n;x+=16){
+    __m128i p[6];
+    __m128i lo;
+    __m128i hi;
+    int     k;
+    for(k=0;k<6;k++)p[k]=_mm_loadu_si128((const __m128i *)(_src[k]+x));
+    lo=od_upsample_filter8_sse2(_mm_unpacklo_epi8(p[0],zero),
+     _mm_unpacklo_epi8(p[1],zero),_mm_unpacklo_epi8(p[2],zero),
+     _mm_unpacklo_epi8(p[3],zero),_mm_unpacklo_epi8(p[4],zero),
+     _mm_unpacklo_epi8(p[5],zero));
+    hi=od_upsample_filter8_sse2(_mm_unpackhi_epi8(p[0],zero),
+     _mm_unpackhi_epi8(p[1],zero),_mm_unpackhi_epi8(p[2],zero),
+     _mm_unpackhi_epi8(p[3],zero),_mm_unpackhi_epi8(p[4],zero),
+     _mm_unpackhi_epi8(p[5],zero));
+    _mm_storeu_si128((__m128i *)(_dst+x),_mm_packus_epi16(lo,hi));
+  }
+  if(x<_n){
+    const unsigned char *src[6];
+    int                  k;
+    for(k=0;k<6;k++)src[k]=_src[k]+x;
+    od_upsample_vrow8_c(_dst+x,src,_n-x);
+  }
+}
+
+#endif
@@ -26,6 +26,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
 # define _x86_x86int_H (1)
 # include "../state.h"
 
+/*The AVX2 kernels are compiled for that target one function at a time, so a
+   library built for plain SSE2 can still pick them at run time when the CPU
+   reports OD_CPU_X86_AVX2.*/
+# if defined(OD_X86ASM)&&(defined(__AVX2__)|| \
+ OD_GNUC_PREREQ(4,9)||defined(__clang__))
+#  define OD_X86_AVX2 (1)
+#  if defined(__AVX2__)
+#   define OD_TARGET_AVX2
+#  else
+#   define OD_TARGET_AVX2 __attribute__((target("avx2")))
+#  endif
+# endif
+
 void od_state_opt_vtbl_init_x86(od_state *_state);
 
 void od_mc_predict1imv8_sse2(unsigned char *_dst,int _dystride,
@@ -39,5 +52,70 @@ void od_mc_blend_full8_sse2(unsigned char *_dst,int _dystride,
  const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
 void od_mc_blend_full_split8_sse2(unsigned char *_dst,int _dystride,
  const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_multi8_sse2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_multi_split8_sse2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_predict1imv8_avx2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src,int _systride,const ogg_int32_t _mvx[4],
+ const ogg_int32_t _mvy[4],const int _m[4],int _r,int _log_xblk_sz,
+ int _log_yblk_sz);
+void od_mc_predict1fmv8_avx2(unsigned char *_dst,const unsigned char *_src,
+ int _systride,ogg_int32_t _mvx,ogg_int32_t _mvy,
+ int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_full8_avx2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _log_xblk_sz,int _log_yblk_sz);
+void od_mc_blend_full_split8_avx2(unsigned char *_dst,int _dystride,
+ const unsigned char *_src[4],int _c,int _s,int _log_xblk_sz,int _log_yblk_sz);
+
+void od_upsample_hrow8_sse2(unsigned char *_dst,const unsigned char *_src,
+ int _n);
+void od_upsample_vrow8_sse2(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n);
+void od_upsample_hrow8_avx2(unsigned char *_dst,const unsigned char *_src,
+ int _n);
+void od_upsample_vrow8_avx2(unsigned char *_dst,
+ const unsigned char *const _src[6],int _n);
+
+ogg_int32_t od_mc_sad8_sse2(const unsigned char *_src,int _systride,
+ const unsigned char *_ref,int _rystride,int _rxstride,int _log_blk_sz);
+void od_mc_sad_multi8_sse2(ogg_int32_t *_sads,const unsigned char *_src,
+ int _systride,const unsigned char *const *_ref,int _nref,int _rystride,
+ int _rxstride,int _log_blk_sz);
+ogg_int32_t od_mc_sad8_avx2(const unsigned char *_src,int _systride,
+ const unsigned char *_ref,int _rystride,int _rxstride,int _log_blk_sz);
+void od_mc_sad_multi8_avx2(ogg_int32_t *_sads,const unsigned char *_src,
+ int _systride,const unsigned char *const *_ref,int _nref,int _rystride,
+ int _rxstride,int _log_blk_sz);
+
+void od_block_var4_row8_sse2(ogg_int32_t *_var,ogg_int32_t *_inv_var,
+ ogg_int32_t *_sx,ogg_int32_t *_sxx,const unsigned char *_img,int _stride,
+ int _n);
+
+void od_bin_fdct4x4_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride);
+void od_bin_idct4x4_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride);
+void od_bin_fdct8x8_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride);
+void od_bin_idct8x8_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride);
+void od_bin_fdct16x16_sse2(od_coeff *_y,int _ystride,
+ const od_coeff *_x,int _xstride);
+void od_bin_idct16x16_sse2(od_coeff *_x,int _xstride,
+ const od_coeff *_y,int _ystride);
+
+void od_pre_filter_cols4_sse2(od_coeff *_c,int _stride,int _n);
+void od_pre_filter_cols8_sse2(od_coeff *_c,int _stride,int _n);
+void od_pre_filter_cols16_sse2(od_coeff *_c,int _stride,int _n);
+void od_post_filter_cols4_sse2(od_coeff *_c,int _stride,int _n);
+void od_post_filter_cols8_sse2(od_coeff *_c,int _stride,int _n);
+void od_post_filter_cols16_sse2(od_coeff *_c,int _stride,int _n);
+
+void od_intra_pred4x4_get_sse2(od_coeff *_out,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _mode);
+void od_intra_pred4x4_dist_sse2(ogg_uint32_t *_dist,
+ const od_coeff *_c,int _stride,
+ od_coeff *_neighbors[4],int _neighbor_strides[4],int _pli);
 
 #endif
@@ -38,6 +38,51 @@ void od_state_opt_vtbl_init_x86(od_state *_state){
     _state->opt_vtbl.mc_predict1fmv8=od_mc_predict1fmv8_sse2;
     _state->opt_vtbl.mc_blend_full8=od_mc_blend_full8_sse2;
     _state->opt_vtbl.mc_blend_full_split8=od_mc_blend_full_split8_sse2;
+# if defined(__SSE2__)
+    /*The reference upsampler, SADs, multiresolution blends, block-size
+       statistics, transforms, lapping filters and intra predictors use
+       intrinsics, which need the compiler to target SSE2.*/
+    _state->opt_vtbl.upsample_hrow8=od_upsample_hrow8_sse2;
+    _state->opt_vtbl.upsample_vrow8=od_upsample_vrow8_sse2;
+    _state->opt_vtbl.mc_sad8=od_mc_sad8_sse2;
+    _state->opt_vtbl.mc_sad_multi8=od_mc_sad_multi8_sse2;
+    _state->opt_vtbl.mc_blend_multi8=od_mc_blend_multi8_sse2;
+    _state->opt_vtbl.mc_blend_multi_split8=od_mc_blend_multi_split8_sse2;
+    _state->opt_vtbl.block_var4_row8=od_block_var4_row8_sse2;
+    _state->opt_vtbl.fdct_2d[0]=od_bin_fdct4x4_sse2;
+    _state->opt_vtbl.idct_2d[0]=od_bin_idct4x4_sse2;
+    _state->opt_vtbl.fdct_2d[1]=od_bin_fdct8x8_sse2;
+    _state->opt_vtbl.idct_2d[1]=od_bin_idct8x8_sse2;
+    _state->opt_vtbl.fdct_2d[2]=od_bin_fdct16x16_sse2;
+    _state->opt_vtbl.idct_2d[2]=od_bin_idct16x16_sse2;
+    _state->opt_vtbl.filter.cols[0][0]=od_pre_filter_cols4_sse2;
+    _state->opt_vtbl.filter.cols[0][1]=od_pre_filter_cols8_sse2;
+    _state->opt_vtbl.filter.cols[0][2]=od_pre_filter_cols16_sse2;
+    _state->opt_vtbl.filter.cols[1][0]=od_post_filter_cols4_sse2;
+    _state->opt_vtbl.filter.cols[1][1]=od_post_filter_cols8_sse2;
+    _state->opt_vtbl.filter.cols[1][2]=od_post_filter_cols16_sse2;
+    _state->opt_vtbl.intra_get[0]=od_intra_pred4x4_get_sse2;
+    _state->opt_vtbl.intra_dist[0]=od_intra_pred4x4_dist_sse2;
+# endif
+# if defined(OD_X86_AVX2)
+    if(_state->cpu_flags&OD_CPU_X86_AVX2){
+      if(_state->opt_vtbl.mc_predict1imv8==od_mc_predict1imv8_sse2){
+        /*This must produce the same output as the SSE2 version, so it uses
+           the same stride limit.*/
+        _state->opt_vtbl.mc_predict1imv8=od_mc_predict1imv8_avx2;
+      }
+      _state->opt_vtbl.mc_predict1fmv8=od_mc_predict1fmv8_avx2;
+      _state->opt_vtbl.mc_blend_full8=od_mc_blend_full8_avx2;
+      _state->opt_vtbl.mc_blend_full_split8=od_mc_blend_full_split8_avx2;
+#  if defined(__SSE2__)
+      /*These fall back on the SSE2 intrinsics above.*/
+      _state->opt_vtbl.upsample_hrow8=od_upsample_hrow8_avx2;
+      _state->opt_vtbl.upsample_vrow8=od_upsample_vrow8_avx2;
+      _state->opt_vtbl.mc_sad8=od_mc_sad8_avx2;
+      _state->opt_vtbl.mc_sad_multi8=od_mc_sad_multi8_avx2;
+#  endif
+    }
+# endif
   }
 }
 
@@ -368,15 +368,26 @@ int switch_decision(unsigned char *img, int w, int h, int stride, int ow, int oh
 #endif
 #endif
   /* Replace decision with the one from process_block_size32() */
-  if (1)
+  if (h32 > 2 && w32 > 2)
   {
     BlockSizeComp bs;
+    BlockStatsFrame stats;
 
+    /* The superblocks on the edges are skipped, so the variances around the
+       others are all in the image. */
+    if (od_block_stats_frame_init(&stats, w32 - 2, h32 - 2) < 0) {
+      fprintf(stderr, "Error allocating the block-size statistics.\n");
+      exit(1);
+    }
+    od_block_stats_frame_compute(&stats, od_block_var4_row8_c,
+     img + 32*stride + 32, stride);
     for(i=1;i<h32-1;i++){
       for(j=1;j<w32-1;j++){
         int k,m;
         int dec[4][4];
-        process_block_size32(&bs, img+32*stride*i+32*j, img+32*stride*i+32*j, stride, dec);
+        BlockStats bstats;
+        od_block_stats_get(&bstats, &stats, j - 1, i - 1);
+        process_block_size32(&bs, &bstats, &bstats, dec);
         for(k=0;k<4;k++)
           for(m=0;m<4;m++)
             dec8[4*i+k][4*j+m]=dec[k][m];
@@ -385,8 +396,8 @@ int switch_decision(unsigned char *img, int w, int h, int stride, int ow, int oh
         {
           for(m=0;m<16;m++)
           {
-            var[16*i+k][16*j+m]=bs.img_stats.Var4[k+3][m+3];
-            var_1[16*i+k][16*j+m]=bs.img_stats.invVar4[k+3][m+3];
+            var[16*i+k][16*j+m]=bstats.Var4[(k+3)*bstats.stride4+m+3];
+            var_1[16*i+k][16*j+m]=bstats.invVar4[(k+3)*bstats.stride4+m+3];
           }
         }
         for(k=0;k<8;k++)
@@ -407,8 +418,8 @@ int switch_decision(unsigned char *img, int w, int h, int stride, int ow, int oh
         {
           for(m=0;m<8;m++)
           {
-            var8[8*i+k][8*j+m]=bs.img_stats.Var8[k+2][m+2];
-            var8_1[8*i+k][8*j+m]=bs.img_stats.invVar8[k+2][m+2];
+            var8[8*i+k][8*j+m]=bstats.Var8[(k+2)*bstats.stride8+m+2];
+            var8_1[8*i+k][8*j+m]=bstats.invVar8[(k+2)*bstats.stride8+m+2];
           }
         }
 #endif
@@ -459,6 +470,7 @@ int switch_decision(unsigned char *img, int w, int h, int stride, int ow, int oh
       for (i = 0; i < 144; i++) for (j = 0; j < 16; j++) printf("%d ", stats8[i][j]);
       printf("\n");
     }
+    od_block_stats_frame_clear(&stats);
   }
 
 #if 0
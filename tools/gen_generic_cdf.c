@@ -0,0 +1,159 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+
+/*Generates the initial CDFs of the generic coder (see generic_encoder.c).
+  Each of the GENERIC_TABLES CDFs is used for values whose expectation falls
+   in a given half-octave (see logEx()).
+  With no arguments, the CDFs come from a one-sided geometric distribution,
+   averaged over the range of expectations each table is used for.
+  Given the name of an entropy coder log from an encoder built with
+   --enable-logging and run with OD_LOG_MODULES='entropy-coder:5', the
+   symbols counted from the log are blended with that model, so the tables
+   can be trained on a set of test clips.*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define GENERIC_TABLES (12)
+/*The total of the initial CDFs.
+  This must be at least 16384 for od_ec_encode_cdf(), and the adaptation rate
+   in generic_model_update() assumes the CDFs start there.*/
+#define TOTAL (16384)
+/*The number of symbols the model counts as when blending it with
+   statistics from a log.*/
+#define PRIOR_WEIGHT (256)
+/*The number of expectations to average over for each table.*/
+#define NSTEPS (64)
+
+/*Computes the probability of each coded symbol, min(15,xs), for values with
+   a one-sided geometric distribution with mean ex, shifted as in
+   generic_encode().*/
+static void model_pdf(double *p, double ex, int shift) {
+  double r;
+  int x;
+  int j;
+  r = ex/(1 + ex);
+  for (j = 0; j < 16; j++) p[j] = 0;
+  for (x = 0; x < 16 << shift; x++) {
+    int xs;
+    xs = (x + (1 << shift >> 1)) >> shift;
+    if (xs >= 15) break;
+    p[xs] += (1 - r)*pow(r, x);
+  }
+  p[15] = pow(r, x);
+}
+
+int main(int argc, char **argv) {
+  static double counts[GENERIC_TABLES][16];
+  double n[GENERIC_TABLES];
+  int i;
+  int j;
+  memset(n, 0, sizeof(n));
+  if (argc > 2) {
+    fprintf(stderr, "usage: gen_generic_cdf [<entropy coder log>]\n");
+    return 1;
+  }
+  if (argc == 2) {
+    FILE *fin;
+    char line[1024];
+    fin = fopen(argv[1], "r");
+    if (fin == NULL) {
+      fprintf(stderr, "Could not open %s.\n", argv[1]);
+      return 1;
+    }
+    while (fgets(line, sizeof(line), fin) != NULL) {
+      char *p;
+      int ex;
+      int x;
+      int shift;
+      int id;
+      int xs;
+      /*The lines logged by generic_encode().*/
+      p = strstr(line, "enc: ");
+      if (p == NULL) continue;
+      if (sscanf(p + 5, "%d %d %d %d %d", &ex, &x, &shift, &id, &xs) != 5) {
+        continue;
+      }
+      if (id < 0 || id >= GENERIC_TABLES || xs < 0) continue;
+      counts[id][xs < 15 ? xs : 15]++;
+      n[id]++;
+    }
+    fclose(fin);
+  }
+  if (argc == 2) {
+    printf("/* This file is auto-generated using \"gen_generic_cdf\" "
+     "trained on %s */\n\n", argv[1]);
+  }
+  else printf("/* This file is auto-generated using \"gen_generic_cdf\" */\n\n");
+  printf("#include \"generic_code.h\"\n\n");
+  printf("const ogg_uint16_t generic_cdf_init[%d][16] = {\n", GENERIC_TABLES);
+  for (i = 0; i < GENERIC_TABLES; i++) {
+    double p[16];
+    int pi[16];
+    int shift;
+    int sum;
+    int maxj;
+    int cdf;
+    int k;
+    for (j = 0; j < 16; j++) p[j] = 0;
+    /*Table i is used when 2*log2(E(x)) + 1 is in [i, i + 1), except that the
+       first table also covers everything smaller and the last table
+       everything larger.
+      We average over the half-octave of each one.*/
+    shift = i > 5 ? (i - 5) >> 1 : 0;
+    for (k = 0; k < NSTEPS; k++) {
+      double q[16];
+      double ex;
+      ex = pow(2, (i - 1 + (k + .5)/NSTEPS)*.5);
+      model_pdf(q, ex, shift);
+      for (j = 0; j < 16; j++) p[j] += q[j]/NSTEPS;
+    }
+    for (j = 0; j < 16; j++) {
+      p[j] = (PRIOR_WEIGHT*p[j] + counts[i][j])/(PRIOR_WEIGHT + n[i]);
+    }
+    /*Every symbol needs a non-zero probability, and the rounding error goes
+       to the most likely one.*/
+    sum = 0;
+    maxj = 0;
+    for (j = 0; j < 16; j++) {
+      pi[j] = (int)floor(.5 + TOTAL*p[j]);
+      if (pi[j] < 1) pi[j] = 1;
+      if (pi[j] > pi[maxj]) maxj = j;
+      sum += pi[j];
+    }
+    pi[maxj] += TOTAL - sum;
+    cdf = 0;
+    printf("  {");
+    for (j = 0; j < 16; j++) {
+      cdf += pi[j];
+      printf("%5d%s", cdf, j + 1 < 16 ? "," : "");
+    }
+    printf("}%s\n", i + 1 < GENERIC_TABLES ? "," : "");
+  }
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,203 @@
+/*Daala video codec
+Copyright (c) 2012 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+/*Generates src/intradata_fixed.c, the fixed-point versions of the intra
+   prediction weights in src/intradata.c.*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "../src/intra.h"
+
+#define OD_PRED_MAX_INPUTS (4*16*16)
+
+static int od_pred_weight_q12(double _w){
+  return (int)floor(_w*(1<<OD_INTRA_PRED_SHIFT)+0.5);
+}
+
+/*Prints the taps of every prediction coefficient for every mode, in the order
+   they are stored in src/intradata.c, replacing the x and y coordinates of
+   each neighbor with an index into the buffer built by
+   od_intra_pred_gather().*/
+static void print_taps(int _n,const int *_mults,const int **_paramx,
+ const int **_paramy,const double **_weights){
+  int offsets[OD_INTRA_NMODES];
+  int ntaps;
+  int mode;
+  int ci;
+  int k;
+  int n2;
+  n2=_n*_n;
+  ntaps=0;
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    offsets[mode]=ntaps;
+    for(ci=0;ci<n2;ci++)ntaps+=_mults[mode*n2+ci];
+  }
+  printf("const int OD_PRED_OFFSETS_%ix%i[OD_INTRA_NMODES]={\n ",_n,_n);
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    printf(" %i%s",offsets[mode],mode+1<OD_INTRA_NMODES?",":"\n};\n\n");
+  }
+  printf("const unsigned short OD_PRED_INDEX_%ix%i[%i]={",_n,_n,ntaps);
+  k=0;
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    for(ci=0;ci<n2;ci++){
+      int ti;
+      for(ti=0;ti<_mults[mode*n2+ci];ti++){
+        int x;
+        int y;
+        x=_paramx[mode*n2+ci][ti];
+        y=_paramy[mode*n2+ci][ti];
+        if(x<0||y<0||y>=2*_n||x>=(y<_n?3:1)*_n){
+          fprintf(stderr,"Neighbor (%i,%i) out of range.\n",x,y);
+          exit(EXIT_FAILURE);
+        }
+        printf("%s%4i%s",k%12?"":"\n  ",3*_n*y+x,k+1<ntaps?",":"\n};\n\n");
+        k++;
+      }
+    }
+  }
+  printf("const ogg_int32_t OD_PRED_WEIGHTS_%ix%i_Q%i[%i]={",
+   _n,_n,OD_INTRA_PRED_SHIFT,ntaps);
+  k=0;
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    for(ci=0;ci<n2;ci++){
+      int ti;
+      for(ti=0;ti<_mults[mode*n2+ci];ti++){
+        printf("%s%6i%s",k%10?"":"\n  ",
+         od_pred_weight_q12(_weights[mode*n2+ci][ti]),
+         k+1<ntaps?",":"\n};\n\n");
+        k++;
+      }
+    }
+  }
+}
+
+/*Prints the 4x4 weights transposed, so that each neighbor used by a mode has
+   one weight for every coefficient, with the neighbors in interleaved pairs.
+  This is the layout a SIMD multiply-add wants: each pair of neighbors is
+   broadcast across a register and multiplied by 16 contiguous weight pairs,
+   without any gathering.*/
+static void print_pairs_4x4(void){
+  int inputs[OD_INTRA_NMODES][OD_PRED_MAX_INPUTS];
+  int ninputs[OD_INTRA_NMODES];
+  int max_pairs;
+  int mode;
+  int pi;
+  max_pairs=0;
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    int used[OD_PRED_MAX_INPUTS];
+    int ci;
+    int k;
+    for(k=0;k<8*12;k++)used[k]=0;
+    for(ci=0;ci<16;ci++){
+      int ti;
+      for(ti=0;ti<OD_PRED_MULTS_4x4[mode][ci>>2][ci&3];ti++){
+        used[12*OD_PRED_PARAMY_4x4[mode][ci>>2][ci&3][ti]
+         +OD_PRED_PARAMX_4x4[mode][ci>>2][ci&3][ti]]=1;
+      }
+    }
+    ninputs[mode]=0;
+    for(k=0;k<8*12;k++)if(used[k])inputs[mode][ninputs[mode]++]=k;
+    /*Pad to an even number of inputs with a neighbor whose weights are all
+       zero.*/
+    if(ninputs[mode]&1)inputs[mode][ninputs[mode]++]=-1;
+    if(ninputs[mode]>>1>max_pairs)max_pairs=ninputs[mode]>>1;
+  }
+  printf("const int OD_PRED_NPAIRS_4x4[OD_INTRA_NMODES]={\n ");
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    printf(" %i%s",ninputs[mode]>>1,mode+1<OD_INTRA_NMODES?",":"\n};\n\n");
+  }
+  if(max_pairs>OD_PRED_MAX_PAIRS_4x4){
+    fprintf(stderr,"OD_PRED_MAX_PAIRS_4x4 must be at least %i.\n",max_pairs);
+    exit(EXIT_FAILURE);
+  }
+  printf("const unsigned char "
+   "OD_PRED_PAIR_INDEX_4x4[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][2]={\n");
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    printf("  {");
+    for(pi=0;pi<OD_PRED_MAX_PAIRS_4x4;pi++){
+      int a;
+      int b;
+      a=b=0;
+      if(pi<ninputs[mode]>>1){
+        a=inputs[mode][2*pi];
+        b=inputs[mode][2*pi+1];
+        /*The padding weights are zero, so any valid index will do.*/
+        if(b<0)b=a;
+      }
+      printf("%s{%2i,%2i}%s",pi%6?"":"\n    ",a,b,
+       pi+1<OD_PRED_MAX_PAIRS_4x4?",":"\n");
+    }
+    printf("  }%s\n",mode+1<OD_INTRA_NMODES?",":"");
+  }
+  printf("};\n\n");
+  printf("const ogg_int16_t OD_PRED_PAIR_WEIGHTS_4x4_Q%i"
+   "[OD_INTRA_NMODES][OD_PRED_MAX_PAIRS_4x4][4*4*2]={\n",OD_INTRA_PRED_SHIFT);
+  for(mode=0;mode<OD_INTRA_NMODES;mode++){
+    printf("  {\n");
+    for(pi=0;pi<OD_PRED_MAX_PAIRS_4x4;pi++){
+      int ci;
+      printf("    {");
+      for(ci=0;ci<16;ci++){
+        int w[2];
+        int k;
+        for(k=0;k<2;k++){
+          int ti;
+          w[k]=0;
+          if(pi<ninputs[mode]>>1&&inputs[mode][2*pi+k]>=0){
+            for(ti=0;ti<OD_PRED_MULTS_4x4[mode][ci>>2][ci&3];ti++){
+              if(12*OD_PRED_PARAMY_4x4[mode][ci>>2][ci&3][ti]
+               +OD_PRED_PARAMX_4x4[mode][ci>>2][ci&3][ti]
+               ==inputs[mode][2*pi+k]){
+                w[k]+=od_pred_weight_q12(
+                 OD_PRED_WEIGHTS_4x4[mode][ci>>2][ci&3][ti]);
+              }
+            }
+          }
+          if(w[k]<-32768||w[k]>32767){
+            fprintf(stderr,"4x4 weight %i does not fit in 16 bits.\n",w[k]);
+            exit(EXIT_FAILURE);
+          }
+        }
+        printf("%s%6i,%6i%s",ci%4?"":"\n      ",w[0],w[1],ci+1<16?",":"\n");
+      }
+      printf("    }%s\n",pi+1<OD_PRED_MAX_PAIRS_4x4?",":"");
+    }
+    printf("  }%s\n",mode+1<OD_INTRA_NMODES?",":"");
+  }
+  printf("};\n");
+}
+
+int main(void){
+  printf("/* This file is auto-generated using \"gen_intra_fixed\" */\n\n");
+  printf("#include \"intra.h\"\n\n");
+  print_taps(4,OD_PRED_MULTS_4x4[0][0],OD_PRED_PARAMX_4x4[0][0],
+   OD_PRED_PARAMY_4x4[0][0],OD_PRED_WEIGHTS_4x4[0][0]);
+  print_taps(8,OD_PRED_MULTS_8x8[0][0],OD_PRED_PARAMX_8x8[0][0],
+   OD_PRED_PARAMY_8x8[0][0],OD_PRED_WEIGHTS_8x8[0][0]);
+  print_taps(16,OD_PRED_MULTS_16x16[0][0],OD_PRED_PARAMX_16x16[0][0],
+   OD_PRED_PARAMY_16x16[0][0],OD_PRED_WEIGHTS_16x16[0][0]);
+  print_pairs_4x4();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/*Daala video codec
+Copyright (c) 2014 Daala project contributors.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice, this
+  list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+  this list of conditions and the following disclaimer in the documentation
+  and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE
+FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.*/
+
+/*Times the OBMC blends of the full and multiresolution kinds, with both the
+   C and the optimized versions, and reports the cost per output pixel.*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/state.h"
+#if defined(OD_X86ASM)
+# include "../src/x86/x86int.h"
+#endif
+
+#define NBLOCKS (64)
+
+typedef void (*blend_func)(unsigned char *_dst, int _dystride,
+ const unsigned char *_src[4], int _log_xblk_sz, int _log_yblk_sz);
+typedef void (*blend_split_func)(unsigned char *_dst, int _dystride,
+ const unsigned char *_src[4], int _c, int _s,
+ int _log_xblk_sz, int _log_yblk_sz);
+
+static unsigned char pred[NBLOCKS][4][16*16];
+static unsigned char dst[16*16];
+
+/*Returns the number of nanoseconds per pixel, or per pixel per split
+   configuration if _split_func is not NULL.*/
+static double time_blend(blend_func _func, blend_split_func _split_func,
+ int _log_blk_sz, long _niters) {
+  const unsigned char *src[4];
+  clock_t start;
+  long iter;
+  long npixels;
+  int b;
+  int c;
+  int s;
+  int k;
+  npixels = 0;
+  start = clock();
+  for (iter = 0; iter < _niters; iter++) {
+    for (b = 0; b < NBLOCKS; b++) {
+      for (k = 0; k < 4; k++) src[k] = pred[b][k];
+      if (_split_func == NULL) {
+        (*_func)(dst, 1 << _log_blk_sz, src, _log_blk_sz, _log_blk_sz);
+        npixels++;
+      }
+      else {
+        for (c = 0; c < 4; c++) {
+          for (s = 0; s < 3; s++) {
+            (*_split_func)(dst, 1 << _log_blk_sz, src, c, s,
+             _log_blk_sz, _log_blk_sz);
+            npixels++;
+          }
+        }
+      }
+    }
+  }
+  npixels <<= 2*_log_blk_sz;
+  return (clock() - start)*(1E9/CLOCKS_PER_SEC)/npixels;
+}
+
+static void print_row(const char *_name, const od_state_opt_vtbl *_vtbl,
+ long _niters) {
+  int log_blk_sz;
+  printf("%-10s", _name);
+  for (log_blk_sz = 2; log_blk_sz <= 4; log_blk_sz++) {
+    /*Keep the number of pixels per measurement the same for each size.*/
+    long niters;
+    niters = _niters >> 2*(log_blk_sz - 2);
+    printf(" %7.3f %7.3f %7.3f %7.3f",
+     time_blend(_vtbl->mc_blend_full8, NULL, log_blk_sz, niters),
+     time_blend(_vtbl->mc_blend_multi8, NULL, log_blk_sz, niters),
+     time_blend(NULL, _vtbl->mc_blend_full_split8, log_blk_sz, niters/12),
+     time_blend(NULL, _vtbl->mc_blend_multi_split8, log_blk_sz, niters/12));
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  od_state state;
+  long niters;
+  int b;
+  int k;
+  int i;
+  niters = argc > 1 ? atol(argv[1]) : 4096;
+  if (niters < 12) {
+    fprintf(stderr, "usage: %s [<iterations>]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  srand(1);
+  for (b = 0; b < NBLOCKS; b++) {
+    for (k = 0; k < 4; k++) {
+      /*Four similar predictors, as from nearby motion vectors.*/
+      for (i = 0; i < 16*16; i++) {
+        pred[b][k][i] = (unsigned char)(
+         OD_CLAMP255((i*b & 0xFF) + rand()%17 - 8));
+      }
+    }
+  }
+  memset(&state, 0, sizeof(state));
+  printf("ns/pixel  %-31s %-31s %-31s\n", "4x4", "8x8", "16x16");
+  printf("%-10s", "");
+  for (i = 0; i < 3; i++) printf("    full   multi   fsplt   msplt");
+  printf("\n");
+  od_state_opt_vtbl_init_c(&state);
+  print_row("C", &state.opt_vtbl, niters);
+#if defined(OD_X86ASM)
+  od_state_opt_vtbl_init_x86(&state);
+  print_row("x86", &state.opt_vtbl, niters);
+#endif
+  return EXIT_SUCCESS;
+}